@@ -165,6 +165,9 @@ namespace Application {
 		// TICK DE LOGICA-FISICA
 		CBaseApplication::tick(msecs);
 
+		// ENVIO DE RED: todo lo que la logica ha encolado en el frame sale junto
+		Net::CManager::getSingletonPtr()->flush();
+
 		// TICK DE AUDIO
 		Audio::CServer::getSingletonPtr()->tick(msecs);
 		//boost::thread audio( &Audio::CServer::tick, Audio::CServer::getSingletonPtr(), msecs);
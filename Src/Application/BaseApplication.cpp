@@ -141,14 +141,12 @@ namespace Application {
 	void CBaseApplication::run() 
 	{
 		assert(_clock && "Asegurate de haber creado un reloj en el init de la clase de tu aplicacion!");
-		unsigned int resto;
-		unsigned int multiplo;
-		unsigned int fixedTick;
 
 		// Actualizamos una primera vez el tiempo, antes de
 		// empezar, para que el primer frame tenga un tiempo
 		// de frame razonable.
 		_clock->updateTime();
+		_scheduler.reset();
 		// Ejecucin del bucle principal. Simplemente miramos si
 		// tenemos que hacer una transicin de estado, y si no hay que
 		// hacerla, ejecutamos la vuelta
@@ -157,13 +155,21 @@ namespace Application {
 		while (!exitRequested()) 
 		{
 			if (!_currentState ||
-					(_nextState && (_currentState != _nextState)))
+					(_nextState && (_currentState != _nextState))) {
 				changeState();
 
+				// Lo que haya tardado la activacin no cuenta como tiempo
+				// de simulacin
+				_scheduler.reset();
+			}
+
+			_scheduler.beginFrame();
 			_clock->updateTime();
 
-			tick(_clock->getLastFrameDuration());
-		
+			tick(_scheduler.getFrameDuration());
+
+			// Dormimos lo que sobre del frame (si hay frecuencia fijada)
+			_scheduler.endFrame();
 		}
 		//_CrtDumpMemoryLeaks();
 		
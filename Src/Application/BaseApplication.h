@@ -19,6 +19,7 @@ de todo el juego.
 #define __Application_BaseApplication_H
 
 #include "Input/InputManager.h"
+#include "TickScheduler.h"
 
 #include <map>
 #include <string>
@@ -180,6 +181,14 @@ namespace Application
 		*/
 		unsigned int getAppTime();
 
+		/**
+		Devuelve el planificador del bucle principal. Los estados lo usan
+		para saber cuntos pasos de tick fijo tocan en el frame actual.
+
+		@return Planificador de la aplicacin.
+		*/
+		CTickScheduler& getScheduler() { return _scheduler; }
+
 		// Mtodos de CKeyboardListener
 		
 		/**
@@ -299,6 +308,12 @@ namespace Application
 		*/
 		IClock *_clock;
 
+		/**
+		Planificador que marca el ritmo del bucle principal y los pasos
+		del tick fijo de la lgica y la fsica.
+		*/
+		CTickScheduler _scheduler;
+
 		bool playing;
 
 	}; // class BaseApplication
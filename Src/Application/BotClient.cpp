@@ -0,0 +1,576 @@
+//---------------------------------------------------------------------------
+// BotClient.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file BotClient.cpp
+
+Contiene la implementacin de los bots del generador de carga.
+
+@see Application::CBotClient
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "BotClient.h"
+
+#include "Net/clienteENet.h"
+#include "Net/conexion.h"
+#include "Net/paquete.h"
+#include "Net/BitStream.h"
+
+#include "Logic/Messages/Message.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+namespace Application {
+
+	namespace {
+		/** Microsegundos entre dos PING. */
+		const unsigned long long PING_PERIOD = 1000000;
+
+		/** Valor de la accin de un CMessagePlayerInput sin salto. */
+		const unsigned char NO_ACTION = 0xFF;
+
+		/**
+		Tipo de entrega de cada canal. Es el mismo que el de
+		Net::CManager::getDelivery, pero el bot no usa el manager de red.
+		*/
+		Net::NetDelivery getDelivery(Net::NetChannel channel) {
+			switch(channel) {
+				case Net::ACK_CHANNEL:
+				case Net::SNAPSHOT_CHANNEL:
+					return Net::UNRELIABLE_SEQUENCED;
+				case Net::EFFECT_CHANNEL:
+					return Net::UNRELIABLE;
+				default:
+					return Net::RELIABLE;
+			}
+		}
+	}
+
+	//--------------------------------------------------------
+
+	CBotClient::CBotClient(const std::string& nick, int playerClass, unsigned int seed, TLoadStats& stats) : _nick(nick),
+																											 _playerClass(playerClass),
+																											 _seed(seed),
+																											 _stats(stats),
+																											 _state(DISCONNECTED),
+																											 _client(NULL),
+																											 _connection(NULL),
+																											 _netId(0),
+																											 _entityId(0),
+																											 _inputPeriod(1000000 / 60),
+																											 _nextInput(0),
+																											 _nextPing(0),
+																											 _pingSent(0),
+																											 _serverFrameStart(0),
+																											 _seq(0),
+																											 _nextMove(0),
+																											 _nextFire(0),
+																											 _strafe(0),
+																											 _forward(0),
+																											 _yaw(0),
+																											 _turnSpeed(0),
+																											 _firing(false),
+																											 _jump(false),
+																											 _nbBatched(0),
+																											 _firstOffset(0),
+																											 _firstSize(0) {
+		// Nada que hacer
+	} // CBotClient
+
+	//--------------------------------------------------------
+
+	CBotClient::~CBotClient() {
+		disconnect();
+	} // ~CBotClient
+
+	//--------------------------------------------------------
+
+	void CBotClient::setInputRate(unsigned int hz) {
+		assert(hz > 0 && "Los bots tienen que mandar algun tick de entrada");
+
+		_inputPeriod = 1000000 / hz;
+	} // setInputRate
+
+	//--------------------------------------------------------
+
+	bool CBotClient::connect(const std::string& host, int port) {
+		assert(_client == NULL && "El bot ya esta conectado");
+
+		_client = new Net::CClienteENet();
+		if( !_client->init() ) {
+			delete _client;
+			_client = NULL;
+			return false;
+		}
+
+		// Mismos canales y espera que CManager::connectTo
+		_connection = _client->connect( const_cast<char*>( host.c_str() ), port, Net::NB_CHANNELS, 5 );
+		if(_connection == NULL) {
+			_client->deInit();
+			delete _client;
+			_client = NULL;
+			return false;
+		}
+
+		_state = JOINING;
+		return true;
+	} // connect
+
+	//--------------------------------------------------------
+
+	void CBotClient::disconnect() {
+		if(_client == NULL)
+			return;
+
+		if(_connection) {
+			_client->disconnect(_connection);
+			delete _connection;
+			_connection = NULL;
+		}
+
+		_client->deInit();
+		delete _client;
+		_client = NULL;
+
+		_nbBatched = 0;
+		_pendingAcks.clear();
+
+		if(_state != REJECTED)
+			_state = DISCONNECTED;
+	} // disconnect
+
+	//--------------------------------------------------------
+
+	void CBotClient::tick(unsigned long long now) {
+		if(_connection == NULL)
+			return;
+
+		std::vector<Net::CPaquete*> packets;
+		_client->service(packets);
+
+		bool disconnected = false;
+		for(unsigned int i = 0; i < packets.size(); ++i) {
+			Net::CPaquete* packet = packets[i];
+
+			if(packet->getTipo() == Net::DATOS) {
+				_stats.bytesIn += packet->getDataLength();
+				processPacket( packet->getData(), packet->getDataLength(), now );
+			}
+			else if(packet->getTipo() == Net::DESCONEXION) {
+				disconnected = true;
+			}
+
+			delete packet;
+		}
+
+		// El cliente de ENet ya no cuenta con la conexion, la borramos nosotros
+		if(disconnected) {
+			delete _connection;
+			_connection = NULL;
+			disconnect();
+			return;
+		}
+
+		// Nos han echado o no hay sitio
+		if(_state == DISCONNECTED || _state == REJECTED) {
+			disconnect();
+			return;
+		}
+
+		if(_state == PLAYING) {
+			if(now >= _nextInput) {
+				sendInput(now);
+				sendAcks();
+
+				// Si nos hemos retrasado mas de un tick no intentamos recuperarlo
+				_nextInput += _inputPeriod;
+				if(_nextInput <= now)
+					_nextInput = now + _inputPeriod;
+			}
+
+			if(_pingSent == 0 && now >= _nextPing)
+				sendPing(now);
+		}
+
+		flush();
+	} // tick
+
+	//--------------------------------------------------------
+
+	void CBotClient::processPacket(Net::byte* data, size_t size, unsigned long long now) {
+		if( size < sizeof(Net::NetMessageType) )
+			return;
+
+		Net::NetMessageType msg;
+		memcpy( &msg, data, sizeof(msg) );
+
+		if(msg != Net::MESSAGE_BATCH) {
+			processMessage(data, size, now);
+			return;
+		}
+
+		// Mismo formato que CManager::flush: cada mensaje lleva delante su
+		// tamao como entero de longitud variable
+		Net::byte* current = data + sizeof(msg);
+		Net::byte* end = data + size;
+		while(current < end) {
+			unsigned int messageSize = 0;
+			unsigned int shift = 0;
+			Net::byte sizeByte;
+			do {
+				sizeByte = *current++;
+				messageSize |= (unsigned int)(sizeByte & 0x7F) << shift;
+				shift += 7;
+			} while( (sizeByte & 0x80) && current < end );
+
+			if(current + messageSize > end) {
+				std::cerr << "Bot " << _nick << ": paquete MESSAGE_BATCH corrupto" << std::endl;
+				return;
+			}
+
+			processMessage(current, messageSize, now);
+			current += messageSize;
+		}
+	} // processPacket
+
+	//--------------------------------------------------------
+
+	void CBotClient::processMessage(Net::byte* data, size_t size, unsigned long long now) {
+		if( size < sizeof(Net::NetMessageType) )
+			return;
+
+		Net::CBuffer buffer = Net::CBuffer::createView(data, size);
+
+		Net::NetMessageType msg;
+		buffer.read( &msg, sizeof(msg) );
+
+		switch(msg) {
+			case Net::ASSIGNED_ID: {
+				if( size >= sizeof(msg) + sizeof(_netId) )
+					buffer.read( &_netId, sizeof(_netId) );
+				break;
+			}
+			case Net::SEND_PLAYER_INFO: {
+				Net::NetMessageType playerInfoMsg = Net::PLAYER_INFO;
+				Net::CBuffer playerData( sizeof(playerInfoMsg) + sizeof(unsigned int) + _nick.size() );
+				playerData.write( &playerInfoMsg, sizeof(playerInfoMsg) );
+				playerData.serialize(_nick, false);
+				send( playerData.getbuffer(), playerData.getSize() );
+				break;
+			}
+			// El bot no carga nada: confirma directamente cada fase
+			case Net::LOAD_MAP: {
+				Net::NetMessageType ackMsg = Net::MAP_LOADED;
+				send( &ackMsg, sizeof(ackMsg) );
+				break;
+			}
+			case Net::GAME_SETTINGS: {
+				Net::NetMessageType ackMsg = Net::GAME_SETTINGS_LOADED;
+				send( &ackMsg, sizeof(ackMsg) );
+				break;
+			}
+			case Net::LOAD_WORLD_STATE: {
+				Net::NetMessageType ackMsg = Net::WORLD_STATE_LOADED;
+				send( &ackMsg, sizeof(ackMsg) );
+				break;
+			}
+			case Net::START_GAME: {
+				// Lo que hacen CGameClientState::activate (ping) y el menu de
+				// seleccion de personaje (clase)
+				sendPing(now);
+
+				Net::NetMessageType classMsg = Net::CLASS_SELECTED;
+				Net::CBuffer classBuffer( sizeof(classMsg) + sizeof(_playerClass) );
+				classBuffer.write( &classMsg, sizeof(classMsg) );
+				classBuffer.serialize(_playerClass);
+				send( classBuffer.getbuffer(), classBuffer.getSize() );
+				break;
+			}
+			case Net::LOAD_LOCAL_PLAYER: {
+				Net::NetID playerNetId;
+				if( size < sizeof(msg) + sizeof(playerNetId) + sizeof(_entityId) )
+					break;
+
+				buffer.read( &playerNetId, sizeof(playerNetId) );
+				buffer.read( &_entityId, sizeof(_entityId) );
+
+				Net::NetMessageType ackMsg = Net::LOCAL_PLAYER_LOADED;
+				Net::CBuffer ackBuffer( sizeof(ackMsg) + sizeof(_entityId) );
+				ackBuffer.write( &ackMsg, sizeof(ackMsg) );
+				ackBuffer.write( &_entityId, sizeof(_entityId) );
+				send( ackBuffer.getbuffer(), ackBuffer.getSize() );
+
+				// Empezamos a jugar desde ya
+				_state = PLAYING;
+				_nextInput = _nextMove = _nextFire = now;
+				_nextPing = now + PING_PERIOD;
+				break;
+			}
+			case Net::PING: {
+				processPing(buffer, size, now);
+				break;
+			}
+			case Net::ENTITY_MSG: {
+				processEntityMessage(buffer, size, now);
+				break;
+			}
+			case Net::MATCH_IS_FULL:
+			case Net::NO_FREE_PLAYER_SLOTS: {
+				std::cerr << "Bot " << _nick << ": no hay sitio en la partida" << std::endl;
+				_state = REJECTED;
+				break;
+			}
+			case Net::PLAYER_KICK:
+			case Net::END_GAME: {
+				_state = DISCONNECTED;
+				break;
+			}
+		}
+	} // processMessage
+
+	//--------------------------------------------------------
+
+	void CBotClient::processEntityMessage(Net::CBuffer& buffer, size_t size, unsigned long long now) {
+		// Cabecera: tipo de mensaje de red, entidad destino, id del mensaje de
+		// logica y si la snapshot esta cuantizada
+		unsigned int destID;
+		Logic::TMessageID messageId;
+		if( size < sizeof(Net::NetMessageType) + sizeof(destID) + sizeof(messageId) + sizeof(bool) )
+			return;
+
+		buffer.read( &destID, sizeof(destID) );
+		buffer.read( &messageId, sizeof(messageId) );
+
+		if(messageId != Logic::Message::PLAYER_SNAPSHOT && messageId != Logic::Message::TRANSFORM_SNAPSHOT)
+			return;
+
+		++_stats.snapshots;
+
+		// Primera snapshot desde la respuesta al ultimo PING: es del frame en
+		// el que se contesto
+		if(_serverFrameStart != 0) {
+			if(now > _serverFrameStart)
+				_stats.snapshotLatency.addSample( (unsigned int)(now - _serverFrameStart) );
+
+			_serverFrameStart = 0;
+		}
+
+		bool quantized;
+		buffer.deserialize(quantized);
+		if(!quantized)
+			return;
+
+		// Basta con confirmar la ultima secuencia de cada entidad, igual que
+		// CSnapshotHistory::snapshotReceived
+		Net::CBitReader reader(buffer);
+		unsigned int sequence = reader.readVarUInt();
+
+		std::map<unsigned int, unsigned int>::iterator it = _pendingAcks.find(destID);
+		if( it == _pendingAcks.end() )
+			_pendingAcks[destID] = sequence;
+		else if(it->second < sequence)
+			it->second = sequence;
+	} // processEntityMessage
+
+	//--------------------------------------------------------
+
+	void CBotClient::processPing(Net::CBuffer& buffer, size_t size, unsigned long long now) {
+		if(_pingSent == 0)
+			return;
+
+		_stats.roundTrip.addSample( (unsigned int)(now - _pingSent) );
+		_pingSent = 0;
+		_nextPing = now + PING_PERIOD;
+
+		// Los servidores que no mandan las medidas solo contestan con la hora
+		clock_t serverTime;
+		unsigned long long frameStart;
+		unsigned int meanWorkTime, maxWorkTime;
+		if( size < sizeof(Net::NetMessageType) + sizeof(serverTime) + sizeof(frameStart) + sizeof(meanWorkTime) + sizeof(maxWorkTime) )
+			return;
+
+		buffer.read( &serverTime, sizeof(serverTime) );
+		buffer.read( &frameStart, sizeof(frameStart) );
+		buffer.read( &meanWorkTime, sizeof(meanWorkTime) );
+		buffer.read( &maxWorkTime, sizeof(maxWorkTime) );
+
+		_serverFrameStart = frameStart;
+
+		++_stats.serverReports;
+		_stats.serverWorkTime += meanWorkTime;
+		if(maxWorkTime > _stats.serverMaxWorkTime)
+			_stats.serverMaxWorkTime = maxWorkTime;
+	} // processPing
+
+	//--------------------------------------------------------
+
+	void CBotClient::sendInput(unsigned long long now) {
+		// Cada cierto tiempo cambiamos de direccion y de giro, y a veces saltamos
+		if(now >= _nextMove) {
+			_forward = (char)( (int)random(3) - 1 );
+			_strafe = (char)( (int)random(3) - 1 );
+			_turnSpeed = ( (float)random(201) - 100.0f ) / 2000.0f;
+			_jump = random(4) == 0;
+
+			_nextMove = now + 500000 + random(1500) * 1000ULL;
+		}
+
+		// Rafagas de disparo, con alguna habilidad de vez en cuando. Solo se
+		// mandan los controles que reenvia CMovementSnapshot
+		if(now >= _nextFire) {
+			_firing = !_firing;
+			queueControl(_firing ? Logic::Control::LEFT_CLICK : Logic::Control::UNLEFT_CLICK);
+
+			if( _firing && random(8) == 0 ) {
+				queueControl(Logic::Control::USE_PRIMARY_SKILL);
+				queueControl(Logic::Control::STOP_PRIMARY_SKILL);
+			}
+
+			_nextFire = now + ( _firing ? 200 + random(1000) : 500 + random(2500) ) * 1000ULL;
+		}
+
+		_yaw += _turnSpeed;
+
+		// Mismo formato que CMessagePlayerInput::serialize: secuencia,
+		// direccion, accion y orientacion (un giro sobre el eje Y)
+		Logic::TMessageID messageId = Logic::Message::PLAYER_INPUT;
+		unsigned int seq = ++_seq;
+		char displacementDir[3] = { _strafe, 0, _forward };
+		unsigned char action = _jump ? (unsigned char)Logic::Control::JUMP : NO_ACTION;
+		float orientation[4] = { 0.0f, (float)sin(_yaw * 0.5f), 0.0f, (float)cos(_yaw * 0.5f) };
+		_jump = false;
+
+		Net::CBuffer inputMsg( sizeof(messageId) + sizeof(seq) + sizeof(displacementDir) + sizeof(action) + sizeof(orientation) );
+		inputMsg.write( &messageId, sizeof(messageId) );
+		inputMsg.write( &seq, sizeof(seq) );
+		inputMsg.write( displacementDir, sizeof(displacementDir) );
+		inputMsg.write( &action, sizeof(action) );
+		inputMsg.write( orientation, sizeof(orientation) );
+
+		queueEntityMessage(inputMsg);
+	} // sendInput
+
+	//--------------------------------------------------------
+
+	void CBotClient::queueControl(unsigned int controlType) {
+		// Mismo formato que CMessageControl::serialize. El cliente no numera
+		// estos controles, van con secuencia 0
+		Logic::TMessageID messageId = Logic::Message::CONTROL;
+		unsigned int seq = 0;
+
+		Net::CBuffer controlMsg( sizeof(messageId) + sizeof(seq) + sizeof(controlType) );
+		controlMsg.write( &messageId, sizeof(messageId) );
+		controlMsg.write( &seq, sizeof(seq) );
+		controlMsg.write( &controlType, sizeof(controlType) );
+
+		queueEntityMessage(controlMsg);
+	} // queueControl
+
+	//--------------------------------------------------------
+
+	void CBotClient::queueEntityMessage(Net::CBuffer& message) {
+		Net::NetMessageType msgType = Net::ENTITY_MSG;
+		size_t size = sizeof(msgType) + sizeof(_entityId) + message.getSize();
+
+		if(_nbBatched == 0) {
+			Net::NetMessageType batchType = Net::MESSAGE_BATCH;
+			_batch.reset();
+			_batch.write( &batchType, sizeof(batchType) );
+		}
+
+		size_t remaining = size;
+		while(remaining >= 0x80) {
+			Net::byte sizeByte = (Net::byte)(remaining & 0x7F) | 0x80;
+			_batch.write( &sizeByte, sizeof(sizeByte) );
+			remaining >>= 7;
+		}
+		Net::byte sizeByte = (Net::byte)remaining;
+		_batch.write( &sizeByte, sizeof(sizeByte) );
+
+		if(_nbBatched == 0) {
+			_firstOffset = _batch.getSize();
+			_firstSize = size;
+		}
+
+		_batch.write( &msgType, sizeof(msgType) );
+		_batch.write( &_entityId, sizeof(_entityId) );
+		_batch.write( message.getbuffer(), message.getSize() );
+
+		++_nbBatched;
+	} // queueEntityMessage
+
+	//--------------------------------------------------------
+
+	void CBotClient::sendPing(unsigned long long now) {
+		Net::NetMessageType pingMsg = Net::PING;
+		Net::CBuffer pingBuffer( sizeof(pingMsg) + sizeof(_netId) );
+		pingBuffer.write( &pingMsg, sizeof(pingMsg) );
+		pingBuffer.write( &_netId, sizeof(_netId) );
+		send( pingBuffer.getbuffer(), pingBuffer.getSize() );
+
+		_pingSent = now;
+	} // sendPing
+
+	//--------------------------------------------------------
+
+	void CBotClient::sendAcks() {
+		if( _pendingAcks.empty() )
+			return;
+
+		// Mismo formato que CSnapshotHistory::sendAcks
+		Net::NetMessageType msgType = Net::SNAPSHOT_ACK;
+		Net::CBuffer ackBuffer;
+		ackBuffer.write( &msgType, sizeof(msgType) );
+
+		Net::CBitWriter writer(ackBuffer);
+		writer.writeVarUInt( _pendingAcks.size() );
+		for(std::map<unsigned int, unsigned int>::const_iterator it = _pendingAcks.begin(); it != _pendingAcks.end(); ++it) {
+			writer.writeVarUInt(it->first);
+			writer.writeVarUInt(it->second);
+		}
+		writer.flush();
+
+		send( ackBuffer.getbuffer(), ackBuffer.getSize(), Net::ACK_CHANNEL );
+
+		_pendingAcks.clear();
+	} // sendAcks
+
+	//--------------------------------------------------------
+
+	void CBotClient::flush() {
+		if(_nbBatched == 1)
+			send( _batch.getbuffer() + _firstOffset, _firstSize );
+		else if(_nbBatched > 1)
+			send( _batch.getbuffer(), _batch.getSize() );
+
+		_nbBatched = 0;
+
+		// Un unico vaciado del host por tick, como CManager::flush
+		_client->flush();
+	} // flush
+
+	//--------------------------------------------------------
+
+	void CBotClient::send(void* data, size_t size, Net::NetChannel channel) {
+		_client->queueData( _connection, data, (int)size, channel, getDelivery(channel) );
+		_stats.bytesOut += size;
+	} // send
+
+	//--------------------------------------------------------
+
+	unsigned int CBotClient::random(unsigned int max) {
+		// Generador congruencial lineal, el mismo que suele usar rand()
+		_seed = _seed * 1103515245 + 12345;
+		return ( (_seed >> 16) & 0x7FFF ) % max;
+	} // random
+
+} // namespace Application
@@ -0,0 +1,346 @@
+//---------------------------------------------------------------------------
+// BotClient.h
+//---------------------------------------------------------------------------
+
+/**
+@file BotClient.h
+
+Contiene la declaracin de los bots del generador de carga: clientes de
+red sin Ogre ni lgica que se conectan a un servidor y juegan una partida
+guionizada para medir cunto aguanta.
+
+@see Application::CBotClient
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Application_BotClient_H
+#define __Application_BotClient_H
+
+#include "Net/Manager.h"
+#include "Net/LatencyHistogram.h"
+#include "Net/buffer.h"
+
+#include <map>
+#include <string>
+
+namespace Net {
+	class CClienteENet;
+	class CConexion;
+	class CPaquete;
+}
+
+namespace Application
+{
+	/**
+	Medidas que acumulan todos los bots de un generador de carga entre dos
+	informes. Los bots comparten una nica instancia (todos corren en el
+	mismo hilo).
+	*/
+	struct TLoadStats {
+		/** Bytes de datos recibidos y enviados (sin las cabeceras de ENet ni UDP). */
+		unsigned long long bytesIn;
+		unsigned long long bytesOut;
+		/** Snapshots recibidas. */
+		unsigned int snapshots;
+		/** Tiempo de ida y vuelta de los PING, en microsegundos. */
+		Net::CLatencyHistogram roundTrip;
+		/**
+		Tiempo que va desde el comienzo del frame del servidor que genera una
+		snapshot hasta que llega al bot, en microsegundos. Solo tiene sentido
+		si los bots y el servidor corren en la misma mquina.
+		*/
+		Net::CLatencyHistogram snapshotLatency;
+		/** Respuestas del servidor con el tiempo de trabajo de sus frames. */
+		unsigned int serverReports;
+		/** Suma de los tiempos medios de trabajo informados, en microsegundos. */
+		double serverWorkTime;
+		/** Mayor tiempo de trabajo informado, en microsegundos. */
+		unsigned int serverMaxWorkTime;
+
+		TLoadStats() { reset(); }
+
+		/** Pone a cero todas las medidas. */
+		void reset() {
+			bytesIn = bytesOut = 0;
+			snapshots = 0;
+			roundTrip.reset();
+			snapshotLatency.reset();
+			serverReports = 0;
+			serverWorkTime = 0;
+			serverMaxWorkTime = 0;
+		}
+	};
+
+	/**
+	Bot del generador de carga. Cada bot tiene su propio Net::CClienteENet
+	(y con l su propio socket), as que para el servidor es un cliente ms.
+	<p>
+	El bot sigue el mismo protocolo que CLobbyClientState y
+	CGameClientState pero sin cargar nada: contesta a SEND_PLAYER_INFO,
+	LOAD_MAP, GAME_SETTINGS y LOAD_WORLD_STATE, elige clase con
+	CLASS_SELECTED al recibir START_GAME y confirma su jugador con
+	LOCAL_PLAYER_LOADED. A partir de ah manda lo mismo que el jugador
+	local de un cliente real:
+
+	<ul>
+	<li>Un CMessagePlayerInput por tick fijo (lo que manda CNetCommands)
+	con la direccin de movimiento, la orientacin y los saltos.</li>
+	<li>CMessageControl de disparo y habilidades (lo que reenva
+	CMovementSnapshot).</li>
+	<li>Las confirmaciones de snapshots (SNAPSHOT_ACK), para que el
+	servidor codifique las snapshots como diferencias igual que con un
+	cliente real.</li>
+	<li>Un PING por segundo.</li>
+	</ul>
+
+	Los mensajes de cada tick se mandan juntos en un MESSAGE_BATCH, como
+	hace CManager::flush. El guion (hacia dnde anda, cundo salta y
+	cundo dispara) se decide con un generador pseudoaleatorio propio de
+	cada bot, as que dos ejecuciones con los mismos bots mandan lo mismo.
+	<p>
+	Con las respuestas a los PING se mide el tiempo de ida y vuelta y se
+	recogen el tiempo de trabajo de los frames del servidor y la hora de
+	comienzo del frame en el que se ha contestado (ver
+	CGameServerState::dataPacketReceived). La primera snapshot que llega
+	despus sale al final de ese mismo frame, as que su latencia es la
+	hora de llegada menos la de comienzo del frame. Las dos horas se miden
+	con CLatencyHistogram::getTimestamp, que solo es comparable entre
+	procesos de la misma mquina.
+
+	@ingroup applicationGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	class CBotClient
+	{
+	public:
+		/** Estados por los que pasa un bot. */
+		enum TBotState {
+			/** Sin conexin (o el servidor la ha cerrado). */
+			DISCONNECTED,
+			/** Conectado, cargando la partida o eligiendo clase. */
+			JOINING,
+			/** Con jugador en la partida. */
+			PLAYING,
+			/** El servidor no tiene sitio para el bot. */
+			REJECTED
+		};
+
+		/**
+		Constructor de la clase.
+
+		@param nick Nombre del jugador.
+		@param playerClass Clase que elige el bot (1 screamer, 2 hound, 3
+		archangel y 4 shadow, como en CGameClientState).
+		@param seed Semilla del guion del bot.
+		@param stats Medidas en las que acumula el bot.
+		*/
+		CBotClient(const std::string& nick, int playerClass, unsigned int seed, TLoadStats& stats);
+
+		/**
+		Destructor. Cierra la conexin si sigue abierta.
+		*/
+		~CBotClient();
+
+		/**
+		Fija cuntos ticks de entrada se mandan por segundo. Por defecto 60,
+		que es lo que manda un cliente con el paso fijo de 16 ms.
+
+		@param hz Ticks por segundo.
+		*/
+		void setInputRate(unsigned int hz);
+
+		/**
+		Se conecta al servidor. Bloquea hasta que se establece la conexin.
+
+		@param host Direccin del servidor.
+		@param port Puerto del servidor.
+		@return false si no se ha podido conectar.
+		*/
+		bool connect(const std::string& host, int port);
+
+		/**
+		Procesa lo que haya llegado del servidor y, si toca, manda el
+		siguiente tick de entrada.
+
+		@param now Hora actual (CLatencyHistogram::getTimestamp).
+		*/
+		void tick(unsigned long long now);
+
+		/** Cierra la conexin con el servidor. */
+		void disconnect();
+
+		/** Devuelve el estado del bot. */
+		TBotState getState() const { return _state; }
+
+	private:
+
+		/**
+		Procesa un paquete recibido. Los MESSAGE_BATCH se deshacen y cada
+		mensaje se procesa por separado.
+
+		@param data Contenido del paquete.
+		@param size Tamao del paquete.
+		@param now Hora de llegada.
+		*/
+		void processPacket(Net::byte* data, size_t size, unsigned long long now);
+
+		/**
+		Procesa un mensaje del servidor.
+
+		@param data Contenido del mensaje.
+		@param size Tamao del mensaje.
+		@param now Hora de llegada.
+		*/
+		void processMessage(Net::byte* data, size_t size, unsigned long long now);
+
+		/**
+		Procesa un ENTITY_MSG. Solo interesan las snapshots cuantizadas, de
+		las que se apunta la secuencia para confirmarla.
+
+		@param buffer Mensaje, con el tipo de mensaje de red ya ledo.
+		@param size Tamao del mensaje.
+		@param now Hora de llegada.
+		*/
+		void processEntityMessage(Net::CBuffer& buffer, size_t size, unsigned long long now);
+
+		/**
+		Procesa la respuesta a un PING.
+
+		@param buffer Mensaje, con el tipo de mensaje de red ya ledo.
+		@param size Tamao del mensaje.
+		@param now Hora de llegada.
+		*/
+		void processPing(Net::CBuffer& buffer, size_t size, unsigned long long now);
+
+		/**
+		Avanza el guion y encola los mensajes de un tick de entrada.
+
+		@param now Hora actual.
+		*/
+		void sendInput(unsigned long long now);
+
+		/** Encola un CMessageControl para el jugador del bot. */
+		void queueControl(unsigned int controlType);
+
+		/**
+		Encola un ENTITY_MSG para el jugador del bot.
+
+		@param message Mensaje de lgica serializado.
+		*/
+		void queueEntityMessage(Net::CBuffer& message);
+
+		/** Manda un PING. */
+		void sendPing(unsigned long long now);
+
+		/** Manda las confirmaciones de las snapshots recibidas desde el ltimo envo. */
+		void sendAcks();
+
+		/**
+		Manda de una vez todo lo encolado. Un nico mensaje se manda tal
+		cual y varios en un MESSAGE_BATCH.
+		*/
+		void flush();
+
+		/**
+		Manda un mensaje al servidor.
+
+		@param data Mensaje.
+		@param size Tamao del mensaje.
+		@param channel Canal por el que se manda.
+		*/
+		void send(void* data, size_t size, Net::NetChannel channel = Net::DEFAULT_CHANNEL);
+
+		/** Devuelve un nmero pseudoaleatorio entre 0 y max - 1. */
+		unsigned int random(unsigned int max);
+
+		/** Nombre del jugador. */
+		std::string _nick;
+
+		/** Clase que elige el bot. */
+		int _playerClass;
+
+		/** Estado del generador pseudoaleatorio del guion. */
+		unsigned int _seed;
+
+		/** Medidas compartidas con el resto de bots. */
+		TLoadStats& _stats;
+
+		/** Estado del bot. */
+		TBotState _state;
+
+		/** Cliente de red del bot. */
+		Net::CClienteENet* _client;
+
+		/** Conexin con el servidor. */
+		Net::CConexion* _connection;
+
+		/** Id de red que nos ha dado el servidor (ASSIGNED_ID). */
+		Net::NetID _netId;
+
+		/** Id de la entidad del jugador del bot. */
+		unsigned int _entityId;
+
+		/** Microsegundos entre ticks de entrada. */
+		unsigned long long _inputPeriod;
+
+		/** Hora del siguiente tick de entrada. */
+		unsigned long long _nextInput;
+
+		/** Hora del siguiente PING. */
+		unsigned long long _nextPing;
+
+		/** Hora a la que se mand el PING del que se espera respuesta (0 si no hay ninguno). */
+		unsigned long long _pingSent;
+
+		/**
+		Comienzo del frame del servidor en el que se contest al ltimo PING.
+		La siguiente snapshot que llegue es de ese frame (0 si ya ha llegado).
+		*/
+		unsigned long long _serverFrameStart;
+
+		/** Nmero de secuencia de los mensajes de entrada. */
+		unsigned int _seq;
+
+		/** Hora a la que cambia lo que hace el bot (direccin y disparo). */
+		unsigned long long _nextMove;
+		unsigned long long _nextFire;
+
+		/** Direccin de movimiento: x lateral, z hacia delante (-1, 0 o 1). */
+		char _strafe;
+		char _forward;
+
+		/** Orientacin del jugador (giro en radianes) y su velocidad de giro por tick. */
+		float _yaw;
+		float _turnSpeed;
+
+		/** true mientras el bot tiene el disparo pulsado. */
+		bool _firing;
+
+		/** true si en el siguiente tick hay que saltar. */
+		bool _jump;
+
+		/** ltima secuencia de snapshot recibida por entidad, pendiente de confirmar. */
+		std::map<unsigned int, unsigned int> _pendingAcks;
+
+		/**
+		Mensajes encolados para el siguiente envo, ya con la cabecera de
+		MESSAGE_BATCH y el tamao de cada uno.
+		*/
+		Net::CBuffer _batch;
+
+		/** Mensajes encolados en _batch. */
+		unsigned int _nbBatched;
+
+		/** Posicin y tamao del primer mensaje encolado, para mandarlo solo. */
+		size_t _firstOffset;
+		size_t _firstSize;
+
+	}; // CBotClient
+
+} // namespace Application
+
+#endif //  __Application_BotClient_H
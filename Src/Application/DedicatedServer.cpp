@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------
+// DedicatedServer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file DedicatedServer.cpp
+
+Contiene el punto de entrada del servidor dedicado de Gloom. La partida
+se configura por lnea de comandos:
+
+<pre>
+GloomServer -map Factory -mode "Team DeathMatch" -port 1235 -players 8
+            -spectators 4 -time 15 -frags 20 -tickrate 60
+            -name Gloom -password secreto
+</pre>
+
+Con -record se graban los paquetes de los clientes, y con -replay se
+reproduce una grabacin sin abrir el puerto para medir el servidor (-fast
+para ir tan rpido como se pueda):
+
+<pre>
+GloomServer -map Factory -players 16 -record partida.gnet
+GloomServer -map Factory -players 16 -replay partida.gnet -fast
+</pre>
+
+@see Application::CDedicatedServerApplication
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "Application/DedicatedServerApplication.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+	void printUsage(const char* program) {
+		std::cout << "Uso: " << program << " [-map mapa] [-mode \"Duel\"|\"DeathMatch\"|\"Team DeathMatch\"]" << std::endl
+				  << "       [-port puerto] [-players n] [-spectators n] [-time minutos] [-frags n]" << std::endl
+				  << "       [-tickrate hz] [-name nombre] [-password clave]" << std::endl
+				  << "       [-record fichero] [-replay fichero [-fast]]" << std::endl;
+	}
+
+	//________________________________________________________________________
+
+	bool parseArguments(int argc, char **argv, Application::TDedicatedServerSettings& settings) {
+		for(int i = 1; i < argc; ++i) {
+			if( !strcmp(argv[i], "-fast") ) {
+				settings.replayFast = true;
+				continue;
+			}
+
+			// El resto de opciones llevan un valor
+			if(i + 1 >= argc)
+				return false;
+
+			const char* option = argv[i];
+			const char* value = argv[++i];
+
+			if( !strcmp(option, "-map") )
+				settings.map = value;
+			else if( !strcmp(option, "-mode") )
+				settings.mode = value;
+			else if( !strcmp(option, "-name") )
+				settings.serverName = value;
+			else if( !strcmp(option, "-password") )
+				settings.serverPassword = value;
+			else if( !strcmp(option, "-port") )
+				settings.port = atoi(value);
+			else if( !strcmp(option, "-players") )
+				settings.maxPlayers = atoi(value);
+			else if( !strcmp(option, "-spectators") )
+				settings.maxSpectators = atoi(value);
+			else if( !strcmp(option, "-time") )
+				settings.timeLimit = atoi(value);
+			else if( !strcmp(option, "-frags") )
+				settings.goalScore = atoi(value);
+			else if( !strcmp(option, "-tickrate") )
+				settings.tickRate = atoi(value);
+			else if( !strcmp(option, "-record") )
+				settings.recordFile = value;
+			else if( !strcmp(option, "-replay") )
+				settings.replayFile = value;
+			else
+				return false;
+		}
+
+		return settings.port > 0 && settings.maxPlayers > 0 && settings.tickRate > 0;
+	}
+
+}
+
+//________________________________________________________________________
+
+int main(int argc, char **argv)
+{
+	Application::TDedicatedServerSettings settings;
+	if( !parseArguments(argc, argv, settings) ) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	{
+		Application::CDedicatedServerApplication miApp(settings);
+
+		if (miApp.init())
+			miApp.run();
+
+		miApp.release();
+	}
+
+	return 0;
+
+} // main
@@ -0,0 +1,280 @@
+//---------------------------------------------------------------------------
+// DedicatedServerApplication.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file DedicatedServerApplication.cpp
+
+Contiene la implementacin de la aplicacin del servidor dedicado, que
+ejecuta una partida sin ventana, audio, GUI ni entrada. Los servidores de
+esos subsistemas son los nulos (NullServer.cpp de cada uno).
+
+@see Application::CDedicatedServerApplication
+@see Application::CBaseApplication
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "DedicatedServerApplication.h"
+#include "HighResolutionClock.h"
+#include "PacketReplayer.h"
+#include "ExitState.h"
+#include "DMServer.h"
+#include "TDMServer.h"
+
+#include "BaseSubsystems/Math.h"
+#include "Graphics/Server.h"
+#include "Input/InputManager.h"
+#include "Input/Server.h"
+#include "GUI/Server.h"
+#include "Audio/Server.h"
+#include "Logic/Server.h"
+#include "Logic/Maps/ComponentFactory.h"
+#include "Logic/Maps/EntityFactory.h"
+#include "Physics/Server.h"
+#include "Net/Manager.h"
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+namespace Application {
+
+	CDedicatedServerApplication::CDedicatedServerApplication(const TDedicatedServerSettings& settings) : CBaseApplication(),
+																										 _settings(settings),
+																										 _timer(NULL),
+																										 _lastStatsTime(0),
+																										 _replayer(NULL),
+																										 _replayTime(0) {
+		// Nada que hacer
+	} // CDedicatedServerApplication
+
+	//--------------------------------------------------------
+
+	CDedicatedServerApplication::~CDedicatedServerApplication() {
+		// Nada que hacer
+	} // ~CDedicatedServerApplication
+
+	//--------------------------------------------------------
+
+	bool CDedicatedServerApplication::init() {
+		Math::seed();
+
+		// Inicializamos la clase base.
+		if (!CBaseApplication::init())
+			return false;
+
+		// Graphics, Input, GUI y Audio son los servidores nulos: no abren
+		// ventana ni dispositivos, pero la logica los usa igual que en el
+		// cliente. Sin BaseSubsystems no hay Ogre::Root.
+		if (!Graphics::CServer::Init())
+			return false;
+
+		if (!Input::CInputManager::Init())
+			return false;
+
+		if (!GUI::CServer::Init())
+			return false;
+
+		if (!Input::CServer::Init())
+			return false;
+
+		if (!Physics::CServer::Init())
+			return false;
+
+		if (!Logic::CServer::Init())
+			return false;
+
+		if (!Audio::CServer::Init())
+			return false;
+
+		if (!Net::CManager::Init())
+			return false;
+
+		// El reloj de Ogre necesita BaseSubsystems, usamos el del sistema
+		_timer = new CHighResolutionClock();
+		_clock = _timer;
+
+		// Frecuencia de la partida
+		_scheduler.setFrameRate(_settings.tickRate);
+
+		if( !_settings.replayFile.empty() ) {
+			_replayer = new CPacketReplayer();
+			if( !_replayer->open(_settings.replayFile) ) {
+				std::cerr << "No se ha podido abrir la grabacion " << _settings.replayFile << std::endl;
+				return false;
+			}
+
+			// Sin esperas entre frames; cada uno simula lo mismo que en la partida
+			if(_settings.replayFast) {
+				_scheduler.setFrameRate(0);
+				_scheduler.setSimulatedFrameTime(1000000 / _settings.tickRate);
+			}
+		}
+
+		// En el cliente la escena fisica la crea el menu
+		Physics::CServer::getSingletonPtr()->createScene();
+
+		// CREACION DE ESTADOS.
+		// La aplicacin se hace responsable de destruirlos.
+		if(!addState("DMServer", new CDMServer(this)))
+			return false;
+
+		if(!addState("TDMServer", new CTDMServer(this)))
+			return false;
+
+		// Los estados de juego vuelven al menu al acabar la partida
+		if(!addState("menu", new CExitState(this)))
+			return false;
+
+		return loadMatch();
+	} // init
+
+	//--------------------------------------------------------
+
+	void CDedicatedServerApplication::release() {
+		// Desactivamos y eliminamos todos los estados.
+		releaseAllStates();
+
+		delete _timer;
+		_timer = NULL;
+		_clock = NULL;
+
+		delete _replayer;
+		_replayer = NULL;
+
+		if(Logic::CComponentFactory::getSingletonPtr())
+			delete Logic::CComponentFactory::getSingletonPtr();
+
+		if(Logic::CServer::getSingletonPtr())
+			Logic::CServer::Release();
+
+		if(Physics::CServer::getSingletonPtr())
+			Physics::CServer::Release();
+
+		if(Audio::CServer::getSingletonPtr())
+			Audio::CServer::Release();
+
+		if(GUI::CServer::getSingletonPtr())
+			GUI::CServer::Release();
+
+		if(Input::CServer::getSingletonPtr())
+			Input::CServer::Release();
+
+		if(Input::CInputManager::getSingletonPtr())
+			Input::CInputManager::Release();
+
+		if(Graphics::CServer::getSingletonPtr())
+			Graphics::CServer::Release();
+
+		if(Net::CManager::getSingletonPtr())
+			Net::CManager::Release();
+
+		CBaseApplication::release();
+	} // release
+
+	//--------------------------------------------------------
+
+	bool CDedicatedServerApplication::loadMatch() {
+		Logic::CEntityFactory* entityFactory = Logic::CEntityFactory::getSingletonPtr();
+
+		// Inicializar dispatcher - 0 es el id del server
+		entityFactory->initDispatcher(0, _settings.maxPlayers);
+
+		// Los blueprints del servidor sin los componentes graficos, que con el
+		// servidor grafico nulo no harian nada
+		if( !entityFactory->loadBluePrints("blueprints_dedicated.txt") )
+			return false;
+
+		if( !entityFactory->loadArchetypes("archetypes.txt") )
+			return false;
+
+		if( !Logic::CServer::getSingletonPtr()->loadLevel(_settings.map + "_server.txt") )
+			return false;
+
+		std::vector<std::string> mapList;
+		mapList.push_back(_settings.map);
+		std::pair<unsigned int, unsigned int> timeLimit(_settings.timeLimit, 0);
+
+		if(_settings.mode == "Team DeathMatch") {
+			setState("TDMServer");
+			CTDMServer* state = static_cast<CTDMServer*>( getNextState() );
+
+			state->setPort(_settings.port);
+			state->setRecordFile(_settings.recordFile);
+			state->setReplay(_replayer != NULL);
+			state->serverSettings(_settings.serverName, _settings.serverPassword, _settings.maxPlayers, _settings.maxSpectators, false, false);
+			state->gameSettings(mapList, false, timeLimit, _settings.goalScore, true, false, true, false);
+		}
+		else {
+			setState("DMServer");
+			CDMServer* state = static_cast<CDMServer*>( getNextState() );
+
+			// El duelo es un deathmatch de dos jugadores
+			unsigned int maxPlayers = _settings.mode == "Duel" ? 2 : _settings.maxPlayers;
+
+			state->setPort(_settings.port);
+			state->setRecordFile(_settings.recordFile);
+			state->setReplay(_replayer != NULL);
+			state->serverSettings(_settings.serverName, _settings.serverPassword, maxPlayers, _settings.maxSpectators, false, false);
+			state->gameSettings(mapList, false, timeLimit, _settings.goalScore, true, false);
+		}
+
+		std::cout << "Servidor dedicado: " << _settings.mode << " en " << _settings.map
+				  << ", puerto " << _settings.port << ", " << _settings.tickRate << " Hz" << std::endl;
+
+		return true;
+	} // loadMatch
+
+	//--------------------------------------------------------
+
+	void CDedicatedServerApplication::printStats() {
+		TSchedulerStats stats = _scheduler.getStats();
+
+		std::cout << "Frames: " << stats.frames
+				  << " | media " << stats.meanFrameTime / 1000.0 << " ms"
+				  << " | jitter " << stats.jitter / 1000.0 << " ms"
+				  << " | max " << stats.maxFrameTime / 1000.0 << " ms"
+				  << " | trabajo " << stats.meanWorkTime / 1000.0 << " ms (max " << stats.maxWorkTime / 1000.0 << " ms)"
+				  << " | tarde " << stats.lateFrames
+				  << " | pasos descartados " << stats.droppedSteps << std::endl;
+
+		Logic::CEntityFactory::getSingletonPtr()->printPoolStats();
+
+		_scheduler.resetStats();
+	} // printStats
+
+	//--------------------------------------------------------
+
+	void CDedicatedServerApplication::tick(unsigned int msecs) {
+		// Paquetes grabados que corresponden a este frame
+		if(_replayer) {
+			_replayTime += _scheduler.getFrameTime();
+
+			if( !_replayer->replayUntil(_replayTime) ) {
+				std::cout << "Fin de la grabacion: " << _replayer->getNbPackets() << " paquetes en "
+						  << _replayTime / 1000000.0 << " s de partida" << std::endl;
+				printStats();
+				exitRequest();
+				return;
+			}
+		}
+
+		// TICK DE RED
+		Net::CManager::getSingletonPtr()->tick(msecs);
+
+		// TICK DE LOGICA-FISICA
+		CBaseApplication::tick(msecs);
+
+		// ENVIO DE RED: todo lo que la logica ha encolado en el frame sale junto
+		Net::CManager::getSingletonPtr()->flush();
+
+		// Estadisticas de los frames cada 10 segundos
+		if(_clock->getTime() - _lastStatsTime >= 10000) {
+			_lastStatsTime = _clock->getTime();
+			printStats();
+		}
+	} // tick
+
+} // namespace Application
@@ -0,0 +1,184 @@
+//---------------------------------------------------------------------------
+// DedicatedServerApplication.h
+//---------------------------------------------------------------------------
+
+/**
+@file DedicatedServerApplication.h
+
+Contiene la declaracin de la aplicacin del servidor dedicado, que
+ejecuta una partida sin ventana, audio, GUI ni entrada.
+
+@see Application::CDedicatedServerApplication
+@see Application::CBaseApplication
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Application_DedicatedServerApplication_H
+#define __Application_DedicatedServerApplication_H
+
+#include "BaseApplication.h"
+
+#include <string>
+
+namespace Application
+{
+	class CHighResolutionClock;
+	class CPacketReplayer;
+}
+
+namespace Application
+{
+	/**
+	Configuracin de la partida de un servidor dedicado. Equivale a lo
+	que el anfitrin elige en el men de CLobbyServerState.
+	*/
+	struct TDedicatedServerSettings {
+		/** Nombre del mapa (sin el sufijo _server). */
+		std::string map;
+		/** Modo de juego: "Duel", "DeathMatch" o "Team DeathMatch". */
+		std::string mode;
+		/** Nombre y contrasea del servidor. */
+		std::string serverName;
+		std::string serverPassword;
+		/** Puerto en el que escucha el servidor. */
+		int port;
+		/** Nmero mximo de jugadores y espectadores. */
+		unsigned int maxPlayers;
+		unsigned int maxSpectators;
+		/** Duracin de la partida en minutos (0 para ilimitada). */
+		unsigned int timeLimit;
+		/** Frags para ganar (0 para ilimitado). */
+		unsigned int goalScore;
+		/** Frames por segundo del bucle principal. */
+		unsigned int tickRate;
+		/** Fichero en el que grabar los paquetes recibidos (vaco para no grabar). */
+		std::string recordFile;
+		/**
+		Grabacin a reproducir en lugar de abrir el puerto (vaco para jugar
+		una partida normal). El mapa y el modo tienen que ser los de la
+		partida grabada.
+		*/
+		std::string replayFile;
+		/** true para reproducir la grabacin tan rpido como se pueda. */
+		bool replayFast;
+
+		TDedicatedServerSettings() : map("Factory"), mode("DeathMatch"), serverName("Gloom"), port(1234),
+									 maxPlayers(8), maxSpectators(4), timeLimit(15), goalScore(20), tickRate(60),
+									 replayFast(false) { }
+	};
+
+	/**
+	Aplicacin del servidor dedicado.
+	<p>
+	No crea la ventana de Ogre. Fsica, lgica y red son los de siempre;
+	los servidores grfico, de audio, de GUI y de entrada son
+	implementaciones nulas que se enlazan en lugar de las de verdad (ver
+	NullServer.cpp en cada subsistema), as que la lgica los usa sin
+	comprobar si existen y el ejecutable no depende de las bibliotecas del
+	cliente.
+	<p>
+	El bucle principal es el de CBaseApplication, con el planificador a la
+	frecuencia de la partida: duerme el tiempo que sobra de cada frame en
+	lugar de girar, para poder tener varias partidas en la misma mquina.
+	Cada diez segundos se escriben por consola las estadsticas de los
+	frames.
+	<p>
+	Al terminar la partida el estado de juego vuelve al "menu", que en el
+	servidor dedicado es CExitState: el proceso acaba y quien lo lanz
+	puede arrancar la siguiente partida.
+	<p>
+	Tambin sirve para medir el servidor sin clientes: puede grabar los
+	paquetes de una partida real y reproducirlos despus con
+	CPacketReplayer, a la velocidad original o tan rpido como se pueda
+	(cada frame simula entonces 1/tickRate segundos). Al acabar la
+	grabacin se escriben las estadsticas y el proceso termina.
+
+	@ingroup applicationGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	class CDedicatedServerApplication : public CBaseApplication
+	{
+	public:
+		/**
+		Constructor de la clase
+
+		@param settings Configuracin de la partida.
+		*/
+		CDedicatedServerApplication(const TDedicatedServerSettings& settings);
+
+		/**
+		Destructor de la aplicacin
+		*/
+		virtual ~CDedicatedServerApplication();
+
+		/**
+		Inicializa la fsica, la lgica y la red, crea los estados de juego
+		del servidor y carga el mapa de la partida.
+
+		@return false si la inicializacin ha fallado.
+		*/
+		virtual bool init();
+
+		/**
+		Finaliza la aplicacin, liberando todos los recursos utilizados.
+		*/
+		virtual void release();
+
+	protected:
+
+		/**
+		Ejecuta una vuelta del bucle principal: recepcin de red, tick de los
+		estados (lgica y fsica) y envo de lo que se ha encolado.
+
+		@param msecs Milisegundos transcurridos desde la ltima vuelta.
+		*/
+		virtual void tick(unsigned int msecs);
+
+		/**
+		Carga los blueprints, los arquetipos y el mapa, y deja preparado el
+		estado de juego correspondiente al modo elegido.
+
+		@return false si no se ha podido cargar la partida.
+		*/
+		bool loadMatch();
+
+		/**
+		Escribe por consola las estadsticas de los frames del planificador
+		y las pone a cero, seguidas de las de los pools de entidades.
+		*/
+		void printStats();
+
+		/**
+		Configuracin de la partida.
+		*/
+		TDedicatedServerSettings _settings;
+
+		/**
+		Reloj de la aplicacin (el mismo objeto que _clock).
+		*/
+		CHighResolutionClock* _timer;
+
+		/**
+		Hora de la aplicacin a la que se escribieron las ltimas estadsticas.
+		*/
+		unsigned int _lastStatsTime;
+
+		/**
+		Reproductor de la grabacin (NULL si se juega una partida normal).
+		*/
+		CPacketReplayer* _replayer;
+
+		/**
+		Microsegundos de la grabacin reproducidos hasta ahora.
+		*/
+		unsigned long long _replayTime;
+
+	}; // class CDedicatedServerApplication
+
+} // namespace Application
+
+#endif // __Application_DedicatedServerApplication_H
@@ -27,6 +27,7 @@ Contiene la implementaci
 #include "Input/InputManager.h"
 
 #include "Logic/GameNetPlayersManager.h"
+#include "Logic/SnapshotHistory.h"
 #include "Logic/Entity/Entity.h"
 #include "Logic/Server.h"
 #include "Logic/Maps/EntityFactory.h"
@@ -114,12 +115,19 @@ namespace Application {
 
 	//______________________________________________________________________________
 
+	void CGameClientState::tick(unsigned int msecs) {
+		CGameState::tick(msecs);
+
+		// Confirmamos de una sola vez todas las snapshots recibidas
+		Logic::CSnapshotHistory::getSingletonPtr()->sendAcks();
+	} // tick
+
+	//______________________________________________________________________________
+
 	void CGameClientState::dataPacketReceived(Net::CPaquete* packet) {
 		// Introducimos los datos recibidos en un buffer para leerlo
 		// facilmente
-		Net::CBuffer buffer( packet->getDataLength() );
-		buffer.write( packet->getData(), packet->getDataLength() );
-		buffer.reset();
+		Net::CBuffer buffer = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		// Obtenemos la cabecera del mensaje
 		Net::NetMessageType msg;
@@ -217,7 +225,7 @@ namespace Application {
 
 					Logic::CEntity* camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByName("Camera");
 					assert(camera != NULL && "Error, eres un lamer");
-					camera->getComponent<Logic::CCamera>("CCamera")->setTarget(spectator);
+					camera->getComponent<Logic::CCamera>()->setTarget(spectator);
 
 					// Actualizamos el gestor de players
 					if( !playersMgr->existsByNetId(newPlayerNetId) )
@@ -244,7 +252,7 @@ namespace Application {
 					for(; it != playersMgr->end(); ++it) {
 						if( it->isSpawned() ) {
 							Logic::CEntity* player = Logic::CServer::getSingletonPtr()->getMap()->getEntityByID( it->getEntityId().first );
-							player->getComponent<Logic::CCharacterName>("CCharacterName")->setVisible(true);
+							player->getComponent<Logic::CCharacterName>()->setVisible(true);
 						}
 					}
 				}
@@ -284,7 +292,7 @@ namespace Application {
 					// Fijamos el objetivo de la camara
 					Logic::CEntity* camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByName("Camera");
 					assert(camera != NULL && "Error: Esto no se puede hacer asi que sois unos lamers, ahora el servidor que hace?");
-					camera->getComponent<Logic::CCamera>("CCamera")->setTarget(player);
+					camera->getComponent<Logic::CCamera>()->setTarget(player);
 
 					//ack message to avoid deads
 					Net::NetMessageType msgping = Net::LOCAL_PLAYER_LOADED;
@@ -310,7 +318,7 @@ namespace Application {
 								Logic::TeamFaction::Enum playerTeam = playersMgr->getTeamUsingEntityId(id);
 
 								if(myTeam != Logic::TeamFaction::eNONE && playerTeam != Logic::TeamFaction::eNONE && myTeam == playerTeam)
-									player->getComponent<Logic::CCharacterName>("CCharacterName")->setVisible(true);
+									player->getComponent<Logic::CCharacterName>()->setVisible(true);
 							}
 						}
 					}
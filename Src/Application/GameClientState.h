@@ -93,6 +93,18 @@ namespace Application {
 		*/
 		virtual void deactivate();
 
+		//______________________________________________________________________________
+
+		/**
+		Funcin llamada por la aplicacin para que se ejecute
+		la funcionalidad del estado. Adems de actualizar el juego
+		confirma al servidor las snapshots recibidas en este frame.
+
+		@param msecs Nmero de milisegundos transcurridos desde
+		la ltima llamada.
+		*/
+		virtual void tick(unsigned int msecs);
+
 		//______________________________________________________________________________
 		
 		/**
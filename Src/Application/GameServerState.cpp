@@ -22,6 +22,7 @@ Contiene la implementaci
 #include "Net/paquete.h"
 
 #include "Logic/GameNetPlayersManager.h"
+#include "Logic/SnapshotHistory.h"
 #include "Logic/Entity/Entity.h"
 #include "Logic/Server.h"
 #include "Logic/Maps/EntityFactory.h"
@@ -31,6 +32,8 @@ Contiene la implementaci
 #include "Input/PlayerController.h"
 #include "Input/Server.h"
 
+#include <iostream>
+
 namespace Application {
 
 	void CGameServerState::activate() {
@@ -47,7 +50,20 @@ namespace Application {
 		// Seteamos el mximo de jugadores a 12 (8 players + 4 espectadores)
 		// @deprecated Deberiamos tomar el valor de flash en lobbyServer y
 		// tomar el numero de jugadores que haya en el gestor de jugadores
-		_netMgr->activateAsServer(1234, 12);
+		if(_replay) {
+			// Sin host de red, los paquetes los mete el reproductor
+			_netMgr->activateAsReplayServer(12);
+		}
+		else {
+			_netMgr->activateAsServer(_port, 12);
+
+			// El host de ENet pasa a atenderse desde su propio hilo para que el
+			// service y los envios no compitan con el tick de la logica
+			_netMgr->startIOThread();
+		}
+
+		if( !_recordFile.empty() && !_netMgr->startRecording(_recordFile) )
+			std::cerr << "No se ha podido crear el fichero de grabacion " << _recordFile << std::endl;
 
 		// Nos registramos como observadores del teclado
 		Input::CInputManager::getSingletonPtr()->addKeyListener(this);
@@ -247,9 +263,7 @@ namespace Application {
 		Net::NetID playerNetId = packet->getConexion()->getId();
 
 		// Construimos un buffer para leer los datos que hemos recibido
-		Net::CBuffer inBuffer( packet->getDataLength() );
-		inBuffer.write( packet->getData(), packet->getDataLength() );
-		inBuffer.reset(); // Desplazamos el puntero al principio para realizar la lectura
+		Net::CBuffer inBuffer = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		// En primer lugar extraemos el tipo del mensaje que hemos recibido
 		Net::NetMessageType msgType;
@@ -382,9 +396,23 @@ namespace Application {
 			case Net::PING: {
 				Net::NetMessageType ackMsg = Net::PING;
 				clock_t time = clock();
-				Net::CBuffer ackBuffer(sizeof(ackMsg) + sizeof(time));
+
+				// Detras de la hora van datos para medir el servidor (los usan los
+				// bots del generador de carga, el cliente solo lee la hora): el
+				// comienzo de este frame con el reloj de CLatencyHistogram y lo
+				// que tardan los frames en microsegundos
+				const CTickScheduler& scheduler = _app->getScheduler();
+				TSchedulerStats stats = scheduler.getStats();
+				unsigned long long frameStart = Net::CLatencyHistogram::getTimestamp() - scheduler.getFrameElapsed();
+				unsigned int meanWorkTime = (unsigned int)stats.meanWorkTime;
+				unsigned int maxWorkTime = (unsigned int)stats.maxWorkTime;
+
+				Net::CBuffer ackBuffer( sizeof(ackMsg) + sizeof(time) + sizeof(frameStart) + sizeof(meanWorkTime) + sizeof(maxWorkTime) );
 				ackBuffer.write(&ackMsg, sizeof(ackMsg));
 				ackBuffer.write(&time, sizeof(time));
+				ackBuffer.write(&frameStart, sizeof(frameStart));
+				ackBuffer.write(&meanWorkTime, sizeof(meanWorkTime));
+				ackBuffer.write(&maxWorkTime, sizeof(maxWorkTime));
 				_netMgr->sendTo(playerNetId, ackBuffer.getbuffer(), ackBuffer.getSize());
 				break;
 			}
@@ -448,6 +476,9 @@ namespace Application {
 			// Eliminamos el jugador que se desconecta del manager de jugadores
 			_playersMgr->removePlayer(playerNetId);
 		}
+
+		// Olvidamos las snapshots que le habiamos mandado
+		Logic::CSnapshotHistory::getSingletonPtr()->removeClient(playerNetId);
 	} // disconnexionPacketReceived
 
 	//______________________________________________________________________________
@@ -59,7 +59,7 @@ namespace Application {
 		@param app Aplicacion que se encarga de manejar los estados.
 		*/
 		CGameServerState(CBaseApplication *app, GameMode::Enum mode) : CGameState(app), _gameMode(mode), _playersMgr(NULL),
-																	   _autoBalanceTeams(false) { }
+																	   _autoBalanceTeams(false), _port(1234), _replay(false) { }
 
 
 		// =======================================================================
@@ -179,6 +179,32 @@ namespace Application {
 		void serverSettings(const std::string& serverName, const std::string& serverPassword, unsigned int maxPlayers, 
 							unsigned int maxSpectators, bool voteMap, bool voteKick);
 
+		/**
+		Establece el puerto en el que escucha el servidor. Hay que llamarlo
+		antes de activar el estado; permite tener varias partidas en la misma
+		mquina.
+
+		@param port Puerto de escucha.
+		*/
+		void setPort(int port) { _port = port; }
+
+		/**
+		Hace que al activarse el estado se grabe en un fichero todo lo que se
+		recibe de los clientes (ver Net::CManager::startRecording).
+
+		@param fileName Ruta del fichero. Vaca para no grabar.
+		*/
+		void setRecordFile(const std::string& fileName) { _recordFile = fileName; }
+
+		/**
+		Hace que al activarse el estado no se abra ningn puerto: los paquetes
+		de los clientes los inyecta un reproductor de grabaciones (ver
+		CPacketReplayer).
+
+		@param replay true para reproducir una grabacin.
+		*/
+		void setReplay(bool replay) { _replay = replay; }
+
 	protected:
 
 		inline void disconnect();
@@ -203,6 +229,15 @@ namespace Application {
 
 		bool _autoBalanceTeams;
 
+		/** Puerto en el que escucha el servidor. */
+		int _port;
+
+		/** Fichero en el que se graban los paquetes recibidos (vaco si no se graba). */
+		std::string _recordFile;
+
+		/** true si los paquetes vienen de una grabacin en lugar de la red. */
+		bool _replay;
+
 	private:
 
 		void sendMapInfo(Net::NetID playerNetId);
@@ -67,8 +67,13 @@ namespace Application {
 
 		// Queremos que el GUI maneje al jugador.
 		Input::CServer::getSingletonPtr()->getPlayerController()->activate();
-		// Seteamos el tamao del time step fijo para la logica
-		Logic::CServer::getSingletonPtr()->setFixedTimeStep(16);
+		// Seteamos el tamao del time step fijo para la logica y la fisica,
+		// que es el que marca el planificador. La fisica lo divide en dos.
+		unsigned int fixedTimeStep = _app->getScheduler().getFixedTimeStep();
+		Logic::CServer::getSingletonPtr()->setFixedTimeStep(fixedTimeStep);
+		Physics::CServer::getSingletonPtr()->setFixedTimeStep(fixedTimeStep, 2);
+		// Simulamos la fsica en paralelo con el resto del frame
+		Physics::CServer::getSingletonPtr()->setPipelined(true);
 		// Indicamos que a partir de ahora la creacin de objetos es dinmica
 		Logic::CEntityFactory::getSingletonPtr()->dynamicCreation(true);
 	} // activate
@@ -81,6 +86,9 @@ namespace Application {
 		// controlar al jugador.
 		Input::CServer::getSingletonPtr()->getPlayerController()->deactivate();
 
+		// Recogemos el step en curso antes de descargar el nivel
+		Physics::CServer::getSingletonPtr()->setPipelined(false);
+
 		Logic::CServer::getSingletonPtr()->unLoadLevel();
 		
 		CApplicationState::deactivate();
@@ -94,14 +102,24 @@ namespace Application {
 
 
 	void CGameState::tick(unsigned int msecs) {
-		// Ejecutamos el tick de la lgica del juego
-		Logic::CServer::getSingletonPtr()->tick(msecs);
+		Physics::CServer* physicsServer = Physics::CServer::getSingletonPtr();
+
+		// Pasos de tick fijo de este frame, los mismos para logica y fisica
+		unsigned int fixedSteps = _app->getScheduler().getFixedSteps();
 
-		// Ejecutamos el tick de la fsica del juego.
-		//std::shared_ptr<boost::thread> physics = std::make_shared<boost::thread>(&Physics::CServer::tick , Physics::CServer::getSingletonPtr(), msecs);
+		// Punto de sincronizacin del modo segmentado: recogemos el step
+		// lanzado en el frame anterior y se disparan los callbacks de colisin.
+		// La lgica se ejecuta siempre con la escena sincronizada, porque
+		// PhysX no admite queries ni mover controllers mientras simula
+		physicsServer->fetchSimulation();
+
+		// Ejecutamos el tick de la lgica del juego
+		Logic::CServer::getSingletonPtr()->tick(msecs, fixedSteps);
 
-		// Ejecutamos el tick de la fsica del juego.
-		Physics::CServer::getSingletonPtr()->tick(msecs);
+		// Ejecutamos el tick de la fsica del juego. En modo segmentado el
+		// step se queda simulando mientras se termina el frame (red, render)
+		// y se espera al siguiente
+		physicsServer->tick(fixedSteps);
 	} // tick
 
 	//--------------------------------------------------------
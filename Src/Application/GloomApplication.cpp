@@ -56,6 +56,10 @@ namespace Application {
 		if (!C3DApplication::init())
 			return false;
 
+		// El cliente pinta a 120 fps como mucho; el resto del frame se duerme
+		// en lugar de gastar el nucleo girando
+		_scheduler.setFrameRate(120);
+
 		// CREACION DE ESTADOS. 
 		// La aplicacin se hace responsable de destruirlos.
 		if(!addState("gameOver", new CGameOverState(this)))
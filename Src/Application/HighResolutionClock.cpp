@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------
+// HighResolutionClock.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file HighResolutionClock.cpp
+
+Contiene la implementacin de un temporizador de alta resolucin que no
+depende de Ogre.
+
+@see Application::CHighResolutionClock
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "HighResolutionClock.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace Application {
+
+	namespace {
+		/** Lectura del contador del sistema, en ticks del contador. */
+		unsigned long long readCounter() {
+		#ifdef _WIN32
+			LARGE_INTEGER counter;
+			QueryPerformanceCounter(&counter);
+			return counter.QuadPart;
+		#else
+			timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+		#endif
+		}
+	}
+
+	//--------------------------------------------------------
+
+	CHighResolutionClock::CHighResolutionClock() : IClock()
+	{
+	#ifdef _WIN32
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		_frequency = frequency.QuadPart;
+	#else
+		_frequency = 1000000000ULL;
+	#endif
+
+		_start = readCounter();
+	} // CHighResolutionClock
+
+	//--------------------------------------------------------
+
+	unsigned long long CHighResolutionClock::getMicroseconds() const
+	{
+		unsigned long long elapsed = readCounter() - _start;
+
+		// Separamos segundos y resto para no desbordar al multiplicar
+		return (elapsed / _frequency) * 1000000ULL + ( (elapsed % _frequency) * 1000000ULL ) / _frequency;
+	} // getMicroseconds
+
+	//--------------------------------------------------------
+
+	unsigned long CHighResolutionClock::getPhysicalTime()
+	{
+		return (unsigned long)(getMicroseconds() / 1000);
+	} // getPhysicalTime
+
+} // namespace Application
@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------
+// HighResolutionClock.h
+//---------------------------------------------------------------------------
+
+/**
+@file HighResolutionClock.h
+
+Contiene la declaracin de un temporizador de alta resolucin que no
+depende de Ogre.
+
+@see Application::CHighResolutionClock
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Application_HighResolutionClock_H
+#define __Application_HighResolutionClock_H
+
+#include "Clock.h"
+
+namespace Application
+{
+	/**
+	Temporizador con resolucin de microsegundos que lee directamente el
+	contador del sistema (QueryPerformanceCounter en Windows y el reloj
+	montono en el resto de plataformas).
+	<p>
+	A diferencia de COgreClock no necesita que BaseSubsystems::CServer est
+	inicializado, por lo que lo puede usar el servidor dedicado, que no
+	arranca Ogre.
+
+	@ingroup applicationGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	class CHighResolutionClock : public IClock
+	{
+	public:
+		/**
+		Constructor de la clase
+		*/
+		CHighResolutionClock();
+
+		/**
+		Destructor
+		*/
+		virtual ~CHighResolutionClock() {}
+
+		/**
+		Devuelve los microsegundos transcurridos desde que se cre el reloj.
+		A diferencia de getTime() no depende de updateTime(), lee el contador
+		en el momento de la llamada.
+
+		@return Microsegundos desde la creacin del reloj.
+		*/
+		unsigned long long getMicroseconds() const;
+
+	protected:
+
+		/**
+		Mtodo que devuelve la "hora fsica" del sistema
+		en milisegundos.
+
+		@return Hora en milisegundos.
+		*/
+		virtual unsigned long getPhysicalTime();
+
+		/**
+		Lectura del contador del sistema al crear el reloj.
+		*/
+		unsigned long long _start;
+
+		/**
+		Frecuencia del contador del sistema (ticks por segundo).
+		*/
+		unsigned long long _frequency;
+
+	}; // CHighResolutionClock
+
+} // namespace Application
+
+#endif //  __Application_HighResolutionClock_H
@@ -0,0 +1,253 @@
+//---------------------------------------------------------------------------
+// LoadGenerator.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file LoadGenerator.cpp
+
+Contiene el punto de entrada del generador de carga: un proceso que
+conecta muchos bots (Application::CBotClient) a un servidor para ver
+cuntos jugadores aguanta.
+
+Los bots se van aadiendo por tandas. Al final de cada tanda se escribe
+una lnea con lo que han medido durante ella:
+
+<pre>
+GloomBots -bots 64 -step 8 -interval 10 -host 127.0.0.1 -port 1234
+</pre>
+
+<ul>
+<li>RTT: ida y vuelta de los PING, que esperan en el servidor hasta su
+siguiente frame.</li>
+<li>Snapshot: desde que empieza el frame del servidor que genera una
+snapshot hasta que llega al bot (solo con el servidor en la misma
+mquina).</li>
+<li>Snapshots por segundo y bytes recibidos y enviados por segundo, por
+bot.</li>
+<li>Tick del servidor: tiempo de trabajo medio y mximo de sus frames,
+segn lo que informa en las respuestas a los PING.</li>
+</ul>
+
+Conviene arrancar el servidor dedicado con tantos jugadores como bots se
+vayan a conectar (-players).
+
+@see Application::CBotClient
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "Application/BotClient.h"
+#include "Application/TickScheduler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+	/** Frecuencia con la que se atiende a los bots. Marca la precisin de las medidas. */
+	const unsigned int POLL_RATE = 500;
+
+	/**
+	Configuracin del generador de carga.
+	*/
+	struct TLoadGeneratorSettings {
+		/** Direccin y puerto del servidor. */
+		std::string host;
+		int port;
+		/** Nmero total de bots. */
+		unsigned int bots;
+		/** Bots que se aaden en cada tanda. */
+		unsigned int step;
+		/** Segundos que dura cada tanda. */
+		unsigned int interval;
+		/** Ticks de entrada por segundo de cada bot. */
+		unsigned int inputRate;
+		/** Clase de los bots (0 para repartir las cuatro clases). */
+		int playerClass;
+
+		TLoadGeneratorSettings() : host("127.0.0.1"), port(1234), bots(16), step(4), interval(10),
+								   inputRate(60), playerClass(0) { }
+	};
+
+	//________________________________________________________________________
+
+	void printUsage(const char* program) {
+		std::cout << "Uso: " << program << " [-host direccion] [-port puerto] [-bots n] [-step n]" << std::endl
+				  << "       [-interval segundos] [-rate hz] [-class 1-4]" << std::endl;
+	}
+
+	//________________________________________________________________________
+
+	bool parseArguments(int argc, char **argv, TLoadGeneratorSettings& settings) {
+		for(int i = 1; i < argc; ++i) {
+			// Todas las opciones llevan un valor
+			if(i + 1 >= argc)
+				return false;
+
+			const char* option = argv[i];
+			const char* value = argv[++i];
+
+			if( !strcmp(option, "-host") )
+				settings.host = value;
+			else if( !strcmp(option, "-port") )
+				settings.port = atoi(value);
+			else if( !strcmp(option, "-bots") )
+				settings.bots = atoi(value);
+			else if( !strcmp(option, "-step") )
+				settings.step = atoi(value);
+			else if( !strcmp(option, "-interval") )
+				settings.interval = atoi(value);
+			else if( !strcmp(option, "-rate") )
+				settings.inputRate = atoi(value);
+			else if( !strcmp(option, "-class") )
+				settings.playerClass = atoi(value);
+			else
+				return false;
+		}
+
+		return settings.port > 0 && settings.bots > 0 && settings.step > 0 && settings.interval > 0 &&
+			   settings.inputRate > 0 && settings.playerClass >= 0 && settings.playerClass <= 4;
+	}
+
+	//________________________________________________________________________
+
+	/**
+	Conecta bots hasta tener los pedidos.
+
+	@return Nmero de bots que no se han podido conectar.
+	*/
+	unsigned int addBots(std::vector<Application::CBotClient*>& bots, unsigned int count,
+						 const TLoadGeneratorSettings& settings, Application::TLoadStats& stats) {
+		unsigned int failed = 0;
+
+		while(bots.size() < count) {
+			unsigned int index = bots.size();
+
+			std::ostringstream nick;
+			nick << "Bot" << index;
+
+			// Sin clase fijada repartimos las cuatro clases de jugador
+			int playerClass = settings.playerClass > 0 ? settings.playerClass : (int)(index % 4) + 1;
+
+			Application::CBotClient* bot = new Application::CBotClient(nick.str(), playerClass, index + 1, stats);
+			bot->setInputRate(settings.inputRate);
+			if( !bot->connect(settings.host, settings.port) )
+				++failed;
+
+			bots.push_back(bot);
+		}
+
+		return failed;
+	}
+
+	//________________________________________________________________________
+
+	void printReport(const std::vector<Application::CBotClient*>& bots, const Application::TLoadStats& stats, unsigned long long elapsed) {
+		unsigned int playing = 0, joining = 0, rejected = 0;
+		for(unsigned int i = 0; i < bots.size(); ++i) {
+			switch( bots[i]->getState() ) {
+				case Application::CBotClient::PLAYING:
+					++playing;
+					break;
+				case Application::CBotClient::JOINING:
+					++joining;
+					break;
+				case Application::CBotClient::REJECTED:
+					++rejected;
+					break;
+				default:
+					break;
+			}
+		}
+
+		double seconds = elapsed / 1000000.0;
+		double perBot = playing > 0 ? 1.0 / (playing * seconds) : 0;
+
+		std::cout << std::fixed << std::setprecision(2)
+				  << "Bots: " << playing << " jugando, " << joining << " entrando, " << rejected << " rechazados"
+				  << " | RTT " << stats.roundTrip.getMean() / 1000.0 << " ms (p99 " << stats.roundTrip.getPercentile(0.99f) / 1000.0 << " ms)"
+				  << " | snapshot " << stats.snapshotLatency.getMean() / 1000.0 << " ms (p99 " << stats.snapshotLatency.getPercentile(0.99f) / 1000.0 << " ms)"
+				  << " | " << stats.snapshots * perBot << " snapshots/s"
+				  << " | entrada " << stats.bytesIn * perBot / 1024.0 << " KB/s"
+				  << " | salida " << stats.bytesOut * perBot / 1024.0 << " KB/s"
+				  << " | tick servidor ";
+
+		if(stats.serverReports > 0)
+			std::cout << stats.serverWorkTime / stats.serverReports / 1000.0 << " ms (max " << stats.serverMaxWorkTime / 1000.0 << " ms)";
+		else
+			std::cout << "-";
+
+		std::cout << std::endl;
+	}
+
+}
+
+//________________________________________________________________________
+
+int main(int argc, char **argv)
+{
+	TLoadGeneratorSettings settings;
+	if( !parseArguments(argc, argv, settings) ) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	Application::TLoadStats stats;
+	std::vector<Application::CBotClient*> bots;
+
+	// Los bots se atienden mucho mas a menudo de lo que mandan para medir
+	// las llegadas con precision, pero sin girar: el servidor suele estar
+	// en la misma maquina
+	Application::CTickScheduler scheduler;
+	scheduler.setFrameRate(POLL_RATE);
+	scheduler.setSpinThreshold(0);
+
+	unsigned long long interval = settings.interval * 1000000ULL;
+	unsigned long long stepStart = 0;
+
+	bool finished = false;
+	while(!finished) {
+		// Nueva tanda de bots. Conectar bloquea, asi que las medidas empiezan
+		// cuando estan todos conectados
+		if(stepStart == 0) {
+			unsigned int count = std::min<unsigned int>(bots.size() + settings.step, settings.bots);
+			unsigned int failed = addBots(bots, count, settings, stats);
+			if(failed > 0)
+				std::cerr << failed << " bots no se han podido conectar a " << settings.host << ":" << settings.port << std::endl;
+
+			stats.reset();
+			scheduler.reset();
+			stepStart = Net::CLatencyHistogram::getTimestamp();
+		}
+
+		scheduler.beginFrame();
+
+		unsigned long long now = Net::CLatencyHistogram::getTimestamp();
+		for(unsigned int i = 0; i < bots.size(); ++i)
+			bots[i]->tick(now);
+
+		if(now - stepStart >= interval) {
+			printReport(bots, stats, now - stepStart);
+
+			if(bots.size() >= settings.bots)
+				finished = true;
+			else
+				stepStart = 0;
+		}
+
+		scheduler.endFrame();
+	}
+
+	for(unsigned int i = 0; i < bots.size(); ++i)
+		delete bots[i];
+
+	return 0;
+
+} // main
@@ -137,9 +137,7 @@ namespace Application {
 	void CLobbyClientState::dataPacketReceived(Net::CPaquete* packet) {
 		// Escribimos en un buffer los datos recibidos para ir leyendolos
 		// poco a poco
-		Net::CBuffer buffer( packet->getDataLength() );
-		buffer.write(packet->getData(), packet->getDataLength());
-		buffer.reset();
+		Net::CBuffer buffer = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		// Obtenemos la cabecera del buffer que nos indica el tipo de mensaje
 		// recibido
@@ -315,7 +313,7 @@ namespace Application {
 
 	void CLobbyClientState::requestConnectionTo(const string& ip) {
 		// Pedimos la conexion a la ip dada
-		if ( !_netMgr->connectTo( (char*)ip.c_str(), 1234, 1) ) {
+		if ( !_netMgr->connectTo( (char*)ip.c_str(), 1234, Net::NB_CHANNELS) ) {
 			_menu->callFunction( "connectionFailed", Hikari::Args() );
 		}
 	} // requestConnectionTo
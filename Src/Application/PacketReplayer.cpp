@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------
+// PacketReplayer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file PacketReplayer.cpp
+
+Contiene la implementacin del reproductor de grabaciones de red.
+
+@see Application::CPacketReplayer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "PacketReplayer.h"
+
+#include "Net/Manager.h"
+#include "Net/conexionReplay.h"
+#include "Net/paquete.h"
+
+namespace Application {
+
+	CPacketReplayer::CPacketReplayer() : _pending(false),
+										 _finished(false),
+										 _nbPackets(0) {
+		// Nada que hacer
+	} // CPacketReplayer
+
+	//--------------------------------------------------------
+
+	bool CPacketReplayer::open(const std::string& fileName) {
+		_pending = false;
+		_finished = false;
+		_nbPackets = 0;
+
+		return _playback.open(fileName);
+	} // open
+
+	//--------------------------------------------------------
+
+	bool CPacketReplayer::replayUntil(unsigned long long time) {
+		while(!_finished) {
+			if(!_pending) {
+				if( !_playback.next(_next) ) {
+					_finished = true;
+					break;
+				}
+
+				_pending = true;
+			}
+
+			// Lo que queda es de frames posteriores
+			if(_next.time > time)
+				break;
+
+			replay(_next);
+			_pending = false;
+		}
+
+		return !_finished;
+	} // replayUntil
+
+	//--------------------------------------------------------
+
+	void CPacketReplayer::replay(Net::TRecordedPacket& recorded) {
+		Net::CConexionReplay* connection;
+
+		std::map<Net::NetID, Net::CConexionReplay*>::iterator it = _connections.find(recorded.id);
+		if(recorded.type == Net::CONEXION) {
+			// Una conexion repetida significaria que se ha perdido su desconexion
+			if( it != _connections.end() )
+				return;
+
+			connection = new Net::CConexionReplay(recorded.id);
+			_connections[recorded.id] = connection;
+		}
+		else {
+			// Paquetes de clientes que se conectaron antes de empezar a grabar
+			if( it == _connections.end() )
+				return;
+
+			connection = it->second;
+		}
+
+		connection->setRoundTripTime(recorded.roundTripTime);
+
+		Net::CPaquete packet( recorded.type, recorded.data.empty() ? NULL : &recorded.data[0], recorded.data.size(),
+							  connection, recorded.channel );
+		Net::CManager::getSingletonPtr()->replayPacket(&packet);
+
+		// El manager ya ha destruido la conexion
+		if(recorded.type == Net::DESCONEXION)
+			_connections.erase(recorded.id);
+
+		++_nbPackets;
+	} // replay
+
+} // namespace Application
@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------
+// PacketReplayer.h
+//---------------------------------------------------------------------------
+
+/**
+@file PacketReplayer.h
+
+Contiene la declaracin del reproductor de grabaciones de red, que mete
+en el servidor los paquetes grabados de una partida real.
+
+@see Application::CPacketReplayer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Application_PacketReplayer_H
+#define __Application_PacketReplayer_H
+
+#include "Net/PacketLog.h"
+
+#include <map>
+#include <string>
+
+namespace Net {
+	class CConexionReplay;
+}
+
+namespace Application
+{
+	/**
+	Reproduce una grabacin hecha con Net::CManager::startRecording. Los
+	paquetes se inyectan con Net::CManager::replayPacket, que los reparte a
+	los observadores de la red (CGameServerState::dataPacketReceived y
+	compaa) igual que si acabaran de llegar de los clientes.
+	<p>
+	El manager de red tiene que estar activado con activateAsReplayServer
+	(ver CGameServerState::setReplay). El ritmo lo marca quien llame a
+	replayUntil: con el tiempo real se reproduce a la velocidad original y
+	con un tiempo simulado por frame, tan rpido como d la mquina.
+
+	@ingroup applicationGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	class CPacketReplayer
+	{
+	public:
+		/**
+		Constructor de la clase
+		*/
+		CPacketReplayer();
+
+		/**
+		Abre la grabacin.
+
+		@param fileName Ruta del fichero.
+		@return false si no se ha podido abrir o no es una grabacin.
+		*/
+		bool open(const std::string& fileName);
+
+		/**
+		Inyecta todos los paquetes grabados hasta un momento dado.
+
+		@param time Microsegundos desde el comienzo de la grabacin.
+		@return false si ya no quedan paquetes.
+		*/
+		bool replayUntil(unsigned long long time);
+
+		/** Devuelve el nmero de paquetes inyectados. */
+		unsigned int getNbPackets() const { return _nbPackets; }
+
+	private:
+
+		/**
+		Inyecta un paquete grabado.
+
+		@param recorded Paquete ledo de la grabacin.
+		*/
+		void replay(Net::TRecordedPacket& recorded);
+
+		/** Lector de la grabacin. */
+		Net::CPacketPlayback _playback;
+
+		/** Siguiente paquete, ledo pero an no inyectado. */
+		Net::TRecordedPacket _next;
+
+		/** true si _next tiene un paquete pendiente de inyectar. */
+		bool _pending;
+
+		/** true cuando se ha llegado al final de la grabacin. */
+		bool _finished;
+
+		/**
+		Conexiones de los clientes grabados. Las destruye el manager de red
+		cuando se reproduce su desconexin.
+		*/
+		std::map<Net::NetID, Net::CConexionReplay*> _connections;
+
+		/** Paquetes inyectados. */
+		unsigned int _nbPackets;
+
+	}; // CPacketReplayer
+
+} // namespace Application
+
+#endif //  __Application_PacketReplayer_H
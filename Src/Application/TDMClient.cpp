@@ -42,7 +42,7 @@ namespace Application {
 			// De momento solo mostramos el tiempo si el player esta dentro de la partida (en los menus no se 
 			// muestra el tiempo).
 			if(player != NULL) {
-				Logic::CHud* hudComponent = player->getComponent<Logic::CHud>("CHud");
+				Logic::CHud* hudComponent = player->getComponent<Logic::CHud>();
 				// De momento el espectador no tiene hud, por eso hago esta
 				// comprobacion
 				if(hudComponent != NULL)
@@ -64,7 +64,7 @@ namespace Application {
 				// De momento solo mostramos el tiempo si el player esta dentro de la partida (en los menus no se 
 				// muestra el tiempo).
 				if(player != NULL) {
-					Logic::CHud* hudComponent = player->getComponent<Logic::CHud>("CHud");
+					Logic::CHud* hudComponent = player->getComponent<Logic::CHud>();
 					// De momento el espectador no tiene hud, por eso hago esta
 					// comprobacion
 					if(hudComponent != NULL)
@@ -94,9 +94,7 @@ namespace Application {
 		CGameClientState::dataPacketReceived(packet);
 
 		// Introducimos los datos recibidos en un buffer
-		Net::CBuffer buffer( packet->getDataLength() );
-		buffer.write( packet->getData(), packet->getDataLength() );
-		buffer.reset();
+		Net::CBuffer buffer = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		// Obtenemos la cabecera del mensaje
 		Net::NetMessageType netMsgType;
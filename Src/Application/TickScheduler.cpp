@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------
+// TickScheduler.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file TickScheduler.cpp
+
+Contiene la implementacin del planificador del bucle principal.
+
+@see Application::CTickScheduler
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "TickScheduler.h"
+
+#include <boost/thread/thread.hpp>
+
+#include <cassert>
+#include <cmath>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <mmsystem.h>
+#endif
+
+namespace Application {
+
+	CTickScheduler::CTickScheduler() : _fixedTimeStep(16),
+									   _framePeriod(0),
+									   _maxCatchUpSteps(4),
+									   _spinThreshold(2000),
+									   _simulatedFrameTime(0),
+									   _simulationTime(0),
+									   _frameTime(0),
+									   _frameStart(0),
+									   _nextFrame(0),
+									   _accumulator(0),
+									   _frameDuration(0),
+									   _fixedSteps(0) {
+
+	#ifdef _WIN32
+		// Por defecto Windows despierta a los hilos dormidos cada ~15 ms,
+		// con lo que un sleep se pasaria casi un frame entero
+		timeBeginPeriod(1);
+	#endif
+
+		resetStats();
+		reset();
+	} // CTickScheduler
+
+	//--------------------------------------------------------
+
+	CTickScheduler::~CTickScheduler() {
+	#ifdef _WIN32
+		timeEndPeriod(1);
+	#endif
+	} // ~CTickScheduler
+
+	//--------------------------------------------------------
+
+	void CTickScheduler::setFixedTimeStep(unsigned int msecs) {
+		assert(msecs > 0 && "El paso fijo tiene que durar algo");
+
+		_fixedTimeStep = msecs;
+	} // setFixedTimeStep
+
+	//--------------------------------------------------------
+
+	void CTickScheduler::setFrameRate(unsigned int hz) {
+		_framePeriod = hz > 0 ? 1000000ULL / hz : 0;
+	} // setFrameRate
+
+	//--------------------------------------------------------
+
+	void CTickScheduler::reset() {
+		_frameStart = _nextFrame = _clock.getMicroseconds();
+		_accumulator = 0;
+		_frameTime = 0;
+		_frameDuration = 0;
+		_fixedSteps = 0;
+	} // reset
+
+	//--------------------------------------------------------
+
+	void CTickScheduler::beginFrame() {
+		unsigned long long now = _clock.getMicroseconds();
+		unsigned long long elapsed = now - _frameStart;
+		_frameStart = now;
+
+		// Tiempo que simula el frame: el medido o el fijado a mano
+		_frameTime = _simulatedFrameTime > 0 ? _simulatedFrameTime : elapsed;
+
+		// Los milisegundos se sacan de las horas absolutas para que el
+		// redondeo de un frame se compense en el siguiente
+		unsigned long long previousTime = _simulationTime;
+		_simulationTime += _frameTime;
+		_frameDuration = (unsigned int)(_simulationTime / 1000 - previousTime / 1000);
+
+		// Pasos fijos que caben en el tiempo acumulado
+		unsigned long long step = _fixedTimeStep * 1000ULL;
+		_accumulator += _frameTime;
+		_fixedSteps = (unsigned int)(_accumulator / step);
+		_accumulator %= step;
+
+		// Si vamos demasiado atrasados no intentamos recuperarlo todo
+		if(_maxCatchUpSteps > 0 && _fixedSteps > _maxCatchUpSteps) {
+			_statDroppedSteps += _fixedSteps - _maxCatchUpSteps;
+			_fixedSteps = _maxCatchUpSteps;
+		}
+
+		// Estadsticas
+		++_statFrames;
+		_statSum += (double)elapsed;
+		_statSumSquares += (double)elapsed * (double)elapsed;
+		if(_statFrames == 1 || elapsed < _statMin)
+			_statMin = elapsed;
+		if(elapsed > _statMax)
+			_statMax = elapsed;
+	} // beginFrame
+
+	//--------------------------------------------------------
+
+	void CTickScheduler::endFrame() {
+		unsigned long long now = _clock.getMicroseconds();
+
+		// Lo que ha costado el frame, antes de esperar al siguiente
+		unsigned long long work = now - _frameStart;
+		++_statWorkFrames;
+		_statWorkSum += (double)work;
+		if(work > _statWorkMax)
+			_statWorkMax = work;
+
+		if(_framePeriod == 0)
+			return;
+
+		// La hora del siguiente frame se calcula a partir de la del anterior
+		// y no de la actual, para que los frames no se vayan retrasando
+		_nextFrame += _framePeriod;
+
+		if(now >= _nextFrame) {
+			// Nos hemos pasado: el siguiente frame empieza ya
+			++_statLateFrames;
+			_nextFrame = now;
+			return;
+		}
+
+		// Dormimos mientras quede margen y giramos el ltimo tramo
+		while(now < _nextFrame) {
+			unsigned long long remaining = _nextFrame - now;
+			if(remaining > _spinThreshold)
+				boost::this_thread::sleep( boost::posix_time::microseconds(remaining - _spinThreshold) );
+			else
+				boost::this_thread::yield();
+
+			now = _clock.getMicroseconds();
+		}
+	} // endFrame
+
+	//--------------------------------------------------------
+
+	TSchedulerStats CTickScheduler::getStats() const {
+		TSchedulerStats stats;
+
+		stats.frames = _statFrames;
+		stats.lateFrames = _statLateFrames;
+		stats.droppedSteps = _statDroppedSteps;
+
+		if(_statFrames > 0) {
+			stats.meanFrameTime = _statSum / _statFrames;
+			double variance = _statSumSquares / _statFrames - stats.meanFrameTime * stats.meanFrameTime;
+			stats.jitter = variance > 0 ? sqrt(variance) : 0;
+			stats.minFrameTime = _statMin;
+			stats.maxFrameTime = _statMax;
+		}
+
+		if(_statWorkFrames > 0) {
+			stats.meanWorkTime = _statWorkSum / _statWorkFrames;
+			stats.maxWorkTime = _statWorkMax;
+		}
+
+		return stats;
+	} // getStats
+
+	//--------------------------------------------------------
+
+	void CTickScheduler::resetStats() {
+		_statFrames = 0;
+		_statSum = _statSumSquares = 0;
+		_statMin = _statMax = 0;
+		_statLateFrames = 0;
+		_statDroppedSteps = 0;
+		_statWorkFrames = 0;
+		_statWorkSum = 0;
+		_statWorkMax = 0;
+	} // resetStats
+
+} // namespace Application
@@ -0,0 +1,243 @@
+//---------------------------------------------------------------------------
+// TickScheduler.h
+//---------------------------------------------------------------------------
+
+/**
+@file TickScheduler.h
+
+Contiene la declaracin del planificador del bucle principal, que marca
+el ritmo de los frames y cuntos pasos de tick fijo toca dar en cada uno.
+
+@see Application::CTickScheduler
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Application_TickScheduler_H
+#define __Application_TickScheduler_H
+
+#include "HighResolutionClock.h"
+
+namespace Application
+{
+	/**
+	Estadsticas de la duracin de los frames desde la ltima llamada a
+	CTickScheduler::resetStats. Todos los tiempos en microsegundos.
+	*/
+	struct TSchedulerStats {
+		/** Frames medidos. */
+		unsigned int frames;
+		/** Duracin media de un frame. */
+		double meanFrameTime;
+		/** Desviacin tpica de la duracin de los frames. */
+		double jitter;
+		/** Duracin del frame ms corto y del ms largo. */
+		unsigned long long minFrameTime;
+		unsigned long long maxFrameTime;
+		/** Frames que han terminado despus de su hora de comienzo del siguiente. */
+		unsigned int lateFrames;
+		/** Pasos de tick fijo descartados por superar el mximo de recuperacin. */
+		unsigned int droppedSteps;
+		/**
+		Tiempo de trabajo medio y mximo de un frame: lo que va de beginFrame
+		a endFrame, sin contar la espera hasta el siguiente frame.
+		*/
+		double meanWorkTime;
+		unsigned long long maxWorkTime;
+
+		TSchedulerStats() : frames(0), meanFrameTime(0), jitter(0), minFrameTime(0), maxFrameTime(0),
+							lateFrames(0), droppedSteps(0), meanWorkTime(0), maxWorkTime(0) { }
+	};
+
+	/**
+	Planificador del bucle principal de la aplicacin. Es la nica fuente de
+	tiempo de la simulacin: mide cada frame con microsegundos, acumula el
+	tiempo y decide cuntos pasos de tick fijo hay que dar. La lgica y la
+	fsica reciben ese mismo nmero de pasos, as que sus ticks fijos siempre
+	avanzan a la par (la fsica subdivide cada paso en los suyos).
+	<p>
+	Uso desde el bucle principal:
+
+	<pre>
+	scheduler.beginFrame();
+	tick( scheduler.getFrameDuration() );	// getFixedSteps() pasos fijos
+	scheduler.endFrame();					// duerme hasta el siguiente frame
+	</pre>
+
+	Si hay una frecuencia de frames fijada, endFrame duerme el tiempo que
+	sobra del frame y solo gira en el ltimo tramo (por debajo del umbral de
+	giro), que es donde la precisin del sleep del sistema no llega.
+	<p>
+	Para no entrar en la espiral de la muerte (cada frame lento acumula ms
+	pasos fijos, que hacen el siguiente frame an ms lento) el nmero de
+	pasos de un frame est limitado; el tiempo que sobra se descarta.
+
+	@ingroup applicationGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	class CTickScheduler
+	{
+	public:
+		/**
+		Constructor de la clase. Por defecto el paso fijo es de 16 ms, el
+		nmero de frames por segundo no est limitado y se recuperan como
+		mucho 4 pasos fijos por frame.
+		*/
+		CTickScheduler();
+
+		/**
+		Destructor
+		*/
+		~CTickScheduler();
+
+		/**
+		Fija la duracin de un paso del tick fijo.
+
+		@param msecs Milisegundos de cada paso.
+		*/
+		void setFixedTimeStep(unsigned int msecs);
+
+		/** Devuelve los milisegundos de cada paso del tick fijo. */
+		unsigned int getFixedTimeStep() const { return _fixedTimeStep; }
+
+		/**
+		Fija la frecuencia del bucle principal.
+
+		@param hz Frames por segundo. 0 para no limitarla (endFrame no espera).
+		*/
+		void setFrameRate(unsigned int hz);
+
+		/**
+		Fija el mximo de pasos fijos que se dan en un frame.
+
+		@param steps Mximo de pasos. El tiempo acumulado que no quepa se
+		descarta.
+		*/
+		void setMaxCatchUpSteps(unsigned int steps) { _maxCatchUpSteps = steps; }
+
+		/**
+		Fija a partir de cuntos microsegundos de espera se deja de dormir y
+		se gira hasta el comienzo del siguiente frame.
+
+		@param usecs Umbral en microsegundos.
+		*/
+		void setSpinThreshold(unsigned int usecs) { _spinThreshold = usecs; }
+
+		/**
+		Hace que cada frame simule un tiempo fijo en lugar del que mide el
+		reloj. Sirve para ejecutar la simulacin tan rpido como se pueda (por
+		ejemplo al reproducir una grabacin) sin que cambie el resultado; las
+		estadsticas siguen midiendo el tiempo real de cada frame.
+
+		@param usecs Microsegundos que simula cada frame. 0 para usar el reloj.
+		*/
+		void setSimulatedFrameTime(unsigned int usecs) { _simulatedFrameTime = usecs; }
+
+		/**
+		Vuelve a empezar a contar desde este momento, descartando el tiempo
+		acumulado. Se usa al arrancar el bucle y tras los cambios de estado,
+		para que lo que tarde la carga no se convierta en pasos de simulacin.
+		*/
+		void reset();
+
+		/**
+		Comienza un frame: mide el tiempo transcurrido desde el anterior y
+		calcula los pasos fijos que corresponden.
+		*/
+		void beginFrame();
+
+		/**
+		Termina el frame: si hay frecuencia fijada espera hasta la hora de
+		comienzo del siguiente.
+		*/
+		void endFrame();
+
+		/**
+		Devuelve los milisegundos que ha durado el ltimo frame. Se lleva la
+		cuenta en microsegundos, as que la suma de los frames no deriva.
+		*/
+		unsigned int getFrameDuration() const { return _frameDuration; }
+
+		/** Devuelve los microsegundos que simula el frame actual. */
+		unsigned long long getFrameTime() const { return _frameTime; }
+
+		/** Devuelve los pasos de tick fijo que hay que dar en este frame. */
+		unsigned int getFixedSteps() const { return _fixedSteps; }
+
+		/**
+		Devuelve la fraccin de paso fijo que queda acumulada, entre 0 y 1.
+		Sirve para interpolar entre los dos ltimos pasos al pintar.
+		*/
+		float getInterpolation() const { return (float)_accumulator / (_fixedTimeStep * 1000); }
+
+		/** Devuelve los microsegundos que lleva funcionando el planificador. */
+		unsigned long long getMicroseconds() const { return _clock.getMicroseconds(); }
+
+		/** Devuelve los microsegundos transcurridos desde el comienzo del frame actual. */
+		unsigned long long getFrameElapsed() const { return _clock.getMicroseconds() - _frameStart; }
+
+		/** Devuelve las estadsticas de los frames desde la ltima llamada a resetStats. */
+		TSchedulerStats getStats() const;
+
+		/** Pone a cero las estadsticas. */
+		void resetStats();
+
+	private:
+
+		/** Reloj con el que se mide todo. */
+		CHighResolutionClock _clock;
+
+		/** Milisegundos de cada paso fijo. */
+		unsigned int _fixedTimeStep;
+
+		/** Duracin de un frame en microsegundos (0 si no est limitada). */
+		unsigned long long _framePeriod;
+
+		/** Mximo de pasos fijos por frame. */
+		unsigned int _maxCatchUpSteps;
+
+		/** Espera por debajo de la cual ya no se duerme. */
+		unsigned int _spinThreshold;
+
+		/** Tiempo fijo que simula cada frame (0 si se usa el reloj). */
+		unsigned int _simulatedFrameTime;
+
+		/** Tiempo simulado desde la creacin del planificador. */
+		unsigned long long _simulationTime;
+
+		/** Microsegundos que simula el frame actual. */
+		unsigned long long _frameTime;
+
+		/** Comienzo del frame actual. */
+		unsigned long long _frameStart;
+
+		/** Hora a la que tiene que empezar el siguiente frame. */
+		unsigned long long _nextFrame;
+
+		/** Microsegundos acumulados que no llegan a un paso fijo. */
+		unsigned long long _accumulator;
+
+		/** Milisegundos y pasos fijos del frame actual. */
+		unsigned int _frameDuration;
+		unsigned int _fixedSteps;
+
+		/** Sumas para las estadsticas. */
+		unsigned int _statFrames;
+		double _statSum;
+		double _statSumSquares;
+		unsigned long long _statMin;
+		unsigned long long _statMax;
+		unsigned int _statLateFrames;
+		unsigned int _statDroppedSteps;
+		unsigned int _statWorkFrames;
+		double _statWorkSum;
+		unsigned long long _statWorkMax;
+
+	}; // CTickScheduler
+
+} // namespace Application
+
+#endif //  __Application_TickScheduler_H
@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------
+// NullServer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file NullServer.cpp
+
+Contiene una implementacin de Audio::CServer que no reproduce nada. La
+compila el servidor dedicado en lugar de Server.cpp, de forma que no
+necesita FMOD ni dispositivo de audio. La lgica usa el servidor igual
+que en el cliente.
+
+@see Audio::CServer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "Server.h"
+
+#include <cassert>
+
+namespace Audio
+{
+	CServer *CServer::_instance = 0;
+
+	CServer::CServer() : _system(NULL), _audioResourcesPath("media/audio/") {
+		assert(!_instance && "Segunda inicializacin de Audio::CServer no permitida!");
+
+		_volume				= 0.5f;
+		_doppler			= 1.0f;
+		_rolloff			= 1.0f;
+		_soundAvatar		= NULL;
+		_playerHeight		= 8;
+		_isMute				= true;
+		_instance			= this;
+		_minimumExecuteTime	= 100;
+		_timeToExecute		= 0;
+	} // CServer
+
+	//--------------------------------------------------------
+
+	CServer::~CServer() {
+		assert(_instance);
+
+		_instance = 0;
+
+	} // ~CServer
+
+	//--------------------------------------------------------
+
+	bool CServer::Init() {
+		assert(!_instance && "Segunda inicializacin de Audio::CServer no permitida!");
+
+		new CServer();
+
+		if ( !_instance->open() ) {
+			Release();
+			return false;
+		}
+
+		return true;
+	} // Init
+
+	//--------------------------------------------------------
+
+	void CServer::Release() {
+		if(_instance) {
+			_instance->close();
+			delete _instance;
+		}
+
+	} // Release
+
+	//--------------------------------------------------------
+
+	bool CServer::open() {
+		return true;
+	} // open
+
+	//--------------------------------------------------------
+
+	void CServer::close() {
+		_soundAvatar = NULL;
+	} // close
+
+	//--------------------------------------------------------
+
+	void CServer::tick(unsigned int msecs) {
+		// Nada que actualizar
+	} // tick
+
+	//--------------------------------------------------------
+
+	void CServer::ERRCHECK(FMOD_RESULT result) {
+		// Sin FMOD no hay errores que comprobar
+	} // ERRCHECK
+
+	//--------------------------------------------------------
+
+	unsigned int CServer::playSound(const std::string& soundName, bool loopSound, bool streamSound, Logic::IAudioListener* userData) {
+		return 0;
+	} // playSound
+
+	//--------------------------------------------------------
+
+	unsigned int CServer::playSound3D(const std::string& soundName, const Vector3& position, const Vector3& speed, bool loopSound, bool streamSound, Logic::IAudioListener* userData) {
+		return 0;
+	} // playSound3D
+
+	//--------------------------------------------------------
+
+	void CServer::stopSound(int channelIndex) {
+		// Nada que parar
+	} // stopSound
+
+	//--------------------------------------------------------
+
+	void CServer::stopAllSounds() {
+		// Nada que parar
+	} // stopAllSounds
+
+	//--------------------------------------------------------
+
+	void CServer::mute() {
+		// Siempre esta en silencio
+	} // mute
+
+	//--------------------------------------------------------
+
+	void CServer::createCRCTable(const std::string& rootDirectory) {
+		// Los mensajes de audio solo se traducen en los clientes
+	} // createCRCTable
+
+	//--------------------------------------------------------
+
+	std::string CServer::translateCRC(int CRC) {
+		return "";
+	} // translateCRC
+
+	//--------------------------------------------------------
+
+	void CServer::update3DAttributes(int channelIndex, const Vector3& position, const Vector3& speed) {
+		// Nada que actualizar
+	} // update3DAttributes
+
+} // namespace Audio
@@ -117,7 +117,7 @@ namespace Audio
 			_timeToExecute = 0;
 			//Si hay un player con el que actualizarnos, seteamos la nueva posicin
 			if(_soundAvatar) {
-				Logic::CAvatarController* avatarCont = _soundAvatar->getComponent<Logic::CAvatarController>("CAvatarController");
+				Logic::CAvatarController* avatarCont = _soundAvatar->getComponent<Logic::CAvatarController>();
 				Vector3 momentum = avatarCont != NULL ? avatarCont->getMomentum() : Vector3::ZERO;
 
 				Vector3 positionAvatar	=_soundAvatar->getPosition();
@@ -0,0 +1,367 @@
+//---------------------------------------------------------------------------
+// NullServer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file NullServer.cpp
+
+Contiene una implementacin de GUI::CServer que no pinta nada, junto con
+las partes de Hikari que usan la lgica y este servidor. La compila el
+servidor dedicado en lugar de GUI/Server.cpp y de la biblioteca Hikari,
+de forma que no necesita ni el control de Flash ni ventana.
+<p>
+Los layouts son Hikari::FlashControl de verdad, as que la lgica los
+puede guardar y llamar como en el cliente; simplemente no hacen nada.
+Los argumentos (Hikari::FlashValue) y las posiciones (Hikari::Position)
+se compilan directamente de los fuentes de Hikari, que no dependen de
+Flash.
+
+@see GUI::CServer
+@see Hikari::FlashControl
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "Server.h"
+
+#include <cassert>
+#include "Hikari.h"
+#include "FlashControl.h"
+#include "FlashValue.h"
+
+namespace Hikari {
+
+	HikariManager* HikariManager::instance = 0;
+
+	//--------------------------------------------------------
+
+	HikariManager::HikariManager(const std::string& assetsDirectory) : flashLib(0), basePath(assetsDirectory),
+																	   keyboardHook(0), focusedControl(0),
+																	   mouseXPos(0), mouseYPos(0),
+																	   mouseButtonRDown(false), zOrderCounter(1)
+	{
+		instance = this;
+
+	} // HikariManager
+
+	//--------------------------------------------------------
+
+	HikariManager::~HikariManager()
+	{
+		destroyAllControls();
+		instance = 0;
+
+	} // ~HikariManager
+
+	//--------------------------------------------------------
+
+	FlashControl* HikariManager::createFlashOverlay(const Ogre::String& name, Ogre::Viewport* viewport, int width, int height, const Position& position, Ogre::ushort zOrder)
+	{
+		assert(controls.find(name) == controls.end() && "Ya existe un control de Flash con este nombre");
+
+		FlashControl* control = new FlashControl(name, width, height);
+		controls[name] = control;
+
+		return control;
+
+	} // createFlashOverlay
+
+	//--------------------------------------------------------
+
+	void HikariManager::destroyFlashControl(FlashControl* controlToDestroy)
+	{
+		ControlMap::iterator it = controls.find(controlToDestroy->getName());
+		if(it != controls.end())
+		{
+			delete it->second;
+			controls.erase(it);
+		}
+
+	} // destroyFlashControl
+
+	//--------------------------------------------------------
+
+	void HikariManager::destroyAllControls()
+	{
+		for(ControlMap::iterator it = controls.begin(); it != controls.end(); ++it)
+			delete it->second;
+
+		controls.clear();
+
+	} // destroyAllControls
+
+	//--------------------------------------------------------
+
+	void HikariManager::update()
+	{
+		// Nada que pintar
+
+	} // update
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	FlashControl::FlashControl(const Ogre::String& name, int width, int height) : site(0), handler(0), flashInterface(0),
+																				  oleObject(0), windowlessObject(0),
+																				  name(name), width(width), height(height),
+																				  state(0), comCount(0),
+																				  mainContext(0), altContext(0),
+																				  mainBitmap(0), altBitmap(0),
+																				  mainBuffer(0), altBuffer(0),
+																				  renderBuffer(0), usingAlphaHack(false),
+																				  isClean(true), isTotallyDirty(false),
+																				  overlay(0), texWidth(0), texHeight(0),
+																				  texDepth(0), texPitch(0), texUnit(0),
+																				  compensateNPOT(false), isTransparent(false),
+																				  isDraggable(false), isIgnoringTransparent(false),
+																				  transThreshold(0), okayToDelete(true)
+	{
+		// Nada que crear
+
+	} // FlashControl
+
+	//--------------------------------------------------------
+
+	FlashControl::~FlashControl()
+	{
+		// Nada que liberar
+
+	} // ~FlashControl
+
+	//--------------------------------------------------------
+
+	void FlashControl::load(const Ogre::String& movieFilename) { }
+	void FlashControl::play() { }
+	void FlashControl::stop() { }
+	void FlashControl::rewind() { }
+	void FlashControl::gotoFrame(long frameNum) { }
+	void FlashControl::setLoop(bool shouldLoop) { }
+	void FlashControl::setQuality(short renderQuality) { }
+	void FlashControl::setScaleMode(short scaleMode) { }
+	void FlashControl::hide() { }
+	void FlashControl::show() { }
+	void FlashControl::setOpacity(Ogre::Real opacity) { }
+	void FlashControl::focus() { }
+	void FlashControl::move(int deltaX, int deltaY) { }
+	void FlashControl::injectMouseMove(int xPos, int yPos) { }
+	void FlashControl::injectMouseDown(int xPos, int yPos) { }
+	void FlashControl::injectMouseUp(int xPos, int yPos) { }
+	void FlashControl::injectMouseWheel(int relScroll, int xPos, int yPos) { }
+	void FlashControl::loadResource(Ogre::Resource* resource) { }
+
+	//--------------------------------------------------------
+
+	void FlashControl::setTransparent(bool isTransparent, bool useAlphaHack)
+	{
+		this->isTransparent = isTransparent;
+
+	} // setTransparent
+
+	//--------------------------------------------------------
+
+	void FlashControl::setDraggable(bool isDraggable)
+	{
+		this->isDraggable = isDraggable;
+
+	} // setDraggable
+
+	//--------------------------------------------------------
+
+	void FlashControl::setIgnoreTransparentPixels(bool shouldIgnore, Ogre::Real threshold)
+	{
+		isIgnoringTransparent = shouldIgnore;
+		transThreshold = threshold;
+
+	} // setIgnoreTransparentPixels
+
+	//--------------------------------------------------------
+
+	const Ogre::String& FlashControl::getName() const
+	{
+		return name;
+
+	} // getName
+
+	//--------------------------------------------------------
+
+	const Ogre::String& FlashControl::getMaterialName() const
+	{
+		return materialName;
+
+	} // getMaterialName
+
+	//--------------------------------------------------------
+
+	void FlashControl::bind(const Ogre::DisplayString& funcName, const FlashDelegate& callback)
+	{
+		delegateMap[funcName] = callback;
+
+	} // bind
+
+	//--------------------------------------------------------
+
+	void FlashControl::unbind(const Ogre::DisplayString& funcName)
+	{
+		delegateMap.erase(funcName);
+
+	} // unbind
+
+	//--------------------------------------------------------
+
+	FlashValue FlashControl::callFunction(Ogre::DisplayString funcName, const Arguments& args)
+	{
+		return FLASH_VOID;
+
+	} // callFunction
+
+	//--------------------------------------------------------
+
+	bool FlashControl::getVisibility() const
+	{
+		return false;
+
+	} // getVisibility
+
+	//--------------------------------------------------------
+
+	void FlashControl::getExtents(unsigned short &width, unsigned short &height) const
+	{
+		width = this->width;
+		height = this->height;
+
+	} // getExtents
+
+	//--------------------------------------------------------
+
+	void FlashControl::getUVScale(Ogre::Real &uScale, Ogre::Real &vScale) const
+	{
+		uScale = vScale = 1;
+
+	} // getUVScale
+
+} // namespace Hikari
+
+namespace GUI {
+
+	CServer* CServer::_instance = 0;
+
+	//--------------------------------------------------------
+
+	CServer::CServer() : _manager(0)
+	{
+		_instance = this;
+	} // CServer
+
+	//--------------------------------------------------------
+
+	CServer::~CServer()
+	{
+		_instance = 0;
+
+	} // ~CServer
+
+	//--------------------------------------------------------
+
+	bool CServer::Init()
+	{
+		assert(!_instance && "Segunda inicializacin de GUI::CServer no permitida!");
+
+		new CServer();
+
+		if (!_instance->open())
+		{
+			Release();
+			return false;
+		}
+
+		return true;
+
+	} // Init
+
+	//--------------------------------------------------------
+
+	void CServer::Release()
+	{
+		assert(_instance && "GUI::CServer no est inicializado!");
+
+		if(_instance)
+		{
+			_instance->close();
+			delete _instance;
+		}
+
+	} // Release
+
+	//--------------------------------------------------------
+
+	bool CServer::open()
+	{
+		// En el cliente el gestor de Hikari es de BaseSubsystems
+		_manager = new Hikari::HikariManager();
+		return true;
+
+	} // open
+
+	//--------------------------------------------------------
+
+	void CServer::close()
+	{
+		delete _manager;
+		_manager = 0;
+
+	} // close
+
+	//________________________________________________________________________
+
+	Hikari::FlashControl* CServer::addLayout(const std::string& layoutName, Hikari::Position pos, unsigned int width, unsigned int height, unsigned short zOrder) {
+		return _manager->createFlashOverlay(layoutName, 0, width, height, pos, zOrder);
+	}
+
+	//________________________________________________________________________
+
+	Hikari::FlashControl* CServer::addLayout(const std::string& layoutName, Hikari::Position pos, float relativePos, unsigned short zOrder) {
+		return _manager->createFlashOverlay(layoutName, 0, 0, 0, pos, zOrder);
+	}
+
+	//________________________________________________________________________
+
+	Hikari::FlashControl* CServer::addLayout(const std::string& layoutName, Hikari::Position pos, unsigned short zOrder) {
+		return _manager->createFlashOverlay(layoutName, 0, 0, 0, pos, zOrder);
+	}
+
+	//________________________________________________________________________
+
+	Hikari::FlashControl* CServer::addLayoutToState(Application::CApplicationState* state,
+		const std::string& layoutName, Hikari::Position pos) {
+
+		return _manager->createFlashOverlay(layoutName, 0, 0, 0, pos, 1);
+	}
+
+	//________________________________________________________________________
+
+	void CServer::destroyLayout(Hikari::FlashControl* overlay){
+		_manager->destroyFlashControl(overlay);
+	}
+
+	//________________________________________________________________________
+
+	void CServer::addButtonToLayout( Application::CApplicationState* state,
+		const std::string& layoutName,  const std::string& buttonName,
+		bool (*buttonFunction)(const GUIEventArgs&) ) {
+
+	} // addButtonToLayout
+
+	//________________________________________________________________________
+
+	bool CServer::activateGUI(Application::CApplicationState* state,
+		const std::string& layoutName) {
+
+		return true;
+	} // activateGUI
+
+	void CServer::tick(){
+		_manager->update();
+	}
+
+} // namespace GUI
@@ -0,0 +1,864 @@
+//---------------------------------------------------------------------------
+// NullServer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file NullServer.cpp
+
+Contiene una implementacin de Graphics::CServer y de las clases grficas
+que usa la lgica en la que nada se pinta. La compila el servidor
+dedicado en lugar del resto de ficheros de Graphics, de forma que no
+necesita ventana, tarjeta grfica ni Particle Universe.
+<p>
+Las escenas y entidades mantienen su estado (a qu escena pertenece cada
+entidad, si est cargada, su nombre...) igual que en el cliente, de forma
+que la lgica los crea, los aade y los destruye sin preguntar si hay
+grficos. Lo que depende de Ogre devuelve valores neutros: posiciones
+nulas, orientaciones identidad y punteros a Ogre a NULL.
+
+@see Graphics::CServer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "Server.h"
+#include "Scene.h"
+#include "Camera.h"
+#include "Entity.h"
+#include "AnimatedEntity.h"
+#include "StaticEntity.h"
+#include "Light.h"
+#include "Overlay.h"
+#include "Plane.h"
+#include "PUParticle.h"
+#include "Billboard.h"
+#include "Movable2dText.h"
+
+#include <assert.h>
+#include <sstream>
+
+namespace Graphics
+{
+	CServer *CServer::_instance = 0;
+
+	CServer::CServer() : _root(0), _renderWindow(0), _activeScene(0), _dummyScene(0), _overlayManager(0)
+	{
+		assert(!_instance && "Segunda inicializacin de Graphics::CServer no permitida!");
+
+		_instance = this;
+
+	} // CServer
+
+	//--------------------------------------------------------
+
+	CServer::~CServer()
+	{
+		assert(_instance);
+
+		_instance = 0;
+
+	} // ~CServer
+
+	//--------------------------------------------------------
+
+	bool CServer::Init()
+	{
+		assert(!_instance && "Segunda inicializacin de Graphics::CServer no permitida!");
+
+		new CServer();
+
+		if (!_instance->open())
+		{
+			Release();
+			return false;
+		}
+
+		return true;
+
+	} // Init
+
+	//--------------------------------------------------------
+
+	void CServer::Release()
+	{
+		if(_instance)
+		{
+			_instance->close();
+			delete _instance;
+		}
+
+	} // Release
+
+	//--------------------------------------------------------
+
+	bool CServer::open()
+	{
+		// Sin ventana ni Ogre::Root; la escena dummy se crea igualmente para
+		// que siempre haya una escena activa
+		_dummyScene = createScene("dummy_scene");
+		setScene(_dummyScene);
+
+		return true;
+
+	} // open
+
+	//--------------------------------------------------------
+
+	void CServer::close()
+	{
+		if(_activeScene)
+		{
+			_activeScene->deactivate();
+			_activeScene = 0;
+		}
+		while(!_scenes.empty())
+		{
+			removeScene(_scenes.begin());
+		}
+
+	} // close
+
+	//--------------------------------------------------------
+
+	typedef std::pair<std::string,CScene*> TStringScenePar;
+
+	CScene* CServer::createScene(const std::string& name)
+	{
+		assert(_scenes.find(name)==_scenes.end() &&
+			"Ya se ha creado una escena con este nombre.");
+
+		CScene *scene = new CScene(name);
+		TStringScenePar ssp(name,scene);
+		_scenes.insert(ssp);
+
+		return scene;
+
+	} // createScene
+
+	//--------------------------------------------------------
+
+	void CServer::removeScene(CScene* scene)
+	{
+		if(_activeScene == scene)
+			_activeScene = 0;
+		_scenes.erase(scene->getName());
+		delete scene;
+
+	} // removeScene
+
+	//--------------------------------------------------------
+
+	void CServer::removeScene(const std::string& name)
+	{
+		CScene* scene = (*_scenes.find(name)).second;
+		removeScene(scene);
+
+	} // removeScene
+
+	//--------------------------------------------------------
+
+	void CServer::removeScene(TScenes::const_iterator iterator)
+	{
+		CScene* scene = (*iterator).second;
+		if(_activeScene == scene)
+			_activeScene = 0;
+		_scenes.erase(iterator);
+		delete scene;
+
+	} // removeScene
+
+	//--------------------------------------------------------
+
+	void CServer::setScene(CScene* scene)
+	{
+		if(_activeScene)
+			_activeScene->deactivate();
+
+		if(scene)
+		{
+			assert((*_scenes.find(scene->getName())).second == scene &&
+				"Esta escena no pertenece al servidor");
+
+			_activeScene = scene;
+		}
+		else
+			_activeScene = _dummyScene;
+
+		_activeScene->activate();
+
+	} // setScene
+
+	//--------------------------------------------------------
+
+	void CServer::setScene(const std::string& name)
+	{
+		if(_activeScene)
+			_activeScene->deactivate();
+
+		assert(_scenes.find(name) != _scenes.end() &&
+			"No existe una escena con este nombre.");
+
+		_activeScene = (*_scenes.find(name)).second;
+		_activeScene->activate();
+
+	} // setScene
+
+	//--------------------------------------------------------
+
+	COverlay* CServer::createOverlay(const std::string &name, CScene* scene, const std::string &type) {
+		return new COverlay(name, scene, type);
+	} // createOverlay
+
+	//--------------------------------------------------------
+
+	COverlay* CServer::getOverlay(const std::string& name) {
+		return 0;
+	} // getOverlay
+
+	//--------------------------------------------------------
+
+	int CServer::getWidth() {
+		return 0;
+	} // getWidth
+
+	//--------------------------------------------------------
+
+	int CServer::getHeight() {
+		return 0;
+	} // getHeight
+
+	//--------------------------------------------------------
+
+	void CServer::tick(float secs)
+	{
+		if(_activeScene != _dummyScene)
+			_activeScene->tick(secs);
+
+	} // tick
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CScene::CScene(const std::string& name) : _root(0), _viewport(0), _sceneMgr(0), _directionalLight(0),
+											  _staticGeometry(0), _glowMaterialListener(0), _compositorManager(0),
+											  _poolParticle(0), _motionBlur(0), _volumetricLight(0)
+	{
+		_name = name;
+		_camera = new CCamera(name,this);
+
+	} // CScene
+
+	//--------------------------------------------------------
+
+	CScene::~CScene()
+	{
+		delete _camera;
+
+	} // ~CScene
+
+	//--------------------------------------------------------
+
+	bool CScene::addEntity(CEntity* entity)
+	{
+		if(!entity->attachToScene(this))
+			return false;
+		_dynamicEntities.push_back(entity);
+		return true;
+
+	} // addEntity
+
+	//--------------------------------------------------------
+
+	bool CScene::addStaticEntity(CStaticEntity* entity)
+	{
+		if(!entity->attachToScene(this))
+			return false;
+		_staticEntities.push_back(entity);
+		return true;
+
+	} // addStaticEntity
+
+	//--------------------------------------------------------
+
+	void CScene::removeEntity(CEntity* entity)
+	{
+		entity->deattachFromScene();
+		_dynamicEntities.remove(entity);
+
+	} // removeEntity
+
+	//--------------------------------------------------------
+
+	void CScene::removeStaticEntity(CStaticEntity* entity)
+	{
+		entity->deattachFromScene();
+		_staticEntities.remove(entity);
+
+	} // removeStaticEntity
+
+	//--------------------------------------------------------
+
+	void CScene::activate()
+	{
+		// Sin viewport ni compositores
+
+	} // activate
+
+	//--------------------------------------------------------
+
+	void CScene::deactivate()
+	{
+		// Sin viewport ni compositores
+
+	} // deactivate
+
+	//--------------------------------------------------------
+
+	void CScene::tick(float secs)
+	{
+		TEntityList::const_iterator it = _dynamicEntities.begin();
+		TEntityList::const_iterator end = _dynamicEntities.end();
+		for(; it != end; it++)
+			(*it)->tick(secs);
+
+	} // tick
+
+	//--------------------------------------------------------
+
+	void CScene::changeAmbientLight(Vector3 Light) { }
+
+	//--------------------------------------------------------
+
+	void CScene::buildStaticGeometry()
+	{
+		// No hay geometra que construir
+
+	} // buildStaticGeometry
+
+	//--------------------------------------------------------
+
+	void CScene::createSceneNode(const std::string &nameSceneNode) { }
+
+	//--------------------------------------------------------
+
+	Ogre::SceneNode* CScene::getSceneNode(const std::string &nameSceneNode) {
+		return 0;
+	} // getSceneNode
+
+	//--------------------------------------------------------
+
+	CParticle * CScene::createParticle(const std::string &particleName, const Vector3 &position) {
+		return 0;
+	} // createParticle
+
+	//--------------------------------------------------------
+
+	CParticle * CScene::createParticle(const std::string &particleName, const Vector3 &position, const Vector3 &directionWithForce) {
+		return 0;
+	} // createParticle
+
+	//--------------------------------------------------------
+
+	void CScene::changeVisibilityParticle(const std::string nameParticle, bool visibility) { }
+
+	//--------------------------------------------------------
+
+	void CScene::createCompositor(const std::string &name) { }
+	void CScene::setCompositorVisible(const std::string &name, bool visible) { }
+	void CScene::destroyCompositor(const std::string &name) { }
+	void CScene::updateCompositorVariable(const std::string &name, const std::string &variable, const float &value) { }
+
+	//--------------------------------------------------------
+
+	bool CScene::getCompositorVisible(const std::string &name) {
+		return false;
+	} // getCompositorVisible
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CCamera::CCamera(const std::string &name, CScene *scene) : _cameraNode(0), _camera(0), _scene(scene)
+	{
+		_name = name;
+		_defaultFov = (Math::PI/2)*0.89;
+
+	} // CCamera
+
+	//--------------------------------------------------------
+
+	CCamera::~CCamera()
+	{
+		// Nada que liberar
+
+	} // ~CCamera
+
+	//--------------------------------------------------------
+
+	const Vector3 &CCamera::getCameraPosition() {
+		return Vector3::ZERO;
+	} // getCameraPosition
+
+	//--------------------------------------------------------
+
+	const Quaternion &CCamera::getCameraOrientation() {
+		return Quaternion::IDENTITY;
+	} // getCameraOrientation
+
+	//--------------------------------------------------------
+
+	const Vector3& CCamera::getCameraDirection() {
+		return Vector3::ZERO;
+	} // getCameraDirection
+
+	//--------------------------------------------------------
+
+	const Quaternion& CCamera::getRealOrientation() {
+		return Quaternion::IDENTITY;
+	} // getRealOrientation
+
+	//--------------------------------------------------------
+
+	void CCamera::setCameraPosition(const Vector3 &newPosition) { }
+	void CCamera::setCameraDirection(const Vector3& direction) { }
+	void CCamera::setOrientation(const Quaternion& orientation) { }
+	void CCamera::rollCamera(float fRadian) { }
+	void CCamera::lookAt(const Vector3& position) { }
+	void CCamera::restartCamera() { }
+	void CCamera::setFov(float radianAngle) { }
+	void CCamera::resetFov() { }
+
+	//--------------------------------------------------------
+
+	Graphics::CEntity* CCamera::addEntityChild(const std::string &nameEntity, const std::string &nameMesh, Vector3 position) {
+		Graphics::CEntity* entity = new CEntity(nameEntity, nameMesh);
+		entity->setScene(_scene);
+
+		return entity;
+	} // addEntityChild
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CEntity::CEntity(const std::string &name, const std::string &mesh)
+		: _entity(0), _entityNode(0), _scene(0), _loaded(false)
+	{
+		_name = name;
+		_mesh = mesh;
+
+	} // CEntity
+
+	//--------------------------------------------------------
+
+	CEntity::~CEntity()
+	{
+		if(_scene){
+			unload();
+			_scene = 0;
+		}
+
+	} // ~CEntity
+
+	//--------------------------------------------------------
+
+	bool CEntity::attachToScene(CScene *scene)
+	{
+		assert(scene && "La entidad debe asociarse a una escena!!");
+
+		if(_loaded && (_scene != scene))
+			return false;
+
+		if (!_loaded)
+		{
+			_scene = scene;
+			return load();
+		}
+
+		return true;
+
+	} // attachToScene
+
+	//--------------------------------------------------------
+
+	bool CEntity::deattachFromScene()
+	{
+		if(!_loaded)
+			return false;
+		else
+		{
+			assert(_scene && "La entidad debe estar asociada a una escena!!");
+			unload();
+			_scene = 0;
+		}
+
+		return true;
+
+	} // deattachFromScene
+
+	//--------------------------------------------------------
+
+	bool CEntity::load()
+	{
+		// No hay malla que cargar
+		return _loaded = true;
+
+	} // load
+
+	//--------------------------------------------------------
+
+	void CEntity::unload()
+	{
+		_loaded = false;
+
+	} // unload
+
+	//--------------------------------------------------------
+
+	void CEntity::tick(float secs) { }
+
+	//--------------------------------------------------------
+
+	void CEntity::setTransform(const Vector3 &position, const Ogre::Quaternion &orientation) { }
+	void CEntity::setOrientation(const Quaternion &orientation) { }
+	void CEntity::setLightMask(unsigned int lightMask) { }
+	void CEntity::setVisible(bool visible) { }
+	void CEntity::setPosition(const Vector3 &position) { }
+	void CEntity::setScale(const Vector3 &scale) { }
+	void CEntity::setScale(const float scale) { }
+	void CEntity::setRenderQueue(unsigned int index) { }
+	void CEntity::setVisibilityMask(unsigned int mask) { }
+	void CEntity::changeMaterial(const std::list<std::string>& materialName) { }
+	void CEntity::changeMaterial(const std::string & material) { }
+
+	//--------------------------------------------------------
+
+	Matrix4 CEntity::getTransform() {
+		return Matrix4::IDENTITY;
+	} // getTransform
+
+	//--------------------------------------------------------
+
+	const bool CEntity::getVisible() {
+		return false;
+	} // getVisible
+
+	//--------------------------------------------------------
+
+	const Vector3& CEntity::getPosition() {
+		return Vector3::ZERO;
+	} // getPosition
+
+	//--------------------------------------------------------
+
+	const Quaternion& CEntity::getOrientation() {
+		return Quaternion::IDENTITY;
+	} // getOrientation
+
+	//--------------------------------------------------------
+
+	unsigned int CEntity::getRenderQueue() {
+		return 0;
+	} // getRenderQueue
+
+	//--------------------------------------------------------
+
+	void CEntity::setOgreEntity(Ogre::Entity* entity) {
+		_entity = entity;
+	} // setOgreEntity
+
+	//--------------------------------------------------------
+
+	void CEntity::getMeshInformation(const Ogre::MeshPtr& mesh,size_t &vertex_count, Ogre::Vector3* &vertices,
+									 size_t &index_count, unsigned* &indices, const Ogre::Vector3 &position,
+									 const Ogre::Quaternion &orient, const Ogre::Vector3 &scale) {
+		vertex_count = index_count = 0;
+		vertices = NULL;
+		indices = NULL;
+	} // getMeshInformation
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	bool CAnimatedEntity::setAnimation(const std::string &anim, bool loop, int rewind, float fadeTime) {
+		return false;
+	} // setAnimation
+
+	//--------------------------------------------------------
+
+	bool CAnimatedEntity::stopAnimation(const std::string &anim) {
+		return false;
+	} // stopAnimation
+
+	//--------------------------------------------------------
+
+	void CAnimatedEntity::stopAllAnimations() { }
+	void CAnimatedEntity::tick(float secs) { }
+	void CAnimatedEntity::attachWeapon(CEntity &arma, unsigned int id) { }
+	void CAnimatedEntity::changeMaterialToWeapon(const std::string& materialName) { }
+	void CAnimatedEntity::freeBoneOrientation(const std::string &bone) { }
+	void CAnimatedEntity::lockBoneOrientation(const std::string &bone) { }
+	void CAnimatedEntity::moveBone(const std::string &bone, float pitch) { }
+	void CAnimatedEntity::notifyDirty() { }
+
+	//--------------------------------------------------------
+
+	std::string CAnimatedEntity::getWeaponMaterial() {
+		return "";
+	} // getWeaponMaterial
+
+	//--------------------------------------------------------
+
+	bool CAnimatedEntity::load() {
+		return CEntity::load();
+	} // load
+
+	//--------------------------------------------------------
+
+	Graphics::CBone CAnimatedEntity::getRootBone() const {
+		return CBone(NULL, NULL);
+	} // getRootBone
+
+	//--------------------------------------------------------
+
+	Graphics::CBone CAnimatedEntity::getBone(const std::string& boneName) const {
+		return CBone(NULL, NULL);
+	} // getBone
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	bool CStaticEntity::addToStaticGeometry() {
+		return true;
+	} // addToStaticGeometry
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CLight::CLight(LightType::Enum lightType, const Vector3& position, const Vector3& direction) : _light(NULL) { }
+
+	//--------------------------------------------------------
+
+	CLight::~CLight() { }
+
+	//--------------------------------------------------------
+
+	void CLight::setPosition(const Vector3& position) { }
+	void CLight::setDirection(const Vector3& direction) { }
+	void CLight::setOrientation(const Quaternion& rotation) { }
+	void CLight::setCastShadows(bool enabled) { }
+	void CLight::setColor(float r, float g, float b) { }
+	void CLight::setAttenuation(float Range, float Kc, float Kl, float Kq) { }
+	void CLight::setSpotLightParams(float innerAngle, float outerAngle) { }
+	void CLight::setGroup(unsigned int group) { }
+	void CLight::setStatic(bool isStatic) { }
+
+	//--------------------------------------------------------
+
+	Vector3 CLight::getDirection() {
+		return Vector3::ZERO;
+	} // getDirection
+
+	//--------------------------------------------------------
+
+	Vector3 CLight::getPosition() {
+		return Vector3::ZERO;
+	} // getPosition
+
+	//--------------------------------------------------------
+
+	std::string CLight::getName() {
+		return "";
+	} // getName
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	COverlay::COverlay(Ogre::Overlay* overlay) : _overlay(NULL), _overlayContainer(NULL), _overlayText(NULL), _scene(NULL) { }
+
+	//--------------------------------------------------------
+
+	COverlay::COverlay(Ogre::OverlayElement* overlay) : _overlay(NULL), _overlayContainer(NULL), _overlayText(NULL), _scene(NULL) { }
+
+	//--------------------------------------------------------
+
+	COverlay::COverlay(const std::string &name, CScene* scene, const std::string &type) : _type(type), _overlay(NULL),
+																						  _overlayContainer(NULL),
+																						  _overlayText(NULL),
+																						  _scene(scene) { }
+
+	//--------------------------------------------------------
+
+	COverlay::~COverlay() { }
+
+	//--------------------------------------------------------
+
+	void COverlay::setVisible(bool visible) { }
+	void COverlay::add2D(COverlay* overlayContainer) { }
+	void COverlay::add3D(Graphics::CParticle *particle, const Vector3 *position) { }
+	void COverlay::setPosition(float left, float top) { }
+	void COverlay::setDimensions(float width, float height) { }
+	void COverlay::setMetricsMode(std::string unit) { }
+	void COverlay::setMaterial(const std::string& material) { }
+	void COverlay::setText(const std::string& text) { }
+	void COverlay::setZBuffer(const int zBuffer) { }
+	void COverlay::setTextSize(const int textSize) { }
+	void COverlay::setFont(const std::string& font) { }
+	void COverlay::addChild(COverlay* child) { }
+	void COverlay::setRotation(float radianAngle) { }
+
+	//--------------------------------------------------------
+
+	bool COverlay::isVisible() {
+		return false;
+	} // isVisible
+
+	//--------------------------------------------------------
+
+	CEntity* COverlay::add3D(const std::string &name, const std::string &mesh, const Vector3 &position) {
+		return 0;
+	} // add3D
+
+	//--------------------------------------------------------
+
+	float COverlay::getWidth(std::string mode) {
+		return 0;
+	} // getWidth
+
+	//--------------------------------------------------------
+
+	float COverlay::getHeight(std::string mode) {
+		return 0;
+	} // getHeight
+
+	//--------------------------------------------------------
+
+	float COverlay::getPositionX(std::string mode) {
+		return 0;
+	} // getPositionX
+
+	//--------------------------------------------------------
+
+	float COverlay::getPositionY(std::string mode) {
+		return 0;
+	} // getPositionY
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CPlane::CPlane(CScene* scene, const std::string& name, const Vector3& position, const Vector3& orientation,
+				   float width, float height, unsigned int xSegments, unsigned int ySegments, float uTiling,
+				   float vTiling, const Vector3& upVector, const std::string& materialName, unsigned int lightMask,
+				   bool castShadows) : _entity(NULL), _sceneNode(NULL) { }
+
+	//--------------------------------------------------------
+
+	CPlane::~CPlane() { }
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	unsigned int PUParticle::_counter = 0;
+
+	//--------------------------------------------------------
+
+	PUParticle::PUParticle(const std::string& scriptName, Graphics::CEntity* parent) : _particleSystem(NULL),
+																						 _sceneNode(NULL),
+																						 _listener(NULL)
+	{
+		std::stringstream particleName;
+		particleName << scriptName;
+		particleName << _counter++;
+
+		_name = particleName.str();
+
+	} // PUParticle
+
+	//--------------------------------------------------------
+
+	PUParticle::~PUParticle() { }
+
+	//--------------------------------------------------------
+
+	void PUParticle::handleParticleSystemEvent(ParticleUniverse::ParticleSystem* particleSystem,
+											   ParticleUniverse::ParticleUniverseEvent& particleUniverseEvent) {
+		// No hay sistema que emita eventos
+	} // handleParticleSystemEvent
+
+	//--------------------------------------------------------
+
+	void PUParticle::start() { }
+	void PUParticle::start(float stopTime) { }
+	void PUParticle::startAndStopFade(float stopTime) { }
+	void PUParticle::stop() { }
+	void PUParticle::stop(float stopTime) { }
+	void PUParticle::stopFade(float stopTime) { }
+	void PUParticle::pause() { }
+	void PUParticle::pause(float pauseTime) { }
+	void PUParticle::resume() { }
+	void PUParticle::setPosition(const Vector3 &position) { }
+	void PUParticle::setDirection(const Vector3 &direction) { }
+	void PUParticle::setOrientation(const Quaternion &orientation) { }
+	void PUParticle::setVisible(bool visible) { }
+
+	//--------------------------------------------------------
+
+	Vector3 PUParticle::getPosition() {
+		return Vector3::ZERO;
+	} // getPosition
+
+	//--------------------------------------------------------
+
+	void PUParticle::addObserver(IObserver* observer) {
+		_observers.push_back(observer);
+	} // addObserver
+
+	//--------------------------------------------------------
+
+	void PUParticle::removeObserver(IObserver* observer) {
+		_observers.remove(observer);
+	} // removeObserver
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CBillboard::CBillboard() : _billboardSet(NULL), _billboard(NULL), _sceneNode(NULL) { }
+
+	//--------------------------------------------------------
+
+	CBillboard::~CBillboard() { }
+
+	//--------------------------------------------------------
+
+	void CBillboard::load(CScene* scene, CEntity* parent, const std::string& materialName, const Vector3& position, const Vector2& defaultDimensions) { }
+	void CBillboard::setVisible(bool isVisible) { }
+	void CBillboard::setPosition(const Vector3& position) { }
+
+	//--------------------------------------------------------
+
+	bool CBillboard::isVisible() {
+		return false;
+	} // isVisible
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CMovable2dText::CMovable2dText() { }
+
+	//--------------------------------------------------------
+
+	CMovable2dText::~CMovable2dText() { }
+
+	//--------------------------------------------------------
+
+	void CMovable2dText::load(CScene* scene, CEntity* parent, const Vector3& position, const std::string& text,
+							  const std::string& textFont, const Vector4& color, float textSize) { }
+	void CMovable2dText::setVisible(bool isVisible) { }
+	void CMovable2dText::setPosition(const Vector3& position) { }
+
+	//--------------------------------------------------------
+
+	bool CMovable2dText::isVisible() {
+		return false;
+	} // isVisible
+
+} // namespace Graphics
@@ -32,6 +32,26 @@ Contiene la implementaci
 
 using namespace std;
 
+namespace {
+
+	/**
+	Listener de Particle Universe que reenva los eventos a su PUParticle.
+	*/
+	class CPUParticleListener : public ParticleUniverse::ParticleSystemListener {
+	public:
+		CPUParticleListener(Graphics::PUParticle* particle) : _particle(particle) { }
+
+		virtual void handleParticleSystemEvent(ParticleUniverse::ParticleSystem* particleSystem,
+											   ParticleUniverse::ParticleUniverseEvent& particleUniverseEvent) {
+			_particle->handleParticleSystemEvent(particleSystem, particleUniverseEvent);
+		}
+
+	private:
+		Graphics::PUParticle* _particle;
+	};
+
+}
+
 namespace Graphics {
 	
 	unsigned int PUParticle::_counter = 0;
@@ -75,7 +95,8 @@ namespace Graphics {
 
 		// Nos registramos como observadores del sistema de particulas creado
 		// para que se nos notifique ante ciertos eventos
-		_particleSystem->addParticleSystemListener(this); // En general no vamos a necesitar hacer el remove
+		_listener = new CPUParticleListener(this);
+		_particleSystem->addParticleSystemListener(_listener); // En general no vamos a necesitar hacer el remove
 	}
 	
 	//______________________________________________________________________________
@@ -94,7 +115,8 @@ namespace Graphics {
 		//_sceneNode->detachObject(_particleSystem);
 		
 		// Nos desregistramos como listeners
-		_particleSystem->removeParticleSystemListener(this);
+		_particleSystem->removeParticleSystemListener(_listener);
+		delete _listener;
 
 		// Pedimos a particle universe que destruya el sistema de particulas
 		particleMgr->destroyParticleSystem(_name, sceneMgr);
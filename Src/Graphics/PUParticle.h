@@ -38,6 +38,7 @@ namespace Graphics {
 
 namespace ParticleUniverse {
 	class ParticleSystem;
+	class ParticleSystemListener;
 }
 
 namespace Graphics {
@@ -51,7 +52,7 @@ namespace Graphics {
 	@date Agosto, 2013
 	*/
 
-	class PUParticle : public ParticleUniverse::ParticleSystemListener {
+	class PUParticle {
 	public:
 
 		class IObserver {
@@ -73,8 +74,12 @@ namespace Graphics {
 		*/
 		~PUParticle();
 
-		virtual void handleParticleSystemEvent(ParticleUniverse::ParticleSystem* particleSystem, 
-											   ParticleUniverse::ParticleUniverseEvent& particleUniverseEvent);
+		/**
+		Avisa a los observadores de los eventos del sistema de partculas.
+		Lo llama el listener que registramos en Particle Universe.
+		*/
+		void handleParticleSystemEvent(ParticleUniverse::ParticleSystem* particleSystem, 
+									   ParticleUniverse::ParticleUniverseEvent& particleUniverseEvent);
 
 		void start();
 		void start(float stopTime);
@@ -138,6 +143,14 @@ namespace Graphics {
 		*/
 		Ogre::SceneNode *_sceneNode;
 
+		/**
+		Listener registrado en el sistema de partculas. No heredamos de
+		ParticleUniverse::ParticleSystemListener para que quien incluya esta
+		cabecera no necesite enlazar con Particle Universe (el servidor
+		dedicado, por ejemplo).
+		*/
+		ParticleUniverse::ParticleSystemListener* _listener;
+
 	private:
 
 		std::list<IObserver*> _observers;
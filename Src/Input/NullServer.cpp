@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------
+// NullServer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file NullServer.cpp
+
+Contiene implementaciones de Input::CInputManager e Input::CServer sin
+perifricos. Las compila el servidor dedicado en lugar de InputManager.cpp
+y Server.cpp, de forma que no necesita OIS ni Hikari. Los oyentes se
+registran igual que en el cliente, pero nunca reciben eventos.
+
+@see Input::CInputManager
+@see Input::CServer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "InputManager.h"
+#include "Server.h"
+#include "PlayerController.h"
+
+#include <cassert>
+
+namespace Input {
+
+	CInputManager *CInputManager::_instance = 0;
+
+	//--------------------------------------------------------
+
+	CInputManager::CInputManager() :
+		_mouse(0),
+		_keyboard(0),
+		_inputSystem(0)
+	{
+		assert(!_instance && "Segunda inicializacin de GUI::CInputManager no permitida!");
+		_instance = this;
+
+	} // CInputManager
+
+	//--------------------------------------------------------
+
+	CInputManager::~CInputManager()
+	{
+		assert(_instance);
+
+		_instance = 0;
+
+	} // ~CInputManager
+
+	//--------------------------------------------------------
+
+	bool CInputManager::Init()
+	{
+		assert(!_instance && "Segunda inicializacin de GUI::CInputManager no permitida!");
+
+		new CInputManager();
+
+		if (!_instance->open())
+		{
+			Release();
+			return false;
+		}
+
+		return true;
+
+	} // Init
+
+	//--------------------------------------------------------
+
+	void CInputManager::Release()
+	{
+		if(_instance)
+		{
+			_instance->close();
+			delete _instance;
+		}
+
+	} // Release
+
+	//--------------------------------------------------------
+
+	bool CInputManager::open()
+	{
+		return true;
+
+	} // open
+
+	//--------------------------------------------------------
+
+	void CInputManager::close()
+	{
+		removeAllListeners();
+
+	} // close
+
+	//--------------------------------------------------------
+
+	void CInputManager::tick(unsigned int msecs)
+	{
+		// No hay perifricos que leer
+
+	} // tick
+
+	//--------------------------------------------------------
+
+	void CInputManager::addKeyListener(CKeyboardListener *keyListener)
+	{
+		_keyListeners.push_front(keyListener);
+
+	} // addKeyListener
+
+	//--------------------------------------------------------
+
+	void CInputManager::addMouseListener(CMouseListener *mouseListener)
+	{
+		_mouseListeners.push_front(mouseListener);
+
+	} // addMouseListener
+
+	//--------------------------------------------------------
+
+	void CInputManager::removeKeyListener(CKeyboardListener *keyListener)
+	{
+		_keyListeners.remove(keyListener);
+
+	} // removeKeyListener
+
+	//--------------------------------------------------------
+
+	void CInputManager::removeMouseListener(CMouseListener *mouseListener)
+	{
+		_mouseListeners.remove(mouseListener);
+
+	} // removeMouseListener
+
+	//--------------------------------------------------------
+
+	void CInputManager::removeAllListeners()
+	{
+		_keyListeners.clear();
+		_mouseListeners.clear();
+
+	} // removeAllListeners
+
+	//--------------------------------------------------------
+
+	void CInputManager::removeAllKeyListeners()
+	{
+		_keyListeners.clear();
+
+	} // removeAllKeyListeners
+
+	//--------------------------------------------------------
+
+	void CInputManager::removeAllMouseListeners()
+	{
+		_mouseListeners.clear();
+
+	} // removeAllMouseListeners
+
+	//--------------------------------------------------------
+
+	bool CInputManager::keyPressed(const OIS::KeyEvent &e)
+	{
+		return true;
+
+	} // keyPressed
+
+	//--------------------------------------------------------
+
+	bool CInputManager::keyReleased(const OIS::KeyEvent &e)
+	{
+		return true;
+
+	} // keyReleased
+
+	//--------------------------------------------------------
+
+	bool CInputManager::mouseMoved(const OIS::MouseEvent &e)
+	{
+		return true;
+
+	} // mouseMoved
+
+	//--------------------------------------------------------
+
+	bool CInputManager::mousePressed(const OIS::MouseEvent &e, OIS::MouseButtonID button)
+	{
+		return true;
+
+	} // mousePressed
+
+	//--------------------------------------------------------
+
+	bool CInputManager::mouseReleased(const OIS::MouseEvent &e, OIS::MouseButtonID button)
+	{
+		return true;
+
+	} // mouseReleased
+
+	//--------------------------------------------------------
+	//--------------------------------------------------------
+
+	CServer* CServer::_instance = 0;
+
+	//--------------------------------------------------------
+
+	CServer::CServer() : _playerController(0), _GUISystem(0)
+	{
+		_instance = this;
+
+	} // CServer
+
+	//--------------------------------------------------------
+
+	CServer::~CServer()
+	{
+		_instance = 0;
+
+	} // ~CServer
+
+	//--------------------------------------------------------
+
+	bool CServer::Init()
+	{
+		assert(!_instance && "Segunda inicializacin de GUI::CServer no permitida!");
+
+		new CServer();
+
+		if (!_instance->open())
+		{
+			Release();
+			return false;
+		}
+
+		return true;
+
+	} // Init
+
+	//--------------------------------------------------------
+
+	void CServer::Release()
+	{
+		assert(_instance && "GUI::CServer no est inicializado!");
+
+		if(_instance)
+		{
+			_instance->close();
+			delete _instance;
+		}
+
+	} // Release
+
+	//--------------------------------------------------------
+
+	bool CServer::open()
+	{
+		// El controlador es el de verdad; sin perifricos nunca mueve a nadie
+		_playerController = new CPlayerController();
+
+		CInputManager::getSingletonPtr()->addMouseListener(this);
+		CInputManager::getSingletonPtr()->addKeyListener(this);
+
+		return true;
+
+	} // open
+
+	//--------------------------------------------------------
+
+	void CServer::close()
+	{
+		CInputManager::getSingletonPtr()->removeKeyListener(this);
+		CInputManager::getSingletonPtr()->removeMouseListener(this);
+
+		delete _playerController;
+
+	} // close
+
+	//--------------------------------------------------------
+
+	bool CServer::keyPressed(TKey key)
+	{
+		return false;
+
+	} // keyPressed
+
+	//--------------------------------------------------------
+
+	bool CServer::keyReleased(TKey key)
+	{
+		return false;
+
+	} // keyReleased
+
+	//--------------------------------------------------------
+
+	bool CServer::mouseMoved(const CMouseState &mouseState)
+	{
+		return true;
+
+	} // mouseMoved
+
+	//--------------------------------------------------------
+
+	bool CServer::mousePressed(const CMouseState &mouseState)
+	{
+		return true;
+
+	} // mousePressed
+
+	//--------------------------------------------------------
+
+	bool CServer::mouseReleased(const CMouseState &mouseState)
+	{
+		return true;
+
+	} // mouseReleased
+
+} // namespace Input
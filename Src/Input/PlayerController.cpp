@@ -119,10 +119,10 @@ namespace Input {
 	{
 		if(_controlledAvatar)
 		{
-			std::shared_ptr<Logic::CMessageHudDebugData> hud3 = std::make_shared<Logic::CMessageHudDebugData>();
+			std::shared_ptr<Logic::CMessageHudDebugData> hud3 = Logic::createMessage<Logic::CMessageHudDebugData>();
 			hud3->setKey("ultimatecla");
 			hud3->setValue("keyreleased");
-			std::shared_ptr<Logic::CMessageControl> m = std::make_shared<Logic::CMessageControl>();
+			std::shared_ptr<Logic::CMessageControl> m = Logic::createMessage<Logic::CMessageControl>();
 			switch(key.keyId)
 			{
 				case Input::Key::W:
@@ -136,7 +136,7 @@ namespace Input {
 					m->setType(Logic::Control::STOP_STRAFE_LEFT);
 										/*std::cout << "StopStrafeLeft" << std::endl;
 				//emitir mensaje de roll
-				std::shared_ptr<Logic::CMessageCameraRoll> messageRoll = std::make_shared<Logic::CMessageCameraRoll>();
+				std::shared_ptr<Logic::CMessageCameraRoll> messageRoll = Logic::createMessage<Logic::CMessageCameraRoll>();
 				messageRoll->setRollDegrees(ROLL_DEGREES);//Roll para que vuelva a posicin original
 				Logic::CEntity * camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByType("Camera");
 				camera->emitMessage(messageRoll);*/
@@ -147,7 +147,7 @@ namespace Input {
 					m->setType(Logic::Control::STOP_STRAFE_RIGHT);
 										/*
 				std::cout << "StopStrafeRight" << std::endl;
-				std::shared_ptr<Logic::CMessageCameraRoll> messageRoll = std::make_shared<Logic::CMessageCameraRoll>();
+				std::shared_ptr<Logic::CMessageCameraRoll> messageRoll = Logic::createMessage<Logic::CMessageCameraRoll>();
 				messageRoll->setRollDegrees(-ROLL_DEGREES); //Roll para que vuelva a posicin original
 				Logic::CEntity * camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByType("Camera");
 				camera->emitMessage(messageRoll);	*/			
@@ -188,7 +188,7 @@ namespace Input {
 	{
 		if(_controlledAvatar)
 		{
-			std::shared_ptr<Logic::CMessageMouse> m = std::make_shared<Logic::CMessageMouse>();
+			std::shared_ptr<Logic::CMessageMouse> m = Logic::createMessage<Logic::CMessageMouse>();
 			m->setType(Logic::Control::MOUSE);
 			float mouse[]={-(float)mouseState.movX * TURN_FACTOR_X,-(float)mouseState.movY * TURN_FACTOR_Y};
 			m->setMouse(mouse);
@@ -209,7 +209,7 @@ namespace Input {
 	{
 		if(_controlledAvatar)
 		{
-			std::shared_ptr<Logic::CMessageControl> m = std::make_shared<Logic::CMessageControl>();
+			std::shared_ptr<Logic::CMessageControl> m = Logic::createMessage<Logic::CMessageControl>();
 			switch(mouseState.button)
 			{
 			case Input::Button::LEFT:
@@ -243,7 +243,7 @@ namespace Input {
 		if(_controlledAvatar)
 		{
 			int a = mouseState.scrool;
-			std::shared_ptr<Logic::CMessageControl> m = std::make_shared<Logic::CMessageControl>();
+			std::shared_ptr<Logic::CMessageControl> m = Logic::createMessage<Logic::CMessageControl>();
 			switch(mouseState.button)
 			{
 			case Input::Button::LEFT:
@@ -315,7 +315,7 @@ namespace Input {
 
 	void CPlayerController::ChangeWeaponMessage(TKey key)
 	{
-		std::shared_ptr<Logic::CMessageChangeWeapon> message = std::make_shared<Logic::CMessageChangeWeapon>();
+		std::shared_ptr<Logic::CMessageChangeWeapon> message = Logic::createMessage<Logic::CMessageChangeWeapon>();
 
 		switch(key.keyId)
 		{
@@ -343,7 +343,7 @@ namespace Input {
 	//Mtodo sobrecargado para cambiar el arma con un entero (y no con una tecla TKey)
 	void CPlayerController::ChangeWeaponMessage(int iWeapon)
 	{
-		std::shared_ptr<Logic::CMessageChangeWeapon> message = std::make_shared<Logic::CMessageChangeWeapon>();
+		std::shared_ptr<Logic::CMessageChangeWeapon> message = Logic::createMessage<Logic::CMessageChangeWeapon>();
 		message->setWeapon(iWeapon);
 		_controlledAvatar->emitMessage(message);
 
@@ -353,7 +353,7 @@ namespace Input {
 
 	void CPlayerController::MovementMessage(TKey key)
 	{
-		std::shared_ptr<Logic::CMessageControl> m = std::make_shared<Logic::CMessageControl>();
+		std::shared_ptr<Logic::CMessageControl> m = Logic::createMessage<Logic::CMessageControl>();
 		unsigned int iDiffTime = clock() - m_iLastTime;
 		switch(key.keyId)
 		{
@@ -390,7 +390,7 @@ namespace Input {
 				{
 					m->setType(Logic::Control::STRAFE_LEFT);
 					//emitir mensaje de roll
-					/*std::shared_ptr<Logic::CMessageCameraRoll> messageRoll = std::make_shared<Logic::CMessageCameraRoll>();
+					/*std::shared_ptr<Logic::CMessageCameraRoll> messageRoll = Logic::createMessage<Logic::CMessageCameraRoll>();
 					messageRoll->setRollDegrees(-ROLL_DEGREES);
 					Logic::CEntity *camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByType("Camera");
 					camera->emitMessage(messageRoll);*/
@@ -417,7 +417,7 @@ namespace Input {
 				m->setType(Logic::Control::CROUCH);
 				break;
 		}
-		std::shared_ptr<Logic::CMessageHudDebugData> hud2 = std::make_shared<Logic::CMessageHudDebugData>();
+		std::shared_ptr<Logic::CMessageHudDebugData> hud2 = Logic::createMessage<Logic::CMessageHudDebugData>();
 		hud2->setKey("lastkey-pcontroller");
 		hud2->setValue(m->getType());
 		_controlledAvatar->emitMessage(hud2);
@@ -428,7 +428,7 @@ namespace Input {
 
 	void CPlayerController::HabilityMessage(TKey key)
 	{
-		std::shared_ptr<Logic::CMessageControl> m = std::make_shared<Logic::CMessageControl>();
+		std::shared_ptr<Logic::CMessageControl> m = Logic::createMessage<Logic::CMessageControl>();
 		switch (key.keyId)
 		{
 			case Input::Key::Q:
@@ -449,21 +449,21 @@ namespace Input {
 		{					
 			case Input::Key::NUMBER7:	
 			{
-				std::shared_ptr<Logic::CMessageAddLife> message2 = std::make_shared<Logic::CMessageAddLife>();
+				std::shared_ptr<Logic::CMessageAddLife> message2 = Logic::createMessage<Logic::CMessageAddLife>();
 				message2->setAddLife(20);
 				_controlledAvatar->emitMessage(message2);
 			}
 			break;
 			case Input::Key::NUMBER8:
 			{
-				std::shared_ptr<Logic::CMessageAddShield> message3 = std::make_shared<Logic::CMessageAddShield>();
+				std::shared_ptr<Logic::CMessageAddShield> message3 = Logic::createMessage<Logic::CMessageAddShield>();
 				message3->setAddShield(20);
 				_controlledAvatar->emitMessage(message3);
 			}
 			break;
 			case Input::Key::O:
 			{
-				std::shared_ptr<Logic::CMessageHudDebug> m2 = std::make_shared<Logic::CMessageHudDebug>();
+				std::shared_ptr<Logic::CMessageHudDebug> m2 = Logic::createMessage<Logic::CMessageHudDebug>();
 				_controlledAvatar->emitMessage(m2);
 			}
 			break;
@@ -471,12 +471,12 @@ namespace Input {
 			{
 				std::cout << "Position = " << _controlledAvatar->getPosition() << std::endl;
 				//std::cout << "Direction = " << (-1.0f * _controlledAvatar->getOrientation().zAxis()) << std::endl;
-				/*std::shared_ptr<Logic::CMessageCameraOffset> m3 = std::make_shared<Logic::CMessageCameraOffset>();
+				/*std::shared_ptr<Logic::CMessageCameraOffset> m3 = Logic::createMessage<Logic::CMessageCameraOffset>();
 				m3->setOffsetTimer(100.0f);//Timer								 
 				Logic::CEntity * camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByType("Camera");
 				camera->emitMessage(m3);*/
 
-				/*std::shared_ptr<Logic::CMessageCameraRoll> m3 = std::make_shared<Logic::CMessageCameraRoll>();
+				/*std::shared_ptr<Logic::CMessageCameraRoll> m3 = Logic::createMessage<Logic::CMessageCameraRoll>();
 				m3->setRollDegrees(ROLL_DEGREES);//Grados								 
 				Logic::CEntity * camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByType("Camera");
 				camera->emitMessage(m3);*/
@@ -490,7 +490,7 @@ namespace Input {
 
 	void CPlayerController::SpellMessage(TKey key)
 	{
-		std::shared_ptr<Logic::CMessageControl> m = std::make_shared<Logic::CMessageControl>();
+		std::shared_ptr<Logic::CMessageControl> m = Logic::createMessage<Logic::CMessageControl>();
 		switch (key.keyId)
 		{
 			case Input::Key::LCONTROL:
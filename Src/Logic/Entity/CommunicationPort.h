@@ -97,6 +97,21 @@ namespace Logic {
 
 		//__________________________________________________________________
 
+		/**
+		Devuelve los tipos de mensaje que la clase puede llegar a aceptar.
+		La entidad slo ofrece a cada componente (va set()) los mensajes de
+		los tipos que declara su clase, as que quien redefina accept() debe
+		redefinir tambin este mtodo con los mismos tipos. accept() puede
+		seguir rechazando mensajes de esos tipos segn su estado.
+		<p>
+		Por defecto el conjunto est vaco, igual que accept() lo rechaza todo.
+
+		@return Conjunto de tipos de mensaje aceptados.
+		*/
+		static TMessageTypeSet getAcceptedMessageTypes() { return TMessageTypeSet(); }
+
+		//__________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
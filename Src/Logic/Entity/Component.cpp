@@ -13,14 +13,18 @@ Contiene la implementaci
 #include "Component.h"
 #include "Logic/Server.h"
 
+#include <cassert>
+
 namespace Logic {
 	IComponent::IComponent() : _entity(0), 
+							   _typeID(UNASSIGNED_COMPONENT_ID),
 							   _isActivated(false),
 							   _deepSleep(false),
 							   _wantsTick(true),
 							   _wantsFixedTick(true),
 							   _state(ComponentState::eAWAKE),
-							   _tickMask(TickMode::eTICK | TickMode::eFIXED_TICK) {
+							   _tickMask(TickMode::eTICK | TickMode::eFIXED_TICK),
+							   _batchedTick(false) {
 
 		// Espia de debug
 		Logic::CServer::getSingletonPtr()->COMPONENT_CONSTRUCTOR_COUNTER += 1;
@@ -173,4 +177,27 @@ namespace Logic {
 		// Los hijos deben redefinir su comportamiento
 	}
 
+	//__________________________________________________________________
+
+	bool IComponent::recycle() {
+		assert(!_isActivated && "Solo se pueden reciclar componentes desactivados");
+
+		// La mascara de tick se conserva: solo la estrechan los onTick y
+		// onFixedTick por defecto, que dependen de la clase del componente
+		_state = ComponentState::eAWAKE;
+		_deepSleep = false;
+		_wantsTick = (_tickMask & TickMode::eTICK) != 0;
+		_wantsFixedTick = (_tickMask & TickMode::eFIXED_TICK) != 0;
+		clearMessages();
+
+		return onRecycle();
+	}
+
+	//__________________________________________________________________
+
+	bool IComponent::onRecycle() {
+		// Los hijos que se puedan reciclar deben redefinirlo
+		return false;
+	}
+
 } // namespace Logic
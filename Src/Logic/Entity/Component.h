@@ -252,6 +252,20 @@ namespace Logic {
 
 		//__________________________________________________________________
 
+		/**
+		Deja el componente como recin construido para que su entidad pueda
+		volver al pool de la factora y reutilizarse con otro spawn. Slo se
+		invoca con la entidad fuera del mapa (y por tanto desactivada).
+		<p>
+		Restaura el estado de la clase base y delega en onRecycle.
+
+		@return false si el componente no sabe reciclarse; en ese caso la
+		entidad se destruye en lugar de volver al pool.
+		*/
+		bool recycle();
+
+		//__________________________________________________________________
+
 		/** 
 		Devuelve true si el componente est activado. 
 
@@ -298,6 +312,16 @@ namespace Logic {
 
 		//__________________________________________________________________
 
+		/**
+		Devuelve true si el tick de este componente lo ejecuta el mapa junto
+		con el de todos los componentes de su mismo tipo (ver enableBatchedTick).
+
+		@return true si el componente tiene tick por lotes.
+		*/
+		inline bool hasBatchedTick() const { return _batchedTick; }
+
+		//__________________________________________________________________
+
 		/**
 		Mtodo que devuelve la entidad a la que pertenece el componente.
 
@@ -306,6 +330,13 @@ namespace Logic {
 		inline CEntity* getEntity() const { return _entity; }
 
 		inline std::string getType() const { return _type; }
+
+		/**
+		Devuelve el identificador numrico del tipo del componente.
+
+		@return Identificador asignado por la factora de componentes.
+		*/
+		inline TComponentID getTypeID() const { return _typeID; }
 	
 	protected:
 
@@ -314,7 +345,20 @@ namespace Logic {
 		//                          MTODOS PROTEGIDOS
 		// =======================================================================
 
-		inline void setType(const std::string& componentName) { _type = componentName; }
+		inline void setType(const std::string& componentName, TComponentID typeID) { _type = componentName; _typeID = typeID; }
+
+		//__________________________________________________________________
+
+		/**
+		Pide que el tick y el fixed tick de este componente no los lance su
+		entidad sino el mapa, que recorre de una vez todos los componentes del
+		mismo tipo despus de los ticks de las entidades. Debe llamarse en el
+		constructor.
+		<p>
+		Slo vale para componentes cuyo tick no dependa de que otros
+		componentes de la entidad hayan hecho ya el suyo en ese frame.
+		*/
+		inline void enableBatchedTick() { _batchedTick = true; }
 
 		/**
 		Se ejecuta la primera vez que la entidad se activa. Garantiza que todas las 
@@ -392,6 +436,17 @@ namespace Logic {
 
 		//__________________________________________________________________
 
+		/**
+		Invocado al reciclar el componente. Los componentes que quieran que
+		su entidad se reutilice deben redefinirlo para liberar lo que creen
+		en el spawn o en el onStart y volver a los valores del constructor.
+
+		@return true si el componente se ha reciclado. Por defecto false.
+		*/
+		virtual bool onRecycle();
+
+		//__________________________________________________________________
+
 		/**
 		Mtodo que establece la entidad a la que pertenece el componente.
 
@@ -421,10 +476,12 @@ namespace Logic {
 
 		/** clase amiga que puede establecerse como poseedor del componente. */
 		friend class CEntity;
-
 		/** String que indica el nombre del componente. */
 		std::string _type;
 
+		/** Identificador numrico del tipo del componente. */
+		TComponentID _typeID;
+
 		/** true si el componente esta activado. */
 		bool _isActivated;
 
@@ -459,6 +516,9 @@ namespace Logic {
 		bool _wantsTick;
 
 		bool _wantsFixedTick;
+
+		/** true si el tick del componente lo ejecuta el mapa por lotes. */
+		bool _batchedTick;
 		
 	}; // class IComponent
 
@@ -483,6 +543,10 @@ public: \
 	Registra el componente de la clase en la factora. \
 	*/ \
 	static bool regist(); \
+	/** \
+	Identificador numrico del tipo, asignado al registrarlo en la factora. \
+	*/ \
+	static TComponentID ID; \
 
 /** 
 Macro para la implementacin de los mtodos necesarios para que
@@ -490,6 +554,7 @@ la factoria cree nuevas instancias del tipo de componentes y
 para que el componente se registre en la factora.
 */
 #define IMP_FACTORY(Class) \
+TComponentID Class::ID = UNASSIGNED_COMPONENT_ID; \
 IComponent* Class::create() \
 { \
 	IComponent* res = new Class(); \
@@ -501,6 +566,8 @@ bool Class::regist() \
 	{ \
 		CComponentFactory::getSingletonPtr()->add(Class::create, #Class); \
 	} \
+	Class::ID = CComponentFactory::getSingletonPtr()->registerID(#Class); \
+	CComponentFactory::getSingletonPtr()->setAcceptedMessageTypes(Class::ID, Class::getAcceptedMessageTypes()); \
 	return true; \
 }
 
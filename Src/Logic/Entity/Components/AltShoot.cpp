@@ -37,6 +37,14 @@ namespace Logic {
 		// Leer los atributos que toque
 	}
 
+	TMessageTypeSet CAltShoot::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTROL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool CAltShoot::accept(const shared_ptr<CMessage>& message) {
 		// Solo nos interesan los mensajes de disparo.
 		// Es importante que hagamos esto porque si no, el putToSleep
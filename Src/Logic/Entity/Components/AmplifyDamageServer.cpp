@@ -47,11 +47,11 @@ namespace Logic {
 
 		_weaponry.resize(WeaponType::eSIZE);
 		// Rellenamos el vector con los punteros a los componentes correspondientes
-		_weaponry[WeaponType::eSOUL_REAPER] = _entity->getComponent<Logic::CSoulReaper>("CSoulReaper");
-		_weaponry[WeaponType::eSNIPER]= _entity->getComponent<Logic::CSniper>("CSniper");
-		_weaponry[WeaponType::eSHOTGUN]= _entity->getComponent<Logic::CShotGun>("CShotGun");
-		_weaponry[WeaponType::eMINIGUN]= _entity->getComponent<Logic::CMiniGun>("CMiniGun");
-		_weaponry[WeaponType::eIRON_HELL_GOAT]= _entity->getComponent<Logic::CIronHellGoat>("CIronHellGoat");
+		_weaponry[WeaponType::eSOUL_REAPER] = _entity->getComponent<Logic::CSoulReaper>();
+		_weaponry[WeaponType::eSNIPER]= _entity->getComponent<Logic::CSniper>();
+		_weaponry[WeaponType::eSHOTGUN]= _entity->getComponent<Logic::CShotGun>();
+		_weaponry[WeaponType::eMINIGUN]= _entity->getComponent<Logic::CMiniGun>();
+		_weaponry[WeaponType::eIRON_HELL_GOAT]= _entity->getComponent<Logic::CIronHellGoat>();
 
 		return true;
 	} // spawn
@@ -59,7 +59,7 @@ namespace Logic {
 
 	void CAmplifyDamageServer::spell(){ 
 		/*
-		auto msg =  std::make_shared<CMessageDamageAmplifier>(_newPercentDamage);
+		auto msg =  createMessage<CMessageDamageAmplifier>(_newPercentDamage);
 		_entity->emitMessage(msg);
 		*/
 		for(unsigned int i = 0; i < WeaponType::eSIZE;++i){
@@ -74,7 +74,7 @@ namespace Logic {
 		
 	void CAmplifyDamageServer::stopSpell() {
 		/*
-		auto msg = std::make_shared<CMessageDamageAmplifier>(0);
+		auto msg = createMessage<CMessageDamageAmplifier>(0);
 		_entity->emitMessage(msg);
 		*/
 		for(unsigned int i = 0; i < WeaponType::eSIZE;++i){
@@ -117,6 +117,16 @@ namespace Logic
 	}
 	//---------------------------------------------------------
 
+	TMessageTypeSet CAnimatedGraphics::getAcceptedMessageTypes() {
+		TMessageTypeSet types = CGraphics::getAcceptedMessageTypes();
+		types.set(Message::CHANGE_WEAPON_GRAPHICS);
+		types.set(Message::SET_ANIMATION);
+		types.set(Message::STOP_ANIMATION);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CAnimatedGraphics::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -69,6 +69,9 @@ namespace Logic
 		@return true si el mensaje es aceptado.
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
+
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
 		/**
 		Mtodo virtual que procesa un mensaje.
 
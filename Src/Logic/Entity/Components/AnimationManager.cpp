@@ -39,13 +39,13 @@ namespace Logic{
 	bool CAnimationManager::spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo){
 		if( !IComponent::spawn(entity,map,entityInfo) ) return false;
 
-		_avatarController =  _entity->getComponent<CAvatarController>("CAvatarController");
+		_avatarController =  _entity->getComponent<CAvatarController>();
 	}
 
 	void CAnimationManager::onStart(){
 		initAnimationCommands();
 
-		std::shared_ptr<CMessageSetAnimation> anim = std::make_shared<CMessageSetAnimation>();
+		std::shared_ptr<CMessageSetAnimation> anim = createMessage<CMessageSetAnimation>();
 		anim->setLoop(true);
 		anim->setAnimation("idle");
 		anim->setExclude(false);
@@ -61,7 +61,7 @@ namespace Logic{
 
 			_flying = false;
 			_lastDisplacementAnimation = displacementDir;
-			std::shared_ptr<CMessageSetAnimation> anim = std::make_shared<CMessageSetAnimation>();
+			std::shared_ptr<CMessageSetAnimation> anim = createMessage<CMessageSetAnimation>();
 			anim->setLoop(true);
 			anim->setAnimation(animation->second.animation);
 			anim->setExclude(false);
@@ -70,7 +70,7 @@ namespace Logic{
 		}
 		/*else if ( flying && !_flying ) {
 			_flying = true;
-			std::shared_ptr<CMessageSetAnimation> anim = std::make_shared<CMessageSetAnimation>();
+			std::shared_ptr<CMessageSetAnimation> anim = createMessage<CMessageSetAnimation>();
 			anim->setLoop(true);
 			anim->setAnimation("airwalk");
 			anim->setExclude(false);
@@ -78,7 +78,7 @@ namespace Logic{
 		}*/
 		/*else if ( !flying && _flying ) {
 			_flying = false;
-			std::shared_ptr<CMessageSetAnimation> anim = std::make_shared<CMessageSetAnimation>();
+			std::shared_ptr<CMessageSetAnimation> anim = createMessage<CMessageSetAnimation>();
 			anim->setLoop(true);
 			anim->setAnimation(getMotionAnimation(_lastDisplacementAnimation));
 			anim->setRewind(1);
@@ -87,6 +87,16 @@ namespace Logic{
 		}*/
 	}
 
+	TMessageTypeSet CAnimationManager::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTROL);
+		types.set(Message::DAMAGED);
+		types.set(Message::PLAYER_DEAD);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------------------------
+
 	bool CAnimationManager::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -117,7 +127,7 @@ namespace Logic{
 				if( ( ctrlType == ControlType::JUMP || ctrlType == ControlType::DODGE_BACKWARDS || ctrlType == ControlType::DODGE_FORWARD || 
 				ctrlType == ControlType::DODGE_LEFT || ctrlType == ControlType::DODGE_RIGHT ) ){
 
-					std::shared_ptr<CMessageSetAnimation> anim = std::make_shared<CMessageSetAnimation>();
+					std::shared_ptr<CMessageSetAnimation> anim = createMessage<CMessageSetAnimation>();
 					anim->setLoop(false);
 					anim->setAnimation("jump");
 					anim->setExclude(true);
@@ -139,7 +149,7 @@ namespace Logic{
 		entityDirection.normalise();
 		float angle = direction.angleBetween(entityDirection).valueDegrees();
 
-		std::shared_ptr<CMessageSetAnimation> anim = std::make_shared<CMessageSetAnimation>();
+		std::shared_ptr<CMessageSetAnimation> anim = createMessage<CMessageSetAnimation>();
 
 		//si no lo esta mirando la muerte ha sido por detras, luego ponemos
 		//la animacion de muerte por detras
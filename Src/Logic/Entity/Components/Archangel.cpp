@@ -83,13 +83,13 @@ namespace Logic {
 				_inmunityTimer -= msecs;
 			}else{
 				// Seteamos la reduccin de dao a 0 de manera que recibimos los daos normales
- 				std::shared_ptr<CMessageSetReducedDamage> pReducedDmgMsg = std::make_shared<CMessageSetReducedDamage>();
+ 				std::shared_ptr<CMessageSetReducedDamage> pReducedDmgMsg = createMessage<CMessageSetReducedDamage>();
 				pReducedDmgMsg->setReducedDamage(0);
 				_entity->emitMessage(pReducedDmgMsg);					
 	
 				// Desactivamos el shader de inmunidad
 				// Desactivamos el shader de invisibilidad
-				std::shared_ptr<CMessageChangeMaterial> materialMsg = std::make_shared<CMessageChangeMaterial>();
+				std::shared_ptr<CMessageChangeMaterial> materialMsg = createMessage<CMessageChangeMaterial>();
 				materialMsg->setMaterialName("original");
 				_entity->emitMessage(materialMsg);
 				Logic::CWorldState::getSingletonPtr()->addChange(_entity,materialMsg);
@@ -127,12 +127,12 @@ namespace Logic {
 		_inmunityTimer = _inmunityDuration;
 
 		// Seteamos la reduccin de dao al mximo de manera que no se reciban daos
-		std::shared_ptr<CMessageSetReducedDamage> pReducedDmgMsg = std::make_shared<CMessageSetReducedDamage>();
+		std::shared_ptr<CMessageSetReducedDamage> pReducedDmgMsg = createMessage<CMessageSetReducedDamage>();
 		pReducedDmgMsg->setReducedDamage(1);
 		_entity->emitMessage(pReducedDmgMsg);
 
 		// Activamos el shader de inmunidad
-		std::shared_ptr<CMessageChangeMaterial> materialMsg = std::make_shared<CMessageChangeMaterial>();
+		std::shared_ptr<CMessageChangeMaterial> materialMsg = createMessage<CMessageChangeMaterial>();
 		materialMsg->setMaterialName("archangelDiamond"); // En el futuro debe ser el material del archangel
 		_entity->emitMessage(materialMsg);
 		Logic::CWorldState::getSingletonPtr()->addChange(_entity,materialMsg);
@@ -161,7 +161,7 @@ namespace Logic {
 			position,
 			Quaternion::IDENTITY
 		);
-		_lifeDome->getComponent<CLifeDome>("CLifeDome")->setOwner(_entity);
+		_lifeDome->getComponent<CLifeDome>()->setOwner(_entity);
 		_lifeDome->activate();
 		_lifeDome->start();
 
@@ -169,7 +169,7 @@ namespace Logic {
 		
 		// Enviamos el mensaje SET_OWNER para que el escudo se mueva
 		// acorde a los movimientos del player
-		std::shared_ptr<CMessageSetOwner> setOwnerMsg = std::make_shared<CMessageSetOwner>();
+		std::shared_ptr<CMessageSetOwner> setOwnerMsg = createMessage<CMessageSetOwner>();
 		setOwnerMsg->setOwner(_entity);
 		_lifeDome->emitMessage(setOwnerMsg);
 		_doingSecondarySkill = true;
@@ -136,6 +136,15 @@ namespace Logic
 	
 	//---------------------------------------------------------
 
+	TMessageTypeSet CArrayGraphics::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CHANGE_WEAPON_GRAPHICS);
+		types.set(Message::SET_TRANSFORM);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CArrayGraphics::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -78,6 +78,9 @@ namespace Logic
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
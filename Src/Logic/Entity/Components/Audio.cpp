@@ -21,6 +21,14 @@ using namespace std;
 namespace Logic {
 	IMP_FACTORY(CAudio);
 
+	TMessageTypeSet CAudio::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::AUDIO);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CAudio::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::AUDIO;
 	} // accept
@@ -46,6 +46,9 @@ namespace Logic
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
 		/**
 		Al recibir un mensaje de tipo AUDIO se encarga de comunicarselo al server de audio.
 		*/
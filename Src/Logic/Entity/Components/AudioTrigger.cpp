@@ -42,6 +42,15 @@ namespace Logic {
 		return true;
 	} // spawn
 
+	TMessageTypeSet CAudioTrigger::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		types.set(Message::UNTOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CAudioTrigger::accept(const std::shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -59,7 +68,7 @@ namespace Logic {
 				// del sonido online.
 				// Si somos el servidor queremos mandar un mensaje de audio.
 				if( Net::CManager::getSingletonPtr()->imServer() ) {
-					shared_ptr<CMessageAudio> audioMsg = make_shared<CMessageAudio>();
+					shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 					
 					audioMsg->setAudioName(_name);
 					audioMsg->is3dSound(true);
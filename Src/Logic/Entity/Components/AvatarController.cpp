@@ -53,6 +53,7 @@ namespace Logic {
 											 _sideColliding(false),
 											 _collisionOnTop(false),
 											 _walking(false),
+											 _commandDriven(false),
 											 _physicController(0),
 											 _momentum(Vector3::ZERO),
 											 _displacementDir(Vector3::ZERO),
@@ -121,6 +122,17 @@ namespace Logic {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CAvatarController::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ADDFORCEPLAYER);
+		types.set(Message::CHANGE_GRAVITY);
+		types.set(Message::CONTROL);
+		types.set(Message::HOUND_CHARGE);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CAvatarController::accept(const std::shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -238,7 +250,7 @@ namespace Logic {
 		// Para evitar overhead de mensajes nos quedamos con el puntero al 
 		// componente CPhysicController que es el que realmente se encargar 
 		// de desplazar al controlador del jugador.
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
+		_physicController = _entity->getComponent<CPhysicController>();
 		assert(_physicController && "Error: El player no tiene un controlador fisico");
 
 		// Pasamos la mascara de movimiento al modo normal
@@ -248,6 +260,15 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CAvatarController::onFixedTick(unsigned int msecs) {
+		// En el servidor nos movemos al ritmo de los comandos del cliente
+		if(_commandDriven) return;
+
+		simulate(msecs);
+	} // tick
+
+	//________________________________________________________________________
+
+	void CAvatarController::simulate(unsigned int msecs) {
 		// Calculamos el vector de desplazamiento teniendo en cuenta
 		// si estamos en el aire o en el suelo
 		Vector3 displacement = _touchingGround ? estimateGroundMotion(msecs) : estimateAirMotion(msecs);
@@ -261,7 +282,39 @@ namespace Logic {
 		// al movernos para asegurarnos de que hay colision
 		Vector3 oldPosition = _entity->getPosition();
 		manageCollisions( _physicController->move(displacement-Vector3(0.0f, 0.15f, 0.0f), _filterMask, msecs), oldPosition );
-	} // tick
+	} // simulate
+
+	//________________________________________________________________________
+
+	void CAvatarController::applyInputCommand(ControlType action, const Vector3& displacementDir, unsigned int msecs) {
+		// Las acciones se ejecutan antes del paso, igual que cuando llegan
+		// como mensaje de control antes del fixed tick
+		if(action == Control::JUMP)
+			executeJump();
+		else if(action > Control::JUMP && action < Control::MOUSE)
+			executeDodge(action);
+
+		// La esquiva toca la direccion de desplazamiento, mandamos la del comando
+		_displacementDir = displacementDir;
+
+		simulate(msecs);
+	} // applyInputCommand
+
+	//________________________________________________________________________
+
+	void CAvatarController::setMovementState(const Vector3& momentum, bool touchingGround) {
+		_momentum = momentum;
+		_touchingGround = touchingGround;
+	} // setMovementState
+
+	//________________________________________________________________________
+
+	void CAvatarController::muteObservers(bool mute) {
+		if(mute)
+			_mutedObservers.swap(_observers);
+		else
+			_observers.swap(_mutedObservers);
+	} // muteObservers
 
 	//________________________________________________________________________
 
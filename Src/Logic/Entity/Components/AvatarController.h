@@ -149,6 +149,11 @@ namespace Logic {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -212,6 +217,63 @@ namespace Logic {
 
 		void removeObserver(IObserver* observer);
 
+		//________________________________________________________________________
+
+		/**
+		Simula un paso de movimiento: calcula el desplazamiento segn la
+		direccin de desplazamiento y la inercia actuales y mueve el
+		controlador fsico.
+
+		@param msecs Milisegundos que dura el paso.
+		*/
+		void simulate(unsigned int msecs);
+
+		//________________________________________________________________________
+
+		/**
+		Aplica un comando de entrada completo y simula el paso que le
+		corresponde. Lo usa el servidor para simular los comandos que le manda
+		el cliente y el cliente para repetir los comandos que el servidor an
+		no ha confirmado.
+
+		@param action Salto o esquiva del comando (Control::UNASSIGNED si no hay).
+		@param displacementDir Direccin de desplazamiento durante el paso.
+		@param msecs Milisegundos que dura el paso.
+		*/
+		void applyInputCommand(ControlType action, const Vector3& displacementDir, unsigned int msecs);
+
+		//________________________________________________________________________
+
+		/**
+		Fija el estado del movimiento (para rebobinar al estado que confirma
+		el servidor).
+
+		@param momentum Vector de inercia.
+		@param touchingGround true si el jugador est tocando el suelo.
+		*/
+		void setMovementState(const Vector3& momentum, bool touchingGround);
+
+		//________________________________________________________________________
+
+		/**
+		Si se activa, el controlador deja de moverse en su fixed tick y slo
+		se mueve al aplicarle comandos de entrada (applyInputCommand). Es el
+		modo del servidor, que mueve al jugador al ritmo de sus comandos.
+		*/
+		void setCommandDriven(bool commandDriven) { _commandDriven = commandDriven; }
+
+		//________________________________________________________________________
+
+		/**
+		Silencia a los observadores (sonidos, cmara...) mientras se repiten
+		comandos ya simulados.
+
+		@param mute true para silenciarlos, false para volver a avisarles.
+		*/
+		void muteObservers(bool mute);
+
+		//________________________________________________________________________
+
 		Vector3 getMomentum() { return _momentum; }
 
 		Vector3 getVelocity(){ return _momentum; }
@@ -220,6 +282,8 @@ namespace Logic {
 
 		Vector3 getDisplacementDir() { return _displacementDir; }
 
+		void setDisplacementDir(const Vector3& displacementDir) { _displacementDir = displacementDir; }
+
 		bool getFlying() { return !_touchingGround; }
 
 	protected:
@@ -402,6 +466,12 @@ namespace Logic {
 		*/
 		std::list<IObserver*> _observers;
 
+		/** Observadores apartados mientras estn silenciados (ver muteObservers). */
+		std::list<IObserver*> _mutedObservers;
+
+		/** true si el controlador slo se mueve al aplicarle comandos de entrada. */
+		bool _commandDriven;
+
 		/** Nmero mximo de comandos de movimiento. */
 		static const int MAX_MOVEMENT_COMMANDS = Control::CROUCH;
 
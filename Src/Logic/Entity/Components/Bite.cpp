@@ -24,6 +24,14 @@ namespace Logic{
 	} // spawn
 
 
+	TMessageTypeSet CBite::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CBite::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::TOUCHED;
 	}
@@ -34,12 +42,12 @@ namespace Logic{
 			CEntity* entityTouched = msg->getEntity();
 
 			if(_owner != NULL && entityTouched != _owner) {
-				std::shared_ptr<CMessageDamaged> damage = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damage = createMessage<CMessageDamaged>();
 				damage->setEnemy(_owner);
 				damage->setDamage(_biteDamage);
 				entityTouched->emitMessage(damage);
 
-				std::shared_ptr<CMessageAddLife> addLifeMsg = std::make_shared<CMessageAddLife>();
+				std::shared_ptr<CMessageAddLife> addLifeMsg = createMessage<CMessageAddLife>();
 				addLifeMsg->setAddLife(_lifeSteal);
 				_owner->emitMessage(addLifeMsg);
 			}
@@ -52,7 +60,7 @@ namespace Logic{
 
 	void CBite::onStart() {
 		// Sacamos el componente fisico
-		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity");
+		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>();
 		assert(_physicComponent != NULL);
 	}
 
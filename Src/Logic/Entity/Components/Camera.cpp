@@ -93,6 +93,17 @@ namespace Logic
 	
 	//---------------------------------------------------------
 
+	TMessageTypeSet CCamera::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CAMERA_OFFSET);
+		types.set(Message::CAMERA_ROLL);
+		types.set(Message::CAMERA_TO_ENEMY);
+		types.set(Message::PLAYER_SPAWN);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CCamera::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 		
@@ -95,6 +95,9 @@ namespace Logic
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
 		/**
 		Al tratar el mensaje de situar la camara al morir, nos quedaremos mirando al jugador que nos ha matado.
 		*/
@@ -88,6 +88,15 @@ namespace Logic {
 	
 	//________________________________________________________________________
 
+	TMessageTypeSet CCameraFeedbackNotifier::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::DAMAGED);
+		types.set(Message::FLASH);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CCameraFeedbackNotifier::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -128,9 +137,9 @@ namespace Logic {
 	void CCameraFeedbackNotifier::onStart() {
 		CEntity* cameraEntity = Logic::CServer::getSingletonPtr()->getMap()->getEntityByName("Camera");
 		assert(cameraEntity != NULL && "Error: No existe una entidad camara");
-		_cameraComponent = cameraEntity->getComponent<CCamera>("CCamera");
+		_cameraComponent = cameraEntity->getComponent<CCamera>();
 		assert(_cameraComponent != NULL && "Error: La entidad camara no tiene un componente de camara");
-		_avatarc = _entity->getComponent<CAvatarController>("CAvatarController");
+		_avatarc = _entity->getComponent<CAvatarController>();
 		assert(_avatarc != NULL && "Error: no tenemos avatar controller lol");
 
 		// Nos registramos como observadores (no hace falta que nos desregistremos)
@@ -339,7 +348,7 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CCameraFeedbackNotifier::damaged(Vector3 vEnemyPosition) {
-		std::shared_ptr<Logic::CMessageCameraOffset> m3 = std::make_shared<Logic::CMessageCameraOffset>();
+		std::shared_ptr<Logic::CMessageCameraOffset> m3 = Logic::createMessage<Logic::CMessageCameraOffset>();
 		m3->setOffsetTimer(100.0f);//Timer								 
 		Logic::CEntity * camera = Logic::CServer::getSingletonPtr()->getMap()->getEntityByName("Camera");
 		assert(camera != NULL && "Error: Esto no se puede hacer asi que sois unos lamers, ahora el servidor que hace?");
@@ -392,7 +401,7 @@ namespace Logic {
 		}
 
 		//Mando el mensaje
-		std::shared_ptr<Logic::CMessageImpact> impact = std::make_shared<Logic::CMessageImpact>();
+		std::shared_ptr<Logic::CMessageImpact> impact = Logic::createMessage<Logic::CMessageImpact>();
 		impact->setDirectionImpact(fRadianes);							 
 		_entity->emitMessage(impact);
 	}
@@ -61,12 +61,12 @@ namespace Logic {
 		_audioServer = Audio::CServer::getSingletonPtr();
 		// Nos quedamos con el componente de movimiento para evitar sobrecarga
 		// y nos registramos como observadores de el
-		_avatarController = _entity->getComponent<CAvatarController>("CAvatarController");
+		_avatarController = _entity->getComponent<CAvatarController>();
 		assert(_avatarController != NULL && "Error: Es necesario disponer del componente de movimiento");
 		_avatarController->addObserver(this);
 
 		// Nos registramos como observadores de la capsula fisica tambien
-		CPhysicController* physicCont = _entity->getComponent<CPhysicController>("CPhysicController");
+		CPhysicController* physicCont = _entity->getComponent<CPhysicController>();
 		assert(physicCont != NULL && "Error: Se necesita tener un controlador fisico");
 		physicCont->addObserver(this);
 	}
@@ -48,6 +48,15 @@ namespace Logic  {
 	} // spawn
 	//________________________________________________________________________
 
+	TMessageTypeSet CClientRespawn::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::PLAYER_DEAD);
+		types.set(Message::PLAYER_SPAWN);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CClientRespawn::accept(const std::shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -64,7 +73,7 @@ namespace Logic  {
 				// @deprecated Esto no deberia hacerse aqui pero como maana es la gamelab
 				// lo dejo asi. El problema es que el componente del servidor no procesa
 				// el mensaje de audio de muerte mandado desde el cliente
-				/*std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+				/*std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 				audioMsg->setAudioName("slapchot.wav");
 				audioMsg->is3dSound(true);
 				_entity->emitMessage(audioMsg);*/
@@ -87,12 +96,12 @@ namespace Logic  {
 				
 				// En caso de estar simulando fisica en el cliente, desactivamos
 				// la cpsula.
-				_entity->getComponent<CPhysicController>("CPhysicController")->deactivateSimulation();
+				_entity->getComponent<CPhysicController>()->deactivateSimulation();
 
-				CAvatarController* component = _entity->getComponent<CAvatarController>("CAvatarController");
+				CAvatarController* component = _entity->getComponent<CAvatarController>();
 				if(component != NULL) {
 					exceptionList.insert( std::string("CAvatarController") );
-					_entity->getComponent<CAvatarController>("CAvatarController")->putToSleep(true);
+					_entity->getComponent<CAvatarController>()->putToSleep(true);
 				}
 
 				_entity->deactivateAllComponentsExcept(exceptionList);
@@ -128,12 +137,12 @@ namespace Logic  {
 
 				Audio::CServer::getSingletonPtr()->playSound3D("gameplay/spawn.wav", spawnPos, Vector3::ZERO, false, false);
 
-				_entity->getComponent<CPhysicController>("CPhysicController")->setPhysicPosition(spawnPos);
+				_entity->getComponent<CPhysicController>()->setPhysicPosition(spawnPos);
 				// Activamos la simulacion aqui sin problemas. El componente life ignora los mensajes de dao
 				// hasta que no desaparece la inmunidad del respawn. 
-				_entity->getComponent<CPhysicController>("CPhysicController")->activateSimulation();
+				_entity->getComponent<CPhysicController>()->activateSimulation();
 
-				CAvatarController* component = _entity->getComponent<CAvatarController>("CAvatarController");
+				CAvatarController* component = _entity->getComponent<CAvatarController>();
 				if(component != NULL) {
 					component->wakeUp();
 				}
@@ -147,12 +156,12 @@ namespace Logic  {
 
 				Vector3 entityPos = _entity->getPosition();
 
-				std::shared_ptr<CMessagePlayerSpawn> cameraPlayerSpawnMsg = std::make_shared<CMessagePlayerSpawn>();
+				std::shared_ptr<CMessagePlayerSpawn> cameraPlayerSpawnMsg = createMessage<CMessagePlayerSpawn>();
 				CEntity* cam = CServer::getSingletonPtr()->getMap()->getEntityByName("Camera");
 				assert(cam != NULL && "Error: Esto no se puede hacer asi que sois unos lamers, ahora el servidor que hace?");
 				cam->emitMessage(cameraPlayerSpawnMsg);
 
-				std::shared_ptr<CMessageHudSpawn> messageHudSpawn = std::make_shared<CMessageHudSpawn>();
+				std::shared_ptr<CMessageHudSpawn> messageHudSpawn = createMessage<CMessageHudSpawn>();
 				messageHudSpawn->setTime(0);
 				_entity->emitMessage(messageHudSpawn);
 
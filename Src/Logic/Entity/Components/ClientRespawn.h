@@ -65,6 +65,11 @@ namespace Logic  {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
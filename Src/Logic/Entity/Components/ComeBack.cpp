@@ -31,7 +31,7 @@ namespace Logic {
 	bool CComeBack::spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo) {
 		if(!ISpell::spawn(entity,map,entityInfo)) return false;
 
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
+		_physicController = _entity->getComponent<CPhysicController>();
 		/*assert( entityInfo->hasAttribute(_spellName + "newGravity") );
 
 		_newGravity = entityInfo->getFloatAttribute(_spellName + "newGravity");
@@ -45,7 +45,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CComeBack::spell(){ 
-		/*auto msg =  std::make_shared<CMessageChangeGravity>(_newGravity);
+		/*auto msg =  createMessage<CMessageChangeGravity>(_newGravity);
 		_entity->emitMessage(msg);*/
 		if(_comeBackPosition == Vector3::ZERO){
 			_comeBackPosition = _entity->getPosition();
@@ -64,7 +64,7 @@ namespace Logic {
 
 		_comeBackPosition = Vector3::ZERO;
 		_comeBackOrientation = Quaternion::ZERO;
-		/*auto msg = std::make_shared<CMessageChangeGravity>(_defaultGravity);
+		/*auto msg = createMessage<CMessageChangeGravity>(_defaultGravity);
 		_entity->emitMessage(msg);*/
 	} // stopSpell
 	//__________________________________________________________________
@@ -37,6 +37,13 @@ namespace Logic
 
 	//---------------------------------------------------------
 
+	TMessageTypeSet CDamageTrigger::getAcceptedMessageTypes()
+	{
+		return TMessageTypeSet();
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CDamageTrigger::accept(const std::shared_ptr<CMessage>& message)
 	{
 		// TODO: 2. Aceptar mensajes de tipo TOUCHED
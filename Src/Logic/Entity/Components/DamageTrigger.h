@@ -50,6 +50,9 @@ namespace Logic
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
 		/**
 		Al recibir un mensaje TOUCHED se enva otro mensaje de tipo DAMAGED a la
 		entidad tocada.
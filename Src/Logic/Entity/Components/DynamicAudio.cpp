@@ -24,6 +24,14 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet CDynamicAudio::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::AUDIO);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool CDynamicAudio::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::AUDIO;
 	} // accept
@@ -23,7 +23,8 @@ namespace Logic {
 
 	CDynamicLight::CDynamicLight() : _timer(0.0f),
 									 _offset(Vector3::ZERO) {
-		// Nada que hacer
+		// Solo sigue a la entidad, puede ir en el lote de su tipo
+		enableBatchedTick();
 	}
 
 	//________________________________________________________________________
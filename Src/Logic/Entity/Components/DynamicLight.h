@@ -60,6 +60,9 @@ namespace Logic {
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message) { return false; }
 
+		/** Tipos de mensaje que puede aceptar el componente (ninguno). */
+		static TMessageTypeSet getAcceptedMessageTypes() { return TMessageTypeSet(); }
+
 
 		// =======================================================================
 		//                            METODOS PROPIOS
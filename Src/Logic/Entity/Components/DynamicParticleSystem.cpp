@@ -14,7 +14,8 @@ namespace Logic {
 	//______________________________________________________________________________
 
 	CDynamicParticleSystem::CDynamicParticleSystem() : _graphicParent(NULL) { 
-		// Nada que hacer
+		// Solo sigue a la entidad, puede ir en el lote de su tipo
+		enableBatchedTick();
 	}
 
 	//______________________________________________________________________________
@@ -25,6 +26,14 @@ namespace Logic {
 
 	//______________________________________________________________________________
 
+	TMessageTypeSet CDynamicParticleSystem::getAcceptedMessageTypes() {
+		TMessageTypeSet types = CParticleSystem::getAcceptedMessageTypes();
+		types.set(Message::ACTIVATE);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//______________________________________________________________________________
+
 	bool CDynamicParticleSystem::accept(const std::shared_ptr<CMessage>& message) {
 		return CParticleSystem::accept(message)					||
 			   message->getMessageType() == Message::ACTIVATE;
@@ -86,6 +95,14 @@ namespace Logic {
 			_particleSystem->setOrientation( _entity->getOrientation() );
 		}
 	} // onTick
+
+	//______________________________________________________________________________
+
+	bool CDynamicParticleSystem::onRecycle() {
+		_graphicParent = NULL;
+
+		return CParticleSystem::onRecycle();
+	} // onRecycle
 	//______________________________________________________________________________
 
 	void CDynamicParticleSystem::setVisible(bool visible) {
@@ -24,6 +24,9 @@ namespace Logic {
 		~CDynamicParticleSystem();
 
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
+
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
 		virtual void process(const std::shared_ptr<CMessage>& message);
 
 		// En el caso de tener nodo de escena padre es el vector de
@@ -36,6 +39,7 @@ namespace Logic {
 
 		virtual void onStart();
 		virtual void onTick(unsigned int msecs);
+		virtual bool onRecycle();
 
 		Graphics::CEntity* _graphicParent;
 
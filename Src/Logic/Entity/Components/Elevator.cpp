@@ -74,6 +74,17 @@ namespace Logic
 
 
 
+	TMessageTypeSet CElevator::getAcceptedMessageTypes()
+
+
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CElevator::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED;
@@ -129,7 +140,7 @@ namespace Logic
 					_waitTimeInFinal=0;
 				}
 
-				std::shared_ptr<CMessageKinematicMove> m = std::make_shared<CMessageKinematicMove>();
+				std::shared_ptr<CMessageKinematicMove> m = createMessage<CMessageKinematicMove>();
 				m->setMovement(toDirection);
 				_entity->emitMessage(m);
 			}
@@ -146,7 +157,7 @@ namespace Logic
 					_active=false;
 				}
 
-				std::shared_ptr<CMessageKinematicMove> m = std::make_shared<CMessageKinematicMove>();
+				std::shared_ptr<CMessageKinematicMove> m = createMessage<CMessageKinematicMove>();
 				m->setMovement(toDirection);
 				_entity->emitMessage(m);
 			}
@@ -84,6 +84,18 @@ namespace Logic
 
 
 
+	TMessageTypeSet CElevatorTrigger::getAcceptedMessageTypes()
+
+
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		types.set(Message::UNTOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CElevatorTrigger::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED|| 
@@ -128,7 +140,7 @@ namespace Logic
 			_wait=false;
 
 			//Mensaje para que la parte fsica haga el camino tambin.
-			std::shared_ptr<CMessageTouched> t = std::make_shared<CMessageTouched>();
+			std::shared_ptr<CMessageTouched> t = createMessage<CMessageTouched>();
 			t->setEntity(getEntity());
 			_elevatorLink->emitMessage(t);
  
@@ -156,7 +168,7 @@ namespace Logic
 					_waitTimeInFinal=0;
 				}
 
-				std::shared_ptr<CMessageKinematicMove> m = std::make_shared<CMessageKinematicMove>();
+				std::shared_ptr<CMessageKinematicMove> m = createMessage<CMessageKinematicMove>();
 				m->setMovement(toDirection);
 				_entity->emitMessage(m);
 			}
@@ -174,7 +186,7 @@ namespace Logic
 					_timer=0;
 				}
 
-				std::shared_ptr<CMessageKinematicMove> m = std::make_shared<CMessageKinematicMove>();
+				std::shared_ptr<CMessageKinematicMove> m = createMessage<CMessageKinematicMove>();
 				m->setMovement(toDirection);
 				_entity->emitMessage(m);
 			}
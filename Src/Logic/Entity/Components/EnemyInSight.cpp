@@ -76,7 +76,7 @@ namespace Logic {
 			for(int i = 0; i < entitiesToBeDeleted.size(); ++i) {
 				entity = map->getEntityByID( entitiesToBeDeleted[i]->first->getEntityID() );
 				if(entity != NULL) { // Nos aseguramos de que la entidad no haya sido borrada
-					charName = entitiesToBeDeleted[i]->first->getComponent<CCharacterName>("CCharacterName");
+					charName = entitiesToBeDeleted[i]->first->getComponent<CCharacterName>();
 					if(charName != NULL) {
 						charName->setVisible(false);
 						_namesBeingShown.erase(entitiesToBeDeleted[i]);
@@ -90,12 +90,14 @@ namespace Logic {
 			_raycastTimer = _raycastTimeStep;
 			
 			Ray straightLine(_entity->getPosition() + Vector3(0.0f, _heightShoot, 0.0f), _entity->getOrientation() * Vector3::NEGATIVE_UNIT_Z);
-			std::vector<Physics::CRaycastHit> hits;
-			_physicsServer->raycastMultiple(straightLine, 600.0f, hits, true, Physics::CollisionGroup::ePLAYER);
+			// Como mucho nos interesan los dos impactos ms cercanos: uno puede ser
+			// nuestra propia cpsula y el otro el enemigo
+			Physics::CRaycastHit hits[2];
+			unsigned int nbHits = _physicsServer->raycastMultiple(straightLine, 600.0f, hits, 2, true, Physics::CollisionGroup::ePLAYER);
 			
-			if( !hits.empty() ) {
+			if(nbHits > 0) {
 				CEntity* enemyEntity = NULL;
-				for(int i = 0; i < hits.size(); ++i) {
+				for(unsigned int i = 0; i < nbHits; ++i) {
 					if(hits[i].entity != _entity) {
 						enemyEntity = hits[i].entity;
 						break;
@@ -108,7 +110,7 @@ namespace Logic {
 					TeamFaction::Enum otherEntityTeam = playersMgr->getTeamUsingEntityId( enemyEntity->getEntityID() );
 
 					if(myTeam == TeamFaction::eNONE || otherEntityTeam == TeamFaction::eNONE || myTeam != otherEntityTeam) {
-						CCharacterName* charName = enemyEntity->getComponent<CCharacterName>("CCharacterName");
+						CCharacterName* charName = enemyEntity->getComponent<CCharacterName>();
 						if(charName != NULL) {
 							_namesBeingShown[enemyEntity] = _visibilityTimeStep;
 							charName->setVisible(true);
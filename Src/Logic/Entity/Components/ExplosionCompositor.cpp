@@ -44,6 +44,15 @@ namespace Logic
 	} // spawn
 	//---------------------------------------------------------
 
+	TMessageTypeSet CExplosionCompositor::getAcceptedMessageTypes()
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CExplosionCompositor::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED;
@@ -59,7 +59,7 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CFireBallController::onStart() {
-		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity");
+		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>();
 		assert(_physicComponent != NULL && "Error: La bola de fuego no tiene collider");
 	}
 
@@ -92,6 +92,14 @@ namespace Logic {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CFireBallController::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTACT_ENTER);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CFireBallController::accept(const shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::CONTACT_ENTER;
 	}
@@ -111,7 +119,7 @@ namespace Logic {
 					CEntityFactory::getSingletonPtr()->deferredDeleteEntity(_entity, true);
 
 					if( entityContacted->getType() == "ScreamerShield" ) {
-						CEntity* screamerShieldOwner = entityContacted->getComponent<CScreamerShieldDamageNotifier>("CScreamerShieldDamageNotifier")->getOwner();
+						CEntity* screamerShieldOwner = entityContacted->getComponent<CScreamerShieldDamageNotifier>()->getOwner();
 
 						// Comprobamos que el screamer shield que hemos alcanzado
 						// no es el nuestro
@@ -124,14 +132,14 @@ namespace Logic {
 								TeamFaction::Enum myTeam = playersMgr->getTeamUsingEntityId(_owner->getEntity()->getEntityID());
 
 								if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-									std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+									std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 									damageDone->setDamage(_damage);
 									damageDone->setEnemy( _owner->getEntity() );
 									entityContacted->emitMessage(damageDone);
 								}
 							}
 							else {
-								shared_ptr<CMessageDamaged> dmgMsg = make_shared<CMessageDamaged>();
+								shared_ptr<CMessageDamaged> dmgMsg = createMessage<CMessageDamaged>();
 								dmgMsg->setDamage(_damage);
 								dmgMsg->setEnemy( _owner->getEntity() );
 								entityContacted->emitMessage(dmgMsg);
@@ -270,28 +278,28 @@ namespace Logic {
 
 			if( !playersMgr->friendlyFireIsActive() && enemyId != playerId) {
 				if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-					std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+					std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 					damageDone->setDamage(dmg);
 					damageDone->setEnemy( _owner->getEntity() );
 					entityHit->emitMessage(damageDone);
 				}
 			}
 			else {
-				std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 				damageDone->setDamage(dmg);
 				damageDone->setEnemy( _owner->getEntity() );
 				entityHit->emitMessage(damageDone);
 			}
 		}
 		else {
-			std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+			std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 			damageDone->setDamage(dmg);
 			damageDone->setEnemy( _owner->getEntity() );
 			entityHit->emitMessage(damageDone);
 		}
 
 		//send force message
-		std::shared_ptr<CMessageAddForcePlayer> force = std::make_shared<CMessageAddForcePlayer>();
+		std::shared_ptr<CMessageAddForcePlayer> force = createMessage<CMessageAddForcePlayer>();
 		force->setForce( (entityHit->getPosition() - _entity->getPosition()).normalisedCopy() * _strength);
 		entityHit->emitMessage(force);
 	}
@@ -86,6 +86,11 @@ namespace Logic {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -23,7 +23,8 @@ namespace Logic {
 	//________________________________________________________________________
 
 	CFloatingMovement::CFloatingMovement() : _currentOrbitalPos(0) {
-		// Nada que hacer
+		// El movimiento no depende del resto de componentes del item
+		enableBatchedTick();
 	}
 	
 	//________________________________________________________________________
@@ -159,6 +159,16 @@ namespace Logic
 
 	//---------------------------------------------------------
 
+	TMessageTypeSet CGraphics::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ACTIVATE);
+		types.set(Message::CHANGE_MATERIAL);
+		types.set(Message::DECAL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CGraphics::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
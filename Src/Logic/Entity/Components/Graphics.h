@@ -88,6 +88,9 @@ namespace Logic
 		*/
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
 		/**
 		Mtodo que activa el componente; invocado cuando se activa
 		el mapa donde est la entidad a la que pertenece el componente.
@@ -74,6 +74,15 @@ namespace Logic {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CGrenadeControllerClient::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTACT_ENTER);
+		types.set(Message::CONTACT_EXIT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CGrenadeControllerClient::accept(const std::shared_ptr<CMessage>& message) {
 		//Solamente podemos aceptar un contacto porque luego explotamos
 		return message->getMessageType() == Message::CONTACT_ENTER && !_explotionActive ||
@@ -118,7 +127,7 @@ namespace Logic {
 
 	void CGrenadeControllerClient::createExplotion() {
 		//Sonido de explosion
-		std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+		std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		audioMsg->setRuta(_audioExplotion);
 		audioMsg->setId("audioExplotion");
 		audioMsg->setPosition(_entity->getPosition());
@@ -126,7 +135,7 @@ namespace Logic {
 		audioMsg->setIsPlayer(false);
 		_entity->emitMessage(audioMsg);
 		//Particulas
-		std::shared_ptr<CMessageCreateParticle> particleMsg = std::make_shared<CMessageCreateParticle>();
+		std::shared_ptr<CMessageCreateParticle> particleMsg = createMessage<CMessageCreateParticle>();
 		particleMsg->setParticle("ExplosionParticle");
 		particleMsg->setPosition(_entity->getPosition());
 		_entity->emitMessage(particleMsg);
@@ -63,6 +63,15 @@ namespace Logic
 	} // activate
 	//---------------------------------------------------------
 
+	TMessageTypeSet CHacksaw::getAcceptedMessageTypes()
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CHacksaw::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED;
@@ -75,7 +84,7 @@ namespace Logic
 			case Message::TOUCHED: {
 				std::shared_ptr<CMessageTouched> touchedMsg = std::static_pointer_cast<CMessageTouched>(message);
 
-				std::shared_ptr<Logic::CMessageDamaged> damagedMsg = std::make_shared<Logic::CMessageDamaged>();
+				std::shared_ptr<Logic::CMessageDamaged> damagedMsg = Logic::createMessage<Logic::CMessageDamaged>();
 				damagedMsg->setDamage(1000);
 				damagedMsg->setEnemy(_entity);
 				touchedMsg->getEntity()->emitMessage(damagedMsg);
@@ -103,7 +112,7 @@ namespace Logic
 					_toFinal=false;
 				}
 				
-				std::shared_ptr<CMessageKinematicMove> m = std::make_shared<CMessageKinematicMove>();
+				std::shared_ptr<CMessageKinematicMove> m = createMessage<CMessageKinematicMove>();
 				m->setMovement(toDirection);
 				_entity->emitMessage(m);
 			}
@@ -119,7 +128,7 @@ namespace Logic
 					_toFinal=true;
 				}
 
-				std::shared_ptr<CMessageKinematicMove> m = std::make_shared<CMessageKinematicMove>();
+				std::shared_ptr<CMessageKinematicMove> m = createMessage<CMessageKinematicMove>();
 				m->setMovement(toDirection);
 				_entity->emitMessage(m);
 			}
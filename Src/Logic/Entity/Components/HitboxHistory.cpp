@@ -0,0 +1,82 @@
+/**
+@file HitboxHistory.cpp
+
+Contiene la implementacin del componente que guarda el historial de la
+cpsula de un jugador para la compensacin de lag.
+ 
+@see Logic::CHitboxHistory
+@see Logic::IComponent
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "HitboxHistory.h"
+#include "PhysicController.h"
+
+#include "Logic/Entity/Entity.h"
+#include "Logic/Maps/Map.h"
+#include "Logic/LagCompensation.h"
+#include "Map/MapEntity.h"
+
+#include <cassert>
+
+namespace Logic {
+	
+	IMP_FACTORY(CHitboxHistory);
+
+	//__________________________________________________________________
+
+	CHitboxHistory::CHitboxHistory() : _interpolationTicks(0) {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	CHitboxHistory::~CHitboxHistory() {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	bool CHitboxHistory::spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo) {
+		if( !IComponent::spawn(entity, map, entityInfo) ) return false;
+
+		// Los clientes reproducen a los demas un buffer de snapshot por
+		// detras (ver CPlayerInterpolator)
+		if( entityInfo->hasAttribute("ticksPerSample") && entityInfo->hasAttribute("samplesPerSnapshot") ) {
+			unsigned int ticksPerSample = entityInfo->getIntAttribute("ticksPerSample");
+			unsigned int samplesPerSnapshot = entityInfo->getIntAttribute("samplesPerSnapshot");
+
+			_interpolationTicks = samplesPerSnapshot + ( (samplesPerSnapshot - 1) * (ticksPerSample - 1) );
+		}
+
+		return true;
+	}
+
+	//__________________________________________________________________
+
+	void CHitboxHistory::onActivate() {
+		CPhysicController* controller = _entity->getComponent<CPhysicController>();
+		assert(controller && "CHitboxHistory necesita un CPhysicController en la entidad");
+
+		CLagCompensation::getSingletonPtr()->addEntity(_entity, controller->getCapsuleRadius(), controller->getCapsuleHeight(), _interpolationTicks);
+	}
+
+	//__________________________________________________________________
+
+	void CHitboxHistory::onDeactivate() {
+		CLagCompensation::getSingletonPtr()->removeEntity(_entity);
+	}
+
+	//__________________________________________________________________
+
+	void CHitboxHistory::onFixedTick(unsigned int msecs) {
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+
+		unsigned int tick = _entity->getMap()->getFixedTickCount();
+		lagCompensation->setTime(tick, msecs);
+		lagCompensation->record(_entity, tick, _entity->getPosition());
+	}
+
+} // namespace Logic
@@ -0,0 +1,117 @@
+/**
+@file HitboxHistory.h
+
+Contiene la declaracin del componente que guarda el historial de la
+cpsula de un jugador para la compensacin de lag.
+
+@see Logic::CHitboxHistory
+@see Logic::IComponent
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_HitboxHistory_H
+#define __Logic_HitboxHistory_H
+
+#include "Logic/Entity/Component.h"
+
+namespace Logic {
+	
+	/**
+	Componente del servidor que apunta en CLagCompensation la posicin de
+	la cpsula del jugador en cada paso del tick fijo, para que los disparos
+	de los dems se puedan comprobar contra donde estaba cuando lo vieron.
+	<p>
+	La cpsula se saca del CPhysicController de la entidad. El retardo de
+	interpolacin del cliente se calcula con los mismos atributos que usa
+	CPlayerSnapshot:
+	<ul>
+		<li><strong>ticksPerSample:</strong> Cada cuantos fixed ticks se toma una muestra. </li>
+		<li><strong>samplesPerSnapshot:</strong> Nmero de muestras por snapshot. </li>
+	</ul>
+	
+    @ingroup logicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	
+	class CHitboxHistory : public IComponent {
+		DEC_FACTORY(CHitboxHistory);
+	public:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CHitboxHistory();
+
+		//__________________________________________________________________
+
+		/** Destructor. */
+		virtual ~CHitboxHistory();
+
+		
+		// =======================================================================
+		//                     METODOS HEREDADOS DE ICOMPONENT
+		// =======================================================================
+
+
+		/**
+		Lee los atributos del retardo de interpolacin.
+
+		@param entity Entidad a la que pertenece el componente.
+		@param map Mapa Lgico en el que se registrar el objeto.
+		@param entityInfo Informacin de construccin del objeto ledo del
+		fichero de disco.
+		@return Cierto si la inicializacin ha sido satisfactoria.
+		*/
+		virtual bool spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo);
+
+	protected:
+
+
+		// =======================================================================
+		//                          METODOS PROTEGIDOS
+		// =======================================================================
+
+
+		/** Registra la entidad en CLagCompensation con el historial vaco. */
+		virtual void onActivate();
+
+		//__________________________________________________________________
+
+		/** Quita la entidad de CLagCompensation (muerto no se le puede dar). */
+		virtual void onDeactivate();
+
+		//__________________________________________________________________
+
+		/**
+		Apunta la posicin de la entidad en el paso actual.
+
+		@param msecs Milisegundos transcurridos desde el ltimo tick.
+		*/
+		virtual void onFixedTick(unsigned int msecs);
+
+	private:
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Pasos de tick fijo que el cliente va por detrs al interpolar. */
+		unsigned int _interpolationTicks;
+
+	}; // class CHitboxHistory
+
+	REG_FACTORY(CHitboxHistory);
+
+} // namespace Logic
+
+#endif // __Logic_HitboxHistory_H
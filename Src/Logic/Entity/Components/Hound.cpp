@@ -77,7 +77,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CHound::onStart(){
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
+		_physicController = _entity->getComponent<CPhysicController>();
 	}
 
 	//________________________________________________________________________
@@ -93,7 +93,7 @@ namespace Logic {
 
 				// Mandamos un mensaje al avatar controller para que
 				// vuelva a usar el filtro que corresponde
-				std::shared_ptr<CMessageHoundCharge> houndChargeMsg = std::make_shared<CMessageHoundCharge>();
+				std::shared_ptr<CMessageHoundCharge> houndChargeMsg = createMessage<CMessageHoundCharge>();
 				houndChargeMsg->isActive(false);
 				_entity->emitMessage(houndChargeMsg);
 					
@@ -113,7 +113,7 @@ namespace Logic {
 				_berserkerTimer = 0;
 				_doingSecondarySkill = false;
 
-				auto materialMsg = std::make_shared<CMessageParticleVisibility>();
+				auto materialMsg = createMessage<CMessageParticleVisibility>();
 				materialMsg->setNameParticle("Odor");
 				materialMsg->setVisibility(false);
 				_entity->emitMessage(materialMsg);
@@ -153,7 +153,7 @@ namespace Logic {
 		_biteEntity->activate();
 		_biteEntity->start();
 
-		CBite* biteComponent = _biteEntity->getComponent<CBite>("CBite");
+		CBite* biteComponent = _biteEntity->getComponent<CBite>();
 		biteComponent->setOwner(_entity);
 
 		// Queremos desactivar solo las colisiones con los players y los hitboxes
@@ -166,7 +166,7 @@ namespace Logic {
 
 		// Mandar un mensaje al avatar controller de empujar al player en la direccion
 		// en la que este mirando con el filtro cambiado
-		std::shared_ptr<CMessageHoundCharge> houndChargeMsg = std::make_shared<CMessageHoundCharge>();
+		std::shared_ptr<CMessageHoundCharge> houndChargeMsg = createMessage<CMessageHoundCharge>();
 		houndChargeMsg->setFilterMask(filterMask);
 		houndChargeMsg->setForce(_biteSpeed);
 		_entity->emitMessage(houndChargeMsg);
@@ -185,7 +185,7 @@ namespace Logic {
 		//Arrancamos el cronometro
 		_berserkerTimer = _berserkerDuration;
 
-		auto materialMsg = std::make_shared<CMessageParticleVisibility>();
+		auto materialMsg = createMessage<CMessageParticleVisibility>();
 		materialMsg->setNameParticle("Odor");
 		materialMsg->setVisibility(true);
 		_entity->emitMessage(materialMsg);
@@ -92,6 +92,24 @@ namespace Logic{
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+	TMessageTypeSet CHud::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CHANGE_MATERIAL_HUD_WEAPON);
+		types.set(Message::HUD);
+		types.set(Message::HUD_AMMO);
+		types.set(Message::HUD_DEBUG);
+		types.set(Message::HUD_DEBUG_DATA);
+		types.set(Message::HUD_DISPERSION);
+		types.set(Message::HUD_LIFE);
+		types.set(Message::HUD_SHIELD);
+		types.set(Message::HUD_SPAWN);
+		types.set(Message::HUD_WEAPON);
+		types.set(Message::IMPACT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CHud::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -435,6 +435,23 @@ namespace Logic
 	} // spawn
 	//---------------------------------------------------------
 
+	TMessageTypeSet CHudOverlay::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CHANGE_MATERIAL_HUD_WEAPON);
+		types.set(Message::HUD_AMMO);
+		types.set(Message::HUD_DEBUG);
+		types.set(Message::HUD_DEBUG_DATA);
+		types.set(Message::HUD_DISPERSION);
+		types.set(Message::HUD_LIFE);
+		types.set(Message::HUD_SHIELD);
+		types.set(Message::HUD_SPAWN);
+		types.set(Message::HUD_WEAPON);
+		types.set(Message::IMPACT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CHudOverlay::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -570,7 +587,7 @@ namespace Logic
 			for (std::map<std::string,std::string>::iterator it=_textDebug.begin(); it!=_textDebug.end(); ++it){
 				_sDebug << it->first << " => " << it->second << '\n';
 			}
-			std::shared_ptr<CMessageHudDebugData> m = std::make_shared<CMessageHudDebugData>();
+			std::shared_ptr<CMessageHudDebugData> m = createMessage<CMessageHudDebugData>();
 			m->setKey("Posicion");
 			m->setValue(_entity->getPosition());
 			_entity->emitMessage(m);
@@ -285,17 +285,26 @@ namespace Logic {
 		}
 		_graphicsEntities[WeaponType::eSOUL_REAPER].graphicsEntity->setVisible(true);
 
-		_avatarController = _entity->getComponent<CAvatarController>("CAvatarController");
+		_avatarController = _entity->getComponent<CAvatarController>();
 		assert(_avatarController != NULL && "Error: Se necesita el componente avatar controller");
 
 		_avatarController->addObserver(this);
 
-		float cameraLandTime = Math::PI / _entity->getComponent<CCameraFeedbackNotifier>("CCameraFeedbackNotifier")->getLandRecoverySpeed();
+		float cameraLandTime = Math::PI / _entity->getComponent<CCameraFeedbackNotifier>()->getLandRecoverySpeed();
 		_landAnim.recoverySpeed = Math::PI / cameraLandTime;
 	}
 	
 	//________________________________________________________________________
 
+	TMessageTypeSet CHudWeapons::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CHANGE_WEAPON_GRAPHICS);
+		types.set(Message::SET_TRANSFORM);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CHudWeapons::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -355,7 +364,7 @@ namespace Logic {
 	void CHudWeapons::changeWeapon(int newWeapon) {
 		_linking = _continouslyShooting = _loadingWeapon = false;
 
-		shared_ptr<CMessageBlockShoot> lockWeaponsMsg = make_shared<CMessageBlockShoot>();
+		shared_ptr<CMessageBlockShoot> lockWeaponsMsg = createMessage<CMessageBlockShoot>();
 		lockWeaponsMsg->canShoot(false);
 		_entity->emitMessage(lockWeaponsMsg);
 
@@ -560,7 +569,7 @@ namespace Logic {
 			_changingWeapon = false;
 			_chgWpnAnim.offset = Vector3::ZERO;
 
-			shared_ptr<CMessageBlockShoot> lockWeaponsMsg = make_shared<CMessageBlockShoot>();
+			shared_ptr<CMessageBlockShoot> lockWeaponsMsg = createMessage<CMessageBlockShoot>();
 			lockWeaponsMsg->canShoot(true);
 			_entity->emitMessage(lockWeaponsMsg);
 		}
@@ -49,6 +49,12 @@ namespace Logic  {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CInterpolation::getAcceptedMessageTypes() {
+		return TMessageTypeSet();
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CInterpolation::accept(const std::shared_ptr<CMessage>& message) {
 		return false;
 	} // accept
@@ -67,13 +73,13 @@ namespace Logic  {
 		//calculamos la direccion en la que debemos interpolar
 		Vector3 direction = (_serverDirection*Vector3(1,0,1)).normalisedCopy();
 		//calculamos el movimiento que debe hacer el monigote, mucho mas lento del que debe hacer de normal
-		direction*=(_entity->getComponent<CAvatarController>("CAvatarController")->getVelocity()*Vector3(1,0,1)).length()*0.25f;
+		direction*=(_entity->getComponent<CAvatarController>()->getVelocity()*Vector3(1,0,1)).length()*0.25f;
 
 		//si nos hemos pasado, debemos moverlo al sitio
 		if(direction.length() > _distance){
 			direction*=(_distance/direction.length());
 		}
-		_entity->getComponent<CPhysicController>("CPhysicController")->move(direction,msecs);
+		_entity->getComponent<CPhysicController>()->move(direction,msecs);
 		_distance -= direction.length();
 
 		//si hemos terminado de interpolar, lo dejamos
@@ -119,7 +125,7 @@ namespace Logic  {
 
 		if((serverPos-_entity->getPosition()).length()< _minDistance)
 			return;
-		Vector3 serverDisplacement = _entity->getComponent<CAvatarController>("CAvatarController")->getVelocity();
+		Vector3 serverDisplacement = _entity->getComponent<CAvatarController>()->getVelocity();
 
 		//esta es la posi que suponemos que tiene el server en eeste momento
 		if(_actualPing > _msecs)
@@ -134,7 +140,7 @@ namespace Logic  {
 
 		//si nuestra distancia es inadmisible, lo ponemos donde nos ha dicho el servidor mas lo que hemos supuesto
 		if(distance > _maxDistance){
-			_entity->getComponent<CPhysicController>("CPhysicController")->setPhysicPosition(serverPos);
+			_entity->getComponent<CPhysicController>()->setPhysicPosition(serverPos);
 			//Movemos la orientacion logica/grafica
 			Matrix3 tmpMatrix;
 			_serverPos.extract3x3Matrix(tmpMatrix);
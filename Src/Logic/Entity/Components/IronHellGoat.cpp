@@ -295,7 +295,7 @@ namespace Logic {
 
 		// Le indicamos al controlador de la bola que este componente es el poseedor
 		// para que se invoque al metodo correspondiente cuando las bolas mueran
-		CFireBallController* fbController = fireBall->getComponent<CFireBallController>("CFireBallController");
+		CFireBallController* fbController = fireBall->getComponent<CFireBallController>();
 		fbController->setOwner(this);
 
 		// Arrancamos la entidad
@@ -68,9 +68,9 @@ namespace Logic {
 		_maxAmmoPerShot = weapon->getIntAttribute( "MaxAmmoPerShot");
 		_ammoSpentTimeStep = (float)_maxLoadingTime / (float)(_maxAmmoPerShot);
 
-		_friend[_friends] = _entity->getComponent<Logic::CIronHellGoat>("CIronHellGoat");
+		_friend[_friends] = _entity->getComponent<Logic::CIronHellGoat>();
 		if(_friend[_friends]) ++_friends;
-		_friend[_friends] = _entity->getComponent<Logic::CIronHellGoatFeedback>("CIronHellGoatFeedback");
+		_friend[_friends] = _entity->getComponent<Logic::CIronHellGoatFeedback>();
 		if(_friend[_friends]) ++_friends;
 		if(_friends == 0) assert("\nTiene que tenes alguno de los dos componentes");
 
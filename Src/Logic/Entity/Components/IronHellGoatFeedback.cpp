@@ -64,7 +64,7 @@ namespace Logic {
 		emitSound("weapons/ironHellGoat/shootFireBall2.wav", false, true, false, false);
 
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 		shootFlash->setColor( Vector3(1.0f, 0.8f, 0.0f) );
 		shootFlash->setAttenuation( Vector3(1.0f, 0.014f, 0.0007f) );
 		shootFlash->setRange(325.0f);
@@ -49,6 +49,15 @@ namespace Logic
 	} // spawn
 	//---------------------------------------------------------
 
+	TMessageTypeSet CJumper::getAcceptedMessageTypes()
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CJumper::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED;
@@ -60,7 +69,7 @@ namespace Logic
 	{
 		switch( message->getMessageType() ) {
 			case Message::TOUCHED: {
-				std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+				std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 				std::shared_ptr<CMessageTouched> touchedMsg = std::static_pointer_cast<CMessageTouched>(message);
 
 				applyJump(touchedMsg->getEntity());
@@ -72,7 +81,7 @@ namespace Logic
 
 				_entity->emitMessage(audioMsg);
 
-				std::shared_ptr<CMessageParticleStart> particleMsg = std::make_shared<CMessageParticleStart>();
+				std::shared_ptr<CMessageParticleStart> particleMsg = createMessage<CMessageParticleStart>();
 				_entity->emitMessage(particleMsg);
 
 				break;
@@ -83,7 +92,7 @@ namespace Logic
 	//---------------------------------------------------------
 
 	void CJumper::applyJump(CEntity *entity) {
-		std::shared_ptr<CMessageAddForcePlayer> forcePlayerMsg = std::make_shared<CMessageAddForcePlayer>();
+		std::shared_ptr<CMessageAddForcePlayer> forcePlayerMsg = createMessage<CMessageAddForcePlayer>();
 		forcePlayerMsg->setForce(_force);
 		entity->emitMessage(forcePlayerMsg);
 	} // applyJump
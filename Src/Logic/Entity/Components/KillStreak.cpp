@@ -70,6 +70,17 @@ namespace Logic
 
 
 
+	TMessageTypeSet CKillStreak::getAcceptedMessageTypes()
+
+
+	{
+		TMessageTypeSet types;
+		types.set(Message::KILL_STREAK);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CKillStreak::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::KILL_STREAK;
@@ -163,7 +174,7 @@ namespace Logic
 			case 1: //x3: Aumento de la vida.
 			{
 				std::cout << "Envio vida" << std::endl;
-				std::shared_ptr<Logic::CMessageAddLife> messageLife = std::make_shared<Logic::CMessageAddLife>();
+				std::shared_ptr<Logic::CMessageAddLife> messageLife = Logic::createMessage<Logic::CMessageAddLife>();
 				messageLife->setAddLife(20);
 				this->getEntity()->emitMessage(messageLife);
 			}
@@ -48,6 +48,17 @@ namespace Logic
 	//--------------------------------------------------------
 
 
+	TMessageTypeSet CLava::getAcceptedMessageTypes()
+
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		types.set(Message::UNTOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//--------------------------------------------------------
+
 	bool CLava::accept(const std::shared_ptr<CMessage>& message)
 	{
 		Logic::TMessageType msgType = message->getMessageType();
@@ -85,7 +96,7 @@ namespace Logic
 		if(_intrigger.size()>0 && _timestamp > _timeDamage){
 			std::list<CEntity*>::const_iterator it = _intrigger.begin();
 			for(; it != _intrigger.end(); ++it) {
-				std::shared_ptr<CMessageDamaged> damage = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damage = createMessage<CMessageDamaged>();
 				damage->setDamage(_damage);
 				damage->setEnemy(_entity);
 				(*it)->emitMessage(damage);
@@ -112,17 +112,30 @@ namespace Logic {
 
 		// @deprecated
 		// Actualizamos la info del HUD
-		std::shared_ptr<CMessageHudLife> hudLifeMsg = std::make_shared<CMessageHudLife>();
+		std::shared_ptr<CMessageHudLife> hudLifeMsg = createMessage<CMessageHudLife>();
 		hudLifeMsg->setLife(_currentLife);
 		_entity->emitMessage(hudLifeMsg);	
 		
-		std::shared_ptr<CMessageHudShield> hudShieldMsg = std::make_shared<CMessageHudShield>();
+		std::shared_ptr<CMessageHudShield> hudShieldMsg = createMessage<CMessageHudShield>();
 		hudShieldMsg->setShield(_currentShield);
 		_entity->emitMessage(hudShieldMsg);	
 	} // activate
 	
 	//________________________________________________________________________
 
+	TMessageTypeSet CLife::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ADD_LIFE);
+		types.set(Message::ADD_SHIELD);
+		types.set(Message::DAMAGED);
+		types.set(Message::SET_REDUCED_DAMAGE);
+		types.set(Message::SPAWN_IS_LIVE);
+		types.set(Message::SPELL_HUNGRY);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CLife::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -181,7 +194,7 @@ namespace Logic {
 
 			// Actualizacin la informacin de vida del HUD
 			// @deprecated
-			std::shared_ptr<CMessageHudLife> hudLifeMsg = std::make_shared<CMessageHudLife>();
+			std::shared_ptr<CMessageHudLife> hudLifeMsg = createMessage<CMessageHudLife>();
 			hudLifeMsg->setLife(_currentLife);
 			_entity->emitMessage(hudLifeMsg);	
 
@@ -193,7 +206,7 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CLife::onStart() {
-		std::shared_ptr<CMessagePlayerDead> playerDeadMsg = std::make_shared<CMessagePlayerDead>();
+		std::shared_ptr<CMessagePlayerDead> playerDeadMsg = createMessage<CMessagePlayerDead>();
 		_entity->emitMessage(playerDeadMsg);
 	}
 
@@ -218,7 +231,7 @@ namespace Logic {
 
 		// @deprecated -> guarreo para el gamelab por falta de tiempo, pero
 		// esto aqui esta muy muy mal hecho (nios malos xD)
-		std::shared_ptr<CMessageHud> hudMsg = std::make_shared<CMessageHud>();
+		std::shared_ptr<CMessageHud> hudMsg = createMessage<CMessageHud>();
 		hudMsg->setType(CMessageHud::HudType::HIT);
 		enemy->emitMessage(hudMsg);
 
@@ -234,7 +247,7 @@ namespace Logic {
 			else
 				_currentLife = _maxLife;
 
-			std::shared_ptr<CMessageHudLife> hudLifeMsg = std::make_shared<CMessageHudLife>();
+			std::shared_ptr<CMessageHudLife> hudLifeMsg = createMessage<CMessageHudLife>();
 			hudLifeMsg->setLife(_currentLife);
 			_entity->emitMessage(hudLifeMsg);
 		}
@@ -249,7 +262,7 @@ namespace Logic {
 			else
 				_currentShield = _maxShield;
 
-			std::shared_ptr<CMessageHudShield> hudShieldMsg = std::make_shared<CMessageHudShield>();
+			std::shared_ptr<CMessageHudShield> hudShieldMsg = createMessage<CMessageHudShield>();
 			hudShieldMsg->setShield(_currentShield);
 			_entity->emitMessage(hudShieldMsg);
 		}// addShield
@@ -289,7 +302,7 @@ namespace Logic {
 			}
 
 			// Actualizamos los puntos de armadura mostrados en el HUD
-			std::shared_ptr<CMessageHudShield> hudShieldMsg = std::make_shared<CMessageHudShield>();
+			std::shared_ptr<CMessageHudShield> hudShieldMsg = createMessage<CMessageHudShield>();
 			hudShieldMsg->setShield(_currentShield);
 			_entity->emitMessage(hudShieldMsg);
 		}
@@ -298,7 +311,7 @@ namespace Logic {
 		}
 
 		// Actualizamos los puntos de salud mostrados en el HUD
-		std::shared_ptr<CMessageHudLife> hudLifeMsg = std::make_shared<CMessageHudLife>();
+		std::shared_ptr<CMessageHudLife> hudLifeMsg = createMessage<CMessageHudLife>();
 		hudLifeMsg->setLife(_currentLife);
 		_entity->emitMessage(hudLifeMsg);
 
@@ -312,12 +325,12 @@ namespace Logic {
 
 		// Mensaje de playerDead para tratar el respawn y desactivar los componentes
 		// del personaje.
-		std::shared_ptr<CMessagePlayerDead> playerDeadMsg = std::make_shared<CMessagePlayerDead>();
+		std::shared_ptr<CMessagePlayerDead> playerDeadMsg = createMessage<CMessagePlayerDead>();
 		playerDeadMsg->setKiller(enemy);
 		_entity->emitMessage(playerDeadMsg);
 
 		//Emitir el mensaje para los killstreak, no me est llegando :S
-		std::shared_ptr<CMessageKillStreak> msKS = std::make_shared<CMessageKillStreak>();
+		std::shared_ptr<CMessageKillStreak> msKS = createMessage<CMessageKillStreak>();
 		msKS->setKiller(enemy->getEntityID());
 		enemy->emitMessage(msKS);
 
@@ -328,7 +341,7 @@ namespace Logic {
 		// Mensaje para que la camara enfoque al jugador que nos ha matado
 		// En el caso de la red, hay que enviar un mensaje especial para el cliente
 		// Siempre y cuando no haya muerto un remotePlayer/enemigo (debug singlePlayer)
-		std::shared_ptr<CMessageCameraToEnemy> cteMsg = std::make_shared<CMessageCameraToEnemy>();
+		std::shared_ptr<CMessageCameraToEnemy> cteMsg = createMessage<CMessageCameraToEnemy>();
 		CEntity* camera=camera = CServer::getSingletonPtr()->getMap()->getEntityByName("Camera");
 		assert(camera != NULL && "Error: Esto no se puede hacer asi que sois unos lamers, ahora el servidor que hace?");
 		cteMsg->setEnemy(enemy);
@@ -344,7 +357,7 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CLife::triggerDeathSound(CEntity* enemy) {
-		std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+		std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 
 		std::string audioFile;
 		if(enemy->getType() == "Lava") {
@@ -373,7 +386,7 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CLife::triggerHurtSound() {
-		std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+		std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 
 		audioMsg->setAudioName(_audioPain);
 		audioMsg->isLoopable(false);
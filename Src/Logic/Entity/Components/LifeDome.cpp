@@ -52,9 +52,9 @@ namespace Logic
 		if(!IComponent::spawn(entity,map,entityInfo))
 			return false;
 
-		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity"); 	
+		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>(); 	
 
-		_cGraph = _entity->getComponent<CParticleSystem>("CParticleSystem");
+		_cGraph = _entity->getComponent<CParticleSystem>();
 
 		_life  = entityInfo->getIntAttribute("lifeDomeLife");
 		_lifePerFriend = entityInfo->getIntAttribute("lifeDomePerFriend");
@@ -64,6 +64,17 @@ namespace Logic
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CLifeDome::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::DAMAGED);
+		types.set(Message::SET_OWNER);
+		types.set(Message::SET_REDUCED_DAMAGE);
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CLifeDome::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -144,13 +155,13 @@ namespace Logic
 		auto temp = _lifeGiven.find(entityTouched->getEntityID());
 		if(entityTouched->getEntityID() != _owner->getEntityID() && temp == _lifeGiven.end()){
 			// He de comprobar que es amigo, o eso, o en el filtro que solo le de a los amigos
-			std::shared_ptr<CMessageAddLife> addLifeMsg = std::make_shared<CMessageAddLife>();
+			std::shared_ptr<CMessageAddLife> addLifeMsg = createMessage<CMessageAddLife>();
 			addLifeMsg->setAddLife(_life);
 			entityTouched->emitMessage(addLifeMsg);
 
 			// Lo insertamos en la lista para que no se le envie mas veces.
 			_lifeGiven.insert(entityTouched->getEntityID());
-			std::shared_ptr<CMessageAddLife> addLifeMsg2 = std::make_shared<CMessageAddLife>();
+			std::shared_ptr<CMessageAddLife> addLifeMsg2 = createMessage<CMessageAddLife>();
 			addLifeMsg2->setAddLife(_lifePerFriend);
 			_owner->emitMessage(addLifeMsg2);
 		}
@@ -69,6 +69,11 @@ namespace Logic
 
 		//__________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//__________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
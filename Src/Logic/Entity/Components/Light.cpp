@@ -113,6 +113,14 @@ namespace Logic {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CLight::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CLight::accept(const std::shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
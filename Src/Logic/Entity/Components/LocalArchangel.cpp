@@ -30,6 +30,14 @@ namespace Logic{
 	}
 	//------------------------------------------------------
 
+	TMessageTypeSet CLocalArchangel::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CHANGE_MATERIAL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//------------------------------------------------------
+
 	bool CLocalArchangel::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 		return msgType == Message::CHANGE_MATERIAL;
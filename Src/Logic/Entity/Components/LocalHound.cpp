@@ -29,8 +29,8 @@ namespace Logic{
 		//_berserkerDamagePercent = entityInfo->getFloatAttribute("berserkerDamagePercent");
 		//_berserkerCooldownPercent = entityInfo->getFloatAttribute("berserkerCooldownPercent");
 
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
-		_avatarController = _entity->getComponent<CAvatarController>("CAvatarController");
+		_physicController = _entity->getComponent<CPhysicController>();
+		_avatarController = _entity->getComponent<CAvatarController>();
 		
 		return true;
 	} // spawn
@@ -46,6 +46,14 @@ namespace Logic{
 	}
 	//------------------------------------------------------
 
+	TMessageTypeSet CLocalHound::getAcceptedMessageTypes() {
+		TMessageTypeSet types = CPlayerClass::getAcceptedMessageTypes();
+		types.set(Message::CHANGE_MATERIAL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//------------------------------------------------------
+
 	bool CLocalHound::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 		return CPlayerClass::accept(message) ||
@@ -31,6 +31,14 @@ namespace Logic{
 		_scene->setCompositorVisible(_colourEffect, false);
 	}
 
+	TMessageTypeSet CLocalShadow::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CHANGE_MATERIAL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CLocalShadow::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 		return msgType == Message::CHANGE_MATERIAL;
@@ -15,6 +15,7 @@ Contiene la implementaci
 #include "BaseSubsystems/Euler.h"
 #include "Logic/Maps/EntityFactory.h"
 #include "Logic/GameNetPlayersManager.h"
+#include "Logic/LagCompensation.h"
 #include "Logic/Maps/Map.h"
 #include "Logic/Server.h"
 #include "Map/MapEntity.h"
@@ -247,8 +248,12 @@ namespace Logic {
 		decrementAmmo();
 
 		// Rayo lanzado por el servidor de fsicas de acuerdo a la distancia de potencia del arma
-		std::vector<Physics::CRaycastHit> hits;
-		Physics::CServer::getSingletonPtr()->raycastMultiple(ray, _distance,hits, true, Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eSCREAMER_SHIELD | Physics::CollisionGroup::eHITBOX);
+		// Los jugadores se comprueban donde los veia el tirador
+		std::vector<Physics::CRaycastHit>& hits = _hits;
+		hits.clear();
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+		lagCompensation->rewind(_entity);
+		lagCompensation->raycastMultiple(ray, _distance,hits, true, Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eSCREAMER_SHIELD | Physics::CollisionGroup::eHITBOX);
 
 		//Devolvemos lo primero tocado que no seamos nosotros mismos
 		CEntity* touched=NULL;
@@ -262,7 +267,7 @@ namespace Logic {
 				drawDecal(hits[i].entity, hits[i].impact, (int)WeaponType::eMINIGUN);
 			
 				// Aado aqui las particulas de dado en la pared.
-				/*auto m = std::make_shared<CMessageCreateParticle>();
+				/*auto m = createMessage<CMessageCreateParticle>();
 				m->setPosition(hits[i].impact);
 				m->setParticle("impactParticle");
 				m->setDirectionWithForce(hits[i].normal);
@@ -285,7 +290,7 @@ namespace Logic {
 			else if(hits[i].entity!=_entity) {
 				if(hits[i].entity->getType() == "ScreamerShield") 
 				{
-					CEntity* screamerShieldOwner = hits[i].entity->getComponent<CScreamerShieldDamageNotifier>("CScreamerShieldDamageNotifier")->getOwner();
+					CEntity* screamerShieldOwner = hits[i].entity->getComponent<CScreamerShieldDamageNotifier>()->getOwner();
 
 					// Si se trata de un escudo enemigo nos quedamos con esta
 					// entidad y pintamos las particulas
@@ -342,14 +347,14 @@ namespace Logic {
 				TeamFaction::Enum myTeam = playersMgr->getTeamUsingEntityId(playerId);
 
 				if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-					std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+					std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 					damageDone->setDamage(damage);
 					damageDone->setEnemy( _entity );
 					entityHit->emitMessage(damageDone);
 				}
 			}
 			else {
-				std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 				damageDone->setDamage(damage);
 				damageDone->setEnemy( _entity );
 				entityHit->emitMessage(damageDone);
@@ -361,21 +366,21 @@ namespace Logic {
 
 			if( !playersMgr->friendlyFireIsActive() && enemyId != playerId) {
 				if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-					std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+					std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 					damageDone->setDamage(damage);
 					damageDone->setEnemy( _entity );
 					entityHit->emitMessage(damageDone);
 				}
 			}
 			else {
-				std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 				damageDone->setDamage(damage);
 				damageDone->setEnemy( _entity );
 				entityHit->emitMessage(damageDone);
 			}
 		}
 		else {
-			std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+			std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 			damageDone->setDamage(damage);
 			damageDone->setEnemy( _entity );
 			entityHit->emitMessage(damageDone);
@@ -390,12 +395,15 @@ namespace Logic {
 		if( !isActivated() ) return;
 
 		//Creacin de sweephit para 
-		Physics::SphereGeometry sphere  = Physics::CGeometryFactory::getSingletonPtr()->createSphere(3.5);
-		std::vector<Physics::CSweepHit> hits;
+		std::vector<Physics::CSweepHit>& hits = _sweepHits;
+		hits.clear();
 		//Physics::CServer::getSingletonPtr()->sweepMultiple(sphere, (_entity->getPosition() + Vector3(0,_heightShoot,0)),_directionShoot,_screamerScreamMaxDistance,hitSpots, true);
 		Vector3 vDirectionShoot =_entity->getOrientation() * Vector3::NEGATIVE_UNIT_Z;
 		vDirectionShoot.normalise();
-		Physics::CServer::getSingletonPtr()->sweepMultiple(sphere, (_entity->getPosition() + Vector3(0,_heightShoot,0)),vDirectionShoot, _distance,hits, true, 
+		// Los jugadores se comprueban donde los veia el tirador
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+		lagCompensation->rewind(_entity);
+		lagCompensation->sweepMultiple(3.5f, (_entity->getPosition() + Vector3(0,_heightShoot,0)),vDirectionShoot, _distance,hits, true, 
 			Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eSCREAMER_SHIELD | Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::eHITBOX);	
 
 		int danyoTotal = _damage * _currentSpentSecondaryAmmo;
@@ -425,7 +433,7 @@ namespace Logic {
 			}
 
 			else if( typeEntity == "ScreamerShield") {
-				CEntity* screamerShieldOwner = it->entity->getComponent<CScreamerShieldDamageNotifier>("CScreamerShieldDamageNotifier")->getOwner();
+				CEntity* screamerShieldOwner = it->entity->getComponent<CScreamerShieldDamageNotifier>()->getOwner();
 
 				// Si se trata de un escudo enemigo nos quedamos con esta
 				// entidad y pintamos las particulas
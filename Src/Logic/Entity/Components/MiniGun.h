@@ -15,6 +15,10 @@ Contiene la declaraci
 #define __Logic_MiniGun_H
 
 #include "Logic/Entity/Components/Weapon.h"
+#include "Physics/RaycastHit.h"
+#include "Physics/SweepHit.h"
+
+#include <vector>
 
 namespace Logic {
 	
@@ -119,6 +123,15 @@ namespace Logic {
 		float _distance;
 
 		bool _primaryFireIsActive;
+
+		/** 
+		Impactos del ltimo disparo. Es miembro para que el vector conserve su
+		capacidad entre disparos y disparar no reserve memoria.
+		*/
+		std::vector<Physics::CRaycastHit> _hits;
+
+		/** Impactos del ltimo barrido, por el mismo motivo que _hits. */
+		std::vector<Physics::CSweepHit> _sweepHits;
 	}; // class CMiniGun
 
 	REG_FACTORY(CMiniGun);
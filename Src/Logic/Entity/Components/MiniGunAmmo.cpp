@@ -83,9 +83,9 @@ namespace Logic {
 		_maxAmmoSpentPerSecondaryShot = weapon->getIntAttribute("MaxAmmoSpentPerSecondaryShot");
 		_defaultAmmoSpentTimeStep = _ammoSpentTimeStep = (float)_secondaryFireLoadTime / (float)(_maxAmmoSpentPerSecondaryShot);
 
-		_friend[_friends] = _entity->getComponent<Logic::CMiniGun>("CMiniGun");
+		_friend[_friends] = _entity->getComponent<Logic::CMiniGun>();
 		if(_friend[_friends]) ++_friends;
-		_friend[_friends] = _entity->getComponent<Logic::CMiniGunFeedback>("CMiniGunFeedback");
+		_friend[_friends] = _entity->getComponent<Logic::CMiniGunFeedback>();
 		if(_friend[_friends]) ++_friends;
 		if(_friends == 0) assert("\nTiene que tenes alguno de los dos componentes");
 
@@ -211,7 +211,7 @@ namespace Logic {
 		_currentSpentSecondaryAmmo = _ammoSpentTimer = 0;
 
 		// Termino el sonido del disparo cargao
-		/*auto m = std:: make_shared<CMessageAudio>();
+		/*auto m = std:: createMessage<CMessageAudio>();
 		m->setAudioName("minigun.wav");
 		m->isLoopable(false);
 		m->is3dSound(true);
@@ -81,7 +81,7 @@ namespace Logic {
 		//emitSound(_weaponSound, true, true, false, false);
 		
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 		shootFlash->setColor( Vector3(0.098f, 0.823f, 0.161f) );
 		shootFlash->setAttenuation( Vector3(1.0f, 0.014f, 0.0007f) );
 		shootFlash->setRange(325.0f);
@@ -90,7 +90,7 @@ namespace Logic {
 
 		emitParticle2();
 
-		_currentParticle->getComponent<CDynamicParticleSystem>("CDynamicParticleSystem")->setVisible(true);
+		_currentParticle->getComponent<CDynamicParticleSystem>()->setVisible(true);
 	}
 
 	//__________________________________________________________________
@@ -103,21 +103,21 @@ namespace Logic {
 		
 		_iContadorLeftClicked = 0;
 		//Envo el mensaje con valores para que resetee la mirilla
-		auto m = std::make_shared<CMessageHudDispersion>();
+		auto m = createMessage<CMessageHudDispersion>();
 		m->setTime(0);
 		m->setReset(true);
 		_entity->emitMessage(m);
 
-		_entity->getComponent<CDynamicLight>("CDynamicLight")->turnOff();
+		_entity->getComponent<CDynamicLight>()->turnOff();
 		_primaryFireIsActive = false;
 
 
-		std::shared_ptr<CMessageActivate> activateMsg = std::make_shared<CMessageActivate>();
+		std::shared_ptr<CMessageActivate> activateMsg = createMessage<CMessageActivate>();
 		activateMsg->setActivated(false);
 		_currentParticle->emitMessage(activateMsg);
 		printf("\n para de emitir");
 
-		_currentParticle->getComponent<CDynamicParticleSystem>("CDynamicParticleSystem")->setVisible(false);
+		_currentParticle->getComponent<CDynamicParticleSystem>()->setVisible(false);
 		_soundTimer = _soundRate;
 	}
 
@@ -136,7 +136,7 @@ namespace Logic {
 		//emitSound("miniGun", false, true, false, true);
 		
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 		shootFlash->setColor( Vector3(0.9f, 0.9f, 0.9f) );
 		shootFlash->setAttenuation( Vector3(1.0f, 0.014f, 0.0007f) );
 		shootFlash->setRange(325.0f);
@@ -144,7 +144,7 @@ namespace Logic {
 
 		//emitParticle2(false);
 
-		_currentParticle->getComponent<CDynamicParticleSystem>("CDynamicParticleSystem")->setVisible(false);
+		_currentParticle->getComponent<CDynamicParticleSystem>()->setVisible(false);
 		Audio::CServer::getSingletonPtr()->playSound("weapons/minigun/shoot.wav");
 	}
 
@@ -180,7 +180,7 @@ namespace Logic {
 						_dispersion = _dispersionOriginal + 15.0f;
 						//Enviamos el mensaje para que empiece a modificar la mirilla con la dispersin
 
-						std::shared_ptr<CMessageHudDispersion> m = std::make_shared<CMessageHudDispersion>();
+						std::shared_ptr<CMessageHudDispersion> m = createMessage<CMessageHudDispersion>();
 						m->setHeight(8.0f);
 						m->setWidth(9.0f);
 						m->setTime(2500);//Tiempo mximo que bajar el tamao de la mirilla
@@ -213,7 +213,7 @@ namespace Logic {
 
 	void CMiniGunFeedback::flashAnim() {
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 
 		if(_firingRound) {
 			float r = Math::unifRand(0.098f, 0.18f);
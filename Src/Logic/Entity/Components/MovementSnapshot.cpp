@@ -16,7 +16,6 @@
 #include "Map/MapEntity.h"
 #include "Basesubsystems/Math.h"
 
-#include "Logic/Messages/MessageSyncPosition.h"
 #include "Logic/Messages/MessageControl.h"
 #include "Logic/Entity/Components/AvatarController.h"
 
@@ -40,6 +39,14 @@ namespace Logic  {
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+	TMessageTypeSet CMovementSnapshot::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTROL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CMovementSnapshot::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::CONTROL;
 	} // accept
@@ -65,14 +72,6 @@ namespace Logic  {
 		}
 
 	} // proces
-	
-	//________________________________________________________________________
 
-	void CMovementSnapshot::onFixedTick(unsigned int msecs){
-		std::shared_ptr<CMessageSyncPosition> msg = std::make_shared<CMessageSyncPosition>();
-		msg->setPosition( _entity->getPosition() );
-		msg->setOrientation( _entity->getOrientation() );
-		CGameNetMsgManager::getSingletonPtr()->sendEntityMessage(msg, _entity->getEntityID());
-	}
 } // namespace Logic
 
@@ -20,8 +20,9 @@ namespace Logic  {
 	/**
     @ingroup logicGroup
 
-	Clase encargada de recolocar al jugador en caso de no estar sincronizados
-	con el servidor.
+	Clase encargada de reenviar al servidor los controles de disparo y
+	habilidades del jugador local. El movimiento viaja como comandos de
+	entrada (ver CNetCommands).
 
 	@author Francisco Aisa Garca
 	@date Febrero, 2013
@@ -65,7 +66,6 @@ namespace Logic  {
 		Este componente acepta los siguientes mensajes:
 
 		<ul>
-			<li>SYNC_POSITION</li>
 			<li>CONTROL</li>
 		</ul>
 		
@@ -76,6 +76,11 @@ namespace Logic  {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -83,12 +88,6 @@ namespace Logic  {
 		*/
 		virtual void process(const std::shared_ptr<CMessage>& message);
 
-		//________________________________________________________________________
-
-	protected:
-
-		/** Tick de reloj del componente. */
-		virtual void onFixedTick(unsigned int msecs);
 	}; // class CMovementSnapshot
 
 	REG_FACTORY(CMovementSnapshot);
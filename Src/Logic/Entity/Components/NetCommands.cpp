@@ -2,6 +2,7 @@
 @file NetCommands.cpp
 
 @author Rubn Mulero Guerrero
+@author Francisco Aisa Garca
 @date May, 2013
 */
 
@@ -12,68 +13,62 @@
 #include "Map/MapEntity.h"
 #include "Basesubsystems/Math.h"
 
-#include "Logic/Messages/MessageSyncPosition.h"
 #include "Logic/Messages/MessageControl.h"
+#include "Logic/Messages/MessagePlayerInput.h"
+#include "Logic/Messages/MessagePlayerState.h"
 
 #include "Logic/Entity/Components/PhysicController.h"
-#include "Logic/Entity/Components/Interpolation.h"
 #include "Logic/Entity/Components/AvatarController.h"
 
 #include "Logic/GameNetMsgManager.h"
 
-namespace Logic 
+namespace Logic
 {
 	IMP_FACTORY(CNetCommands);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void CNetCommands::onFixedTick(unsigned int msecs) {
+	bool CNetCommands::spawn(CEntity *entity, CMap *map, const Map::CEntity *entityInfo) {
+		if(!IComponent::spawn(entity,map,entityInfo))
+			return false;
 
-		/*if(_timer > _syncPosTimeStamp) {
-			std::shared_ptr<CMessageSyncPosition> msg = std::make_shared<CMessageSyncPosition>();
-			Vector3 position = _entity->getPosition();
-			msg->setPosition( position );
-			msg->setSeq(++_seqNumber);
-			//CGameNetMsgManager::getSingletonPtr()->sendEntityMessage(msg, _entity->getEntityID());
-			//insertamos el mensaje en la lista de mensajes no aceptados todava
-			TSyncMessage elem(_seqNumber,position);
-			_msgBuffer.push_back(elem);
-
-			//si sobro tiempo lo guardamos pa el siguiente
-			_timer = _timer-_syncPosTimeStamp;
-		}
+		if( entityInfo->hasAttribute("reconciliationThreshold") )
+			_minDist = entityInfo->getFloatAttribute("reconciliationThreshold");
 
-		_timer += msecs;*/
-	} // tick
+		return true;
+	} // spawn
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	bool CNetCommands::spawn(CEntity *entity, CMap *map, const Map::CEntity *entityInfo) {
-		if(!IComponent::spawn(entity,map,entityInfo))
-			return false;
+	void CNetCommands::onStart() {
+		_avatarController = _entity->getComponent<CAvatarController>();
+		assert(_avatarController && "Error: CNetCommands necesita un CAvatarController");
 
-		if( entityInfo->hasAttribute("syncPosTimeStamp") ) {
-			// Convertimos a msecs
-			_syncPosTimeStamp = entityInfo->getFloatAttribute("syncPosTimeStamp") * 1000;
-		}
+		_physicController = _entity->getComponent<CPhysicController>();
+		assert(_physicController && "Error: CNetCommands necesita un CPhysicController");
+	} // onStart
 
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
+////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		_interpolater = _entity->getComponent<CInterpolation>("CInterpolation");
+	void CNetCommands::onActivate() {
+		_pendingInputs.clear();
+		_pendingAction = Control::UNASSIGNED;
+	} // onActivate
 
-		if(!_physicController || !_interpolater)
-			return false;
+////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		_minDist = 0.05f;
-		_maxDist = 7.0f;
-		return true;
-	} // spawn
+	TMessageTypeSet CNetCommands::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTROL);
+		types.set(Message::PLAYER_STATE);
+		return types;
+	} // getAcceptedMessageTypes
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//---------------------------------------------------------
 
 	bool CNetCommands::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::CONTROL ||
-			message->getMessageType() == Message::SYNC_POSITION;
+			message->getMessageType() == Message::PLAYER_STATE;
 	} // accept
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,125 +76,98 @@ namespace Logic
 	void CNetCommands::process(const std::shared_ptr<CMessage>& message) {
 		switch(message->getMessageType())
 		{
-		case Message::SYNC_POSITION:
+		case Message::PLAYER_STATE:
 			{
-			acceptAndInterpolate(std::static_pointer_cast<CMessageSyncPosition>(message));
+			reconcile(std::static_pointer_cast<CMessagePlayerState>(message));
 			break;
 			}
 		case Message::CONTROL:
 			{
-			sendControlMessage(std::static_pointer_cast<CMessageControl>(message));
+			// Los saltos y esquivas se aplican una sola vez, hay que mandarlos
+			// con el comando del siguiente paso
+			ControlType type = std::static_pointer_cast<CMessageControl>(message)->getType();
+			if(type >= Control::JUMP && type < Control::MOUSE)
+				_pendingAction = type;
 			break;
 			}
 		}
 
-	} // proces
+	} // process
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void CNetCommands::sendControlMessage(const std::shared_ptr<CMessageControl>& message){
-		//completamos el mensaje de control, nos lo guardamos en la lista de mensajes no
-		//aceptados y lo enviamos por la red
-
-		Vector3 position = _entity->getPosition();
-		TSyncMessage elem(++_seqNumber,position);
-		_msgBuffer.push_back(elem);
-
-		//std::cout << "mensaje " << _seqNumber << " resultado " << _entity->getComponent<CAvatarController>("CAvatarController")->getVelocity() << std::endl;
-
-		//aadimos el numero de secuencia al mensaje
-		message->setSeqNumber(_seqNumber);
-
-		//enviamos el mensaje por red
-		CGameNetMsgManager::getSingletonPtr()->sendEntityMessage(message, _entity->getEntityID());
-
-		//reset the sync timer
-		_timer = 0;
-	}
+	void CNetCommands::onFixedTick(unsigned int msecs) {
+		// CAvatarController ya ha simulado este paso, mandamos lo que ha usado
+		TInputCommand command;
+		command.seq = ++_seqNumber;
+		command.action = _pendingAction;
+		command.displacementDir = _avatarController->getDisplacementDir();
+		command.orientation = _entity->getOrientation();
+		command.msecs = msecs;
+		command.predictedPosition = _entity->getPosition();
+
+		_pendingAction = Control::UNASSIGNED;
+
+		// Si el servidor deja de contestar no acumulamos sin limite
+		if(_pendingInputs.size() == MAX_PENDING_INPUTS)
+			_pendingInputs.pop_front();
+		_pendingInputs.push_back(command);
+
+		std::shared_ptr<CMessagePlayerInput> inputMsg = createMessage<CMessagePlayerInput>();
+		inputMsg->setSeqNumber(command.seq);
+		inputMsg->setAction(command.action);
+		inputMsg->setDisplacementDir(command.displacementDir);
+		inputMsg->setOrientation(command.orientation);
+
+		CGameNetMsgManager::getSingletonPtr()->sendEntityMessage(inputMsg, _entity->getEntityID());
+	} // onFixedTick
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void CNetCommands::acceptAndInterpolate(const std::shared_ptr<CMessageSyncPosition>& message){
-		//ensure the list is not empty
-		if(_msgBuffer.empty())
-			return;
-		
-/*		unsigned int seq = message->getSeq();
-
-		std::deque<TSyncMessage>::iterator it = _msgBuffer.begin();
-		std::deque<TSyncMessage>::iterator end = _msgBuffer.end();
-
-		while(it!=end){
-			if((*it).first<seq){
-				it = _msgBuffer.erase(it);
-			}else if((*it).first==seq){
-				//calculate interpolation and return
-				calculateInterpolation((*it).second, message->getPosition());
-				it = _msgBuffer.erase(it);
-				return;
-			}else{
-				++it;
-			}
-		}
-
-		//calculateInterpolation(lastSeq.second, message->getPosition());
-*/
-	}
+	void CNetCommands::reconcile(const std::shared_ptr<CMessagePlayerState>& message) {
+		unsigned int seq = message->getSeqNumber();
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////
+		// Descartamos los comandos que el servidor ya ha procesado
+		while( !_pendingInputs.empty() && _pendingInputs.front().seq < seq )
+			_pendingInputs.pop_front();
 
-	void CNetCommands::calculateInterpolation(const Vector3 &myPosition, const Vector3 &srvPosition){
-		Vector3 distance = srvPosition - myPosition;
-		 
-		//we don't need to interpolate if we are accurate enough
-		if(distance.length()<_minDist){
-			_interpolater->setLerpLevel(Vector3::ZERO);
+		// Respuesta repetida o de un comando que ya no tenemos
+		if( _pendingInputs.empty() || _pendingInputs.front().seq != seq )
 			return;
-		}
 
-		
+		Vector3 error = message->getPosition() - _pendingInputs.front().predictedPosition;
+		_pendingInputs.pop_front();
 
-		//update non acknowledged points
-		for(int i =0; i< _msgBuffer.size();++i){
-			_msgBuffer[i].second +=distance;
-		}
-
-		//if distance is far enough, teleport the player
-		if(distance.length()>_maxDist){
-			_physicController->setPhysicPosition( _entity->getPosition()+distance );
-			_interpolater->setLerpLevel(Vector3::ZERO);
+		// Si predijimos bien no hay nada que corregir
+		if( error.squaredLength() < _minDist * _minDist )
 			return;
-		}
-		distance*=Vector3(1,0,1);
-		std::cout << distance.length() << std::endl;
-		//interpolate
-		_interpolater->setLerpLevel(distance);
 
-	}
+		// Rebobinamos al estado del servidor
+		if( _physicController->isSimulating() )
+			_physicController->setPhysicPosition( message->getPosition() );
+		else
+			_entity->setPosition( message->getPosition() );
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-	/*void CNetCommands::lerp(){
+		_avatarController->setMovementState( message->getMomentum(), message->getTouchingGround() );
 
-		//get the tick lerp
-		Vector3 distance = _lerp*0.3;
-		_lerp-=distance;
+		// Y repetimos los comandos sin confirmar sin avisar a los observadores:
+		// los sonidos y efectos de camara ya se dieron en su momento
+		Vector3 displacementDir = _avatarController->getDisplacementDir();
+		Quaternion orientation = _entity->getOrientation();
 
-		//refresh all the positions saved for acknowledge
-		for(int i =0; i< _msgBuffer.size();++i){
-			_msgBuffer[i].second +=distance;
+		_avatarController->muteObservers(true);
+		for(std::deque<TInputCommand>::iterator it = _pendingInputs.begin(); it != _pendingInputs.end(); ++it) {
+			_entity->setOrientation(it->orientation);
+			_avatarController->applyInputCommand(it->action, it->displacementDir, it->msecs);
+			it->predictedPosition = _entity->getPosition();
 		}
+		_avatarController->muteObservers(false);
 
-		//update entity position
-		_physicController->setPhysicPosition( _entity->getPosition()+distance );
-
-		//if lerp distance is close enough, we can ignore it
-		if(_lerp.length()<_minDist)
-			_lerp=Vector3::ZERO;
-	}*/
+		_entity->setOrientation(orientation);
+		_avatarController->setDisplacementDir(displacementDir);
+	} // reconcile
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
 } // namespace Logic
-
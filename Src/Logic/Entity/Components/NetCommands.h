@@ -1,10 +1,12 @@
 /**
 @file NetCommands.h
 
-Contiene la declaracin del componente que envia con cierta frecuencia
-desde el servidor al cliente la posicion que existe en el servidor.
+Contiene la declaracin del componente que manda al servidor los comandos
+de entrada del jugador local y corrige la prediccin con las respuestas
+del servidor.
 
 @author Rubn Mulero Guerrero
+@author Francisco Aisa Garca
 @date May, 2010
 */
 
@@ -16,18 +18,34 @@ desde el servidor al cliente la posicion que existe en el servidor.
 
 namespace Logic{
 	class CMessageControl;
-	class CMessageSyncPosition;
+	class CMessagePlayerState;
 	class CPhysicController;
-	class CInterpolation;
+	class CAvatarController;
 }
 
 
 namespace Logic  {
 
 	/**
+	Prediccin en cliente del jugador local.
+	<p>
+	El jugador local se mueve en cuanto se pulsan las teclas (CAvatarController
+	lo simula en el cliente). En cada fixed tick este componente empaqueta lo
+	que se ha usado en ese paso (direccin de desplazamiento, salto o esquiva
+	y orientacin) en un CMessagePlayerInput numerado, lo manda al servidor y
+	se lo guarda junto a la posicin predicha.
+	<p>
+	El servidor simula los mismos comandos y contesta con el estado
+	autoritativo y el nmero del ltimo comando procesado
+	(CMessagePlayerState). Si la posicin del servidor coincide con la que
+	predijimos para ese comando no hay nada que hacer; si no, se rebobina al
+	estado del servidor y se vuelven a simular los comandos que an no ha
+	confirmado.
+
     @ingroup logicGroup
 
 	@author Rubn Mulero Guerrero
+	@author Francisco Aisa Garca
 	@date Febrero, 2013
 	*/
 
@@ -41,8 +59,9 @@ namespace Logic  {
 		// =======================================================================
 
 
-		/** Constructor por defecto. Inicializa el timer a 0. */
-		CNetCommands() : IComponent(), _timer(0), _seqNumber(0) {}
+		/** Constructor por defecto. */
+		CNetCommands() : IComponent(), _seqNumber(0), _pendingAction(Control::UNASSIGNED),
+						 _avatarController(0), _physicController(0), _minDist(0.05f) {}
 
 
 		// =======================================================================
@@ -51,14 +70,11 @@ namespace Logic  {
 
 
 		/**
-		Inicializacin del componente utilizando la informacin extrada de
-		la entidad leda del mapa (Maps::CEntity). Toma del mapa el atributo
-		speed que indica a la velocidad a la que se mover el jugador.
-
 		Inicializacin del componente a partir de la informacin extraida de la entidad
 		leida del mapa:
 		<ul>
-			<li><strong>syncPosTimeStamp:</strong> Tiempo de recolocacion del player </li>
+			<li><strong>reconciliationThreshold:</strong> Error (en unidades lgicas) a partir
+			del cual se corrige la prediccin. Por defecto 0.05. </li>
 		</ul>
 
 		@param entity Entidad a la que pertenece el componente.
@@ -68,14 +84,14 @@ namespace Logic  {
 		*/
 		virtual bool spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo);
 
-		/** 
+		/**
 		Este componente acepta los siguientes mensajes:
 
 		<ul>
-			<li>SYNC_POSITION</li>
+			<li>PLAYER_STATE</li>
 			<li>CONTROL</li>
 		</ul>
-		
+
 		@param message Mensaje a chequear.
 		@return true si el mensaje es aceptado.
 		*/
@@ -83,6 +99,11 @@ namespace Logic  {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -90,24 +111,37 @@ namespace Logic  {
 		*/
 		virtual void process(const std::shared_ptr<CMessage>& message);
 
-		
+
 
 	protected:
 
+		/** Se queda con los controladores de movimiento y fsico de la entidad. */
+		virtual void onStart();
+
+		//________________________________________________________________________
+
+		/** Olvida los comandos pendientes (al morir o reaparecer). */
+		virtual void onActivate();
+
+		//________________________________________________________________________
+
 		/**
-		Mtodo llamado en cada frame que actualiza la posicion flotante del item.
+		Manda al servidor el comando de entrada del paso que se acaba de
+		simular y se lo guarda hasta que el servidor lo confirme.
 
 		@param msecs Milisegundos transcurridos desde el ltimo tick.
 		*/
 		virtual void onFixedTick(unsigned int msecs);
 
-		void sendControlMessage(const std::shared_ptr<CMessageControl>& message);
-
-		void acceptAndInterpolate(const std::shared_ptr<CMessageSyncPosition>& message);
+		//________________________________________________________________________
 
-		void calculateInterpolation(const Vector3 &myPosition, const Vector3 &srvPosition);
+		/**
+		Compara el estado del servidor con lo que predijimos para ese comando
+		y, si no coincide, rebobina y repite los comandos sin confirmar.
 
-		void lerp();
+		@param message Estado autoritativo mandado por el servidor.
+		*/
+		void reconcile(const std::shared_ptr<CMessagePlayerState>& message);
 
 	private:
 
@@ -117,29 +151,39 @@ namespace Logic  {
 		// =======================================================================
 
 
-		/** Timer para controlar cada cuanto se manda el mensaje de sincronizacion de la posicion del cliente. */
-		float _timer;
+		/** Nmero mximo de comandos sin confirmar que se guardan. */
+		static const unsigned int MAX_PENDING_INPUTS = 64;
 
-		/** Limite de tiempo para mandar el mensaje de sincronizacion. */
-		float _syncPosTimeStamp;
+		/** Comando de entrada enviado y an no confirmado por el servidor. */
+		struct TInputCommand {
+			unsigned int seq;
+			ControlType action;
+			Vector3 displacementDir;
+			Quaternion orientation;
+			unsigned int msecs;
 
-		/** non acknowledged messages buffer */
-		typedef std::pair <unsigned int,Vector3> TSyncMessage; 
-		std::deque<TSyncMessage> _msgBuffer;
+			/** Posicin en la que acabamos tras simularlo. */
+			Vector3 predictedPosition;
+		};
 
-		/** ack sequence number */
+		/** Comandos sin confirmar, del ms antiguo al ms reciente. */
+		std::deque<TInputCommand> _pendingInputs;
+
+		/** Nmero de secuencia del ltimo comando enviado. */
 		unsigned int _seqNumber;
 
-		/** lerp component */
-		CInterpolation* _interpolater;;
+		/** Salto o esquiva recibido desde el ltimo fixed tick. */
+		ControlType _pendingAction;
+
+		/** Atajo al controlador de movimiento de la entidad. */
+		CAvatarController* _avatarController;
 
-		/** shortcut for entity phisic controller */
+		/** Atajo al controlador fsico de la entidad. */
 		CPhysicController* _physicController;
 
-		/** min and max lerp distance */
+		/** Error a partir del cual se corrige la prediccin. */
 		float _minDist;
-		float _maxDist;
-	}; // class CUpdateClientPosition
+	}; // class CNetCommands
 
 	REG_FACTORY(CNetCommands);
 
@@ -65,6 +65,16 @@ namespace Logic {
 		return true;
 	}
 
+	TMessageTypeSet CNetConnector::getAcceptedMessageTypes() {
+		// Los tipos que reenvia se leen del mapa en el spawn, asi que
+		// se le ofrecen todos y es accept quien filtra
+		TMessageTypeSet types;
+		types.set();
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------------------------------
+
 	bool CNetConnector::accept(const std::shared_ptr<CMessage>& message) {
 		// TODO Vemos si es uno de los mensajes que debemos trasmitir 
 		// por red. Para eso usamos la lista de mensajes que se ha
@@ -0,0 +1,78 @@
+/**
+@file NetProjectiles.cpp
+
+Contiene la implementacin del componente que recibe en el cliente los
+perdigones que dispara una entidad en el servidor.
+ 
+@see Logic::CNetProjectiles
+@see Logic::IComponent
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "NetProjectiles.h"
+
+#include "Logic/Entity/Entity.h"
+#include "Logic/ProjectileSimulator.h"
+#include "Logic/Messages/MessageProjectileSpawn.h"
+#include "Logic/Messages/MessageProjectileImpact.h"
+
+namespace Logic {
+	
+	IMP_FACTORY(CNetProjectiles);
+
+	//__________________________________________________________________
+
+	CNetProjectiles::CNetProjectiles() {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	CNetProjectiles::~CNetProjectiles() {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	TMessageTypeSet CNetProjectiles::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::PROJECTILE_SPAWN);
+		types.set(Message::PROJECTILE_IMPACT);
+		types.set(Message::PROJECTILE_RECALL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
+	bool CNetProjectiles::accept(const std::shared_ptr<CMessage>& message) {
+		TMessageType msgType = message->getMessageType();
+
+		return msgType == Message::PROJECTILE_SPAWN	||
+			   msgType == Message::PROJECTILE_IMPACT	||
+			   msgType == Message::PROJECTILE_RECALL;
+	} // accept
+
+	//__________________________________________________________________
+
+	void CNetProjectiles::process(const std::shared_ptr<CMessage>& message) {
+		CProjectileSimulator* simulator = CProjectileSimulator::getSingletonPtr();
+
+		switch( message->getMessageType() ) {
+			case Message::PROJECTILE_SPAWN: {
+				simulator->replicateVolley( std::static_pointer_cast<CMessageProjectileSpawn>(message)->getVolley() );
+				break;
+			}
+			case Message::PROJECTILE_IMPACT: {
+				simulator->replicateImpact( std::static_pointer_cast<CMessageProjectileImpact>(message)->getProjectileId() );
+				break;
+			}
+			case Message::PROJECTILE_RECALL: {
+				simulator->recall( _entity->getEntityID() );
+				break;
+			}
+		}
+	} // process
+
+} // namespace Logic
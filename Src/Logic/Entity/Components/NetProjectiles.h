@@ -0,0 +1,91 @@
+/**
+@file NetProjectiles.h
+
+Contiene la declaracin del componente que recibe en el cliente los
+perdigones que dispara una entidad en el servidor.
+
+@see Logic::CNetProjectiles
+@see Logic::IComponent
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_NetProjectiles_H
+#define __Logic_NetProjectiles_H
+
+#include "Logic/Entity/Component.h"
+
+namespace Logic {
+	
+	/**
+	Componente del cliente que pasa a CProjectileSimulator las rfagas, las
+	rdenes de retorno y los impactos de los perdigones que el servidor
+	replica a travs de la entidad que los dispara.
+	<p>
+	Acepta los mensajes:
+	<ul>
+		<li>PROJECTILE_SPAWN</li>
+		<li>PROJECTILE_IMPACT</li>
+		<li>PROJECTILE_RECALL</li>
+	</ul>
+	
+    @ingroup logicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+	
+	class CNetProjectiles : public IComponent {
+		DEC_FACTORY(CNetProjectiles);
+	public:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CNetProjectiles();
+
+		//__________________________________________________________________
+
+		/** Destructor. */
+		virtual ~CNetProjectiles();
+
+		
+		// =======================================================================
+		//                     METODOS HEREDADOS DE ICOMPONENT
+		// =======================================================================
+
+
+		/**
+		Mtodo virtual que elige que mensajes son aceptados.
+
+		@param message Mensaje a chequear.
+		@return true si el mensaje es aceptado.
+		*/
+		virtual bool accept(const std::shared_ptr<CMessage>& message);
+
+		//__________________________________________________________________
+
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//__________________________________________________________________
+
+		/**
+		Pasa al simulador de proyectiles lo que ha mandado el servidor.
+
+		@param message Mensaje a procesar.
+		*/
+		virtual void process(const std::shared_ptr<CMessage>& message);
+
+	}; // class CNetProjectiles
+
+	REG_FACTORY(CNetProjectiles);
+
+} // namespace Logic
+
+#endif // __Logic_NetProjectiles_H
@@ -32,7 +32,8 @@ namespace Logic
 	//---------------------------------------------------------
 
 	CParticle::CParticle(){
-		// Nada que hacer
+		// Solo recoloca las particulas donde este la entidad
+		enableBatchedTick();
 	}
 
 	//---------------------------------------------------------
@@ -137,6 +138,15 @@ namespace Logic
 
 
 
+	TMessageTypeSet CParticle::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CREATE_PARTICLE);
+		types.set(Message::PARTICLE_VISIBILITY);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CParticle::accept(const std::shared_ptr<CMessage>& message) {
 		
 		return message->getMessageType() == Message::CREATE_PARTICLE ||
@@ -32,6 +32,7 @@ namespace Logic {
 
 	CParticleSystem::CParticleSystem() : _particleSystem(NULL),
 										 _offset(Vector3::ZERO),
+										 _destroyEntityOnExpiry(false),
 									     _emitting(false) {
 		// Nada que hacer
 	}
@@ -72,6 +73,15 @@ namespace Logic {
 
 	//______________________________________________________________________________
 
+	TMessageTypeSet CParticleSystem::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::PARTICLE_START);
+		types.set(Message::PARTICLE_STOP);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//______________________________________________________________________________
+
 	bool CParticleSystem::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::PARTICLE_START ||
 			message->getMessageType() == Message::PARTICLE_STOP;
@@ -106,6 +116,22 @@ namespace Logic {
 
 	//______________________________________________________________________________
 
+	bool CParticleSystem::onRecycle() {
+		// El sistema de particulas se crea en el onStart de cada uso
+		if(_particleSystem != NULL) {
+			delete _particleSystem;
+			_particleSystem = NULL;
+		}
+
+		_offset = Vector3::ZERO;
+		_destroyEntityOnExpiry = false;
+		_emitting = false;
+
+		return true;
+	} // onRecycle
+
+	//______________________________________________________________________________
+
 	void CParticleSystem::onParticlesExpired() {
 		if(_destroyEntityOnExpiry)
 			CEntityFactory::getSingletonPtr()->deferredDeleteEntity(_entity, false);
@@ -40,6 +40,9 @@ namespace Logic {
 
 		virtual bool spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo);
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
+
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
 		virtual void process(const std::shared_ptr<CMessage>& message);
 
 		virtual void onParticlesExpired();
@@ -64,6 +67,7 @@ namespace Logic {
 	protected:
 
 		virtual void onStart();
+		virtual bool onRecycle();
 
 		Graphics::PUParticle* _particleSystem;
 
@@ -68,6 +68,18 @@ bool CPhysicDynamicEntity::spawn(Logic::CEntity *entity, CMap *map, const Map::C
 
 //---------------------------------------------------------
 
+TMessageTypeSet CPhysicDynamicEntity::getAcceptedMessageTypes() {
+	TMessageTypeSet types;
+	types.set(Message::ACTIVATE);
+	types.set(Message::ADD_FORCE_PHYSICS);
+	types.set(Message::KINEMATIC_MOVE);
+	types.set(Message::SET_PHYSIC_POSITION);
+	types.set(Message::SET_TRANSFORM);
+	return types;
+} // getAcceptedMessageTypes
+
+//---------------------------------------------------------
+
 bool CPhysicDynamicEntity::accept(const std::shared_ptr<CMessage>& message) {
 	Logic::TMessageType msgType = message->getMessageType();
 
@@ -267,12 +279,12 @@ void CPhysicDynamicEntity::onTrigger(IPhysics *otherComponent, bool enter) {
 
 	if (enter) {
 		_inTrigger=true;
-		std::shared_ptr<CMessageTouched> m = std::make_shared<CMessageTouched>();
+		std::shared_ptr<CMessageTouched> m = createMessage<CMessageTouched>();
 		m->setEntity(otherComponent->getEntity());
 		_entity->emitMessage(m);
 	} else {
 		_inTrigger=false;
-		std::shared_ptr<CMessageUntouched> m = std::make_shared<CMessageUntouched>();
+		std::shared_ptr<CMessageUntouched> m = createMessage<CMessageUntouched>();
 		m->setEntity(otherComponent->getEntity());
 		_entity->emitMessage(m);
 	}
@@ -288,13 +300,13 @@ void CPhysicDynamicEntity::onContact(IPhysics *otherComponent, const Physics::CC
 
 	if (enter) {
 		_inContact=true;
-		std::shared_ptr<CMessageContactEnter> msg = std::make_shared<CMessageContactEnter>();
+		std::shared_ptr<CMessageContactEnter> msg = createMessage<CMessageContactEnter>();
 		msg->setEntity( otherComponent->getEntity() );
 		msg->setContactPoint(contactPoint);
 		_entity->emitMessage(msg);
 	} else {
 		_inContact=false;
-		std::shared_ptr<CMessageContactExit> m = std::make_shared<CMessageContactExit>();
+		std::shared_ptr<CMessageContactExit> m = createMessage<CMessageContactExit>();
 		m->setEntity(otherComponent->getEntity()->getEntityID());
 		_entity->emitMessage(m);
 	}
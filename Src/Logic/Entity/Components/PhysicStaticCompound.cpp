@@ -62,6 +62,14 @@ namespace Logic {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CPhysicStaticCompound::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ACTIVATE);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CPhysicStaticCompound::accept(const shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -218,12 +226,12 @@ namespace Logic {
 		// Construimos un mensaje de tipo TOUCHED o UNTOUCHED y lo enviamos a 
 		// todos los componentes de la entidad. 
 		if(enter) {
-			shared_ptr<CMessageTouched> triggerEnterMsg = make_shared<CMessageTouched>();
+			shared_ptr<CMessageTouched> triggerEnterMsg = createMessage<CMessageTouched>();
 			triggerEnterMsg->setEntity( otherComponent->getEntity() );
 			_entity->emitMessage(triggerEnterMsg);
 		} 
 		else {
-			shared_ptr<CMessageUntouched> triggerExitMsg = make_shared<CMessageUntouched>();
+			shared_ptr<CMessageUntouched> triggerExitMsg = createMessage<CMessageUntouched>();
 			triggerExitMsg->setEntity( otherComponent->getEntity() );
 			_entity->emitMessage(triggerExitMsg);
 		}
@@ -238,13 +246,13 @@ namespace Logic {
 		}
 
 		if(enter) {
-			shared_ptr<CMessageContactEnter> contactEnterMsg = make_shared<CMessageContactEnter>();
+			shared_ptr<CMessageContactEnter> contactEnterMsg = createMessage<CMessageContactEnter>();
 			contactEnterMsg->setEntity( otherComponent->getEntity() );
 			contactEnterMsg->setContactPoint(contactPoint);
 			_entity->emitMessage(contactEnterMsg);
 		} 
 		else {
-			shared_ptr<CMessageContactExit> contactExitMsg = make_shared<CMessageContactExit>();
+			shared_ptr<CMessageContactExit> contactExitMsg = createMessage<CMessageContactExit>();
 			contactExitMsg->setEntity(otherComponent->getEntity()->getEntityID());
 			_entity->emitMessage(contactExitMsg);
 		}
@@ -67,6 +67,14 @@ bool CPhysicStaticEntity::spawn(Logic::CEntity *entity, CMap *map, const Map::CE
 
 //---------------------------------------------------------
 
+TMessageTypeSet CPhysicStaticEntity::getAcceptedMessageTypes() {
+	TMessageTypeSet types;
+	types.set(Message::ACTIVATE);
+	return types;
+} // getAcceptedMessageTypes
+
+//---------------------------------------------------------
+
 bool CPhysicStaticEntity::accept(const std::shared_ptr<CMessage>& message) {
 	Logic::TMessageType msgType = message->getMessageType();
 
@@ -228,12 +236,12 @@ void CPhysicStaticEntity::onTrigger(IPhysics *otherComponent, bool enter) {
 
 	if (enter) {
 		_inTrigger=true;
-		std::shared_ptr<CMessageTouched> m = std::make_shared<CMessageTouched>();
+		std::shared_ptr<CMessageTouched> m = createMessage<CMessageTouched>();
 		m->setEntity(otherComponent->getEntity());
 		_entity->emitMessage(m);
 	} else {
 		_inTrigger=false;
-		std::shared_ptr<CMessageUntouched> m = std::make_shared<CMessageUntouched>();
+		std::shared_ptr<CMessageUntouched> m = createMessage<CMessageUntouched>();
 		m->setEntity(otherComponent->getEntity());
 		_entity->emitMessage(m);
 	}
@@ -249,13 +257,13 @@ void CPhysicStaticEntity::onContact(IPhysics *otherComponent, const Physics::CCo
 
 	if (enter) {
 		_inContact=true;
-		std::shared_ptr<CMessageContactEnter> msg = std::make_shared<CMessageContactEnter>();
+		std::shared_ptr<CMessageContactEnter> msg = createMessage<CMessageContactEnter>();
 		msg->setEntity( otherComponent->getEntity() );
 		msg->setContactPoint(contactPoint);
 		_entity->emitMessage(msg);
 	} else {
 		_inContact=false;
-		std::shared_ptr<CMessageContactExit> m = std::make_shared<CMessageContactExit>();
+		std::shared_ptr<CMessageContactExit> m = createMessage<CMessageContactExit>();
 		m->setEntity(otherComponent->getEntity()->getEntityID());
 		_entity->emitMessage(m);
 	}
@@ -70,6 +70,14 @@ namespace Logic {
 	
 	//__________________________________________________________________
 
+	TMessageTypeSet CPlayerClass::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTROL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool CPlayerClass::accept(const std::shared_ptr<CMessage>& message) {
 		// Solo nos interesan los mensajes de skills.
 		// Es importante que hagamos esto porque si no, el putToSleep
@@ -97,7 +105,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CPlayerClass::onStart() {
-		std::shared_ptr<CMessageChangeMaterial> materialMsg = std::make_shared<CMessageChangeMaterial>();
+		std::shared_ptr<CMessageChangeMaterial> materialMsg = createMessage<CMessageChangeMaterial>();
 		materialMsg->setMaterialName("original");
 		_entity->emitMessage(materialMsg);
 		Logic::CWorldState::getSingletonPtr()->addChange(_entity,materialMsg);
@@ -114,7 +122,7 @@ namespace Logic {
 				if(type == Control::USE_PRIMARY_SKILL) {
 					if( canUsePrimarySkill() ) {
 						primarySkill();
-						std::shared_ptr<CMessageHud> hudmsg = std::make_shared<CMessageHud>();
+						std::shared_ptr<CMessageHud> hudmsg = createMessage<CMessageHud>();
 						hudmsg->setType(CMessageHud::HudType::PRIMARY_SKILL);
 						_entity->emitMessage(hudmsg);
 						_primarySkillTimer = _primarySkillCooldown;
@@ -123,7 +131,7 @@ namespace Logic {
 				else if(type == Control::USE_SECONDARY_SKILL) {
 					if( canUseSecondarySkill() ) {
 						secondarySkill();
-						std::shared_ptr<CMessageHud> hudmsg = std::make_shared<CMessageHud>();
+						std::shared_ptr<CMessageHud> hudmsg = createMessage<CMessageHud>();
 						hudmsg->setType(CMessageHud::HudType::SECONDARY_SKILL);
 						_entity->emitMessage(hudmsg);
 						_secondarySkillTimer = _secondarySkillCooldown;
@@ -152,7 +160,7 @@ namespace Logic {
 				_primarySkillTimer = 0;
 				//mandamos al jugador que tiene la habilidad disponible
 
-				std::shared_ptr<CMessageHud> hudMsg = std::make_shared<CMessageHud>();
+				std::shared_ptr<CMessageHud> hudMsg = createMessage<CMessageHud>();
 				hudMsg->setType(CMessageHud::HudType::PRIMARY_AVAIABLE);
 				_entity->emitMessage(hudMsg);
 			}
@@ -166,7 +174,7 @@ namespace Logic {
 
 				//mandamos al jugador que tiene la habilidad disponible
 
-				std::shared_ptr<CMessageHud> hudMsg = std::make_shared<CMessageHud>();
+				std::shared_ptr<CMessageHud> hudMsg = createMessage<CMessageHud>();
 				hudMsg->setType(CMessageHud::HudType::SECONDARY_AVAIABLE);
 				_entity->emitMessage(hudMsg);
 			}
@@ -209,7 +217,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CPlayerClass::emitSound(const std::string &soundName, bool loopSound, bool play3d, bool streamSound, bool stopSound, bool playerOnly){
-		std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+		std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		
 		audioMsg->setAudioName(soundName);
 		audioMsg->isLoopable(loopSound);
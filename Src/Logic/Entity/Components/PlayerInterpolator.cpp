@@ -12,6 +12,8 @@
 #include "PlayerInterpolator.h"
 #include "PhysicController.h"
 
+#include "Logic/Entity/Entity.h"
+
 #include "Physics/Server.h"
 
 // Map
@@ -25,19 +27,62 @@
 #include "Logic/Messages/MessageAudio.h"
 #include "Logic/Messages/MessageChangeWeaponGraphics.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace std;
 
 namespace Logic {
+
+	namespace {
+		/** Peso de cada llegada en la estimacin del jitter (como en RFC 3550). */
+		const float JITTER_GAIN = 1.0f / 16.0f;
+
+		/** Cuantas veces el jitter estimado se aade al retardo de reproduccin. */
+		const float JITTER_DELAY_FACTOR = 2.0f;
+
+		/** Retardo mximo, en snapshots. */
+		const float MAX_DELAY_SNAPSHOTS = 4.0f;
+
+		/** Cuanto podemos acelerar o frenar la reproduccin para recuperar la deriva. */
+		const float MAX_RATE_CORRECTION = 0.1f;
+
+		/** A partir de esta deriva (en snapshots) saltamos directamente al instante objetivo. */
+		const float MAX_DRIFT_SNAPSHOTS = 2.0f;
+
+		/** Compara eventos por su tick. */
+		template <typename T>
+		bool earlierTick(const T& a, const T& b) { return a.tick < b.tick; }
+
+		/**
+		Aade los eventos de una snapshot a la cola, desplazados a su tick
+		absoluto y manteniendo la cola ordenada (las snapshots con eventos
+		pueden llegar detrs de otras ms nuevas que viajan por otro canal).
+		*/
+		template <typename T>
+		void storeEvents(const vector<T>& events, unsigned int snapshotTick, deque<T>& buffer) {
+			for(typename vector<T>::const_iterator it = events.begin(); it != events.end(); ++it) {
+				T event = *it;
+				event.tick += snapshotTick;
+				buffer.insert( upper_bound(buffer.begin(), buffer.end(), event, earlierTick<T>), event );
+			}
+		}
+	}
 	
 	IMP_FACTORY(CPlayerInterpolator);
 
 	//__________________________________________________________________
 
-	CPlayerInterpolator::CPlayerInterpolator() : _tickCounter(0),
-												 _lostTicks(0),
-												 _extrapolatedTicks(0),
+	CPlayerInterpolator::CPlayerInterpolator() : _controller(NULL),
 												 _connecting(true),
-												 _extrapolatedMotion(Vector3::ZERO) {
+												 _hermite(true),
+												 _renderTime(0),
+												 _localTime(0),
+												 _lastSequence(0),
+												 _lastArrivalTime(0),
+												 _lastSnapshotTime(0),
+												 _jitter(0),
+												 _delay(0) {
 		// Nada que hacer
 	}
 
@@ -59,43 +104,32 @@ namespace Logic {
 		_ticksPerSample = entityInfo->getIntAttribute("ticksPerSample");
 		// Cada cuantas muestras tomamos una snapshot
 		_samplesPerSnapshot = entityInfo->getIntAttribute("samplesPerSnapshot");
-		// Nmero de ticks por buffer interpolado
+		// Nmero de ticks que cubre cada snapshot
 		_ticksPerBuffer = _samplesPerSnapshot + ( (_samplesPerSnapshot - 1) * (_ticksPerSample - 1) );
 
+		if( entityInfo->hasAttribute("hermiteInterpolation") )
+			_hermite = entityInfo->getBoolAttribute("hermiteInterpolation");
+
+		// Hasta que midamos algo de jitter, con una snapshot de margen
+		_delay = (float)_ticksPerBuffer;
+
 		return true;
 	}
 
 	//__________________________________________________________________
 
-	bool CPlayerInterpolator::accept(const shared_ptr<CMessage>& message) {
-		TMessageType msgType = message->getMessageType();
-
-		return msgType == Message::PLAYER_SNAPSHOT;
-	}
+	TMessageTypeSet CPlayerInterpolator::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::PLAYER_SNAPSHOT);
+		return types;
+	} // getAcceptedMessageTypes
 
 	//__________________________________________________________________
 
-	void CPlayerInterpolator::interpolateSnapshot(const vector<Matrix4>& buffer) {
-		Matrix4 incrementMatrix, temp;
-		unsigned int bufferSize = buffer.size();
-
-		// Interpolamos las posiciones intermedias del buffer
-		for(int i = 0; i < bufferSize - 1; ++i) {
-			// Insertamos la posicion inicial
-			_transformBuffer.push_back(buffer[i]);
-			
-			// Calculamos el incremento para las posiciones interpoladas
-			incrementMatrix = (buffer[i+1] - buffer[i]) * (1.0f / (float)_ticksPerSample);
-			// Generamos las posiciones intermedias
-			temp = buffer[i] + incrementMatrix;
-			for(int k = 0; k < _ticksPerSample - 1; ++k) {
-                _transformBuffer.push_back(temp);
-                temp = temp + incrementMatrix;
-            }
-		}
+	bool CPlayerInterpolator::accept(const shared_ptr<CMessage>& message) {
+		TMessageType msgType = message->getMessageType();
 
-		// Insertamos la ultima posicion
-		_transformBuffer.push_back( buffer[bufferSize - 1] );
+		return msgType == Message::PLAYER_SNAPSHOT;
 	}
 
 	//__________________________________________________________________
@@ -112,176 +146,180 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CPlayerInterpolator::storeSnapshot(const shared_ptr<CMessagePlayerSnapshot>& snapshotMsg) {
-		//no queremos que se nos <acumulen los samples, asi que limpiamos todos menos el primero
-		//(para que la interpolacion haga el resto
-		interpolateSnapshot( snapshotMsg->getTransformBuffer() );
-
-		while (!_transformBuffer.empty() && _transformBuffer.size()>_ticksPerBuffer*2 ){
-			_transformBuffer.pop_front();
-		}
-
-		if(_connecting) {
-			// Preparamos el buffer doble
-			std::cout << "transform buffer size = " << _transformBuffer.size() << std::endl;
-			if(_transformBuffer.size() >= 2 * _ticksPerBuffer)
-				_connecting = false;
-		}
-		
-		if (!_animationBuffer.empty()){
-			AnimInfo info = _animationBuffer.back();
-			_animationBuffer.pop_back();
-
-			// Emitimos el mensaje de animacin
-			if(info.stop) {
-				// Mandar animacin de stop
-				shared_ptr<CMessageStopAnimation> stopAnimMsg = make_shared<CMessageStopAnimation>();
-				stopAnimMsg->setString(info.animName);
-				_entity->emitMessage(stopAnimMsg);
-			}else {
-				// Mandar set animation
-				shared_ptr<CMessageSetAnimation> setAnimMsg = make_shared<CMessageSetAnimation>();
-				setAnimMsg->setAnimation(info.animName);
-				setAnimMsg->setLoop(info.loop);
-				setAnimMsg->setExclude(info.exclude);
-				setAnimMsg->setRewind(info.rewind);
-				_entity->emitMessage(setAnimMsg);
+		// La secuencia solo viaja con las snapshots cuantizadas, si no la
+		// tenemos suponemos que es la siguiente a la ultima
+		unsigned int sequence = snapshotMsg->getSequence();
+		if(sequence == 0)
+			sequence = _lastSequence + 1;
+
+		// Instante (en ticks del servidor) de la primera muestra
+		unsigned int snapshotTick = sequence * _ticksPerBuffer;
+
+		// Si llega tarde ya hemos pasado sus muestras, pero sus eventos
+		// siguen valiendo
+		if(sequence > _lastSequence) {
+			_lastSequence = sequence;
+			updateJitter( (float)snapshotTick );
+
+			// Guardamos las muestras tal cual, se interpolan al pintar
+			const vector<Matrix4>& transforms = snapshotMsg->getTransformBuffer();
+			for(unsigned int i = 0; i < transforms.size(); ++i) {
+				_keyframes.push( (float)(snapshotTick + i * _ticksPerSample), transforms[i].getTrans(), transforms[i].extractQuaternion() );
 			}
-			_animationBuffer.clear();
-		}
-		
-		vector<AnimInfo> tempAnimBuffer = snapshotMsg->getAnimationBuffer();
-		_animationBuffer.insert( _animationBuffer.end(), tempAnimBuffer.begin(), tempAnimBuffer.end() );
 
-		if(!_audioBuffer.empty()){
-			AudioInfo info = _audioBuffer.back();
-			_audioBuffer.pop_front();
+			_lastArrivalTime = _localTime;
+		}
 
-			shared_ptr<CMessageAudio> audioMsg = make_shared<CMessageAudio>();
-			audioMsg->setAudioName(info.audioName);
-			audioMsg->isLoopable(info.loopSound);
-			audioMsg->is3dSound(info.play3d);
-			audioMsg->streamSound(info.streamSound);
-			audioMsg->stopSound(info.stopSound);
+		// Los eventos se guardan con su tick absoluto
+		storeEvents(snapshotMsg->getAnimationBuffer(), snapshotTick, _animationBuffer);
+		storeEvents(snapshotMsg->getAudioBuffer(), snapshotTick, _audioBuffer);
+		storeEvents(snapshotMsg->getWeaponBuffer(), snapshotTick, _weaponBuffer);
+	}
 
-			_entity->emitMessage(audioMsg);
-			_audioBuffer.clear();
-		}
-		vector<AudioInfo> tempAudioBuffer = snapshotMsg->getAudioBuffer();
-		_audioBuffer.insert( _audioBuffer.end(), tempAudioBuffer.begin(), tempAudioBuffer.end() );
+	//__________________________________________________________________
 
+	void CPlayerInterpolator::updateJitter(float snapshotTime) {
+		float step = (float)_entity->getMap()->getFixedTimeStep();
 
-		if(!_weaponBuffer.empty()){
-			WeaponInfo info = _weaponBuffer.back();
-			shared_ptr<CMessageChangeWeaponGraphics> weaponMsg = make_shared<CMessageChangeWeaponGraphics>();
-			weaponMsg->setWeapon(info.weapon);
-			_entity->emitMessage(weaponMsg);
-			_weaponBuffer.clear();
+		if( !_keyframes.empty() ) {
+			// Diferencia entre lo que ha tardado en llegar respecto a la
+			// anterior y lo que tardo el servidor en mandarla
+			float arrivalDelta = (float)(_localTime - _lastArrivalTime);
+			float sendDelta = (snapshotTime - _lastSnapshotTime) * step;
+			_jitter += ( fabs(arrivalDelta - sendDelta) - _jitter ) * JITTER_GAIN;
 		}
+		_lastSnapshotTime = snapshotTime;
 
-		
-		vector<WeaponInfo> tempWeaponBuffer = snapshotMsg->getWeaponBuffer();
-		_weaponBuffer.insert ( _weaponBuffer.end(), tempWeaponBuffer.begin(), tempWeaponBuffer.end() );
-
-		//reiniciamos el contador cada vez que recibimos una snapshot para que no haya marrones
-		_tickCounter = 0;
+		float minDelay = (float)_ticksPerBuffer;
+		float maxDelay = MAX_DELAY_SNAPSHOTS * _ticksPerBuffer;
+		_delay = std::min( maxDelay, minDelay + JITTER_DELAY_FACTOR * _jitter / step );
 	}
 
 	//__________________________________________________________________
 
 	void CPlayerInterpolator::onStart() {
-		_controller = _entity->getComponent<CPhysicController>("CPhysicController");
+		_controller = _entity->getComponent<CPhysicController>();
 		assert(_controller != NULL && "Error: Como piensas interpolar al player si no tiene controlador fisico?");
 	}
 
 	//__________________________________________________________________
 
-	void CPlayerInterpolator::onFixedTick(unsigned int msecs) {
-		if( !_transformBuffer.empty() && !_connecting ) {
-			// Posicionamos el grafico y el controlador fisico donde nos indique
-			// el buffer de posiciones interpolado
-			_extrapolatedTicks = 0;
-
-			Matrix4 newTransform = _transformBuffer.front();
-			Vector3 newPosition = newTransform.getTrans();
-			_extrapolatedMotion = (newPosition - _entity->getPosition())*0.5f;
-
-			_controller->setPhysicPosition( newPosition );
-			_entity->setOrientation( newTransform.extractQuaternion() );
-			_transformBuffer.pop_front();
-
-			if( !_animationBuffer.empty() ) {
-				if( _animationBuffer.front().tick == _tickCounter ) {
-					// Reproducir animacion
-					AnimInfo info = _animationBuffer.front();
-					_animationBuffer.pop_front();
-
-					// Emitimos el mensaje de animacin
-					if(info.stop) {
-						// Mandar animacin de stop
-						shared_ptr<CMessageStopAnimation> stopAnimMsg = make_shared<CMessageStopAnimation>();
-						stopAnimMsg->setString(info.animName);
-
-						_entity->emitMessage(stopAnimMsg);
-					}
-					else {
-						// Mandar set animation
-						shared_ptr<CMessageSetAnimation> setAnimMsg = make_shared<CMessageSetAnimation>();
-						setAnimMsg->setAnimation(info.animName);
-						setAnimMsg->setLoop(info.loop);
-						setAnimMsg->setExclude(info.exclude);
-						setAnimMsg->setRewind(info.rewind);
-						_entity->emitMessage(setAnimMsg);
-					}
-				}
-			}
+	void CPlayerInterpolator::onTick(unsigned int msecs) {
+		_localTime += msecs;
 
-			if( !_audioBuffer.empty() ) {
-				if( _audioBuffer.front().tick == _tickCounter ) {
-					AudioInfo info = _audioBuffer.front();
-					_audioBuffer.pop_front();
+		if( _keyframes.empty() )
+			return;
 
-					shared_ptr<CMessageAudio> audioMsg = make_shared<CMessageAudio>();
-					audioMsg->setAudioName(info.audioName);
-					audioMsg->isLoopable(info.loopSound);
-					audioMsg->is3dSound(info.play3d);
-					audioMsg->streamSound(info.streamSound);
-					audioMsg->stopSound(info.stopSound);
+		const CKeyframeBuffer::TKeyframe& newest = _keyframes.newest();
+		float step = (float)_entity->getMap()->getFixedTimeStep();
+		float elapsedTicks = msecs / step;
 
-					_entity->emitMessage(audioMsg);
-				}
-			}
+		// Instante que estara simulando el servidor ahora mismo y el que
+		// deberiamos estar pintando
+		float serverTime = newest.time + (_localTime - _lastArrivalTime) / step;
+		float targetTime = serverTime - _delay;
 
-			if ( !_weaponBuffer.empty() && _weaponBuffer.front().tick == _tickCounter ) {
-				WeaponInfo info = _weaponBuffer.front();
-				_weaponBuffer.pop_front();
-				shared_ptr<CMessageChangeWeaponGraphics> weaponMsg = make_shared<CMessageChangeWeaponGraphics>();
-				weaponMsg->setWeapon(info.weapon);
-				_entity->emitMessage(weaponMsg);
-			}
+		if(_connecting) {
+			// Esperamos a tener keyframes suficientes para cubrir el retardo
+			if(newest.time - _keyframes.oldest().time < _delay)
+				return;
 
-			_tickCounter = (_tickCounter + 1) % _ticksPerBuffer;
+			_renderTime = targetTime;
+			_connecting = false;
 		}
 		else {
-			// Estamos ejecutando ticks con el buffer vacio
-			// tendremos que descartar estos ticks del siguiente buffer
-			// recibido
-			if(!_connecting) {
-				if( _extrapolatedTicks < _ticksPerBuffer ) {
-					std::cout << "perdiendo ticks"+ _lostTicks << std::endl;
-					Vector3 newPosition = _entity->getPosition() + _extrapolatedMotion * 0.5f;
-					Physics::CapsuleGeometry controllerGeometry = Physics::CapsuleGeometry( _controller->getCapsuleRadius(), _controller->getCapsuleHeight() / 2.0f );
-
-					if( !Physics::CServer::getSingletonPtr()->overlapAny( controllerGeometry, newPosition ) ) {
-						_controller->setPhysicPosition( newPosition );
-					
-						if( ++_extrapolatedTicks == 2 )
-							_extrapolatedMotion = Vector3::ZERO;
-					}
-				}
+			float drift = targetTime - (_renderTime + elapsedTicks);
+			if( fabs(drift) > MAX_DRIFT_SNAPSHOTS * _ticksPerBuffer ) {
+				_renderTime = targetTime;
 			}
+			else {
+				// Aceleramos o frenamos un poco para converger sin saltos
+				float correction = std::max( -MAX_RATE_CORRECTION, std::min(MAX_RATE_CORRECTION, drift * 0.1f) );
+				_renderTime += elapsedTicks * (1.0f + correction);
+			}
+		}
+
+		if(_renderTime <= newest.time) {
+			Vector3 position;
+			Quaternion orientation;
+			_keyframes.sample(_renderTime, _hermite, position, orientation);
+
+			_controller->setPhysicPosition(position);
+			_entity->setOrientation(orientation);
+		}
+		else if(_renderTime - newest.time <= _ticksPerBuffer) {
+			// Se nos ha acabado el buffer, extrapolamos como mucho una
+			// snapshot siempre que no nos metamos en la geometria
+			Vector3 position = newest.position + _keyframes.getLastVelocity() * (_renderTime - newest.time);
+			Physics::CapsuleGeometry controllerGeometry = Physics::CapsuleGeometry( _controller->getCapsuleRadius(), _controller->getCapsuleHeight() / 2.0f );
+
+			if( !Physics::CServer::getSingletonPtr()->overlapAny( controllerGeometry, position ) )
+				_controller->setPhysicPosition(position);
 		}
+
+		emitEvents();
+
+		_keyframes.discardBefore(_renderTime);
 	}
 
-} // namespace Logic
+	//__________________________________________________________________
 
+	void CPlayerInterpolator::emitEvents() {
+		while( !_animationBuffer.empty() && _animationBuffer.front().tick <= _renderTime ) {
+			emitAnimation( _animationBuffer.front() );
+			_animationBuffer.pop_front();
+		}
+
+		while( !_audioBuffer.empty() && _audioBuffer.front().tick <= _renderTime ) {
+			emitAudio( _audioBuffer.front() );
+			_audioBuffer.pop_front();
+		}
 
+		while( !_weaponBuffer.empty() && _weaponBuffer.front().tick <= _renderTime ) {
+			emitWeapon( _weaponBuffer.front() );
+			_weaponBuffer.pop_front();
+		}
+	}
+
+	//__________________________________________________________________
+
+	void CPlayerInterpolator::emitAnimation(const AnimInfo& info) {
+		if(info.stop) {
+			// Mandar animacin de stop
+			shared_ptr<CMessageStopAnimation> stopAnimMsg = createMessage<CMessageStopAnimation>();
+			stopAnimMsg->setString(info.animName);
+			_entity->emitMessage(stopAnimMsg);
+		}
+		else {
+			// Mandar set animation
+			shared_ptr<CMessageSetAnimation> setAnimMsg = createMessage<CMessageSetAnimation>();
+			setAnimMsg->setAnimation(info.animName);
+			setAnimMsg->setLoop(info.loop);
+			setAnimMsg->setExclude(info.exclude);
+			setAnimMsg->setRewind(info.rewind);
+			_entity->emitMessage(setAnimMsg);
+		}
+	}
+
+	//__________________________________________________________________
+
+	void CPlayerInterpolator::emitAudio(const AudioInfo& info) {
+		shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
+		audioMsg->setAudioName(info.audioName);
+		audioMsg->isLoopable(info.loopSound);
+		audioMsg->is3dSound(info.play3d);
+		audioMsg->streamSound(info.streamSound);
+		audioMsg->stopSound(info.stopSound);
+
+		_entity->emitMessage(audioMsg);
+	}
+
+	//__________________________________________________________________
+
+	void CPlayerInterpolator::emitWeapon(const WeaponInfo& info) {
+		shared_ptr<CMessageChangeWeaponGraphics> weaponMsg = createMessage<CMessageChangeWeaponGraphics>();
+		weaponMsg->setWeapon(info.weapon);
+		_entity->emitMessage(weaponMsg);
+	}
+
+} // namespace Logic
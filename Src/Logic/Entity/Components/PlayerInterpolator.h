@@ -14,6 +14,7 @@
 
 #include "Logic/Entity/Component.h"
 #include "Logic/Messages/MessagePlayerSnapshot.h"
+#include "Logic/KeyframeBuffer.h"
 
 #include <deque>
 
@@ -24,6 +25,19 @@ namespace Logic {
 namespace Logic {
 	
 	/**
+	Reproduce en el cliente el movimiento de un jugador remoto a partir de
+	las snapshots que manda el servidor (ver CPlayerSnapshot).
+	<p>
+	Cada muestra de la snapshot se guarda como keyframe en un CKeyframeBuffer
+	con su instante en ticks del servidor, y la transformacin se calcula en
+	cada frame de render muestreando el buffer un poco por detrs del
+	servidor. Ese retardo (el jitter buffer) es como mnimo lo que ocupa una
+	snapshot y crece con la variacin medida en la llegada de las snapshots,
+	de modo que con una red estable se va lo ms pegado posible al servidor y
+	con una red irregular no nos quedamos sin keyframes.
+	<p>
+	Las animaciones, sonidos y cambios de arma de la snapshot se disparan
+	cuando la reproduccin llega a su tick.
 	
     @ingroup logicGroup
 
@@ -59,7 +73,10 @@ namespace Logic {
 		Inicializacin del componente a partir de la informacin extraida de la entidad
 		leida del mapa:
 		<ul>
-			<li><strong>interpolationTimestep:</strong> Tiempo de interpolacin. </li>
+			<li><strong>ticksPerSample:</strong> Cada cuantos fixed ticks se toma una muestra. </li>
+			<li><strong>samplesPerSnapshot:</strong> Nmero de muestras por snapshot. </li>
+			<li><strong>hermiteInterpolation:</strong> false para interpolar la posicin
+			linealmente en lugar de con Hermite (por defecto true). </li>
 		</ul>
 
 		@param entity Entidad a la que pertenece el componente.
@@ -75,7 +92,7 @@ namespace Logic {
 		Este componente acepta los siguientes mensajes:
 
 		<ul>
-			<li></li>
+			<li>PLAYER_SNAPSHOT</li>
 		</ul>
 		
 		@param message Mensaje a chequear.
@@ -85,6 +102,11 @@ namespace Logic {
 
 		//__________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//__________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -92,11 +114,6 @@ namespace Logic {
 		*/
 		virtual void process(const std::shared_ptr<CMessage>& message);
 
-		
-		// =======================================================================
-		//                            METODOS PROPIOS
-		// =======================================================================
-
 
 	protected:
 
@@ -107,24 +124,50 @@ namespace Logic {
 
 		virtual void onStart();
 
+		//__________________________________________________________________
 
 		/**
-		Mtodo llamado en cada frame. En este componente se encarga
-		de reducir la vida del individuo paulatinamente en base a los
-		parmetros fijados desde fichero.
+		Avanza el reloj de reproduccin y coloca al jugador donde indique el
+		buffer de keyframes en ese instante.
 
 		@param msecs Milisegundos transcurridos desde el ltimo tick.
 		*/
-		virtual void onFixedTick(unsigned int msecs);
+		virtual void onTick(unsigned int msecs);
 
 
 	private:
 
 
-		void interpolateSnapshot(const std::vector<Matrix4>& buffer);
+		// =======================================================================
+		//                            METODOS PRIVADOS
+		// =======================================================================
 
+
+		/** Mete en los buffers las muestras y eventos de una snapshot. */
 		void storeSnapshot(const std::shared_ptr<CMessagePlayerSnapshot>& snapshotMsg);
 
+		//__________________________________________________________________
+
+		/**
+		Actualiza la estimacin del jitter con la llegada de una snapshot y
+		recalcula el retardo de reproduccin.
+
+		@param snapshotTime Instante (en ticks del servidor) de la primera muestra.
+		*/
+		void updateJitter(float snapshotTime);
+
+		//__________________________________________________________________
+
+		/** Dispara los eventos cuyo tick ya se ha reproducido. */
+		void emitEvents();
+
+		//__________________________________________________________________
+
+		void emitAnimation(const AnimInfo& info);
+		void emitAudio(const AudioInfo& info);
+		void emitWeapon(const WeaponInfo& info);
+
+
 		// =======================================================================
 		//                          MIEMBROS PRIVADOS
 		// =======================================================================
@@ -133,25 +176,47 @@ namespace Logic {
 		unsigned int _samplesPerSnapshot;
 		
 		unsigned int _ticksPerBuffer;
-		unsigned int _tickCounter;
 
-		unsigned int _lostTicks;
+		/** Keyframes recibidos, con su instante en ticks del servidor. */
+		CKeyframeBuffer _keyframes;
 
-		std::deque<Matrix4> _transformBuffer;
+		/** Eventos pendientes. Su tick es absoluto (en ticks del servidor). */
 		std::deque<AnimInfo> _animationBuffer;
 		std::deque<AudioInfo> _audioBuffer;
 		std::deque<WeaponInfo> _weaponBuffer;
 
 		CPhysicController* _controller;
 
+		/** true hasta que tenemos keyframes para cubrir el retardo. */
 		bool _connecting;
 
-		unsigned int _extrapolatedTicks;
-		Vector3 _extrapolatedMotion;
+		/** true para interpolar la posicin con Hermite. */
+		bool _hermite;
+
+		/** Instante del servidor que se est reproduciendo (en ticks). */
+		float _renderTime;
+
+		/** Reloj local en milisegundos. */
+		unsigned int _localTime;
+
+		/** Secuencia de la ltima snapshot recibida. */
+		unsigned int _lastSequence;
+
+		/** Momento de llegada de la ltima snapshot (reloj local). */
+		unsigned int _lastArrivalTime;
+
+		/** Instante de la primera muestra de la ltima snapshot (en ticks). */
+		float _lastSnapshotTime;
+
+		/** Estimacin de la variacin en la llegada de las snapshots (msecs). */
+		float _jitter;
+
+		/** Retardo de reproduccin respecto al servidor (en ticks). */
+		float _delay;
 	}; // class CPlayerInterpolator
 
 	REG_FACTORY(CPlayerInterpolator);
 
 } // namespace Logic
 
-#endif // __Logic_TransformInterpolator_H
+#endif // __Logic_PlayerInterpolator_H
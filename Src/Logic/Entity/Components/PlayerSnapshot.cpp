@@ -47,6 +47,17 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet CPlayerSnapshot::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::AUDIO);
+		types.set(Message::CHANGE_WEAPON_GRAPHICS);
+		types.set(Message::SET_ANIMATION);
+		types.set(Message::STOP_ANIMATION);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool CPlayerSnapshot::accept(const shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -131,11 +142,13 @@ namespace Logic {
 
 	void CPlayerSnapshot::sendSnapshot() {
 		// Enviar un mensaje con el buffer
-		shared_ptr<CMessagePlayerSnapshot> snapshotMsg = make_shared<CMessagePlayerSnapshot>();
+		shared_ptr<CMessagePlayerSnapshot> snapshotMsg = createMessage<CMessagePlayerSnapshot>();
 		snapshotMsg->setTransformBuffer(_transformBuffer);
 		snapshotMsg->setAnimationBuffer(_animationBuffer);
 		snapshotMsg->setAudioBuffer(_audioBuffer);
 		snapshotMsg->setWeaponBuffer(_weaponBuffer);
+		snapshotMsg->setQuantized(_quantize);
+		snapshotMsg->setSequence(++_snapshotSequence);
 		_entity->emitMessage(snapshotMsg);
 
 		// Limpiar el buffer para la siguiente snapshot
@@ -55,6 +55,14 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet CPositionInterpolator::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::POSITION_SNAPSHOT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool CPositionInterpolator::accept(const shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::POSITION_SNAPSHOT;
 	}
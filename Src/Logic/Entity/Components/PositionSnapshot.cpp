@@ -31,8 +31,9 @@ namespace Logic {
 
 	void CPositionSnapshot::sendSnapshot() {
 		// Enviar un mensaje con el buffer
-		shared_ptr<CMessagePositionSnapshot> snapshotMsg = make_shared<CMessagePositionSnapshot>();
+		shared_ptr<CMessagePositionSnapshot> snapshotMsg = createMessage<CMessagePositionSnapshot>();
 		snapshotMsg->setBuffer(_positionBuffer);
+		snapshotMsg->setQuantized(_quantize);
 		_entity->emitMessage(snapshotMsg);
 
 		// Limpiar el buffer para la siguiente snapshot
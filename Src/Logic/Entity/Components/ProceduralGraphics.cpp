@@ -65,7 +65,7 @@ namespace Logic
 	//---------------------------------------------------------
 
 	void CProceduralGraphics::onActivate() {
-		_animatedEntity = _entity->getComponent<CAnimatedGraphics>("CAnimatedGraphics")->getAnimatedEntity();
+		_animatedEntity = _entity->getComponent<CAnimatedGraphics>()->getAnimatedEntity();
 		_animatedEntity->addObserver(this);
 		_animatedEntity->freeBoneOrientation(_masterBoneName);
 	}
@@ -77,6 +77,14 @@ namespace Logic
 	
 	//---------------------------------------------------------
 
+	TMessageTypeSet CProceduralGraphics::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::SET_ANIMATION);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CProceduralGraphics::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
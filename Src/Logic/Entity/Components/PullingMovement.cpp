@@ -86,18 +86,26 @@ namespace Logic {
 		if(entityInfo->hasAttribute("reward")) {
 			_reward = entityInfo->getIntAttribute("reward");
 		}
-		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity");
+		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>();
 		
 		return true;
 	} // spawn
 
+	TMessageTypeSet CPullingMovement::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CPullingMovement::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::TOUCHED;
 	} // accept
 
 	void CPullingMovement::setPlayer(CEntity * player){
 		_player = player;
-		_height = _player->getComponent<CSoulReaper>("CSoulReaper")->getHeight()*0.5;
+		_height = _player->getComponent<CSoulReaper>()->getHeight()*0.5;
 	}
 
 	
@@ -124,29 +132,29 @@ namespace Logic {
 			// Mandar el mensaje que corresponda a la entidad actuadora
 			// en funcion del item que se haya cogido (comprobando el id)
 			if(_id == "orb") {
-				std::shared_ptr<CMessageAddLife> addLifeMsg = std::make_shared<CMessageAddLife>();
+				std::shared_ptr<CMessageAddLife> addLifeMsg = createMessage<CMessageAddLife>();
 				addLifeMsg->setAddLife(_reward);
 				actor->emitMessage(addLifeMsg);
 			}
 			else if(_id == "armor") {
-				std::shared_ptr<CMessageAddShield> addShieldMsg = std::make_shared<CMessageAddShield>();
+				std::shared_ptr<CMessageAddShield> addShieldMsg = createMessage<CMessageAddShield>();
 				addShieldMsg->setAddShield(_reward);
 				actor->emitMessage(addShieldMsg);
 			}
 			else if(_id == "ammo") {
-				std::shared_ptr<CMessageAddAmmo> addAmmoMsg = std::make_shared<CMessageAddAmmo>();
+				std::shared_ptr<CMessageAddAmmo> addAmmoMsg = createMessage<CMessageAddAmmo>();
 				addAmmoMsg->setAddAmmo(_reward);
 				addAmmoMsg->setAddWeapon(_weaponType);
 				actor->emitMessage(addAmmoMsg);
 			}
 			else if(_id == "weapon") {
-				std::shared_ptr<CMessageAddWeapon> addWeaponMsg = std::make_shared<CMessageAddWeapon>();
+				std::shared_ptr<CMessageAddWeapon> addWeaponMsg = createMessage<CMessageAddWeapon>();
 				addWeaponMsg->setAddAmmo(_reward);
 				addWeaponMsg->setAddWeapon(_weaponType);
 				actor->emitMessage(addWeaponMsg);
 			}
 			else if(_id == "spell") {
-				std::shared_ptr<CMessageAddSpell> addSpellMsg = std::make_shared<CMessageAddSpell>();
+				std::shared_ptr<CMessageAddSpell> addSpellMsg = createMessage<CMessageAddSpell>();
 				addSpellMsg->setSpell(_reward);
 				actor->emitMessage(addSpellMsg);
 			}
@@ -155,7 +163,7 @@ namespace Logic {
 		CEntityFactory::getSingletonPtr()->deferredDeleteEntity(_entity, true);
 
 		//resguardo contra bugs, le decimos al soulReaper que no está cogiendo ningun item
-		_player->getComponent<CSoulReaper>("CSoulReaper")->resetEntityPulling();
+		_player->getComponent<CSoulReaper>()->resetEntityPulling();
 	}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
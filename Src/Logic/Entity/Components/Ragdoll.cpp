@@ -69,6 +69,15 @@ bool CRagdoll::spawn(Logic::CEntity *entity, CMap *map, const Map::CEntity *enti
 
 //________________________________________________________________________
 
+TMessageTypeSet CRagdoll::getAcceptedMessageTypes() {
+	TMessageTypeSet types;
+	types.set(Message::PLAYER_DEAD);
+	types.set(Message::PLAYER_SPAWN);
+	return types;
+} // getAcceptedMessageTypes
+
+//________________________________________________________________________
+
 bool CRagdoll::accept(const std::shared_ptr<CMessage>& message) {
 	TMessageType msgType = message->getMessageType();
 
@@ -141,7 +150,7 @@ void CRagdoll::onFixedTick(unsigned int msecs) {
 
 void CRagdoll::onStart() {
 	// Nos aseguramos de que exista un componente grfico animado
-	CAnimatedGraphics* animComp = _entity->getComponent<CAnimatedGraphics>("CAnimatedGraphics");
+	CAnimatedGraphics* animComp = _entity->getComponent<CAnimatedGraphics>();
 	assert(animComp != NULL && "Error: Los componentes de ragdoll necesitan tener entidades animadas");
 
 	// Obtenemos la lista de huesos que el ragdoll controla
@@ -29,6 +29,7 @@ implementa las habilidades del personaje
 #include "Logic/Maps/Map.h"
 #include "Logic/Entity/Entity.h"
 #include "Logic/Server.h"
+#include "Logic/LagCompensation.h"
 #include "Map/MapEntity.h"
 
 // Mensajes
@@ -186,7 +187,7 @@ namespace Logic {
 
 		// @deprectaed De momento se hace esto en el activate para darle
 		// una textura distinta a cada clase.
-		/*std::shared_ptr<CMessageChangeMaterial> materialMsg = std::make_shared<CMessageChangeMaterial>();
+		/*std::shared_ptr<CMessageChangeMaterial> materialMsg = createMessage<CMessageChangeMaterial>();
 		materialMsg->setMaterialName(_materialName);
 		_entity->emitMessage(materialMsg);*/
 
@@ -210,7 +211,7 @@ namespace Logic {
 	void CScreamer::primarySkill() {
 
 		// Sonido de grito
-		std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+		std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		
 		audioMsg->setAudioName("character/scream.ogg");
 		audioMsg->isLoopable(false);
@@ -243,10 +244,12 @@ namespace Logic {
 		}
 		
 
-		// 3.5 mirao a ojo a traves del visual debbuger 
-		Physics::SphereGeometry sphere  = Physics::CGeometryFactory::getSingletonPtr()->createSphere(3.5);
+		// 3.5 mirao a ojo a traves del visual debbuger. Los jugadores se
+		// comprueban donde los veia el tirador
 		std::vector<Physics::CSweepHit> hitSpots;
-		Physics::CServer::getSingletonPtr()->sweepMultiple(sphere, _positionShoot,_directionShoot,distance,hitSpots, false, Physics::CollisionGroup::ePLAYER );
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+		lagCompensation->rewind(_entity);
+		lagCompensation->sweepMultiple(3.5f, _positionShoot,_directionShoot,distance,hitSpots, false, Physics::CollisionGroup::ePLAYER );
 		
 		sweepHitConsequences(hitSpots);
 		// Ocurre igual q arriba, si la distancia es menor q 0 esq no ha habido colision con el mundo
@@ -258,7 +261,7 @@ namespace Logic {
 
 	void CScreamer::raycastHitConsequences(const Physics::CRaycastHit &hitWorld){
 		if(hitWorld.distance < _screamerReboundDistance){
-			auto m = std::make_shared<CMessageAddForcePlayer>();
+			auto m = createMessage<CMessageAddForcePlayer>();
 			m->setForce(-_directionShoot * (_screamerReboundForce*( 1.0f - hitWorld.distance/_screamerScreamMaxDistance)));
 			_entity->emitMessage(m);
 			_rebound = 0;
@@ -283,7 +286,7 @@ namespace Logic {
 		for(auto it = hits.begin(); it < hits.end(); ++it){
 			if((*it).entity->getName() != _entity->getName()){
 				Vector3 direct = -(_directionShoot.reflect(-(*it).normal));
-				auto m = std::make_shared<CMessageAddForcePlayer>();
+				auto m = createMessage<CMessageAddForcePlayer>();
 				Vector3 temp = (_directionShoot + (Vector3(0.0f,1.0f,0.0f))).normalisedCopy();
 				m->setForce(temp * (_screamerScreamForce*(1.0f- (*it).distance/_screamerScreamMaxDistance)));
 				(*it).entity->emitMessage(m);
@@ -317,12 +320,12 @@ namespace Logic {
 
 		// Enviamos el mensaje SET_OWNER para que el escudo se mueva
 		// acorde a los movimientos del player
-		shared_ptr<CMessageSetOwner> setOwnerMsg = make_shared<CMessageSetOwner>();
+		shared_ptr<CMessageSetOwner> setOwnerMsg = createMessage<CMessageSetOwner>();
 		setOwnerMsg->setOwner(_entity);
 		_screamerShield->emitMessage(setOwnerMsg);
 
 		// Sonido del escudo
-		std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+		std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		
 		audioMsg->setAudioName("character/screamerShield.wav");
 		audioMsg->isLoopable(true);
@@ -331,12 +334,12 @@ namespace Logic {
 		_screamerShield->emitMessage(audioMsg);
 
 		// Enviamos un mensaje para indicar que se bloquee el disparo
-		shared_ptr<CMessageBlockShoot> canShootMsg = make_shared<CMessageBlockShoot>();
+		shared_ptr<CMessageBlockShoot> canShootMsg = createMessage<CMessageBlockShoot>();
 		canShootMsg->canShoot(false);
 		_entity->emitMessage(canShootMsg);
 
 		// Mandamos al jugador que tiene la habilidad disponible
-		std::shared_ptr<CMessageHud> hudMsg = std::make_shared<CMessageHud>();
+		std::shared_ptr<CMessageHud> hudMsg = createMessage<CMessageHud>();
 		hudMsg->setType(CMessageHud::HudType::SECONDARY_ACTIVE);
 		_entity->emitMessage(hudMsg);
 	} // secondarySkill
@@ -346,7 +349,7 @@ namespace Logic {
 		_secondarySkillIsActive = false;
 
 		// Enviamos un mensaje para indicar que el disparo ya no esta bloqueado
-		shared_ptr<CMessageBlockShoot> canShootMsg = make_shared<CMessageBlockShoot>();
+		shared_ptr<CMessageBlockShoot> canShootMsg = createMessage<CMessageBlockShoot>();
 		canShootMsg->canShoot(true);
 		_entity->emitMessage(canShootMsg);
 
@@ -357,12 +360,12 @@ namespace Logic {
 		}
 
 		if(_secondarySkillCooldown > 0) {
-			std::shared_ptr<CMessageHud> hudMsg = std::make_shared<CMessageHud>();
+			std::shared_ptr<CMessageHud> hudMsg = createMessage<CMessageHud>();
 			hudMsg->setType(CMessageHud::HudType::SECONDARY_AVAIABLE);
 			_entity->emitMessage(hudMsg);
 		}
 		else {
-			std::shared_ptr<CMessageHud> hudMsg = std::make_shared<CMessageHud>();
+			std::shared_ptr<CMessageHud> hudMsg = createMessage<CMessageHud>();
 			hudMsg->setType(CMessageHud::HudType::SECONDARY_SKILL);
 			_entity->emitMessage(hudMsg);
 		}
@@ -398,7 +401,7 @@ namespace Logic {
 			if( entitiesHit[i] != NULL && entitiesHit[i]->isPlayer() ) {
 				// Emitimos el mensaje de instakill
 				// @todo mandar un mensaje de instakill en vez de un mensaje de dao
-				shared_ptr<CMessageDamaged> dmgMsg = make_shared<CMessageDamaged>();
+				shared_ptr<CMessageDamaged> dmgMsg = createMessage<CMessageDamaged>();
 				dmgMsg->setDamage(_screamerExplotionDamage);
 				dmgMsg->setEnemy(_entity);
 				entitiesHit[i]->emitMessage(dmgMsg);
@@ -44,6 +44,14 @@ namespace Logic {
 	
 	//________________________________________________________________________
 
+	TMessageTypeSet CScreamerShieldController::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::SET_OWNER);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CScreamerShieldController::accept(const shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -66,7 +74,7 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CScreamerShieldController::onStart() {
-		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity");
+		_physicComponent = _entity->getComponent<CPhysicDynamicEntity>();
 	}
 
 	//________________________________________________________________________
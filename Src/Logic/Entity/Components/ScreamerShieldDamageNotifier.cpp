@@ -46,6 +46,15 @@ namespace Logic {
 	
 	//________________________________________________________________________
 
+	TMessageTypeSet CScreamerShieldDamageNotifier::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::DAMAGED);
+		types.set(Message::SET_REDUCED_DAMAGE);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CScreamerShieldDamageNotifier::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -88,7 +97,7 @@ namespace Logic {
 		// al componente CScreamer, sino que sencillamente vamos a llamar al
 		// mtodo que corresponda del propio componente.
 		if(_owner != NULL) {
-			CScreamer* screamerComponent = _owner->getComponent<CScreamer>("CScreamer");
+			CScreamer* screamerComponent = _owner->getComponent<CScreamer>();
 			assert(screamerComponent && "Error: La entidad del jugador no tiene ningun componente llamado CScreamer");
 			screamerComponent->absorbDamage(damage);
 		}
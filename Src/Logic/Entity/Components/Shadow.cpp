@@ -81,12 +81,12 @@ namespace Logic {
 				}
 			}else{
 				// Desactivamos el "shader" de invisibilidad (shader por llamarle algo)
-				std::shared_ptr<CMessageChangeMaterial> materialMsg = std::make_shared<CMessageChangeMaterial>();
+				std::shared_ptr<CMessageChangeMaterial> materialMsg = createMessage<CMessageChangeMaterial>();
 				materialMsg->setMaterialName("original");
 				_entity->emitMessage(materialMsg);
 				Logic::CWorldState::getSingletonPtr()->addChange(_entity,materialMsg);
 				/*
-				std::shared_ptr<CMessageChangeMaterialHudWeapon> materialMsgHud = std::make_shared<CMessageChangeMaterialHudWeapon>();
+				std::shared_ptr<CMessageChangeMaterialHudWeapon> materialMsgHud = createMessage<CMessageChangeMaterialHudWeapon>();
 				materialMsgHud->setMaterialName("original");
 				_entity->emitMessage(materialMsgHud);
 				*/
@@ -124,7 +124,7 @@ namespace Logic {
 		_invisibilityTimer = _invisibilityDuration;
 		
 		// Activamos el shader de invisibilidad
-		std::shared_ptr<CMessageChangeMaterial> materialMsg = std::make_shared<CMessageChangeMaterial>();
+		std::shared_ptr<CMessageChangeMaterial> materialMsg = createMessage<CMessageChangeMaterial>();
 		materialMsg->setMaterialName("shadowInvisibility");
 		_entity->emitMessage(materialMsg);
 		Logic::CWorldState::getSingletonPtr()->addChange(_entity,materialMsg);
@@ -208,7 +208,7 @@ namespace Logic {
 
 
 		//mandamos un mensaje de flashazo
-		std::shared_ptr<CMessageFlash> flashMsg = std::make_shared<CMessageFlash>();
+		std::shared_ptr<CMessageFlash> flashMsg = createMessage<CMessageFlash>();
 		flashMsg->setFlashFactor(flashFactor);
 		entity->emitMessage(flashMsg);
 	}
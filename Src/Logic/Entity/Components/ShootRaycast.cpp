@@ -92,7 +92,7 @@ namespace Logic {
 			emitSound(_audioShoot, "audioShoot");
 
 			//Mensaje de dispersion en mira
-			/*std::shared_ptr<CMessageHudDispersion> dispersionMsg = std::make_shared<CMessageHudDispersion>();
+			/*std::shared_ptr<CMessageHudDispersion> dispersionMsg = createMessage<CMessageHudDispersion>();
 			_entity->emitMessage(dispersionMsg);*/
 		}
 		else if(_currentAmmo == 0) {
@@ -112,20 +112,19 @@ namespace Logic {
 		decrementAmmo(iRafagas);
 
 		//Creacin de sweephit para 
-		Physics::SphereGeometry sphere  = Physics::CGeometryFactory::getSingletonPtr()->createSphere(3.5);
-		std::vector<Physics::CSweepHit> hits;
+		std::vector<Physics::CSweepHit>& hits = _sweepHits;
+		hits.clear();
 		//Physics::CServer::getSingletonPtr()->sweepMultiple(sphere, (_entity->getPosition() + Vector3(0,_heightShoot,0)),_directionShoot,_screamerScreamMaxDistance,hitSpots, true);
 		Vector3 vDirectionShoot = _entity->getOrientation()*Vector3::NEGATIVE_UNIT_Z;
 		Physics::CServer::getSingletonPtr()->sweepMultiple(sphere, (_entity->getPosition() + Vector3(0,_heightShoot,0)),vDirectionShoot, _distance,hits, false, Physics::CollisionGroup::ePLAYER );	
 
 		for(auto it = hits.begin(); it < hits.end(); ++it){
-			std::string typeEntity = (*it).entity->getType();
 			if((*it).entity->getName() != _entity->getName())
 			{
 				int danyoTotal = _damage * iRafagas;
 				std::cout << "Le he dado!!! Danyo = " << danyoTotal << std::endl;
 
-				std::shared_ptr<CMessageDamaged> m = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> m = createMessage<CMessageDamaged>();
 				m->setDamage(danyoTotal);
 				m->setEnemy(_entity);
 				(*it).entity->emitMessage(m);
@@ -133,11 +132,11 @@ namespace Logic {
 				//Le he dado
 				/*
 				Vector3 direct = -(_directionShoot.reflect(-(*it).normal));
-				auto m = std::make_shared<CMessageAddForcePlayer>();
+				auto m = createMessage<CMessageAddForcePlayer>();
 				m->setForce(_directionShoot * (_screamerScreamForce*(1.0f- (*it).distance/_screamerScreamMaxDistance)));
 				(*it).entity->emitMessage(m);
 
-				auto m2 = std::make_shared<CMessageSetAnimation>();
+				auto m2 = createMessage<CMessageSetAnimation>();
 				m2->setString("Damage");
 				m2->setBool(false);
 				(*it).entity->emitMessage(m2);*/
@@ -183,7 +182,7 @@ namespace Logic {
 			decals(hits2.entity, hits2.impact);
 
 			// Aado aqui las particulas de dado en la pared.
-			auto m = std::make_shared<CMessageCreateParticle>();
+			auto m = createMessage<CMessageCreateParticle>();
 			m->setPosition(hits2.impact);
 			m->setParticle("impactParticle");
 			m->setDirectionWithForce(hits2.normal);
@@ -192,7 +191,8 @@ namespace Logic {
 		}
 
 		// Rayo lanzado por el servidor de fsicas de acuerdo a la distancia de potencia del arma
-		std::vector<Physics::CRaycastHit> hits;
+		std::vector<Physics::CRaycastHit>& hits = _hits;
+		hits.clear();
 		Physics::CServer::getSingletonPtr()->raycastMultiple(ray, _distance,hits, true, Physics::CollisionGroup::ePLAYER);
 
 		//Devolvemos lo primero tocado que no seamos nosotros mismos
@@ -208,7 +208,7 @@ namespace Logic {
 
 	// Implementacin por defecto de triggerHitMessages
 	void CShootRaycast::triggerHitMessages(CEntity* entityHit) {
-		std::shared_ptr<CMessageDamaged> m = std::make_shared<CMessageDamaged>();
+		std::shared_ptr<CMessageDamaged> m = createMessage<CMessageDamaged>();
 		m->setDamage(_damage);
 		m->setEnemy(_entity);
 		entityHit->emitMessage(m);
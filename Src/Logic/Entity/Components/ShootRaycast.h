@@ -17,6 +17,10 @@ disparo por raycast.
 #define __Logic_ShootRaycast_H
 
 #include "Logic/Entity/Components/Shoot.h"
+#include "Physics/RaycastHit.h"
+#include "Physics/SweepHit.h"
+
+#include <vector>
 
 namespace Logic {
 	
@@ -198,6 +202,14 @@ namespace Logic {
 		/** Ruta del sonido de disparo */
 		std::string _audioShoot;
 
+		/** 
+		Impactos del ltimo disparo. Es miembro para que el vector conserve su
+		capacidad entre disparos y disparar no reserve memoria.
+		*/
+		std::vector<Physics::CRaycastHit> _hits;
+
+		/** Impactos del ltimo barrido, por el mismo motivo que _hits. */
+		std::vector<Physics::CSweepHit> _sweepHits;
 
 	};
 
@@ -14,7 +14,7 @@ Contiene la implementaci
 
 
 // Logica
-#include "MagneticBullet.h"
+#include "Logic/ProjectileSimulator.h"
 #include "Logic/Maps/EntityFactory.h"
 #include "Logic/Maps/Map.h"
 #include "Logic/Entity/Entity.h"
@@ -84,11 +84,7 @@ namespace Logic {
 
 	void CShotGun::secondaryFire() {
 		// yo le digo que deben de volver, y a partir de ahi, ellas solas encuentran el camino :D
-		if(!_projectiles.empty()){
-			for(auto it = _projectiles.begin(); it != _projectiles.end(); ++it){
-				(*it)->getComponent<CMagneticBullet>("CMagneticBullet")->setProjectileDirection(_entity->getPosition() + Vector3(0,_heightShoot, 0));
-			} 
-		}
+		CProjectileSimulator::getSingletonPtr()->recall( _entity->getEntityID() );
 	} // secondaryShoot
 	//__________________________________________________________________
 
@@ -107,7 +103,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CShotGun::primaryFire() {
-		/*std::shared_ptr<CMessageCreateParticle> particleMsg = std::make_shared<CMessageCreateParticle>();
+		/*std::shared_ptr<CMessageCreateParticle> particleMsg = createMessage<CMessageCreateParticle>();
 		particleMsg->setParticle("test");
 		Vector3 position2 = this->getEntity()->getPosition();
 		position2.y += _heightShoot;
@@ -121,46 +117,39 @@ namespace Logic {
 		_entity->emitMessage(particleMsg);*/
 
 		int shots = _numberOfShots <= _currentAmmo ? _numberOfShots : _currentAmmo;
-		for(int i = 0; i < shots; ++i) {
-			Vector3 direction = _entity->getOrientation()*Vector3::NEGATIVE_UNIT_Z;
-			Ogre::Radian angle = Ogre::Radian( (  (((float)(rand() % 100))*0.01f) * (_dispersionAngle)) *0.01f);
-			Vector3 dispersionDirection = direction.randomDeviant(angle);
-			dispersionDirection.normalise();
-
-			Vector3 position = _entity->getPosition();
-			position.y += _heightShoot;
-
-			CEntity *projectileEntity= CEntityFactory::getSingletonPtr()->createEntity( 
-				CEntityFactory::getSingletonPtr()->getInfo("MagneticBullet"),
-				Logic::CServer::getSingletonPtr()->getMap(),
-				position,
-				Quaternion::IDENTITY
-			);
-			projectileEntity->activate();
-			projectileEntity->start();
-			projectileEntity->getComponent<CMagneticBullet>("CMagneticBullet")->setProperties(this, _projectileShootForce, dispersionDirection, _heightShoot, _primaryFireDamage, _damageBurned);
-			_projectiles.insert(projectileEntity);
-		}			
+		if(shots <= 0)
+			return;
+
+		// Los perdigones no son entidades, los simula CProjectileSimulator
+		CProjectileSimulator::TVolley volley;
+		volley.owner = _entity->getEntityID();
+		volley.nbProjectiles = shots;
+		volley.origin = _entity->getPosition() + Vector3(0, _heightShoot, 0);
+		volley.direction = _entity->getOrientation() * Vector3::NEGATIVE_UNIT_Z;
+		volley.dispersion = _dispersionAngle;
+		volley.speed = _projectileShootForce;
+		volley.radius = _projectileRadius;
+		volley.returnHeight = _heightShoot * 0.5f;
+		volley.damage = _primaryFireDamage;
+
+		CProjectileSimulator::getSingletonPtr()->fire(volley);
 	} // fireWeapon
 	//_________________________________________________
 
 
-	void CShotGun::destroyProjectile(CEntity *projectile, CEntity *killedBy){
+	void CShotGun::projectileImpact(const Vector3& position, CEntity *killedBy){
 		if(killedBy->getType() == "PhysicWorld"){
-			drawDecal(killedBy, projectile->getPosition(), (int)WeaponType::eSHOTGUN);
+			drawDecal(killedBy, position, (int)WeaponType::eSHOTGUN);
 
 			// Aado aqui las particulas de dado en la pared.
-			auto m = std::make_shared<CMessageCreateParticle>();
-			m->setPosition(projectile->getPosition());
+			auto m = createMessage<CMessageCreateParticle>();
+			m->setPosition(position);
 			m->setParticle("impactParticle");
 			// esto no es correcto en realidad, pero hasata que los decals esten en el otro lao, lo dejo asi.
 			m->setDirectionWithForce(-(_entity->getOrientation()*Vector3::NEGATIVE_UNIT_Z));
 			killedBy->emitMessage(m);
 		}
-
-		CEntityFactory::getSingletonPtr()->deferredDeleteEntity(projectile,true);
-		_projectiles.erase(projectile);
-	} // destroyProjectile
+	} // projectileImpact
 	//_________________________________________________
 	
 	void CShotGun::amplifyDamage(unsigned int percentage) {
@@ -19,7 +19,6 @@ Contiene la declaraci
 
 namespace Logic {
 
-	class CPhysicDynamicEntity;
 	/**
 	@ingroup logicGroup
 
@@ -52,11 +51,12 @@ namespace Logic {
 		virtual void amplifyDamage(unsigned int percentage);
 
 		/**
-		Metodo llamado por el proyectil para que este sea borrado como entidad y que lo borre de la lista de 
-		proyectiles.
-		@param projectile, puntero al proyectil que debera ser destruido
+		Metodo llamado por CProjectileSimulator cuando uno de nuestros perdigones choca con el
+		escenario, para pintar el decal y las particulas del impacto.
+		@param position, posicion del perdigon al chocar
+		@param killedBy, entidad con la que ha chocado
 		*/
-		void destroyProjectile(CEntity *projectile, CEntity *killedBy);
+		void projectileImpact(const Vector3& position, CEntity *killedBy);
 
 		void setCurrentAmmo(unsigned int ammo);
 	protected:
@@ -97,11 +97,6 @@ namespace Logic {
 		radio de los proyectiles, equivale al tamao de estos
 		*/
 		float _projectileRadius;
-
-		/**
-		Lista con los punteros a los projectiles.
-		*/
-		std::set<CEntity*> _projectiles;
 	};
 
 	REG_FACTORY(CShotGun);
@@ -68,9 +68,9 @@ namespace Logic {
 		_numberOfShots = weapon->getIntAttribute("NumberOfShots");
 		
 
-		 _friend[_friends] = _shotGunComponent = _entity->getComponent<Logic::CShotGun>("CShotGun");
+		 _friend[_friends] = _shotGunComponent = _entity->getComponent<Logic::CShotGun>();
 		if(_friend[_friends]) ++_friends;
-		_friend[_friends] = _entity->getComponent<Logic::CShotGunFeedback>("CShotGunFeedback");
+		_friend[_friends] = _entity->getComponent<Logic::CShotGunFeedback>();
 		if(_friend[_friends]) ++_friends;
 		if(_friends == 0) assert("\nTiene que tenes alguno de los dos componentes");
 
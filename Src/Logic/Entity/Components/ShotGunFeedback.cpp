@@ -56,11 +56,11 @@ namespace Logic {
 		emitSound(_weaponSound, false, true, false, false);
 
 		// Shader de onda
-		CCameraFeedbackNotifier* _cameraFX = _entity->getComponent<CCameraFeedbackNotifier>("CCameraFeedbackNotifier");
+		CCameraFeedbackNotifier* _cameraFX = _entity->getComponent<CCameraFeedbackNotifier>();
 		_cameraFX->weaponShockWave( Vector2(0.67f, 0.77f), 0.55f, 0.001f, 0.05f, 40.0f, 0.3f );
 
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 		shootFlash->setColor( Vector3(1.0f, 1.0f, 0.72f) );
 		shootFlash->setAttenuation( Vector3(1.0f, 0.014f, 0.0007f) );
 		shootFlash->setRange(325.0f);
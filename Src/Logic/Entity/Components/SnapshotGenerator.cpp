@@ -21,7 +21,9 @@ namespace Logic {
 	// Arranco en 1 para tomar la snapshot de la primera posicion, las demas
 	// ya van solas
 	CSnapshotGenerator::CSnapshotGenerator() : _ticksPerSampleCounter(1), 
-											   _samplesPerSnapshotCounter(0) {
+											   _samplesPerSnapshotCounter(0),
+											   _quantize(false),
+											   _snapshotSequence(0) {
 		// Nada que hacer
 	}
 
@@ -44,6 +46,10 @@ namespace Logic {
 		// Cada cuantas muestras tomamos una snapshot
 		_samplesPerSnapshot = entityInfo->getIntAttribute("samplesPerSnapshot");
 
+		// Por defecto las snapshots se mandan sin cuantizar
+		if( entityInfo->hasAttribute("quantizeSnapshots") )
+			_quantize = entityInfo->getBoolAttribute("quantizeSnapshots");
+
 		return true;
 	}
 
@@ -54,6 +54,7 @@ namespace Logic {
 		<ul>
 			<li><strong>snapshotsPerSecond:</strong> Nmero de snapshots que se mandan por segundo. </li>
 			<li><strong>samplesPerSnapshot:</strong> Nmero de muestras por snapshot. </li>
+			<li><strong>quantizeSnapshots:</strong> (Opcional) true si las snapshots se mandan empaquetadas a nivel de bit. </li>
 		</ul>
 
 		@param entity Entidad a la que pertenece el componente.
@@ -105,6 +106,12 @@ namespace Logic {
 
 		unsigned int _samplesPerSnapshotCounter;
 
+		/** true si las snapshots se mandan cuantizadas y empaquetadas a nivel de bit. */
+		bool _quantize;
+
+		/** Nmero de secuencia de la ltima snapshot enviada. Sirve para que los clientes confirmen su recepcin. */
+		unsigned int _snapshotSequence;
+
 	}; // class CSnapshotGenerator
 
 	//REG_FACTORY(CSnapshotGenerator);
@@ -28,6 +28,7 @@ Contiene la implementaci
 #include "Logic/Maps/Map.h"
 #include "Logic/Server.h"
 #include "Logic/GameNetPlayersManager.h"
+#include "Logic/LagCompensation.h"
 #include "Map/MapEntity.h"
 
 #include "Logic/Messages/MessageDamaged.h"
@@ -95,8 +96,12 @@ namespace Logic {
 		Ray ray(origin, direction);
 
 		// Rayo lanzado por el servidor de fsicas de acuerdo a la distancia de potencia del arma
-		std::vector<Physics::CRaycastHit> hits;
-		Physics::CServer::getSingletonPtr()->raycastMultiple(ray, _shotsDistance, hits, true, Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eWORLD |
+		// Los jugadores se comprueban donde los veia el tirador
+		std::vector<Physics::CRaycastHit>& hits = _hits;
+		hits.clear();
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+		lagCompensation->rewind(_entity);
+		lagCompensation->raycastMultiple(ray, _shotsDistance, hits, true, Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eWORLD |
 														Physics::CollisionGroup::eHITBOX | Physics::CollisionGroup::eFIREBALL | Physics::CollisionGroup::eSCREAMER_SHIELD);
 
 		//Cogemos lo primero tocado que no seamos nosotros mismos y vemos si a un rango X hay enemigos (no nosotros)
@@ -124,7 +129,7 @@ namespace Logic {
 				continue;
 			}
 			if(hits[i].entity->getType() == "ScreamerShield") {
-				CEntity* screamerShieldOwner = hits[i].entity->getComponent<CScreamerShieldDamageNotifier>("CScreamerShieldDamageNotifier")->getOwner();
+				CEntity* screamerShieldOwner = hits[i].entity->getComponent<CScreamerShieldDamageNotifier>()->getOwner();
 
 				if(screamerShieldOwner != _entity)
 					entityHit = hits[i].entity;
@@ -140,8 +145,8 @@ namespace Logic {
 
 			//Entidades validas (Player que no seamos nosotros mismos)
 			else if(hits[i].entity!=_entity){
-				if( hits[i].physicComponent->collidersHaveName() && hits[i].colliderName == "Bip01 Head" ) {
-					std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+				if( hits[i].physicComponent->collidersHaveName() && *hits[i].colliderName == "Bip01 Head" ) {
+					std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 					audioMsg->setAudioName("feedback/headshot.wav");
 					audioMsg->isPlayerOnlySound(true);
 					_entity->emitMessage(audioMsg);
@@ -214,8 +219,12 @@ namespace Logic {
 		Ray ray(origin, direction);
 
 		// Rayo lanzado por el servidor de fsicas de acuerdo a la distancia de potencia del arma
-		std::vector<Physics::CRaycastHit> hits;
-		Physics::CServer::getSingletonPtr()->raycastMultiple(ray, _shotsDistance, hits,true, Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::eFIREBALL |
+		// Los jugadores se comprueban donde los veia el tirador
+		std::vector<Physics::CRaycastHit>& hits = _hits;
+		hits.clear();
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+		lagCompensation->rewind(_entity);
+		lagCompensation->raycastMultiple(ray, _shotsDistance, hits,true, Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::eFIREBALL |
 																							 Physics::CollisionGroup::eHITBOX | Physics::CollisionGroup::eSCREAMER_SHIELD);
 
 		decrementAmmo();
@@ -249,7 +258,7 @@ namespace Logic {
 				// Tras mandar los mensajes de dao al escudo del screamer
 				// abortamos la ejecucin del bucle ya que el escudo evita
 				// que el rayo de la sniper llegue ms lejos
-				CEntity* screamerShieldOwner = hits[i].entity->getComponent<CScreamerShieldDamageNotifier>("CScreamerShieldDamageNotifier")->getOwner();
+				CEntity* screamerShieldOwner = hits[i].entity->getComponent<CScreamerShieldDamageNotifier>()->getOwner();
 				
 				// Si no se trata de nuestro propio escudo mandamos los
 				// mensajes de dao
@@ -343,14 +352,14 @@ namespace Logic {
 				TeamFaction::Enum myTeam = playersMgr->getTeamUsingEntityId(playerId);
 
 				if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-					std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+					std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 					damageDone->setDamage(damageFire);
 					damageDone->setEnemy( _entity );
 					entityHit->emitMessage(damageDone);
 				}
 			}
 			else {
-				std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 				damageDone->setDamage(damageFire);
 				damageDone->setEnemy( _entity );
 				entityHit->emitMessage(damageDone);
@@ -362,21 +371,21 @@ namespace Logic {
 
 			if( !playersMgr->friendlyFireIsActive() && enemyId != playerId) {
 				if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-					std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+					std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 					damageDone->setDamage(damageFire);
 					damageDone->setEnemy( _entity );
 					entityHit->emitMessage(damageDone);
 				}
 			}
 			else {
-				std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 				damageDone->setDamage(damageFire);
 				damageDone->setEnemy( _entity );
 				entityHit->emitMessage(damageDone);
 			}
 		}
 		else {
-			std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+			std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 			damageDone->setDamage(damageFire);
 			damageDone->setEnemy( _entity );
 			entityHit->emitMessage(damageDone);
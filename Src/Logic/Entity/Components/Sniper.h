@@ -17,6 +17,8 @@ Contiene la declaraci
 #include "Logic/Entity/Components/Weapon.h"
 #include "Physics/RaycastHit.h"
 
+#include <vector>
+
 namespace Logic {
 	
 	/**
@@ -154,7 +156,12 @@ namespace Logic {
 		*/
 		float _burnedIncrementPercentageDamage;
 		bool _burned;
-		
+
+		/** 
+		Impactos del ltimo disparo. Es miembro para que el vector conserve su
+		capacidad entre disparos y disparar no reserve memoria.
+		*/
+		std::vector<Physics::CRaycastHit> _hits;
 
 	}; // class CSniper
 
@@ -71,9 +71,9 @@ namespace Logic {
 		// Ratio al que gastamos municion
 		_ammoSpentPerSecondaryShot = weapon->getIntAttribute("AmmoSpentPerSecondaryShot");
 
-		_friend[_friends] = _entity->getComponent<Logic::CSniper>("CSniper");
+		_friend[_friends] = _entity->getComponent<Logic::CSniper>();
 		if(_friend[_friends]) ++_friends;
-		_friend[_friends] = _entity->getComponent<Logic::CSniperFeedback>("CSniperFeedback");
+		_friend[_friends] = _entity->getComponent<Logic::CSniperFeedback>();
 		if(_friend[_friends]) ++_friends;
 		if(_friends == 0) assert("\nTiene que tenes alguno de los dos componentes");
 
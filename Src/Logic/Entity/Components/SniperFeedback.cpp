@@ -55,11 +55,11 @@ namespace Logic {
 		emitSound(_weaponSound, false, true, false, false);
 
 		// Shader de onda
-		CCameraFeedbackNotifier* _cameraFX = _entity->getComponent<CCameraFeedbackNotifier>("CCameraFeedbackNotifier");
+		CCameraFeedbackNotifier* _cameraFX = _entity->getComponent<CCameraFeedbackNotifier>();
 		_cameraFX->weaponShockWave( Vector2(0.72f, 0.74f), 0.4f, 0.001f, 0.03f, 50.0f, 0.35f );
 
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 		shootFlash->setColor( Vector3(0.04f, 0.91f, 0.97f) );
 		shootFlash->setAttenuation( Vector3(1.0f, 0.014f, 0.0007f) );
 		shootFlash->setRange(325.0f);
@@ -83,11 +83,11 @@ namespace Logic {
 		emitSound(_weaponSound, false, true, false, false);
 
 		// Shader de onda
-		CCameraFeedbackNotifier* _cameraFX = _entity->getComponent<CCameraFeedbackNotifier>("CCameraFeedbackNotifier");
+		CCameraFeedbackNotifier* _cameraFX = _entity->getComponent<CCameraFeedbackNotifier>();
 		_cameraFX->weaponShockWave( Vector2(0.72f, 0.74f), 0.4f, 0.001f, 0.03f, 50.0f, 0.35f );
 
 		// Shoot flash
-		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>("CDynamicLight");
+		CDynamicLight* shootFlash = _entity->getComponent<CDynamicLight>();
 		shootFlash->setColor( Vector3(0.04f, 0.91f, 0.97f) );
 		shootFlash->setAttenuation( Vector3(1.0f, 0.014f, 0.0007f) );
 		shootFlash->setRange(325.0f);
@@ -27,6 +27,7 @@ Contiene la implementaci
 #include "Logic/Entity/Components/PhysicDynamicEntity.h"
 #include "Logic/Entity/Components/PhysicStaticEntity.h"
 #include "Logic/GameNetPlayersManager.h"
+#include "Logic/LagCompensation.h"
 
 #include "Logic/Messages/MessageControl.h"
 #include "Logic/Messages/MessageActivate.h"
@@ -101,8 +102,12 @@ namespace Logic {
 
 		Ray ray(origin, direction);
 			
-		std::vector <Physics::CRaycastHit> hits;
-		Physics::CServer::getSingletonPtr()->raycastMultiple(ray, _shotsDistance, hits, true, Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::eSCREAMER_SHIELD);
+		// Los jugadores se comprueban donde los veia el tirador
+		std::vector<Physics::CRaycastHit>& hits = _hits;
+		hits.clear();
+		CLagCompensation* lagCompensation = CLagCompensation::getSingletonPtr();
+		lagCompensation->rewind(_entity);
+		lagCompensation->raycastMultiple(ray, _shotsDistance, hits, true, Physics::CollisionGroup::ePLAYER | Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::eSCREAMER_SHIELD);
 
 		bool targetHit = false;
 		for (auto it = hits.begin(); it < hits.end(); ++it){
@@ -137,21 +142,21 @@ namespace Logic {
 
 					if( !playersMgr->friendlyFireIsActive() && enemyId != playerId) {
 						if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam) {
-							std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+							std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 							damageDone->setDamage(_primaryFireDamage);
 							damageDone->setEnemy( _entity );
 							(*it).entity->emitMessage(damageDone);
 						}
 					}
 					else {
-						std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+						std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 						damageDone->setDamage(_primaryFireDamage);
 						damageDone->setEnemy( _entity );
 						(*it).entity->emitMessage(damageDone);
 					}
 				}
 				else {
-					std::shared_ptr<CMessageDamaged> damageDone = std::make_shared<CMessageDamaged>();
+					std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
 					damageDone->setDamage(_primaryFireDamage);
 					damageDone->setEnemy( _entity );
 					(*it).entity->emitMessage(damageDone);
@@ -198,7 +203,7 @@ namespace Logic {
 
 		std::string weapon, mesh, reward;
 
-		auto componentCSpawnItemManager= _elementPulled->getComponent<CSpawnItemManager>("CSpawnItemManager");
+		auto componentCSpawnItemManager= _elementPulled->getComponent<CSpawnItemManager>();
 		std::stringstream weaponaux ;
 		weaponaux <<  componentCSpawnItemManager->getWeaponType();
 		weapon = weaponaux.str();
@@ -207,7 +212,7 @@ namespace Logic {
 		rewardaux <<  componentCSpawnItemManager->getReward();
 		reward = rewardaux.str();
 
-		//info->setAttribute("model",_elementPulled->getComponent<CGraphics>("CGraphics")->getMeshName());
+		//info->setAttribute("model",_elementPulled->getComponent<CGraphics>()->getMeshName());
 		info->setAttribute("weaponType", weapon);
 		info->setAttribute("reward", reward);
 		info->setAttribute("id", componentCSpawnItemManager->getId());
@@ -230,10 +235,10 @@ namespace Logic {
 		_elementPulling = dynamicItem;
 
 		//por ultimo, ponemos a la entidad donde debe estar
-		_elementPulling->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity")->setGlobalPose(_elementPulled->getPosition(),_elementPulled->getOrientation(), true);
+		_elementPulling->getComponent<CPhysicDynamicEntity>()->setGlobalPose(_elementPulled->getPosition(),_elementPulled->getOrientation(), true);
 
 		//le metemos donde estamos para que nos siga
-		_elementPulling->getComponent<CPullingMovement>("CPullingMovement")->setPlayer(_entity);
+		_elementPulling->getComponent<CPullingMovement>()->setPlayer(_entity);
 
 		_elementPulling->activate();
 		_elementPulling->start();
@@ -281,8 +286,8 @@ namespace Logic {
 	void CSoulReaper::resetEntityPulling(){
 		_elementPulled->activate();
 		CGameNetMsgManager::getSingletonPtr()->sendActivateEntity(_elementPulled->getEntityID());
-		_elementPulled->getComponent<CSpawnItemManager>("CSpawnItemManager")->beginRespawn();
-		std::shared_ptr<CMessageActivate> deactivateMsg = std::make_shared<CMessageActivate>();
+		_elementPulled->getComponent<CSpawnItemManager>()->beginRespawn();
+		std::shared_ptr<CMessageActivate> deactivateMsg = createMessage<CMessageActivate>();
 		deactivateMsg->setActivated(false);
 		_elementPulled->emitMessage(deactivateMsg);
 
@@ -290,8 +295,8 @@ namespace Logic {
 
 		//vamos a decirle al spawnitem original que le han cogido, diciendole
 		//que comience su periodo de respawn y desactivando su fisica
-		_elementPulled->getComponent<CSpawnItemManager>("CSpawnItemManager")->beginRespawn();
-		_elementPulled->getComponent<CPhysicStaticEntity>("CPhysicStaticEntity")->deactivateSimulation();
+		_elementPulled->getComponent<CSpawnItemManager>()->beginRespawn();
+		_elementPulled->getComponent<CPhysicStaticEntity>()->deactivateSimulation();
 
 		//nos liberamos del puntero
 		_elementPulled=NULL;
@@ -15,6 +15,9 @@ Contiene la declaraci
 #define __Logic_SoulReaper_H
 
 #include "Logic/Entity/Components/Weapon.h"
+#include "Physics/RaycastHit.h"
+
+#include <vector>
 
 namespace Logic {
 	
@@ -127,6 +130,12 @@ namespace Logic {
 		bool _primaryFireIsActive;
 		bool _secondaryFireIsActive;
 
+		/** 
+		Impactos del ltimo disparo. Es miembro para que el vector conserve su
+		capacidad entre disparos y disparar no reserve memoria.
+		*/
+		std::vector<Physics::CRaycastHit> _hits;
+
 	}; // class CShootRaycast
 
 	REG_FACTORY(CSoulReaper);
@@ -57,10 +57,10 @@ namespace Logic {
 		// Cooldown del disparo principal
 		_defaultPrimaryFireCooldown = _primaryFireCooldown = weapon->getFloatAttribute("PrimaryFireCooldown") * 1000;
 
-		_friend[_friends] = _entity->getComponent<Logic::CSoulReaper>("CSoulReaper");
+		_friend[_friends] = _entity->getComponent<Logic::CSoulReaper>();
 		if(_friend[_friends])
 			++_friends;
-		_friend[_friends] = _entity->getComponent<Logic::CSoulReaperFeedback>("CSoulReaperFeedback");
+		_friend[_friends] = _entity->getComponent<Logic::CSoulReaperFeedback>();
 		if(_friend[_friends])
 			++_friends;
 		if(_friends == 0)
@@ -45,7 +45,7 @@ namespace Logic {
 				_isRespawning = false;
 				_timer = 0;
 				// Activar entidad grafica y fisica
-				std::shared_ptr<CMessageActivate> activateMsg = std::make_shared<CMessageActivate>();
+				std::shared_ptr<CMessageActivate> activateMsg = createMessage<CMessageActivate>();
 				activateMsg->setActivated(true);
 				Logic::CWorldState::getSingletonPtr()->addChange(_entity,activateMsg);
 				_entity->emitMessage(activateMsg);
@@ -93,6 +93,14 @@ namespace Logic {
 	
 	//________________________________________________________________________
 
+	TMessageTypeSet CSpawnItemManager::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CSpawnItemManager::accept(const std::shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::TOUCHED;
 	} // accept
@@ -116,7 +124,7 @@ namespace Logic {
 	void CSpawnItemManager::itemGrabbed(CEntity* actor) {
 
 		// Desactivamos la entidad grafica y fisica.
-		std::shared_ptr<CMessageActivate> deactivateMsg = std::make_shared<CMessageActivate>();
+		std::shared_ptr<CMessageActivate> deactivateMsg = createMessage<CMessageActivate>();
 		deactivateMsg->setActivated(false);
 		_entity->emitMessage(deactivateMsg);
 		Logic::CWorldState::getSingletonPtr()->addChange(_entity, deactivateMsg);
@@ -125,35 +133,35 @@ namespace Logic {
 			// Mandar el mensaje que corresponda a la entidad actuadora
 			// en funcion del item que se haya cogido (comprobando el id)
 			if(_id == "orb") {
-				std::shared_ptr<CMessageAddLife> addLifeMsg = std::make_shared<CMessageAddLife>();
+				std::shared_ptr<CMessageAddLife> addLifeMsg = createMessage<CMessageAddLife>();
 				addLifeMsg->setAddLife(_reward);
 				actor->emitMessage(addLifeMsg);
 			}
 			else if(_id == "armor") {
-				std::shared_ptr<CMessageAddShield> addShieldMsg = std::make_shared<CMessageAddShield>();
+				std::shared_ptr<CMessageAddShield> addShieldMsg = createMessage<CMessageAddShield>();
 				addShieldMsg->setAddShield(_reward);
 				actor->emitMessage(addShieldMsg);
 			}
 			else if(_id == "ammo") {
-				std::shared_ptr<CMessageAddAmmo> addAmmoMsg = std::make_shared<CMessageAddAmmo>();
+				std::shared_ptr<CMessageAddAmmo> addAmmoMsg = createMessage<CMessageAddAmmo>();
 				addAmmoMsg->setAddAmmo(_reward);
 				addAmmoMsg->setAddWeapon(_weaponType);
 				actor->emitMessage(addAmmoMsg);
 			}
 			else if(_id == "weapon") {
-				std::shared_ptr<CMessageAddWeapon> addWeaponMsg = std::make_shared<CMessageAddWeapon>();
+				std::shared_ptr<CMessageAddWeapon> addWeaponMsg = createMessage<CMessageAddWeapon>();
 				addWeaponMsg->setAddAmmo(_reward);
 				addWeaponMsg->setAddWeapon(_weaponType);
 				actor->emitMessage(addWeaponMsg);
 			}
 			else if(_id == "damageAmplifier") {
-				std::shared_ptr<CMessageDamageAmplifier> dmgMsg = std::make_shared<CMessageDamageAmplifier>();
+				std::shared_ptr<CMessageDamageAmplifier> dmgMsg = createMessage<CMessageDamageAmplifier>();
 				dmgMsg->setPercentDamage(_reward);
 				dmgMsg->setDuration(15000); // 15 segs
 				actor->emitMessage(dmgMsg);
 			}
 			else if(_id == "cooldownReducer") {
-				std::shared_ptr<CMessageReducedCooldown> cooldownMsg = std::make_shared<CMessageReducedCooldown>();
+				std::shared_ptr<CMessageReducedCooldown> cooldownMsg = createMessage<CMessageReducedCooldown>();
 				cooldownMsg->setPercentCooldown(_reward);
 				cooldownMsg->setDuration(15000); // 15 segs
 				actor->emitMessage(cooldownMsg);
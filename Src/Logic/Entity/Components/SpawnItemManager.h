@@ -39,8 +39,8 @@ namespace Logic {
 		// =======================================================================
 
 
-		/** Constructor por defecto; en la clase base no hace nada. */
-		CSpawnItemManager() : IComponent(), _isRespawning(false), _timer(0), _weaponType(-1) {}
+		/** Constructor por defecto. El componente tiene tick por lotes. */
+		CSpawnItemManager() : IComponent(), _isRespawning(false), _timer(0), _weaponType(-1) { enableBatchedTick(); }
 
 
 		// =======================================================================
@@ -85,6 +85,11 @@ namespace Logic {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -70,6 +70,16 @@ namespace Logic
 	//--------------------------------------------------------
 
 
+	TMessageTypeSet CSpawnPlayer::getAcceptedMessageTypes()
+
+	{
+		TMessageTypeSet types;
+		types.set(Message::PLAYER_DEAD);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//--------------------------------------------------------
+
 	bool CSpawnPlayer::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::PLAYER_DEAD;
@@ -112,7 +122,7 @@ namespace Logic
 
 				//Ponemos la entidad fsica en la posicin instantaneamente ( no se puede permitir el envio de mensajes )
 				//La simulacion fisica tiene que ser activada en el siguiente tick, para que el player se resitue bien
-				_entity->getComponent<CPhysicController>("CPhysicController")->setPhysicPosition(spawnPos);
+				_entity->getComponent<CPhysicController>()->setPhysicPosition(spawnPos);
 				_reactivePhysicSimulation=true;
 
 				//Volvemos a activar todos los componentes(lo que hace resetea _isDead y _actualTimeSpawn)
@@ -125,7 +135,7 @@ namespace Logic
 				_entity->setOrientation(spawn->getYaw());
 				
 				// Si eres el server mandar un mensaje de spawn
-				std::shared_ptr<CMessagePlayerSpawn> spawnMsg = std::make_shared<CMessagePlayerSpawn>();
+				std::shared_ptr<CMessagePlayerSpawn> spawnMsg = createMessage<CMessagePlayerSpawn>();
 				spawnMsg->setSpawnPosition( _entity->getPosition() );
 				spawnMsg->setSpawnOrientation( _entity->getYaw());
 				_entity->emitMessage(spawnMsg);
@@ -140,7 +150,7 @@ namespace Logic
 				//	Logic::CGameNetMsgManager::getSingletonPtr()->sendMessageToOne(new CMessagePlayerSpawn(), camera->getEntityID(), _entity->getEntityID());
 				//Mirar porque se cre esto, lo mismo antonio sabe
 				/*
-				std::shared_ptr<CMessageCreateParticle> particle =std::make_shared<CMessageCreateParticle>();
+				std::shared_ptr<CMessageCreateParticle> particle =createMessage<CMessageCreateParticle>();
 				particle->setParticle("SpawnParticle");
 				particle->setPosition(_entity->getPosition());
 				*/
@@ -149,8 +159,8 @@ namespace Logic
 			}
 		}
 		else if(_reactivePhysicSimulation){
-			_entity->getComponent<CPhysicController>("CPhysicController")->activateSimulation();
-			CAvatarController* avatarComp = _entity->getComponent<CAvatarController>("CAvatarController");
+			_entity->getComponent<CPhysicController>()->activateSimulation();
+			CAvatarController* avatarComp = _entity->getComponent<CAvatarController>();
 			if(avatarComp != NULL) 
 				avatarComp->wakeUp();
 
@@ -158,7 +168,7 @@ namespace Logic
 			_inmunityTimer += msecs;
 			if(_inmunityTimer > _inmunityTime) {
 				_inmunityTimer = 0;
-				_entity->emitMessage( std::make_shared<CMessageSpawnIsLive>() );
+				_entity->emitMessage( createMessage<CMessageSpawnIsLive>() );
 
 				_reactivePhysicSimulation=false;
 				putToSleep();
@@ -185,15 +195,15 @@ namespace Logic
 			except.insert( std::string("CRagdoll") );
 
 			//Desactivamos la simulacin fsica (no puede estar activo en la escena fsica al morir)
-			_entity->getComponent<CPhysicController>("CPhysicController")->deactivateSimulation();
-			CAvatarController* avatarComp = _entity->getComponent<CAvatarController>("CAvatarController");
+			_entity->getComponent<CPhysicController>()->deactivateSimulation();
+			CAvatarController* avatarComp = _entity->getComponent<CAvatarController>();
 			if(avatarComp != NULL) 
 				avatarComp->putToSleep(true);
 
 			_entity->deactivateAllComponentsExcept(except);
 			_isDead=true;
 			//Mensaje para el Hud (tiempo de spawn)
-			std::shared_ptr<CMessageHudSpawn> m = std::make_shared<CMessageHudSpawn>();
+			std::shared_ptr<CMessageHudSpawn> m = createMessage<CMessageHudSpawn>();
 			m->setTime(_timeSpawn/1000);
 			_entity->emitMessage(m);
 		}
@@ -69,7 +69,7 @@ namespace Logic {
 		if(_currentFollowedPlayer != NULL && entity == _currentFollowedPlayer) {
 			_currentFollowedPlayer = NULL;
 
-			CServer::getSingletonPtr()->getMap()->getEntityByName("Camera")->getComponent<CCamera>("CCamera")->setTarget(_entity);
+			CServer::getSingletonPtr()->getMap()->getEntityByName("Camera")->getComponent<CCamera>()->setTarget(_entity);
 
 			_hud->freelook();
 		}
@@ -89,7 +89,7 @@ namespace Logic {
 		assert( entityInfo->hasAttribute("maxVelocity") && "Error: No se ha definido el atributo maxVelocity en el mapa" );
 		_maxVelocity = entityInfo->getFloatAttribute("maxVelocity");
 
-		_hud = _entity->getComponent<CSpectatorHud>("CSpectatorHud");
+		_hud = _entity->getComponent<CSpectatorHud>();
 
 		return true;
 	} // spawn
@@ -102,6 +102,14 @@ namespace Logic {
 
 	//________________________________________________________________________
 
+	TMessageTypeSet CSpectatorController::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::CONTROL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//________________________________________________________________________
+
 	bool CSpectatorController::accept(const std::shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -121,19 +129,19 @@ namespace Logic {
 					CEntity* nextPlayer = getNextPlayerToSpectateAs();
 
 					CEntity* cameraEnt = map->getEntityByName("Camera");
-					CCamera* cameraComp = cameraEnt->getComponent<CCamera>("CCamera");
+					CCamera* cameraComp = cameraEnt->getComponent<CCamera>();
 					if(nextPlayer != NULL) {
 						if(_currentFollowedPlayer != NULL)
-							_currentFollowedPlayer->getComponent<CAnimatedGraphics>("CAnimatedGraphics")->setVisible(true);
+							_currentFollowedPlayer->getComponent<CAnimatedGraphics>()->setVisible(true);
 						
-						nextPlayer->getComponent<CAnimatedGraphics>("CAnimatedGraphics")->setVisible(false);
+						nextPlayer->getComponent<CAnimatedGraphics>()->setVisible(false);
 						cameraComp->setTarget(nextPlayer);
 						_currentFollowedPlayer = nextPlayer;
 						_hud->lookAt(_currentFollowedPlayer->getName());
 					}
 					else {
 						if(_currentFollowedPlayer != NULL) {
-							_currentFollowedPlayer->getComponent<CAnimatedGraphics>("CAnimatedGraphics")->setVisible(true);
+							_currentFollowedPlayer->getComponent<CAnimatedGraphics>()->setVisible(true);
 							_currentFollowedPlayer = NULL;
 						}
 
@@ -143,11 +151,11 @@ namespace Logic {
 				else if(commandType == ControlType::RIGHT_CLICK) {
 					// Modo camara libre
 					if(_currentFollowedPlayer != NULL) {
-						_currentFollowedPlayer->getComponent<CAnimatedGraphics>("CAnimatedGraphics")->setVisible(true);
+						_currentFollowedPlayer->getComponent<CAnimatedGraphics>()->setVisible(true);
 						_currentFollowedPlayer = NULL;
 					}
 
-					CServer::getSingletonPtr()->getMap()->getEntityByName("Camera")->getComponent<CCamera>("CCamera")->setTarget(_entity);
+					CServer::getSingletonPtr()->getMap()->getEntityByName("Camera")->getComponent<CCamera>()->setTarget(_entity);
 
 					_hud->freelook();
 				}
@@ -214,7 +222,7 @@ namespace Logic {
 		// Nos quedamos con el puntero al componente CPhysicController
 		// que es el que realmente se encargar de desplazar al controlador
 		// del jugador.
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
+		_physicController = _entity->getComponent<CPhysicController>();
 		assert(_physicController && "Error: El player no tiene un controlador fisico");
 
 		std::vector<TMessageType> notUsed;
@@ -39,13 +39,21 @@ namespace Logic
 
 		_spells.resize(SpellType::eSIZE);
 		// Rellenamos el vector con los punteros a los componentes correspondientes
-		_spells[SpellType::eAMPLIFY_DAMAGE] = _entity->getComponent<Logic::CAmplifyDamageClient>("CAmplifyDamageClient");
-		_spells[SpellType::eCOOLDOWN] = _entity->getComponent<Logic::CCoolDownClient>("CCoolDownClient");
+		_spells[SpellType::eAMPLIFY_DAMAGE] = _entity->getComponent<Logic::CAmplifyDamageClient>();
+		_spells[SpellType::eCOOLDOWN] = _entity->getComponent<Logic::CCoolDownClient>();
 		return true;
 
 	} // spawn
 	//---------------------------------------------------------
 
+	TMessageTypeSet CSpellsManagerClient::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ADD_SPELL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CSpellsManagerClient::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
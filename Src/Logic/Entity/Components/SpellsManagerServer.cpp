@@ -39,13 +39,21 @@ namespace Logic
 
 		_spells.resize(SpellType::eSIZE);
 		// Rellenamos el vector con los punteros a los componentes correspondientes
-		_spells[SpellType::eAMPLIFY_DAMAGE] = _entity->getComponent<Logic::CAmplifyDamageServer>("CAmplifyDamageServer");
-		_spells[SpellType::eCOOLDOWN] = _entity->getComponent<Logic::CCoolDownServer>("CCoolDownServer");
+		_spells[SpellType::eAMPLIFY_DAMAGE] = _entity->getComponent<Logic::CAmplifyDamageServer>();
+		_spells[SpellType::eCOOLDOWN] = _entity->getComponent<Logic::CCoolDownServer>();
 		return true;
 
 	} // spawn
 	//---------------------------------------------------------
 
+	TMessageTypeSet CSpellsManagerServer::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ADD_SPELL);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CSpellsManagerServer::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
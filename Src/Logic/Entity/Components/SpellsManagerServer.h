@@ -34,6 +34,9 @@ namespace Logic
 		virtual bool spawn(CEntity* entity, CMap *map, const Map::CEntity *entityInfo);
 
 		virtual bool accept(const std::shared_ptr<CMessage>& message);
+
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
 		virtual void process(const std::shared_ptr<CMessage>& message);
 		
 	private:
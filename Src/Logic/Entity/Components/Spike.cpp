@@ -43,6 +43,15 @@ namespace Logic
 	} // spawn
 	//---------------------------------------------------------
 
+	TMessageTypeSet CSpike::getAcceptedMessageTypes()
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CSpike::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED;
@@ -56,19 +65,19 @@ namespace Logic
 			case Message::TOUCHED: {
 				//Aplicamos el dao
 				std::shared_ptr<CMessageTouched> touchedMsg = std::static_pointer_cast<CMessageTouched>(message);
-				std::shared_ptr<CMessageDamaged> damagedMsg = std::make_shared<CMessageDamaged>();
+				std::shared_ptr<CMessageDamaged> damagedMsg = createMessage<CMessageDamaged>();
 				damagedMsg->setDamage(1000);
 				damagedMsg->setEnemy(_entity);
 				touchedMsg->getEntity()->emitMessage(damagedMsg);
 				//Desactivamos la fuerza que lleva el pincho
-				_entity->getComponent<CPhysicDynamicEntity>("CPhysicDynamicEntity")->clearForce(Physics::ForceMode::eFORCE);
+				_entity->getComponent<CPhysicDynamicEntity>()->clearForce(Physics::ForceMode::eFORCE);
 				//Desactivamos grafica y fisicamente
-				std::shared_ptr<CMessageActivate> deactivateMsg = std::make_shared<CMessageActivate>();
+				std::shared_ptr<CMessageActivate> deactivateMsg = createMessage<CMessageActivate>();
 				deactivateMsg->setActivated(false);
 				_entity->emitMessage(deactivateMsg);
 				Logic::CWorldState::getSingletonPtr()->addChange(_entity, deactivateMsg);
 				//Recolocamos la entidad fisicamente en su inicio para cuando se active nuevamente la trampa
-				std::shared_ptr<CMessageTransform> setTransformMsg = std::make_shared<CMessageTransform>();
+				std::shared_ptr<CMessageTransform> setTransformMsg = createMessage<CMessageTransform>();
 				setTransformMsg->setPosition(_initialPosition);
 				setTransformMsg->setOrientation(_initialOrientation);
 				setTransformMsg->setMakeConversion(true);
@@ -69,6 +69,15 @@ namespace Logic
 	} // activate
 	//---------------------------------------------------------
 
+	TMessageTypeSet CSpikeTrap::getAcceptedMessageTypes()
+	{
+		TMessageTypeSet types;
+		types.set(Message::TOUCHED);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CSpikeTrap::accept(const std::shared_ptr<CMessage>& message)
 	{
 		return message->getMessageType() == Message::TOUCHED;
@@ -83,13 +92,13 @@ namespace Logic
 				std::vector<CEntity*> spikes=createSpikes();
 				for(auto it = spikes.begin(); it != spikes.end(); ++it) {
 					//Creamos el mensaje de fuerza para los pinchos
-					std::shared_ptr<CMessageAddForcePhysics> forceMsg = std::make_shared<CMessageAddForcePhysics>();
+					std::shared_ptr<CMessageAddForcePhysics> forceMsg = createMessage<CMessageAddForcePhysics>();
 					forceMsg->setForce(_directionSpikes* _velocitySpikes, Physics::ForceMode::eFORCE );
 					forceMsg->setGravity(false);
 					(*it)->emitMessage(forceMsg);
 					
 					//Audio
-					std::shared_ptr<CMessageAudio> audioMsg = std::make_shared<CMessageAudio>();
+					std::shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 					audioMsg->setAudioName(_audioTrap);
 					audioMsg->isLoopable(false);
 					audioMsg->is3dSound(true);
@@ -99,7 +108,7 @@ namespace Logic
 
 					//Volvemos invisible la trampa
 					//Desactivamos la entidad grafica y fisica.
-					std::shared_ptr<CMessageActivate> deactivateMsg = std::make_shared<CMessageActivate>();
+					std::shared_ptr<CMessageActivate> deactivateMsg = createMessage<CMessageActivate>();
 					deactivateMsg->setActivated(false);
 					_entity->emitMessage(deactivateMsg);
 					Logic::CWorldState::getSingletonPtr()->addChange(_entity, deactivateMsg);
@@ -122,7 +131,7 @@ namespace Logic
 				_timer = 0;
 				//Volvemos visible la trampa
 				//Activamos la entidad grafica y fisica
-				std::shared_ptr<CMessageActivate> activateMsg = std::make_shared<CMessageActivate>();
+				std::shared_ptr<CMessageActivate> activateMsg = createMessage<CMessageActivate>();
 				activateMsg->setActivated(true);
 				_entity->emitMessage(activateMsg);
 				Logic::CWorldState::getSingletonPtr()->addChange(_entity,activateMsg);
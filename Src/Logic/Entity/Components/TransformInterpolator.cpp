@@ -55,6 +55,14 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet CTransformInterpolator::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::TRANSFORM_SNAPSHOT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool CTransformInterpolator::accept(const shared_ptr<CMessage>& message) {
 		return message->getMessageType() == Message::TRANSFORM_SNAPSHOT;
 	}
@@ -32,8 +32,10 @@ namespace Logic {
 
 	void CTransformSnapshot::sendSnapshot() {
 		// Enviar un mensaje con el buffer
-		shared_ptr<CMessageTransformSnapshot> snapshotMsg = make_shared<CMessageTransformSnapshot>();
+		shared_ptr<CMessageTransformSnapshot> snapshotMsg = createMessage<CMessageTransformSnapshot>();
 		snapshotMsg->setBuffer(_transformBuffer);
+		snapshotMsg->setQuantized(_quantize);
+		snapshotMsg->setSequence(++_snapshotSequence);
 		_entity->emitMessage(snapshotMsg);
 
 		// Limpiar el buffer para la siguiente snapshot
@@ -13,12 +13,15 @@
 #include "Map/MapEntity.h"
 #include "Basesubsystems/Math.h"
 
-#include "Logic/Messages/MessageControl.h"
 #include "Logic/Messages/MessageSyncPosition.h"
+#include "Logic/Messages/MessagePlayerInput.h"
+#include "Logic/Messages/MessagePlayerState.h"
 #include "Logic/Entity/Components/AvatarController.h"
 #include "Logic/Entity/Components/PhysicController.h"
 #include "Logic/GameNetMsgManager.h"
 
+#include <algorithm>
+
 namespace Logic 
 {
 	IMP_FACTORY(CUpdateClientPosition);
@@ -26,8 +29,17 @@ namespace Logic
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+	TMessageTypeSet CUpdateClientPosition::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::PLAYER_INPUT);
+		types.set(Message::SYNC_POSITION);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CUpdateClientPosition::accept(const std::shared_ptr<CMessage>& message) {
-		return message->getMessageType() == Message::CONTROL ||
+		return message->getMessageType() == Message::PLAYER_INPUT ||
 			message->getMessageType() == Message::SYNC_POSITION;
 	} // accept
 
@@ -39,8 +51,8 @@ namespace Logic
 		case Message::SYNC_POSITION:
 				updateClientPosition(std::static_pointer_cast<CMessageSyncPosition>(message));
 			break;
-		case Message::CONTROL:
-				sendACKMessage(std::static_pointer_cast<CMessageControl>(message)->getSeqNumber());
+		case Message::PLAYER_INPUT:
+				applyInput(std::static_pointer_cast<CMessagePlayerInput>(message));
 			break;
 		}
 
@@ -57,23 +69,74 @@ namespace Logic
 			// Convertimos a msecs
 			_syncPosTimeStamp = entityInfo->getFloatAttribute("syncPosTimeStamp") * 1000;
 		}
-		_physicController = _entity->getComponent<CPhysicController>("CPhysicController");
+		_physicController = _entity->getComponent<CPhysicController>();
 
 		return true;
 	} // spawn
 
 
-	void CUpdateClientPosition::sendACKMessage(unsigned int sequenceNumber){
-		std::shared_ptr<CMessageSyncPosition> ack = std::make_shared<CMessageSyncPosition>();
-		Vector3 position = _entity->getPosition();
-//		ack->setPosition( position );
-//		ack->setSeq(sequenceNumber);
+	void CUpdateClientPosition::onStart() {
+		// El jugador se mueve al ritmo de los comandos que manda el cliente
+		_avatarController = _entity->getComponent<CAvatarController>();
+		assert(_avatarController && "Error: CUpdateClientPosition necesita un CAvatarController");
+		_avatarController->setCommandDriven(true);
+	} // onStart
 
-		//std::cout << "mensaje " << sequenceNumber << " resultado " << _entity->getComponent<CAvatarController>("CAvatarController")->getVelocity() << std::endl;
+////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		CGameNetMsgManager::getSingletonPtr()->sendMessageToOne(ack, _entity->getEntityID(), _entity->getEntityID());
-	}
+	void CUpdateClientPosition::onActivate() {
+		_lastSeqNumber = 0;
+		_ackPending = false;
+		_commandTime = COMMAND_SLACK_STEPS * _entity->getMap()->getFixedTimeStep();
+	} // onActivate
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void CUpdateClientPosition::onTick(unsigned int msecs) {
+		// Lo que no se gaste se guarda, pero slo hasta el margen
+		unsigned int maxCommandTime = COMMAND_SLACK_STEPS * _entity->getMap()->getFixedTimeStep();
+		_commandTime = std::min(_commandTime + msecs, maxCommandTime);
+
+		if(_ackPending) {
+			sendPlayerState();
+			_ackPending = false;
+		}
+	} // onTick
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+	void CUpdateClientPosition::applyInput(const std::shared_ptr<CMessagePlayerInput> &message) {
+		unsigned int seq = message->getSeqNumber();
+		if(seq <= _lastSeqNumber)
+			return;
+
+		_entity->setOrientation( message->getOrientation() );
+
+		// Sin tiempo de servidor el comando no mueve al jugador. Se confirma
+		// igual, con lo que el cliente vuelve a la posicion del servidor
+		unsigned int fixedTimeStep = _entity->getMap()->getFixedTimeStep();
+		if(_commandTime >= fixedTimeStep) {
+			_avatarController->applyInputCommand( message->getAction(), message->getDisplacementDir(), fixedTimeStep );
+			_commandTime -= fixedTimeStep;
+		}
+
+		_lastSeqNumber = seq;
+		_ackPending = true;
+	} // applyInput
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void CUpdateClientPosition::sendPlayerState() {
+		std::shared_ptr<CMessagePlayerState> stateMsg = createMessage<CMessagePlayerState>();
+		stateMsg->setSeqNumber(_lastSeqNumber);
+		stateMsg->setPosition( _entity->getPosition() );
+		stateMsg->setMomentum( _avatarController->getMomentum() );
+		stateMsg->setTouchingGround( !_avatarController->getFlying() );
+
+		CGameNetMsgManager::getSingletonPtr()->sendMessageToOne(stateMsg, _entity->getEntityID(), _entity->getEntityID());
+	} // sendPlayerState
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void CUpdateClientPosition::updateClientPosition(const std::shared_ptr<CMessageSyncPosition> &message){
 		if( _physicController->isSimulating() ) 
@@ -17,9 +17,24 @@ namespace Logic  {
 
 	//forward declarations
 	class CMessageSyncPosition;
+	class CMessagePlayerInput;
 	class CPhysicController;
+	class CAvatarController;
 
 	/**
+	Lado servidor de la prediccin del jugador (ver CNetCommands).
+	<p>
+	Simula con CAvatarController los comandos de entrada que manda el
+	cliente, en el orden en que los numer, y le contesta con el estado
+	autoritativo del movimiento y el nmero del ltimo comando procesado.
+	Como mucho se contesta una vez por frame: si en un frame llegan varios
+	comandos slo se confirma el ltimo.
+	<p>
+	Cada comando avanza un paso fijo, as que un cliente que mandase ms
+	comandos de la cuenta correra ms. Los comandos gastan el tiempo de
+	servidor transcurrido (ms un margen de COMMAND_SLACK_STEPS pasos para
+	absorber el jitter) y los que no caben no mueven al jugador.
+
     @ingroup logicGroup
 
 	@author Francisco Aisa Garca
@@ -38,7 +53,8 @@ namespace Logic  {
 
 
 		/** Constructor por defecto. Inicializa el timer a 0. */
-		CUpdateClientPosition() : IComponent(), _timer(0) {}
+		CUpdateClientPosition() : IComponent(), _timer(0), _lastSeqNumber(0), _ackPending(false),
+								  _commandTime(0), _physicController(0), _avatarController(0) {}
 
 
 		// =======================================================================
@@ -69,7 +85,7 @@ namespace Logic  {
 
 		<ul>
 			<li>SYNC_POSITION</li>
-			<li>CONTROL</li>
+			<li>PLAYER_INPUT</li>
 		</ul>
 		
 		@param message Mensaje a chequear.
@@ -79,6 +95,11 @@ namespace Logic  {
 
 		//________________________________________________________________________
 
+		/** Tipos de mensaje que puede aceptar el componente (ver accept). */
+		static TMessageTypeSet getAcceptedMessageTypes();
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo virtual que procesa un mensaje.
 
@@ -88,7 +109,43 @@ namespace Logic  {
 
 	protected:
 
-		void sendACKMessage(unsigned int sequenceNumber);
+		/**
+		Se queda con los controladores de la entidad y pasa el de movimiento a
+		moverse slo con los comandos del cliente.
+		*/
+		virtual void onStart();
+
+		//________________________________________________________________________
+
+		/** Olvida el ltimo comando procesado (al reaparecer). */
+		virtual void onActivate();
+
+		//________________________________________________________________________
+
+		/**
+		Suma al tiempo disponible para comandos el del frame y confirma al
+		cliente el ltimo comando procesado en este frame.
+
+		@param msecs Milisegundos transcurridos desde el ltimo tick.
+		*/
+		virtual void onTick(unsigned int msecs);
+
+		//________________________________________________________________________
+
+		/**
+		Simula un comando de entrada del cliente. Los comandos repetidos o que
+		llegan tarde se descartan. Si no queda tiempo de servidor para el
+		comando slo se aplica su orientacin, pero se confirma igualmente
+		para que el cliente corrija su prediccin.
+
+		@param message Comando de entrada del cliente.
+		*/
+		void applyInput(const std::shared_ptr<CMessagePlayerInput> &message);
+
+		//________________________________________________________________________
+
+		/** Manda al cliente el estado autoritativo de su movimiento. */
+		void sendPlayerState();
 
 		void updateClientPosition(const std::shared_ptr<CMessageSyncPosition> &message);
 
@@ -100,14 +157,27 @@ namespace Logic  {
 		// =======================================================================
 
 
+		/** Pasos fijos de margen que puede acumular un cliente sobre el tiempo transcurrido. */
+		static const unsigned int COMMAND_SLACK_STEPS = 4;
+
 		/** Timer para controlar cada cuanto se manda el mensaje de sincronizacion de la posicion del cliente. */
 		float _timer;
 
 		/** Limite de tiempo para mandar el mensaje de sincronizacion. */
 		float _syncPosTimeStamp;
 
+		/** Nmero de secuencia del ltimo comando procesado. */
+		unsigned int _lastSeqNumber;
+
+		/** true si hay que confirmar comandos en el tick. */
+		bool _ackPending;
+
+		/** Milisegundos de servidor que an pueden gastar los comandos del cliente. */
+		unsigned int _commandTime;
 
 		CPhysicController *_physicController;
+
+		CAvatarController *_avatarController;
 	}; // class CUpdateClientPosition
 
 	REG_FACTORY(CUpdateClientPosition);
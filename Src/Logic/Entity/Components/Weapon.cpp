@@ -86,6 +86,16 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet IWeapon::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::BLOCK_SHOOT);
+		types.set(Message::PRIMARY_SHOOT);
+		types.set(Message::SECONDARY_SHOOT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool IWeapon::accept(const shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -154,7 +164,7 @@ namespace Logic {
 
 		/*
 		if(iAmCatch) {
-			std::shared_ptr<CMessageHudAmmo> message = std::make_shared<CMessageHudAmmo>();
+			std::shared_ptr<CMessageHudAmmo> message = createMessage<CMessageHudAmmo>();
 			message->setWeapon(_weaponID);
 			message->setAmmo(_currentAmmo);
 			_entity->emitMessage(message);
@@ -170,7 +180,7 @@ namespace Logic {
 		/*
 		// Notificamos al hud para que cambie la cantidad de municion
 		// que tenemos
-		shared_ptr<CMessageHudAmmo> message = make_shared<CMessageHudAmmo>();
+		shared_ptr<CMessageHudAmmo> message = createMessage<CMessageHudAmmo>();
 		message->setAmmo(_currentAmmo);
 
 		// Cambio sobre uno, hay q cambiarlo ;-)
@@ -193,7 +203,7 @@ namespace Logic {
 		/// This method will extract all of the triangles from the mesh to be used later. Only should be called once.
 		/// If you scale your mesh at all, pass it in here.
 
-		shared_ptr<CMessageDecal> messageDecal = make_shared<CMessageDecal>();
+		shared_ptr<CMessageDecal> messageDecal = createMessage<CMessageDecal>();
 		messageDecal->setPosition(vPos);
 		messageDecal->setTexture("gunshotwall");
 		messageDecal->setRandomSize(true);
@@ -205,7 +215,7 @@ namespace Logic {
 	void IWeapon::drawDecal(Logic::CEntity* pEntity, Vector3 vPos, int iWeapon)	{
 		OgreDecal::OgreMesh worldMesh;
 
-		shared_ptr<CMessageDecal> messageDecal = make_shared<CMessageDecal>();
+		shared_ptr<CMessageDecal> messageDecal = createMessage<CMessageDecal>();
 		messageDecal->setPosition(vPos);
 		switch (iWeapon)
 		{
@@ -224,7 +234,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void IWeapon::emitSound(const string &soundName, bool loopSound, bool play3d, bool streamSound, bool stopSound){
-		shared_ptr<CMessageAudio> audioMsg = make_shared<CMessageAudio>();
+		shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		
 		audioMsg->setAudioName(soundName);
 		audioMsg->isLoopable(loopSound);
@@ -241,7 +251,7 @@ namespace Logic {
 	void IWeapon::particles()
 	{
 		//std::cout << "particula" << std::endl;
-		std::shared_ptr<CMessageCreateParticle> particleMsg = std::make_shared<CMessageCreateParticle>();
+		std::shared_ptr<CMessageCreateParticle> particleMsg = createMessage<CMessageCreateParticle>();
 		particleMsg->setParticle("ShootParticle2");
 
 		Vector3 position2 = _entity->getPosition();
@@ -83,6 +83,16 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet IWeaponAmmo::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::BLOCK_SHOOT);
+		types.set(Message::CONTROL);
+		types.set(Message::REDUCED_COOLDOWN);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool IWeaponAmmo::accept(const shared_ptr<CMessage>& message) {
 		// Solo nos interesan los mensajes de disparo.
 		// Es importante que hagamos esto porque si no, el putToSleep
@@ -153,7 +163,7 @@ namespace Logic {
 	void IWeaponAmmo::primaryFire() {
 		_primaryFireIsActive = true;
 		// Mandar el mensaje primaryFire(true)
-		auto m = make_shared<CMessagePrimaryShoot>(true);
+		auto m = createMessage<CMessagePrimaryShoot>(true);
 		_entity->emitMessage(m);
 	}
 	//__________________________________________________________________
@@ -161,7 +171,7 @@ namespace Logic {
 	void IWeaponAmmo::secondaryFire() {
 		_secondaryFireIsActive = true;
 		// Mandar el mensaje seondaryFire(true)
-		auto m = make_shared<CMessageSecondaryShoot>(true);
+		auto m = createMessage<CMessageSecondaryShoot>(true);
 		_entity->emitMessage(m);
 	}
 
@@ -170,7 +180,7 @@ namespace Logic {
 	void IWeaponAmmo::stopPrimaryFire() {
 		_primaryFireIsActive = false;
 		// Mandar el mensaje primaryFire(false)
-		auto m = make_shared<CMessagePrimaryShoot>(false);
+		auto m = createMessage<CMessagePrimaryShoot>(false);
 		_entity->emitMessage(m);
 	} // stopPrimaryFire
 	//__________________________________________________________________
@@ -178,13 +188,13 @@ namespace Logic {
 	void IWeaponAmmo::stopSecondaryFire() {
 		_secondaryFireIsActive = false;
 		// Mandar el mensaje secondaryFire(false)
-		auto m = make_shared<CMessageSecondaryShoot>(false);
+		auto m = createMessage<CMessageSecondaryShoot>(false);
 		_entity->emitMessage(m);
 	} // stopSecondaryFire
 	//__________________________________________________________________
 
 	void IWeaponAmmo::onAvailable() {
-		shared_ptr<CMessageHudWeapon> message = make_shared<CMessageHudWeapon>();
+		shared_ptr<CMessageHudWeapon> message = createMessage<CMessageHudWeapon>();
 		message->setWeapon(_weaponID);
 		message->setAmmo(_currentAmmo);
 		_entity->emitMessage(message);
@@ -205,7 +215,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void IWeaponAmmo::emitSound(const string &soundName, bool loopSound, bool play3d, bool streamSound, bool stopSound){
-		shared_ptr<CMessageAudio> audioMsg = make_shared<CMessageAudio>();
+		shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		
 		audioMsg->setAudioName(soundName);
 		audioMsg->isLoopable(loopSound);
@@ -222,7 +232,7 @@ namespace Logic {
 		if(_currentAmmo > _maxAmmo)
 			_currentAmmo = _maxAmmo;
 		if(iAmCatch) {
-			std::shared_ptr<CMessageHudAmmo> message = std::make_shared<CMessageHudAmmo>();
+			std::shared_ptr<CMessageHudAmmo> message = createMessage<CMessageHudAmmo>();
 			message->setWeapon(_weaponID);
 			message->setAmmo(_currentAmmo);
 			_entity->emitMessage(message);
@@ -235,7 +245,7 @@ namespace Logic {
 
 		// Notificamos al hud para que cambie la cantidad de municion
 		// que tenemos
-		shared_ptr<CMessageHudAmmo> message = make_shared<CMessageHudAmmo>();
+		shared_ptr<CMessageHudAmmo> message = createMessage<CMessageHudAmmo>();
 		message->setAmmo(_currentAmmo);
 
 		// Cambio sobre uno, hay q cambiarlo ;-)
@@ -257,7 +267,7 @@ namespace Logic {
 		/// If you scale your mesh at all, pass it in here.
 
 		CGraphics* cGraph;
-		cGraph = pEntity->getComponent<CGraphics>("CGraphics");
+		cGraph = pEntity->getComponent<CGraphics>();
 		if (cGraph) {
 			worldMesh.initialize( cGraph->getOgreMesh()->getMesh(), Vector3(1,1,1));
  
@@ -92,7 +92,7 @@ namespace Logic {
 			_particlePosition = Vector3(0, 0, 0);
 
 
-		_hudWeapon = _entity->getComponent<CHudWeapons>("CHudWeapons");
+		_hudWeapon = _entity->getComponent<CHudWeapons>();
 		assert(_hudWeapon != NULL && "Error: El cliente necesita tener un componente de grafico del arma");
 
 		assert( entityInfo->hasAttribute("heightShoot") );
@@ -103,6 +103,16 @@ namespace Logic {
 
 	//__________________________________________________________________
 
+	TMessageTypeSet IWeaponFeedback::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::BLOCK_SHOOT);
+		types.set(Message::PRIMARY_SHOOT);
+		types.set(Message::SECONDARY_SHOOT);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//__________________________________________________________________
+
 	bool IWeaponFeedback::accept(const shared_ptr<CMessage>& message) {
 		TMessageType msgType = message->getMessageType();
 
@@ -171,7 +181,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void IWeaponFeedback::emitSound(const string &soundName, bool loopSound, bool play3d, bool streamSound, bool stopSound){
-		shared_ptr<CMessageAudio> audioMsg = make_shared<CMessageAudio>();
+		shared_ptr<CMessageAudio> audioMsg = createMessage<CMessageAudio>();
 		
 		audioMsg->setAudioName(soundName);
 		audioMsg->isLoopable(loopSound);
@@ -190,7 +200,7 @@ namespace Logic {
 		/// If you scale your mesh at all, pass it in here.
 
 		CGraphics* cGraph;
-		cGraph = pEntity->getComponent<CGraphics>("CGraphics");
+		cGraph = pEntity->getComponent<CGraphics>();
 		if (cGraph) {
 			worldMesh.initialize( cGraph->getOgreMesh()->getMesh(), Vector3(1,1,1));
  
@@ -218,7 +228,7 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void IWeaponFeedback::emitParticle(bool primaryShoot){
-		std::shared_ptr<CMessageCreateParticle> particleMsg = std::make_shared<CMessageCreateParticle>();
+		std::shared_ptr<CMessageCreateParticle> particleMsg = createMessage<CMessageCreateParticle>();
 		particleMsg->setParticle( primaryShoot?_primaryFireParticle:_secondaryFireParticle );
 
 		Vector3 particlePosition = _entity->getPosition();
@@ -245,7 +255,7 @@ namespace Logic {
 	void IWeaponFeedback::emitParticle2(bool primaryShoot){
 		printf("\n a emitir");
 		if(_currentParticle){
-			std::shared_ptr<CMessageActivate> activateMsg = std::make_shared<CMessageActivate>();
+			std::shared_ptr<CMessageActivate> activateMsg = createMessage<CMessageActivate>();
 			activateMsg->setActivated(true);
 			_currentParticle->emitMessage(activateMsg);	
 		}else{
@@ -254,7 +264,7 @@ namespace Logic {
 			Logic::CServer::getSingletonPtr()->getMap());
 
 			Graphics::CEntity* graphicWeapon = _hudWeapon->getCurrentWeapon();
-			CDynamicParticleSystem * particleComp = _currentParticle->getComponent<CDynamicParticleSystem>("CDynamicParticleSystem");
+			CDynamicParticleSystem * particleComp = _currentParticle->getComponent<CDynamicParticleSystem>();
 		
 			particleComp->setGraphicParent(graphicWeapon);
 			particleComp->setOffset(_particlePosition);
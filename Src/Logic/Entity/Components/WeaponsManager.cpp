@@ -66,11 +66,11 @@ namespace Logic
 		_weaponry.resize(WeaponType::eSIZE);
 
 		// Rellenamos el vector con los punteros a los componentes correspondientes
-		_weaponry[WeaponType::eSOUL_REAPER].second = _entity->getComponent<Logic::CSoulReaperAmmo>("CSoulReaperAmmo");
-		_weaponry[WeaponType::eSNIPER].second = _entity->getComponent<Logic::CSniperAmmo>("CSniperAmmo");
-		_weaponry[WeaponType::eSHOTGUN].second = _entity->getComponent<Logic::CShotGunAmmo>("CShotGunAmmo");
-		_weaponry[WeaponType::eMINIGUN].second = _entity->getComponent<Logic::CMiniGunAmmo>("CMiniGunAmmo");
-		_weaponry[WeaponType::eIRON_HELL_GOAT].second = _entity->getComponent<Logic::CIronHellGoatAmmo>("CIronHellGoatAmmo");
+		_weaponry[WeaponType::eSOUL_REAPER].second = _entity->getComponent<Logic::CSoulReaperAmmo>();
+		_weaponry[WeaponType::eSNIPER].second = _entity->getComponent<Logic::CSniperAmmo>();
+		_weaponry[WeaponType::eSHOTGUN].second = _entity->getComponent<Logic::CShotGunAmmo>();
+		_weaponry[WeaponType::eMINIGUN].second = _entity->getComponent<Logic::CMiniGunAmmo>();
+		_weaponry[WeaponType::eIRON_HELL_GOAT].second = _entity->getComponent<Logic::CIronHellGoatAmmo>();
 
 		/*
 		// Por defecto la primera arma est activada y equipada (es el arma 0).
@@ -125,6 +125,18 @@ namespace Logic
 	}// onDeactivate
 	//---------------------------------------------------------
 
+	TMessageTypeSet CWeaponsManager::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ADD_AMMO);
+		types.set(Message::ADD_WEAPON);
+		types.set(Message::CHANGE_WEAPON);
+		types.set(Message::DAMAGE_AMPLIFIER);
+		types.set(Message::REDUCED_COOLDOWN);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CWeaponsManager::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -193,7 +205,7 @@ namespace Logic
 			if(_cooldownTimer <= 0) {
 				_cooldownTimer = 0;
 				//reduceCooldowns(0);
-				std::shared_ptr<CMessageDamageAmplifier> amplifyMessage = std::make_shared<CMessageDamageAmplifier>();
+				std::shared_ptr<CMessageDamageAmplifier> amplifyMessage = createMessage<CMessageDamageAmplifier>();
 				amplifyMessage->setDuration(0);
 				amplifyMessage->setPercentDamage(0);
 				_entity->emitMessage(amplifyMessage);
@@ -208,7 +220,7 @@ namespace Logic
 			if(_dmgAmpTimer <= 0) {
 				_dmgAmpTimer = 0;
 				//amplifyDamage(0);
-				std::shared_ptr<CMessageReducedCooldown> coolDownMessage = std::make_shared<CMessageReducedCooldown>();
+				std::shared_ptr<CMessageReducedCooldown> coolDownMessage = createMessage<CMessageReducedCooldown>();
 				coolDownMessage->setDuration(0);
 				coolDownMessage->setPercentCooldown(0);
 				_entity->emitMessage(coolDownMessage);
@@ -256,11 +268,11 @@ namespace Logic
 		}
 
 		if(!percentage){
-			std::shared_ptr<CMessageChangeMaterial> matMsg = std::make_shared<CMessageChangeMaterial>();
+			std::shared_ptr<CMessageChangeMaterial> matMsg = createMessage<CMessageChangeMaterial>();
 			matMsg->setMaterialName("ArchangelBerserk");
 			_entity->emitMessage(matMsg);
 		}else{
-			std::shared_ptr<CMessageChangeMaterial> matMsg = std::make_shared<CMessageChangeMaterial>();
+			std::shared_ptr<CMessageChangeMaterial> matMsg = createMessage<CMessageChangeMaterial>();
 			matMsg->setMaterialName("original");
 			_entity->emitMessage(matMsg);
 		}
@@ -275,11 +287,11 @@ namespace Logic
 		}
 
 		if(!percentage){
-			std::shared_ptr<CMessageChangeMaterial> matMsg = std::make_shared<CMessageChangeMaterial>();
+			std::shared_ptr<CMessageChangeMaterial> matMsg = createMessage<CMessageChangeMaterial>();
 			matMsg->setMaterialName("ArchangelAzul");
 			_entity->emitMessage(matMsg);
 		}else{
-			std::shared_ptr<CMessageChangeMaterial> matMsg = std::make_shared<CMessageChangeMaterial>();
+			std::shared_ptr<CMessageChangeMaterial> matMsg = createMessage<CMessageChangeMaterial>();
 			matMsg->setMaterialName("original");
 			_entity->emitMessage(matMsg);
 		}
@@ -311,7 +323,7 @@ namespace Logic
 
 		/*
 		// Enviamos un mensaje de actualizacion del hud
-		std::shared_ptr<CMessageHudAmmo> *m=std::make_shared<CMessageHudAmmo>();
+		std::shared_ptr<CMessageHudAmmo> *m=createMessage<CMessageHudAmmo>();
 		m->setWeapon(weaponIndex);
 		m->setAmmo(ammo);//No es necesario esto, ya que solo actualizare el hud como que puedo coger el arma pero no mostrara sus balas(en este caso concreto)
 		_entity->emitMessage(m);
@@ -65,11 +65,11 @@ namespace Logic
 		_weaponry.resize(WeaponType::eSIZE);
 
 		// Rellenamos el vector con los punteros a los componentes correspondientes
-		_weaponry[WeaponType::eSOUL_REAPER].second = _entity->getComponent<Logic::CSoulReaperAmmo>("CSoulReaperAmmo");
-		_weaponry[WeaponType::eSNIPER].second = _entity->getComponent<Logic::CSniperAmmo>("CSniperAmmo");
-		_weaponry[WeaponType::eSHOTGUN].second = _entity->getComponent<Logic::CShotGunAmmo>("CShotGunAmmo");
-		_weaponry[WeaponType::eMINIGUN].second = _entity->getComponent<Logic::CMiniGunAmmo>("CMiniGunAmmo");
-		_weaponry[WeaponType::eIRON_HELL_GOAT].second = _entity->getComponent<Logic::CIronHellGoatAmmo>("CIronHellGoatAmmo");
+		_weaponry[WeaponType::eSOUL_REAPER].second = _entity->getComponent<Logic::CSoulReaperAmmo>();
+		_weaponry[WeaponType::eSNIPER].second = _entity->getComponent<Logic::CSniperAmmo>();
+		_weaponry[WeaponType::eSHOTGUN].second = _entity->getComponent<Logic::CShotGunAmmo>();
+		_weaponry[WeaponType::eMINIGUN].second = _entity->getComponent<Logic::CMiniGunAmmo>();
+		_weaponry[WeaponType::eIRON_HELL_GOAT].second = _entity->getComponent<Logic::CIronHellGoatAmmo>();
 
 
 		_currentScene = _entity->getMap()->getScene();
@@ -117,6 +117,18 @@ namespace Logic
 	}// onDeactivate
 	//---------------------------------------------------------
 
+	TMessageTypeSet CWeaponsManagerClient::getAcceptedMessageTypes() {
+		TMessageTypeSet types;
+		types.set(Message::ADD_AMMO);
+		types.set(Message::ADD_WEAPON);
+		types.set(Message::CHANGE_WEAPON);
+		types.set(Message::DAMAGE_AMPLIFIER);
+		types.set(Message::REDUCED_COOLDOWN);
+		return types;
+	} // getAcceptedMessageTypes
+
+	//---------------------------------------------------------
+
 	bool CWeaponsManagerClient::accept(const std::shared_ptr<CMessage>& message) {
 		Logic::TMessageType msgType = message->getMessageType();
 
@@ -197,7 +209,7 @@ namespace Logic
 			_currentWeapon = newWeapon;
 			
 			// Mandamos un mensaje para actualizar el HUD
-			std::shared_ptr<CMessageChangeWeaponGraphics> chgWpnGraphicsMsg = std::make_shared<CMessageChangeWeaponGraphics>();
+			std::shared_ptr<CMessageChangeWeaponGraphics> chgWpnGraphicsMsg = createMessage<CMessageChangeWeaponGraphics>();
 			chgWpnGraphicsMsg->setWeapon(_currentWeapon);
 			_entity->emitMessage(chgWpnGraphicsMsg);
 		}
@@ -262,7 +274,7 @@ namespace Logic
 
 		/*
 		// Enviamos un mensaje de actualizacion del hud
-		std::shared_ptr<CMessageHudAmmo> *m=std::make_shared<CMessageHudAmmo>();
+		std::shared_ptr<CMessageHudAmmo> *m=createMessage<CMessageHudAmmo>();
 		m->setWeapon(weaponIndex);
 		m->setAmmo(ammo);//No es necesario esto, ya que solo actualizare el hud como que puedo coger el arma pero no mostrara sus balas(en este caso concreto)
 		_entity->emitMessage(m);
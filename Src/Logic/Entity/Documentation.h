@@ -297,11 +297,15 @@ REG_FACTORY(CMyComponent);
 El funcionamiento interno del motor ayudar a entender los siguientes
 apartados. En algn momento una entidad externa puede enviar un
 mensaje a la entidad a la que pertenecemos. La entidad al recibirlos
-lo que hace es preguntar uno a uno a todos sus componentes para averiguar
-cules de ellos estn interesados en el mensaje, o lo que es lo mismo,
-para qu componentes el mensaje resulta til. Si un componente <em>acepta</em>
-un mensaje, ste se <em>encola</em> en la lista de mensajes a procesar
-del componente.
+lo que hace es preguntar a sus componentes para averiguar cules de ellos
+estn interesados en el mensaje, o lo que es lo mismo, para qu componentes
+el mensaje resulta til. Si un componente <em>acepta</em> un mensaje, ste
+se <em>encola</em> en la lista de mensajes a procesar del componente.
+
+Para no preguntar a todos, cada clase de componente declara en el mtodo
+esttico getAcceptedMessageTypes() los tipos de mensaje que su accept()
+puede llegar a aceptar. La factora los guarda al registrar la clase y la
+entidad slo pregunta a los componentes suscritos al tipo del mensaje.
 
 Posteriormente, en la fase de simulacin de la lgica, se conceder
 tiempo de CPU al componente para que procese todos los mensajes encolados.
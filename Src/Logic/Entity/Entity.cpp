@@ -23,6 +23,7 @@ de juego. Es una colecci
 #include "Component.h"
 #include "Logic/Server.h"
 #include "Logic/Maps/Map.h"
+#include "Logic/Maps/ComponentFactory.h"
 
 #include "Logic/Entity/Components/Graphics.h"
 #include "Logic/Entity/Components/ArrayGraphics.h"
@@ -35,6 +36,8 @@ de juego. Es una colecci
 
 #include "../../Audio/Server.h"
 
+#include <algorithm>
+
 namespace Logic {
 
 	CEntity::CEntity(TEntityID entityID) : _entityID(entityID), 
@@ -43,8 +46,14 @@ namespace Logic {
 										   _name(""), 
 										   _position(0,0,0),
 										   _orientation(Ogre::Quaternion::IDENTITY),
+										   _transforms(NULL),
+										   _transformIndex(CTransformStore::INVALID_INDEX),
+										   _spatialIndex(NULL),
+										   _spatialCell(0),
+										   _spatialSlot(0),
 										   _isPlayer(false), 
-										   _activated(false) {
+										   _activated(false),
+										   _routesDirty(true) {
  
 
 	} // CEntity
@@ -119,7 +128,7 @@ namespace Logic {
 		bool correct = true;
 
 		for(int i = 1; it != _components.end() && correct; ++it, ++i ){
-			correct = it->second.componentPtr->spawn(this,map,entityInfo) && correct;
+			correct = (*it)->spawn(this,map,entityInfo) && correct;
 			if(!correct)
 				std::cout << "ERROR: La entidad " << entityInfo->getName() << " no ha podido ser ensamblada porque el componente " << i << " se ha muerto en el spawn" << std::endl;
 		}
@@ -150,13 +159,13 @@ namespace Logic {
 		_activated = true;
 
 		for(; it != _components.end(); ++it) {
-			if(it->second.componentPtr->isActivated())
+			if((*it)->isActivated())
 				continue;
-			it->second.componentPtr->activate();
-			_activated = it->second.componentPtr->isActivated() && _activated;
+			(*it)->activate();
+			_activated = (*it)->isActivated() && _activated;
 
 			if(!_activated)
-				std::cout << "algun componente no se ha activado " << it->first << std::endl;
+				std::cout << "algun componente no se ha activado " << (*it)->getType() << std::endl;
 
 		}
 
@@ -178,7 +187,7 @@ namespace Logic {
 
 		// Desactivamos los componentes
 		for(auto it = _components.begin(); it != _components.end(); ++it)
-			it->second.componentPtr->deactivate();
+			(*it)->deactivate();
 
 		_activated = false;
 
@@ -187,8 +196,8 @@ namespace Logic {
 
 	void CEntity::deactivateAllComponentsExcept(const std::set<std::string>& exceptionList) {
 		for(auto it = _components.begin(); it != _components.end(); ++it) {
-			if( !exceptionList.count(it->first) ) {
-				it->second.componentPtr->deactivate();
+			if( !exceptionList.count((*it)->getType()) ) {
+				(*it)->deactivate();
 			}
 		}
 	}// deactivateAllComponentsExcept
@@ -196,11 +205,11 @@ namespace Logic {
 	//---------------------------------------------------------
 
 	void CEntity::deactivateComponents(const std::vector<std::string>& componentList) {
-		TComponentMap::iterator it;
+		CComponentFactory* componentFactory = CComponentFactory::getSingletonPtr();
 		for(unsigned int i = 0; i < componentList.size(); ++i) {
-			it = _components.find(componentList[i]);
-			if( it != _components.end() ) {
-				it->second.componentPtr->deactivate();
+			TComponentID id = componentFactory->getComponentID(componentList[i]);
+			if( id < _componentsByID.size() && _componentsByID[id] != NULL ) {
+				_componentsByID[id]->deactivate();
 			}
 		}
 	}
@@ -209,41 +218,35 @@ namespace Logic {
 
 	void CEntity::start() {
 		for(auto it = _components.begin(); it != _components.end(); ++it) {
-			if( it->second.componentPtr->isActivated() ) {
-				it->second.componentPtr->start();
+			if( (*it)->isActivated() ) {
+				(*it)->start();
 			}
 		}
 	}
 
 	//---------------------------------------------------------
 
-	// @deprecated
-	// Ahora mismo puedo hacer esta llamada y en cualquier momento
-	// por que la lista de la stl me permite introducir el componente 
-	// al final sin problemas incluso cuando se esta ejecutando un bucle for.
-	// Cuando cambiemos a listas de prioridades esto puede ser un problema.
+	// Esta llamada puede hacerse en cualquier momento, incluso durante el
+	// tick: los arrays de ticks se recorren por indice hasta su tamao
+	// actual, asi que el componente se aade al final y se ejecuta en la
+	// misma vuelta aunque el vector se realoje.
 	void CEntity::wakeUp(IComponent* component) {
+		// Los componentes con tick por lotes se apuntan en el mapa
+		if(component->_batchedTick) {
+			if(component->_wantsTick) _map->wantsBatchedTick(component);
+			if(component->_wantsFixedTick) _map->wantsBatchedFixedTick(component);
+			return;
+		}
+
 		if(component->_wantsTick) {
 			_componentsWithTick.push_back(component);
 
-			// Anotamos el iterador que se le asigna
-			auto it = _components.find( component->getType() );
-			if(it != _components.end()) {
-				it->second.tickIterator = _componentsWithTick.rbegin();
-			}
-
 			// Reclamar ticks para la entidad si es necesario
 			if( _componentsWithTick.size() == 1 ) _map->wantsTick(this);
 		}
 		if(component->_wantsFixedTick) {
 			_componentsWithFixedTick.push_back(component);
 
-			// Anotamos el iterador que se le asigna
-			auto it = _components.find( component->getType() );
-			if(it != _components.end()) {
-				it->second.fixedTickIterator = _componentsWithFixedTick.rbegin();
-			}
-
 			// Reclamar fixed ticks para la entidad si es necesario
 			if( _componentsWithFixedTick.size() == 1 ) _map->wantsFixedTick(this);
 		}
@@ -254,7 +257,7 @@ namespace Logic {
 	void CEntity::processComponentMessages() {
 		IComponent* component;
 		for(auto it = _components.begin(); it != _components.end(); ++it) {
-			component = it->second.componentPtr;
+			component = *it;
 
 			// No hace falta comprobar si estamos activados o no u ociosos
 			// para procesar mensajes, ya que eso se tiene en cuenta en el
@@ -268,111 +271,163 @@ namespace Logic {
 	//---------------------------------------------------------
 
 	bool CEntity::tick(unsigned int msecs) {
+		// Compactamos el array sobre la marcha: los componentes que dejan
+		// de querer tick (o se han quitado) no se copian a la parte buena
 		IComponent* component;
-		std::list<IComponent*>::const_iterator it = _componentsWithTick.begin();
-		while(it != _componentsWithTick.end()) {
-			component = *it;
+		unsigned int last = 0;
+		for(unsigned int i = 0; i < _componentsWithTick.size(); ++i) {
+			component = _componentsWithTick[i];
+			if(component == NULL)
+				continue;
 
-			if( component->isActivated() ) {
-				if( !component->tick(msecs) ) {
-					auto tempIt = _components.find( component->getType() );
-					if(tempIt != _components.end()) tempIt->second.tickIterator = _componentsWithTick.rend();
-					it = _componentsWithTick.erase(it);
-					continue;
-				}
-			}
-			
-			++it;
+			if( component->isActivated() && !component->tick(msecs) )
+				continue;
+
+			_componentsWithTick[last++] = component;
 		}
+		_componentsWithTick.resize(last);
 
-		return !_componentsWithTick.empty();
+		return last > 0;
 	} // tick
 
 	//---------------------------------------------------------
 
 	bool CEntity::fixedTick(unsigned int msecs) {
+		// Igual que en el tick compactamos sobre la marcha
 		IComponent* component;
-		std::list<IComponent*>::const_iterator it = _componentsWithFixedTick.begin();
-		while(it != _componentsWithFixedTick.end()) {
-			component = *it;
+		unsigned int last = 0;
+		for(unsigned int i = 0; i < _componentsWithFixedTick.size(); ++i) {
+			component = _componentsWithFixedTick[i];
+			if(component == NULL)
+				continue;
 
-			if( component->isActivated() ) {
-				if( !component->fixedTick(msecs) ) {
-					auto tempIt = _components.find( component->getType() );
-					if(tempIt != _components.end()) tempIt->second.fixedTickIterator = _componentsWithFixedTick.rend();
-					it = _componentsWithFixedTick.erase(it);
-					continue;
-				}
-			}
+			if( component->isActivated() && !component->fixedTick(msecs) )
+				continue;
 
-			++it;
+			_componentsWithFixedTick[last++] = component;
 		}
+		_componentsWithFixedTick.resize(last);
 
-		return !_componentsWithFixedTick.empty();
-	}
+		return last > 0;
+	} // fixedTick
 
 	//---------------------------------------------------------
 
 	void CEntity::addComponent(IComponent* component, const std::string& id) {
 		// Registramos en todas las listas a todos los componentes
-		// ellos solos se desapuntaran en funcion de lo que quieran
-		_componentsWithTick.push_back(component);
-		_componentsWithFixedTick.push_back(component);
+		// ellos solos se desapuntaran en funcion de lo que quieran.
+		// Los que tienen tick por lotes los apunta el mapa en addEntity
+		if(!component->_batchedTick) {
+			_componentsWithTick.push_back(component);
+			_componentsWithFixedTick.push_back(component);
+		}
 
-		// Anotamos los iteradores para realizar borrados rapidos
-		ComponentInfo info;
-		info.componentPtr = component;
-		info.tickIterator = _componentsWithTick.rbegin();
-		info.fixedTickIterator = _componentsWithFixedTick.rbegin();
+		TComponentID typeID = CComponentFactory::getSingletonPtr()->getComponentID(id);
+		assert(typeID != UNASSIGNED_COMPONENT_ID && "El componente no esta registrado en la factoria");
 
-		_components[id] = info;
+		if( typeID >= _componentsByID.size() )
+			_componentsByID.resize(typeID + 1, NULL);
 
-		component->setType(id);
+		_componentsByID[typeID] = component;
+		_components.push_back(component);
+		_routesDirty = true;
+
+		component->setType(id, typeID);
 		component->setEntity(this);
 	} // addComponent
 
 	//---------------------------------------------------------
 
 	bool CEntity::removeComponent(IComponent* component) {
-		ComponentInfo info;
-		bool success = false;
-		for(auto it = _components.begin(); it != _components.end() && !success; ++it) {
-			info = it->second;
-			if(info.componentPtr == component) {
-				if( info.tickIterator != _componentsWithTick.rend() )
-					_componentsWithTick.erase( (++info.tickIterator).base() );
-				if( info.fixedTickIterator != _componentsWithFixedTick.rend() )
-					_componentsWithFixedTick.erase( (++info.fixedTickIterator).base() );
-				
-				_components.erase(it);
-				
-				success = true;
-			}
-		}
+		auto it = std::find(_components.begin(), _components.end(), component);
+		if( it == _components.end() )
+			return false;
+
+		_components.erase(it);
+		_routesDirty = true;
+
+		TComponentID typeID = component->getTypeID();
+		if( typeID < _componentsByID.size() && _componentsByID[typeID] == component )
+			_componentsByID[typeID] = NULL;
+
+		// En los arrays de ticks solo lo anulamos; se quitara al compactar
+		// en el siguiente tick (puede que estemos dentro de uno)
+		std::replace(_componentsWithTick.begin(), _componentsWithTick.end(), component, (IComponent*)NULL);
+		std::replace(_componentsWithFixedTick.begin(), _componentsWithFixedTick.end(), component, (IComponent*)NULL);
+
+		if(component->_batchedTick && _map != NULL)
+			_map->removeBatchedComponent(component);
 
-		return success;
+		return true;
 	} // removeComponent
 
 	//---------------------------------------------------------
 
 	void CEntity::destroyAllComponents() {
 		for(auto it = _components.begin(); it != _components.end(); ++it) {
-			delete it->second.componentPtr;
+			delete *it;
 		}
 
 		_components.clear();
+		_componentsByID.clear();
+		_routes.clear();
+		_routeOffsets.clear();
+		_routesDirty = true;
 		_componentsWithTick.clear();
 		_componentsWithFixedTick.clear();
 	} // destroyAllComponents
 
 	//---------------------------------------------------------
 
+	bool CEntity::recycle() {
+		assert(!_map && "Antes de reciclar la entidad debe desacoplarse del mapa!!");
+
+		for(auto it = _components.begin(); it != _components.end(); ++it) {
+			(*it)->deactivate();
+			if( !(*it)->recycle() )
+				return false;
+		}
+
+		_type = "";
+		_name = "";
+		_position = Vector3::ZERO;
+		_orientation = Ogre::Quaternion::IDENTITY;
+		_transforms = NULL;
+		_transformIndex = CTransformStore::INVALID_INDEX;
+		_spatialIndex = NULL;
+		_spatialCell = 0;
+		_spatialSlot = 0;
+		_isPlayer = false;
+		_activated = false;
+
+		// Volvemos a apuntar a todos los componentes como en addComponent
+		_componentsWithTick.clear();
+		_componentsWithFixedTick.clear();
+		for(auto it = _components.begin(); it != _components.end(); ++it) {
+			if( !(*it)->_batchedTick ) {
+				_componentsWithTick.push_back(*it);
+				_componentsWithFixedTick.push_back(*it);
+			}
+		}
+
+		return true;
+	} // recycle
+
+	//---------------------------------------------------------
+
 	bool CEntity::emitMessage(const std::shared_ptr<CMessage>& message, IComponent* emitter) {
+		if(_routesDirty)
+			buildRoutes();
+
+		TMessageType type = message->getMessageType();
+		assert(type < Message::NB_MESSAGE_TYPES && "Tipo de mensaje no valido");
+
+		// Solo se ofrece el mensaje a los componentes que aceptan su tipo.
 		// Para saber si alguien quiso el mensaje.
 		IComponent* component;
 		bool anyReceiver = false;
-		for(auto it = _components.begin(); it != _components.end(); ++it) {
-			component = it->second.componentPtr;
+		for(unsigned int i = _routeOffsets[type]; i < _routeOffsets[type + 1]; ++i) {
+			component = _routes[i];
 			// Si el componente es el propio emisor no se le envia el mensaje
 			// Ademas solo recibe mensajes si esta activado y no esta ocioso
 			if( emitter != component && component->isActivated() && !component->isBusy() )
@@ -384,58 +439,98 @@ namespace Logic {
 
 	//---------------------------------------------------------
 
+	void CEntity::buildRoutes() {
+		CComponentFactory* componentFactory = CComponentFactory::getSingletonPtr();
+
+		// Contamos los suscriptores de cada tipo y acumulamos para sacar
+		// donde empieza cada tipo
+		_routeOffsets.assign(Message::NB_MESSAGE_TYPES + 1, 0);
+		for(unsigned int i = 0; i < _components.size(); ++i) {
+			const TMessageTypeSet& types = componentFactory->getAcceptedMessageTypes( _components[i]->getTypeID() );
+			for(unsigned int type = 0; type < Message::NB_MESSAGE_TYPES; ++type) {
+				if( types.test(type) )
+					++_routeOffsets[type + 1];
+			}
+		}
+
+		for(unsigned int type = 0; type < Message::NB_MESSAGE_TYPES; ++type)
+			_routeOffsets[type + 1] += _routeOffsets[type];
+
+		// Colocamos cada componente en los huecos de sus tipos
+		_routes.resize( _routeOffsets[Message::NB_MESSAGE_TYPES] );
+		std::vector<unsigned short> next(_routeOffsets.begin(), _routeOffsets.end() - 1);
+		for(unsigned int i = 0; i < _components.size(); ++i) {
+			const TMessageTypeSet& types = componentFactory->getAcceptedMessageTypes( _components[i]->getTypeID() );
+			for(unsigned int type = 0; type < Message::NB_MESSAGE_TYPES; ++type) {
+				if( types.test(type) )
+					_routes[ next[type]++ ] = _components[i];
+			}
+		}
+
+		_routesDirty = false;
+	} // buildRoutes
+
+	//---------------------------------------------------------
+
 	void CEntity::setPosition(const Vector3 &position) {
-		_position = position;
+		positionRef() = position;
+
+		if(_spatialIndex)
+			_spatialIndex->move(this, position);
 	} // setPosition
 
 	//---------------------------------------------------------
 
 	void CEntity::setOrientation(const Quaternion& orientation) {
-		_orientation = orientation;
+		orientationRef() = orientation;
 	} // setOrientation
 
 	//---------------------------------------------------------
 
 	Ogre::Quaternion CEntity::getOrientation() const {
-		return _orientation;
+		return _transforms ? _transforms->getOrientation(_transformIndex) : _orientation;
 	} // getOrientation
 	//---------------------------------------------------------
 
 	void CEntity::setYaw(const Quaternion &yaw){
-		_orientation = yaw * Math::getPitchQuaternion(_orientation) * Math::getRollQuaternion(_orientation);
+		Quaternion& orientation = orientationRef();
+		orientation = yaw * Math::getPitchQuaternion(orientation) * Math::getRollQuaternion(orientation);
 	}
 	// setYaw
 	//---------------------------------------------------------
 
 	void CEntity::setPitch(const Quaternion &pitch) {
-		_orientation = Math::getYawQuaternion(_orientation) * pitch * Math::getRollQuaternion(_orientation);
+		Quaternion& orientation = orientationRef();
+		orientation = Math::getYawQuaternion(orientation) * pitch * Math::getRollQuaternion(orientation);
 	} // setPitch
 	//---------------------------------------------------------
 
 	void CEntity::setRoll(const Quaternion &roll) {
-		_orientation = Math::getYawQuaternion(_orientation) * Math::getPitchQuaternion(_orientation) * roll;
+		Quaternion& orientation = orientationRef();
+		orientation = Math::getYawQuaternion(orientation) * Math::getPitchQuaternion(orientation) * roll;
 	} // setRoll
 	//---------------------------------------------------------
 
 	Quaternion CEntity::getYaw(){
-		return Math::getYawQuaternion(_orientation);
+		return Math::getYawQuaternion( orientationRef() );
 	} // getYaw
 	//---------------------------------------------------------
 
 	Quaternion CEntity::getPitch(){
-		return Math::getPitchQuaternion(_orientation);
+		return Math::getPitchQuaternion( orientationRef() );
 	} // getPitch
 	//---------------------------------------------------------
 
 	Quaternion CEntity::getRoll(){
-		return Math::getRollQuaternion(_orientation);
+		return Math::getRollQuaternion( orientationRef() );
 	} // getRoll
 	//---------------------------------------------------------
 
 	void CEntity::rotate(int orientation, Ogre::Radian rotation){
-		Quaternion yawOrientation = Math::getYawQuaternion(_orientation);
-		Quaternion pitchOrientation = Math::getPitchQuaternion(_orientation);
-		Quaternion rollOrientation = Math::getRollQuaternion(_orientation);
+		Quaternion& currentOrientation = orientationRef();
+		Quaternion yawOrientation = Math::getYawQuaternion(currentOrientation);
+		Quaternion pitchOrientation = Math::getPitchQuaternion(currentOrientation);
+		Quaternion rollOrientation = Math::getRollQuaternion(currentOrientation);
 		switch(orientation){
 			case Orientation::eYAW:{
 				Math::rotate(Vector3::UNIT_Y,rotation,yawOrientation);
@@ -451,7 +546,7 @@ namespace Logic {
 			}
 		}
 		//Actualizamos la orientacion final
-		_orientation = yawOrientation * pitchOrientation * rollOrientation;
+		currentOrientation = yawOrientation * pitchOrientation * rollOrientation;
 	}
 
 } // namespace Logic
@@ -22,10 +22,10 @@ de juego. Es una colecci
 #include "Logic/Maps/EntityID.h"
 #include "Logic/Messages/Message.h"
 #include "Logic/Maps/ComponentID.h"
+#include "Logic/Maps/TransformStore.h"
 
-#include <list>
 #include <string>
-#include <map>
+#include <vector>
 #include <set>
 #include <memory>
 
@@ -38,6 +38,7 @@ namespace Logic {
 	class CMap;
 	class IComponent;
 	class CEntityFactory;
+	class CSpatialIndex;
 }
 
 // Declaracin de la clase
@@ -254,7 +255,7 @@ namespace Logic {
 
 		@return Posicin de la entidad en el entorno.
 		*/
-		Vector3 getPosition() const { return _position; }
+		Vector3 getPosition() const { return _transforms ? _transforms->getPosition(_transformIndex) : _position; }
 
 		//__________________________________________________________________
 
@@ -389,16 +390,16 @@ namespace Logic {
 
 
 		/**
-		Obtiene un puntero al componente que buscamos por id.
+		Obtiene un puntero al componente del tipo dado. La bsqueda es un
+		acceso directo al array de componentes usando el identificador
+		numrico que la factora asigna a cada tipo (T::ID).
 
-		@param id String que identifica al componente. Es el mismo nombre
-		que el asignado en el blueprints.
-		@return Puntero al componente que buscamos.
+		@return Puntero al componente que buscamos o NULL si la entidad no
+		tiene ningn componente de ese tipo.
 		*/
 		template<typename T>
-		T* getComponent(const std::string& id) {
-			std::map<std::string, ComponentInfo>::iterator it = _components.find(id);
-			return it != _components.end() ? static_cast<T*>(it->second.componentPtr) : NULL;
+		T* getComponent() {
+			return T::ID < _componentsByID.size() ? static_cast<T*>(_componentsByID[T::ID]) : NULL;
 		}
 
 		//__________________________________________________________________
@@ -507,6 +508,18 @@ namespace Logic {
 		*/
 		friend class CMap;
 
+		/**
+		Clase amiga que actualiza el ndice de la transformacin cuando la
+		mueve dentro de sus arrays.
+		*/
+		friend class CTransformStore;
+
+		/**
+		Clase amiga que actualiza la celda y el hueco de la entidad cuando la
+		mueve dentro de la rejilla.
+		*/
+		friend class CSpatialIndex;
+
 
 		// =======================================================================
 		//                      CONSTRUCTORES Y DESTRUCTOR
@@ -549,6 +562,39 @@ namespace Logic {
 
 		//__________________________________________________________________
 
+		/**
+		Devuelve la entidad al estado en que la deja la factora al
+		ensamblarla, conservando sus componentes, para que pueda volver a
+		hacer spawn. La entidad debe estar fuera del mapa.
+
+		@return false si algn componente no se puede reciclar. La entidad
+		queda entonces a medio reciclar y hay que destruirla.
+		*/
+		bool recycle();
+
+		//__________________________________________________________________
+
+		/**
+		Reconstruye la tabla de rutas de mensajes a partir de los tipos de
+		mensaje que acepta cada componente de la entidad.
+		*/
+		void buildRoutes();
+
+		//__________________________________________________________________
+
+		/**
+		Devuelve la posicin buena de la entidad: la del almacn de
+		transformaciones del mapa si est en uno, o _position si no.
+		*/
+		Vector3& positionRef() { return _transforms ? _transforms->getPosition(_transformIndex) : _position; }
+
+		//__________________________________________________________________
+
+		/** Igual que positionRef pero para la orientacin. */
+		Quaternion& orientationRef() { return _transforms ? _transforms->getOrientation(_transformIndex) : _orientation; }
+
+		//__________________________________________________________________
+
 		/**
 		Inicializacin del objeto Logic, utilizando la informacin extrada de
 		la entidad leda del mapa (Map::CEntity). Avisar a los componentes
@@ -580,26 +626,43 @@ namespace Logic {
 		// =======================================================================
 
 
-		struct ComponentInfo {
-			IComponent* componentPtr;
-			std::list<IComponent*>::const_reverse_iterator tickIterator;
-			std::list<IComponent*>::const_reverse_iterator fixedTickIterator;
-		};
+		// typedef
+		typedef std::vector<IComponent*> TComponentArray;
 
-		/** Lista de componentes que tienen tick. */
-		std::list<IComponent*> _componentsWithTick;
+		/**
+		Componentes que tienen tick. Los que dejan de querer tick se quitan
+		compactando el array durante el propio tick; los que se quitan con
+		removeComponent se dejan a NULL hasta entonces.
+		*/
+		TComponentArray _componentsWithTick;
 		
-		/** Lista de componentes que tienen fixed tick. */
-		std::list<IComponent*> _componentsWithFixedTick;
+		/** Componentes que tienen fixed tick. Igual que _componentsWithTick. */
+		TComponentArray _componentsWithFixedTick;
 
 		/** Identificador nico de la entidad. */
 		Logic::TEntityID _entityID;
-		
-		// typedef
-		typedef std::map<std::string, ComponentInfo> TComponentMap;
 
-		/** Lista de componentes que posee la entidad. */
-		TComponentMap _components;
+		/** Componentes que posee la entidad en el orden en que se aadieron. */
+		TComponentArray _components;
+
+		/**
+		Componentes indexados por su TComponentID. Las posiciones de los
+		tipos que la entidad no tiene valen NULL.
+		*/
+		TComponentArray _componentsByID;
+
+		/**
+		Tabla de rutas de mensajes: los componentes suscritos a cada tipo de
+		mensaje, agrupados por tipo y en el orden de _components. Los de tipo
+		t estn en [_routeOffsets[t], _routeOffsets[t + 1]).
+		*/
+		TComponentArray _routes;
+
+		/** Inicio de los suscriptores de cada tipo de mensaje en _routes. */
+		std::vector<unsigned short> _routeOffsets;
+
+		/** true si hay que reconstruir la tabla de rutas antes de usarla. */
+		bool _routesDirty;
 
 		/** Indica si la entidad est activada. */
 		bool _activated;
@@ -613,12 +676,34 @@ namespace Logic {
 		/** Mapa lgico donde est la entidad. */
 		Logic::CMap *_map;
 
-		/** Posicion de la entidad. */
+		/**
+		Posicion de la entidad mientras no est en un mapa. Cuando lo est,
+		la posicin buena es la del almacn de transformaciones del mapa.
+		*/
 		Vector3 _position;
 
-		/** Orientacion de la entidad. */
+		/** Orientacion de la entidad. Igual que _position. */
 		Quaternion _orientation;
 
+		/**
+		Almacn de transformaciones del mapa en el que est la entidad, o
+		NULL si no est en ninguno.
+		*/
+		CTransformStore* _transforms;
+
+		/** ndice de la transformacin de la entidad en _transforms. */
+		unsigned int _transformIndex;
+
+		/**
+		ndice espacial del mapa en el que est apuntada la entidad, o NULL
+		si no est en ninguno.
+		*/
+		CSpatialIndex* _spatialIndex;
+
+		/** Celda y hueco de la entidad dentro de _spatialIndex. */
+		long long _spatialCell;
+		unsigned int _spatialSlot;
+
 		/**
 		Atributo que indica si la entidad es el jugador; por defecto
 		es false a no ser que se lea otra cosa de los atributos.
@@ -17,6 +17,8 @@ los punteros a funci
 
 #include <cassert>
 
+static_assert(Logic::Message::NB_MESSAGE_IDS <= 256, "Los identificadores de red de los mensajes deben caber en un byte");
+
 namespace Logic {
 
 	CMessageFactory* CMessageFactory::_instance = 0;
@@ -27,6 +29,9 @@ namespace Logic {
 	{
 		_instance = this;
 
+		for(unsigned int i = 0; i < TABLE_SIZE; ++i)
+			_table[i] = 0;
+
 	} // CMessageFactory
 
 	//--------------------------------------------------------
@@ -34,15 +39,6 @@ namespace Logic {
 	CMessageFactory::~CMessageFactory()
 	{
 		_instance = 0;
-		std::map<int, FunctionPointer>::const_iterator it = _table.begin();
-		std::map<int, FunctionPointer>::const_iterator it2;
-		
-		while( it != _table.end() )
-		{
-			it2 = it;
-			it++;
-			_table.erase(it2);
-		}
 
 	} // ~CMessageFactory
 	
@@ -58,50 +54,30 @@ namespace Logic {
 	} // Init
 
 	
-	void CMessageFactory::add(FunctionPointer function, const std::string& name)
+	void CMessageFactory::add(FunctionPointer function, TMessageID id)
 	{
-		TStringFunctionPointerPair element(Math::CRC(name),function);
-		_table.insert(element);
+		_table[id] = function;
 
 	} // add
 
 	//--------------------------------------------------------
 
-	bool CMessageFactory::has(const std::string& name) const
+	bool CMessageFactory::has(TMessageID id) const
 	{
-		return _table.count(Math::CRC(name)) > 0;
+		return _table[id] != 0;
 
 	} // has
 
 	//--------------------------------------------------------
 
-	CMessage * CMessageFactory::create(const std::string& name) const
+	CMessage * CMessageFactory::create(TMessageID id) const
 	{
-		int n = Math::CRC(name);
-		if(has(name))
-		{
-			TFunctionPointerMap::const_iterator it;
-			it = _table.find(n);
-			if( it != _table.end() )
-				return _table.find(n)->second();
-		}
-		throw new std::exception("No existe la funcin de creacin que se solicit.");
-
-	} // create (string)
+		if(_table[id] != 0)
+			return _table[id]();
 
-	CMessage * CMessageFactory::create(int name) const
-	{
-
-		
-		if(_table.count(name) > 0)
-		{
-			TFunctionPointerMap::const_iterator it;
-			it = _table.find(name);
-			if( it != _table.end() )
-				return _table.find(name)->second();
-		}
 		throw new std::exception("No existe la funcin de creacin que se solicit.");
-	}//create (int)
+
+	} // create
 
 
 } // namespace Logic
@@ -15,12 +15,19 @@ los punteros a funci
 #define __Logic_MessageFactory_H
 
 #include <string>
-#include <map>
 
 // Predeclaracin de clases para ahorrar tiempo de compilacin
 namespace Logic 
 {
 	class CMessage;
+
+	/**
+	Identificador de red de un mensaje. Ocupa un nico byte en el buffer.
+
+	@see Logic::Message::TMessageType
+	@see Logic::Message::TExtraMessageID
+	*/
+	typedef unsigned char TMessageID;
 }
 
 // Declaracin de la clase
@@ -34,6 +41,10 @@ namespace Logic
 	Es usada para almacenar componentes 
 	en Logic::CEntityFactory donde todo el registro de componentes se realiza 
 	utilizando macros del preprocesador declarados en Logic::CComponent.
+	<p>
+	Las funciones de creacin se guardan en una tabla plana indexada por el
+	identificador de red del mensaje, de manera que crear un mensaje recibido
+	por la red cuesta un nico acceso a la tabla.
 
 	@ingroup logicGroup
 	@ingroup mapGroup
@@ -69,38 +80,27 @@ namespace Logic
 		Aade una nueva funcin a la tabla de la factora.
 
 		@param funcion Funcin de creacin del objeto.
-		@param name Nombre con el que nos referiremos a la funcin para
-		la futura creacin del objeto.
+		@param id Identificador de red del mensaje que crea la funcin.
 		*/
-		void add(FunctionPointer function, const std::string& name);
+		void add(FunctionPointer function, TMessageID id);
 
 		/**
 		Si una funcin ya est contenida en la tabla.
 
-		@param name Nombre de la clase del objeto que se quiere saber si 
+		@param id Identificador de red del mensaje que se quiere saber si 
 		se puede crear.
 		@return true si se encuentra en la tabla.
 		*/
-		bool has(const std::string& name) const;
-
-		/**
-		Crea una nueva instancia de la clase requerida.
-
-		@param name Nombre de la clase del objeto que se quiere crear.
-		@return Nueva instancia de la clase. 0 si no est en la tabla.
-		*/
-		
-		CMessage * create(const std::string& name) const;
-
+		bool has(TMessageID id) const;
 
 		/**
-		Crea una nueva instancia de la clase requerida.
+		Crea una nueva instancia del mensaje requerido.
 
-		@param name Nombre de la clase del objeto que se quiere crear.
-		@return Nueva instancia de la clase. 0 si no est en la tabla.
+		@param id Identificador de red del mensaje que se quiere crear.
+		@return Nueva instancia del mensaje. Lanza una excepcin si no est
+		en la tabla.
 		*/
-		
-		CMessage * create(int name) const;
+		CMessage * create(TMessageID id) const;
 
 	protected:
 		/**
@@ -108,10 +108,11 @@ namespace Logic
 		*/
 		CMessageFactory ();
 
-		typedef std::pair <int,FunctionPointer> TStringFunctionPointerPair;
-		typedef std::map<int,FunctionPointer> TFunctionPointerMap;
+		/** Nmero de entradas de la tabla (todos los valores de TMessageID). */
+		static const unsigned int TABLE_SIZE = 256;
 
-		TFunctionPointerMap _table;
+		/** Funciones de creacin indexadas por identificador de red. */
+		FunctionPointer _table[TABLE_SIZE];
 
 	private:
 		/**
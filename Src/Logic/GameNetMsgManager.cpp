@@ -33,6 +33,10 @@ Contiene la implementaci
 
 #include "Logic/GameNetPlayersManager.h"
 #include "Logic/PlayerInfo.h"
+#include "Logic/SnapshotHistory.h"
+#include "Logic/Messages/MessageDeltaSnapshot.h"
+#include "Logic/Messages/MessageAudio.h"
+#include "Logic/Messages/MessagePlayerSnapshot.h"
 
 #include "Application/BaseApplication.h"
 
@@ -103,8 +107,26 @@ namespace Logic {
 		// TODO Dejamos de escuchar los mensajes de red. 
 		// Desengancharnos de Net::CManager
 		Net::CManager::getSingletonPtr()->removeObserver(this);
+
+		_pendingSnapshots.clear();
+		_relevancy.clear();
 	} // deactivate
 
+	//---------------------------------------------------------
+
+	void CGameNetMsgManager::tick(unsigned int msecs) {
+		Net::CManager* netMgr = Net::CManager::getSingletonPtr();
+		if( netMgr == NULL || !netMgr->imServer() )
+			return;
+
+		_relevancy.update(msecs);
+
+		if( !_pendingSnapshots.empty() ) {
+			sendPendingSnapshots();
+			_pendingSnapshots.clear();
+		}
+	} // tick
+
 	//---------------------------------------------------------
 		
 	void CGameNetMsgManager::sendDestroyEntity(TEntityID destID){
@@ -118,15 +140,18 @@ namespace Logic {
 		serialMsg.serialize(destID);
 
 		//enviamos el mensaje
-		Net::CManager::getSingletonPtr()->broadcast(serialMsg.getbuffer(), serialMsg.getSize());
+		Net::CManager::getSingletonPtr()->enqueue(serialMsg.getbuffer(), serialMsg.getSize());
+
+		// Las siguientes snapshots con este id seran de otra entidad
+		CSnapshotHistory::getSingletonPtr()->removeEntity(destID);
+		_pendingSnapshots.erase(destID);
+		_relevancy.removeEntity(destID);
 	}
 
 	//---------------------------------------------------------
 
 	void CGameNetMsgManager::processDestroyEntity(Net::CPaquete* packet){
-		Net::CBuffer serialMsg;
-			serialMsg.write(packet->getData(),packet->getDataLength());
-			serialMsg.reset(); // Reiniciamos el puntero de lectura a la posicin 0
+		Net::CBuffer serialMsg = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		//deserializamos toda la informacin que se necesita para la creacin de la entidad
 		Net::NetMessageType msgType;
@@ -141,6 +166,8 @@ namespace Logic {
 		//Comprobamos por si acaso para hacerlo bien
 		if(entity!=NULL)
 			CEntityFactory::getSingletonPtr()->deleteEntity(entity);
+
+		CSnapshotHistory::getSingletonPtr()->removeEntity(destID);
 	}
 
 	//---------------------------------------------------------
@@ -164,16 +191,14 @@ namespace Logic {
 		}
 
 		//enviamos el mensaje
-		Net::CManager::getSingletonPtr()->broadcast(serialMsg.getbuffer(), serialMsg.getSize());
+		Net::CManager::getSingletonPtr()->enqueue(serialMsg.getbuffer(), serialMsg.getSize());
 	}
 
 	//---------------------------------------------------------
 		
 	void CGameNetMsgManager::processCreateEntity(Net::CPaquete* packet){
 
-		Net::CBuffer serialMsg;
-			serialMsg.write(packet->getData(),packet->getDataLength());
-			serialMsg.reset(); // Reiniciamos el puntero de lectura a la posicin 0
+		Net::CBuffer serialMsg = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		//deserializamos toda la informacin que se necesita para la creacin de la entidad
 		Net::NetMessageType msgType;
@@ -231,20 +256,220 @@ namespace Logic {
 	//---------------------------------------------------------
 		
 	void CGameNetMsgManager::sendEntityMessage(const std::shared_ptr<CMessage>& txMsg, TEntityID destID) {
+		Net::CManager* netMgr = Net::CManager::getSingletonPtr();
+
+		// En el servidor las snapshots se reparten al final del frame segun
+		// la relevancia de la entidad para cada cliente
+		TMessageType txMsgType = txMsg->getMessageType();
+		if( netMgr->imServer() && (txMsgType == Message::PLAYER_SNAPSHOT || txMsgType == Message::TRANSFORM_SNAPSHOT) ) {
+			_pendingSnapshots[destID].push_back( std::static_pointer_cast<CMessageDeltaSnapshot>(txMsg) );
+			return;
+		}
 
 		Net::CBuffer bufferAux = txMsg->serialize();
 
 		Net::NetMessageType msgType = Net::ENTITY_MSG;// Escribimos el tipo de mensaje de red a enviar
-		Net::CBuffer serialMsg;
+		// Reservamos de una vez el espacio de la cabecera y del mensaje para no tener que crecer
+		Net::CBuffer serialMsg( sizeof(msgType) + sizeof(destID) + bufferAux.getSize() );
 			serialMsg.write(&msgType, sizeof(msgType));
 			serialMsg.write(&destID, sizeof(destID)); // Escribimos el id de la entidad destino
 			serialMsg.write(bufferAux.getbuffer(), bufferAux.getSize()); //Guardamos el mensaje en el buffer
 			
-		Net::CManager::getSingletonPtr()->broadcast(serialMsg.getbuffer(), serialMsg.getSize());
+		unsigned long long coalesceKey = getCoalesceKey(txMsgType, destID);
+		Net::NetChannel channel = getChannel(txMsg);
+		if( netMgr->imServer() && isProximityMessage(txMsg) ) {
+			// Solo a los clientes que tienen cerca la entidad
+			CGameNetPlayersManager* playersMgr = CGameNetPlayersManager::getSingletonPtr();
+			for(CGameNetPlayersManager::iterator it = playersMgr->begin(); it != playersMgr->end(); ++it) {
+				Net::NetID clientId = it->getNetId();
+				if( _relevancy.isRelevant(clientId, destID) )
+					netMgr->enqueueTo( clientId, serialMsg.getbuffer(), serialMsg.getSize(), coalesceKey, channel );
+			}
+		}
+		else {
+			netMgr->enqueue( serialMsg.getbuffer(), serialMsg.getSize(), coalesceKey, channel );
+		}
 		//std::cout << "Enviado mensaje tipo " << txMsg->getMessageType() << " para la entidad " << destID << " de tamao " << serialMsg.getSize() << std::endl;
 		//LOG("TX ENTITY_MSG " << txMsg._type << " to EntityID " << destID);
 	} // sendEntityMessage
 
+	//---------------------------------------------------------
+
+	void CGameNetMsgManager::sendPendingSnapshots() {
+		_pendingIds.clear();
+		for(std::map<TEntityID, TSnapshotList>::const_iterator it = _pendingSnapshots.begin(); it != _pendingSnapshots.end(); ++it)
+			_pendingIds.push_back(it->first);
+
+		_relevancy.buildGrid(_pendingIds);
+
+		CGameNetPlayersManager* playersMgr = CGameNetPlayersManager::getSingletonPtr();
+		for(CGameNetPlayersManager::iterator it = playersMgr->begin(); it != playersMgr->end(); ++it) {
+			Net::NetID clientId = it->getNetId();
+
+			// Lo que no quepa en el presupuesto sube de prioridad para el
+			// siguiente frame
+			_sentIds.clear();
+			_relevancy.getInterestSet(clientId, _candidates);
+			for(unsigned int i = 0; i < _candidates.size() && _relevancy.hasBudget(clientId); ++i) {
+				TEntityID destID = _candidates[i].entity;
+
+				const TSnapshotList& snapshots = _pendingSnapshots[destID];
+				unsigned int size = 0;
+				for(TSnapshotList::const_iterator snapshotIt = snapshots.begin(); snapshotIt != snapshots.end(); ++snapshotIt)
+					size += sendSnapshotTo(clientId, *snapshotIt, destID);
+
+				_relevancy.snapshotSent(clientId, destID, size);
+				_sentIds.insert(destID);
+			}
+
+			// De las entidades descartadas solo se pierden las posiciones. Las
+			// snapshots con eventos salen igualmente (por el canal fiable) y
+			// lo que gastan se descuenta del presupuesto del siguiente frame
+			for(std::map<TEntityID, TSnapshotList>::const_iterator entityIt = _pendingSnapshots.begin(); entityIt != _pendingSnapshots.end(); ++entityIt) {
+				TEntityID destID = entityIt->first;
+				if( _sentIds.count(destID) )
+					continue;
+
+				unsigned int size = 0;
+				for(TSnapshotList::const_iterator snapshotIt = entityIt->second.begin(); snapshotIt != entityIt->second.end(); ++snapshotIt) {
+					if( hasEvents(*snapshotIt) )
+						size += sendSnapshotTo(clientId, *snapshotIt, destID);
+				}
+
+				if(size > 0)
+					_relevancy.snapshotSent(clientId, destID, size);
+			}
+		}
+	} // sendPendingSnapshots
+
+	//---------------------------------------------------------
+
+	unsigned int CGameNetMsgManager::sendSnapshotTo(Net::NetID clientId, const std::shared_ptr<CMessageDeltaSnapshot>& snapshotMsg, TEntityID destID) {
+		CSnapshotHistory* history = CSnapshotHistory::getSingletonPtr();
+		bool quantized = snapshotMsg->isQuantized();
+
+		if(quantized) {
+			// Codificamos contra lo ultimo que ha confirmado este cliente
+			unsigned int baselineSequence;
+			Net::TQuantizedTransform baseline;
+			if( history->getBaseline(clientId, destID, baselineSequence, baseline) )
+				snapshotMsg->setBaseline(baselineSequence, baseline);
+			else
+				snapshotMsg->clearBaseline();
+		}
+
+		Net::CBuffer bufferAux = snapshotMsg->serialize();
+
+		Net::NetMessageType msgType = Net::ENTITY_MSG;
+		Net::CBuffer serialMsg( sizeof(msgType) + sizeof(destID) + bufferAux.getSize() );
+			serialMsg.write(&msgType, sizeof(msgType));
+			serialMsg.write(&destID, sizeof(destID));
+			serialMsg.write(bufferAux.getbuffer(), bufferAux.getSize());
+
+		Net::CManager::getSingletonPtr()->enqueueTo( clientId, serialMsg.getbuffer(), serialMsg.getSize(), 0, getChannel(snapshotMsg) );
+
+		Net::TQuantizedTransform lastState;
+		if( quantized && snapshotMsg->getLastState(lastState) )
+			history->snapshotSent(clientId, destID, snapshotMsg->getSequence(), lastState);
+
+		return serialMsg.getSize();
+	} // sendSnapshotTo
+
+	//---------------------------------------------------------
+
+	bool CGameNetMsgManager::resolveDeltaSnapshot(const std::shared_ptr<CMessageDeltaSnapshot>& snapshotMsg, TEntityID destID) {
+		CSnapshotHistory* history = CSnapshotHistory::getSingletonPtr();
+
+		if( !snapshotMsg->isResolved() ) {
+			Net::TQuantizedTransform baseline;
+			if( !history->getReceived(destID, snapshotMsg->getBaselineSequence(), baseline) ) {
+				// La baseline se ha perdido o ha llegado desordenada. Sin
+				// confirmacion el servidor acabara mandando una snapshot
+				// completa.
+				return false;
+			}
+
+			snapshotMsg->resolveBaseline(baseline);
+		}
+
+		Net::TQuantizedTransform lastState;
+		if( snapshotMsg->getLastState(lastState) )
+			history->snapshotReceived(destID, snapshotMsg->getSequence(), lastState);
+
+		return true;
+	} // resolveDeltaSnapshot
+
+	//---------------------------------------------------------
+
+	unsigned long long CGameNetMsgManager::getCoalesceKey(TMessageType type, TEntityID destID) {
+		switch(type) {
+			// Mensajes que fijan un estado completo: si en el mismo frame se
+			// manda otro para la misma entidad, el anterior sobra
+			case Message::SYNC_POSITION:
+			case Message::SET_TRANSFORM:
+				return ( (unsigned long long)destID << 32 ) | ( (unsigned long long)type + 1 );
+			default:
+				return 0;
+		}
+	} // getCoalesceKey
+
+	//---------------------------------------------------------
+
+	Net::NetChannel CGameNetMsgManager::getChannel(const std::shared_ptr<CMessage>& message) {
+		switch( message->getMessageType() ) {
+			case Message::PLAYER_SNAPSHOT: {
+				// Las snapshots con eventos (animaciones, sonidos, armas) no se
+				// pueden perder
+				std::shared_ptr<CMessagePlayerSnapshot> snapshotMsg = std::static_pointer_cast<CMessagePlayerSnapshot>(message);
+				if( !snapshotMsg->isQuantized() || hasEvents(snapshotMsg) )
+					return Net::DEFAULT_CHANNEL;
+
+				return Net::SNAPSHOT_CHANNEL;
+			}
+			case Message::TRANSFORM_SNAPSHOT:
+				// Sin cuantizar no llevan secuencia y no se pueden descartar
+				// las que lleguen tarde
+				return std::static_pointer_cast<CMessageDeltaSnapshot>(message)->isQuantized() ? Net::SNAPSHOT_CHANNEL : Net::DEFAULT_CHANNEL;
+			case Message::SYNC_POSITION:
+			case Message::PLAYER_STATE:
+				// Estado completo, el siguiente reemplaza al perdido
+				return Net::SNAPSHOT_CHANNEL;
+			default:
+				// Los efectos puntuales no merecen un reenvio
+				return isProximityMessage(message) ? Net::EFFECT_CHANNEL : Net::DEFAULT_CHANNEL;
+		}
+	} // getChannel
+
+	//---------------------------------------------------------
+
+	bool CGameNetMsgManager::hasEvents(const std::shared_ptr<CMessage>& snapshotMsg) {
+		// Las snapshots de transformacion solo llevan posiciones
+		if( snapshotMsg->getMessageType() != Message::PLAYER_SNAPSHOT )
+			return false;
+
+		std::shared_ptr<CMessagePlayerSnapshot> playerSnapshot = std::static_pointer_cast<CMessagePlayerSnapshot>(snapshotMsg);
+		return !playerSnapshot->getAnimationBuffer().empty() || !playerSnapshot->getAudioBuffer().empty() || 
+			   !playerSnapshot->getWeaponBuffer().empty();
+	} // hasEvents
+
+	//---------------------------------------------------------
+
+	bool CGameNetMsgManager::isProximityMessage(const std::shared_ptr<CMessage>& message) {
+		switch( message->getMessageType() ) {
+			// Efectos puntuales, si no se ven ni se oyen no dejan rastro
+			case Message::CREATE_PARTICLE:
+				return true;
+			case Message::AUDIO: {
+				// Los sonidos en bucle o sin posicion hay que mandarlos siempre,
+				// el cliente puede acercarse mientras suenan
+				std::shared_ptr<CMessageAudio> audioMsg = std::static_pointer_cast<CMessageAudio>(message);
+				return audioMsg->is3dSound() && !audioMsg->isLoopable() && !audioMsg->isPlayerOnlySound();
+			}
+			default:
+				return false;
+		}
+	} // isProximityMessage
+
 	//---------------------------------------------------------
 		
 	void CGameNetMsgManager::sendMessageToOne(const std::shared_ptr<CMessage>& txMsg, TEntityID destID, TEntityID player)
@@ -253,14 +478,15 @@ namespace Logic {
 		Net::CBuffer bufferAux = txMsg->serialize();
 
 		Net::NetMessageType msgType = Net::ENTITY_MSG;// Escribimos el tipo de mensaje de red a enviar
-		Net::CBuffer serialMsg;
+		// Reservamos de una vez el espacio de la cabecera y del mensaje para no tener que crecer
+		Net::CBuffer serialMsg( sizeof(msgType) + sizeof(destID) + bufferAux.getSize() );
 			serialMsg.write(&msgType, sizeof(msgType));
 			serialMsg.write(&destID, sizeof(destID)); // Escribimos el id de la entidad destino
 			serialMsg.write(bufferAux.getbuffer(), bufferAux.getSize()); //Guardamos el mensaje en el buffer
 			
 		Net::NetID idMsg = Logic::CGameNetPlayersManager::getSingletonPtr()->getPlayerByEntityId(player).getNetId();
 
-		Net::CManager::getSingletonPtr()->sendTo(idMsg, serialMsg.getbuffer(), serialMsg.getSize());
+		Net::CManager::getSingletonPtr()->enqueueTo( idMsg, serialMsg.getbuffer(), serialMsg.getSize(), 0, getChannel(txMsg) );
 	} // sendMessageToOne
 
 	//---------------------------------------------------------
@@ -268,9 +494,7 @@ namespace Logic {
 	void CGameNetMsgManager::processEntityMessage(Net::CPaquete* packet)
 	{
 		// Creamos un buffer con los datos para leer de manera ms cmoda
-		Net::CBuffer serialMsg;
-			serialMsg.write(packet->getData(),packet->getDataLength());
-			serialMsg.reset(); // Reiniciamos el puntero de lectura a la posicin 0
+		Net::CBuffer serialMsg = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		// Extraemos, pero ignoramos el tipo de mensaje de red. Ya lo hemos procesado		
 		Net::NetMessageType msgType;
@@ -281,16 +505,28 @@ namespace Logic {
 			serialMsg.read(&destID, sizeof(destID));
 			
 		//leemos el mensaje que se ha enviado por la red
-		int typeMessage;
-		serialMsg.read(&typeMessage, sizeof(int));
-		//std::cout << "mensaje de tipo " << typeMessage << std::endl;
+		TMessageID typeMessage;
+		serialMsg.deserialize(typeMessage);
+		//std::cout << "mensaje de tipo " << (int)typeMessage << std::endl;
 		std::shared_ptr<CMessage> messageReceived( Logic::CMessageFactory::getSingletonPtr()->create(typeMessage) );
 			messageReceived->deserialize(serialMsg);
 
-		// Me saco la entidad a la que va destinado el mensaje y se lo envo
+		// Me saco la entidad a la que va destinado el mensaje. Los mensajes
+		// que no son fiables pueden llegar antes de crearla o despues de
+		// destruirla
 		CEntity* destEntity = Logic::CServer::getSingletonPtr()->getMap()->getEntityByID(destID);
-		if(destEntity != 0)
-			destEntity->emitMessage(messageReceived);
+		if(destEntity == NULL)
+			return;
+
+		// Las snapshots cuantizadas pueden venir codificadas como diferencia
+		TMessageType rxMsgType = messageReceived->getMessageType();
+		if(rxMsgType == Message::PLAYER_SNAPSHOT || rxMsgType == Message::TRANSFORM_SNAPSHOT) {
+			std::shared_ptr<CMessageDeltaSnapshot> snapshotMsg = std::static_pointer_cast<CMessageDeltaSnapshot>(messageReceived);
+			if( snapshotMsg->isQuantized() && !resolveDeltaSnapshot(snapshotMsg, destID) )
+				return;
+		}
+
+		destEntity->emitMessage(messageReceived);
 	} // processEntityMessage
 
 
@@ -300,9 +536,7 @@ namespace Logic {
 	// Aqu es donde debemos recibir los mensajes de red
 	void CGameNetMsgManager::dataPacketReceived(Net::CPaquete* packet)
 	{
-		Net::CBuffer rxSerialMsg; // Packet: "NetMessageType | extraData"
-			rxSerialMsg.write(packet->getData(),packet->getDataLength());
-			rxSerialMsg.reset();
+		Net::CBuffer rxSerialMsg = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		Net::NetMessageType rxMsgType;
 			rxSerialMsg.read( &rxMsgType, sizeof(rxMsgType) );			
@@ -340,6 +574,9 @@ namespace Logic {
 		case Net::DEACTIVATE_ENTITY:	
 			deactivateEntity(packet);
 			break;
+		case Net::SNAPSHOT_ACK:
+			CSnapshotHistory::getSingletonPtr()->processAcks(packet);
+			break;
 		}
 		
 	} // dataPacketReceived
@@ -347,9 +584,7 @@ namespace Logic {
 	//--------------------------------------------------------
 
 	void CGameNetMsgManager::activateEntity(Net::CPaquete* packet){
-		Net::CBuffer serialMsg;
-			serialMsg.write(packet->getData(),packet->getDataLength());
-			serialMsg.reset(); // Reiniciamos el puntero de lectura a la posicin 0
+		Net::CBuffer serialMsg = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		//deserializamos toda la informacin que se necesita para la creacin de la entidad
 		Net::NetMessageType msgType;
@@ -369,9 +604,7 @@ namespace Logic {
 	//--------------------------------------------------------
 
 	void CGameNetMsgManager::deactivateEntity(Net::CPaquete* packet){
-		Net::CBuffer serialMsg;
-			serialMsg.write(packet->getData(),packet->getDataLength());
-			serialMsg.reset(); // Reiniciamos el puntero de lectura a la posicin 0
+		Net::CBuffer serialMsg = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		//deserializamos toda la informacin que se necesita para la creacin de la entidad
 		Net::NetMessageType msgType;
@@ -401,7 +634,7 @@ namespace Logic {
 		serialMsg.serialize(destID);
 
 		//enviamos el mensaje
-		Net::CManager::getSingletonPtr()->broadcast(serialMsg.getbuffer(), serialMsg.getSize());
+		Net::CManager::getSingletonPtr()->enqueue(serialMsg.getbuffer(), serialMsg.getSize());
 	}
 
 	//--------------------------------------------------------
@@ -417,7 +650,7 @@ namespace Logic {
 		serialMsg.serialize(destID);
 
 		//enviamos el mensaje
-		Net::CManager::getSingletonPtr()->broadcast(serialMsg.getbuffer(), serialMsg.getSize());
+		Net::CManager::getSingletonPtr()->enqueue(serialMsg.getbuffer(), serialMsg.getSize());
 	}
 
 	//--------------------------------------------------------
@@ -21,11 +21,20 @@ Contiene la declaraci
 
 #include "Logic/Messages/Message.h"
 #include "Logic/Maps/EntityID.h"
+#include "Logic/NetRelevancy.h"
+
+#include <map>
+#include <set>
+#include <vector>
 
 namespace Map {
 	class CEntity;
 }
 
+namespace Logic {
+	class CMessageDeltaSnapshot;
+}
+
 namespace Logic {
 	/**
 	Este mdulo es un singleton que se usa como front-end de la red en el 
@@ -43,6 +52,12 @@ namespace Logic {
 	mensajes lgicos que vienen encapsulados por la red, proporciona un
 	mtodo sendEntityMessage que se encarga de serializar y enviar al otro
 	extremo del tubo un mensaje lgico.
+	<p>
+	En el servidor las snapshots no se mandan en el momento: se quedan
+	pendientes hasta el final del frame (ver tick) y se reparten a cada
+	cliente segn su conjunto de inters y su presupuesto de ancho de banda
+	(ver CNetRelevancy). Los mensajes que solo se perciben cerca de la
+	entidad (sonidos y partculas) tampoco se mandan a quien est lejos.
 
 	@ingroup netGroup
 
@@ -85,6 +100,15 @@ namespace Logic {
 		*/
 		void deactivate();
 
+		/**
+		Funcin llamada en cada frame, despus del tick de la lgica. En el
+		servidor reparte entre los clientes las snapshots que se han generado
+		en el frame.
+
+		@param msecs Milisegundos transcurridos desde el ltimo tick.
+		*/
+		void tick(unsigned int msecs);
+
 		/**
 		Mtodo que serializa un mensaje lgico y lo enva por el tubo al otro
 		extremo de la red.
@@ -171,12 +195,97 @@ namespace Logic {
 		*/
 		void processEntityMessage(Net::CPaquete* packet);
 
+		/**
+		Manda las snapshots pendientes a cada cliente, de su conjunto de
+		inters y en orden de prioridad hasta agotar su presupuesto. De las
+		entidades que se quedan fuera solo se mandan las snapshots con
+		eventos (ver hasEvents).
+		*/
+		void sendPendingSnapshots();
+
+		/**
+		Enva una snapshot a un cliente. Las cuantizadas se codifican como
+		diferencia respecto a la ltima snapshot que ese cliente ha confirmado
+		(o completa si no hay ninguna confirmada).
+
+		@param clientId Id de red del cliente.
+		@param snapshotMsg Snapshot a enviar.
+		@param destination ID de la entidad a la que va dirigida la snapshot.
+		@return Bytes encolados.
+		*/
+		unsigned int sendSnapshotTo(Net::NetID clientId, const std::shared_ptr<CMessageDeltaSnapshot>& snapshotMsg, TEntityID destination);
+
+		/**
+		Devuelve true si un mensaje solo se percibe cerca de la entidad a la
+		que va dirigido y, por tanto, no hace falta mandarlo a los clientes
+		para los que la entidad no es relevante.
+
+		@param message Mensaje a comprobar.
+		*/
+		static bool isProximityMessage(const std::shared_ptr<CMessage>& message);
+
+		/**
+		Reconstruye una snapshot recibida a partir de la baseline que tenemos
+		guardada y la apunta en el historial para confirmarla al servidor.
+
+		@param snapshotMsg Snapshot recibida.
+		@param destination ID de la entidad a la que va dirigida la snapshot.
+		@return false si no tenemos la baseline y hay que descartar la snapshot.
+		*/
+		bool resolveDeltaSnapshot(const std::shared_ptr<CMessageDeltaSnapshot>& snapshotMsg, TEntityID destination);
+
+		/**
+		Devuelve la clave con la que se encola un mensaje de entidad en
+		Net::CManager. Los mensajes que dejan obsoletos a los anteriores del
+		mismo tipo para la misma entidad sustituyen al que estuviera encolado
+		en lugar de mandarse los dos.
+
+		@param type Tipo del mensaje.
+		@param destination ID de la entidad a la que va dirigido el mensaje.
+		@return Clave de sustitucin, o 0 si el mensaje no sustituye a nadie.
+		*/
+		static unsigned long long getCoalesceKey(TMessageType type, TEntityID destination);
+
+		/**
+		Devuelve el canal por el que viaja un mensaje de entidad. Los mensajes
+		que la siguiente actualizacin deja obsoletos van por canales sin
+		fiabilidad para que una prdida no retrase al resto; los que llevan
+		eventos que no se repiten van siempre por el canal fiable.
+
+		@param message Mensaje a enviar.
+		@return Canal de Net::CManager por el que se encola.
+		*/
+		static Net::NetChannel getChannel(const std::shared_ptr<CMessage>& message);
+
+		/**
+		Devuelve true si la snapshot lleva eventos (animaciones, sonidos o
+		cambios de arma). Estos eventos no se vuelven a mandar, as que la
+		snapshot no se puede descartar por relevancia ni por presupuesto.
+
+		@param snapshotMsg Snapshot a comprobar.
+		@return true si lleva algn evento.
+		*/
+		static bool hasEvents(const std::shared_ptr<CMessage>& snapshotMsg);
+
 	private:
 		/**
 		nica instancia de la clase.
 		*/
 		static CGameNetMsgManager* _instance;
 
+		/** Filtro de relevancia de los clientes. */
+		CNetRelevancy _relevancy;
+
+		typedef std::vector< std::shared_ptr<CMessageDeltaSnapshot> > TSnapshotList;
+
+		/** Snapshots generadas este frame por cada entidad, en orden. */
+		std::map<TEntityID, TSnapshotList> _pendingSnapshots;
+
+		/** Buffers reutilizados en cada reparto para no reservar memoria. */
+		std::vector<TEntityID> _pendingIds;
+		std::vector<CNetRelevancy::TCandidate> _candidates;
+		std::set<TEntityID> _sentIds;
+
 	}; // CGameNetMsgManager
 
 } // namespace Logic
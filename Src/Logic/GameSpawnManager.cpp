@@ -94,23 +94,23 @@ namespace Logic {
 	CEntity* CGameSpawnManager::getSpawnPosition(){
 		/*int disponibles=0;
 		for(int i =0;i<_listSpawnPoints.size();i++)
-			if(!_listSpawnPoints[i]->getComponent<CPhysicStaticEntity>("CPhysicStaticEntity")->getInTrigger())
+			if(!_listSpawnPoints[i]->getComponent<CPhysicStaticEntity>()->getInTrigger())
 				disponibles++;*/
 		int random=(rand()*clock())%_listSpawnPoints.size();
 		//Mientras que nos devuelva que el trigger esta activado buscamos otro punto
 		int intentos=0;
-		while(_listSpawnPoints[random]->getComponent<CPhysicStaticEntity>("CPhysicStaticEntity")->getInTrigger()){
+		while(_listSpawnPoints[random]->getComponent<CPhysicStaticEntity>()->getInTrigger()){
 			std::cout << "try: " << intentos+1 << ". Random: " << random << std::endl;
 			random=(rand()*clock())%_listSpawnPoints.size();
 			std::cout << "clock vale " << clock() << std::endl;
 			intentos++;
 			if(intentos>_maxTrys){
-				_listSpawnPoints[random]->getComponent<CPhysicStaticEntity>("CPhysicStaticEntity")->setInTrigger(true);
+				_listSpawnPoints[random]->getComponent<CPhysicStaticEntity>()->setInTrigger(true);
 				return _listSpawnPoints[random];
 			}
 		}
 		//Ademas por si acaso se pide mas de un punto en el mismo tick hay que marcarlo instantaneamente
-		_listSpawnPoints[random]->getComponent<CPhysicStaticEntity>("CPhysicStaticEntity")->setInTrigger(true);
+		_listSpawnPoints[random]->getComponent<CPhysicStaticEntity>()->setInTrigger(true);
 		return _listSpawnPoints[random];
 	}
 
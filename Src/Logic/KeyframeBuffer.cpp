@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------
+// KeyframeBuffer.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file KeyframeBuffer.cpp
+
+Contiene la implementacin del buffer circular de keyframes que usan los
+interpoladores de red.
+
+@see Logic::CKeyframeBuffer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "KeyframeBuffer.h"
+
+#include <cassert>
+
+namespace Logic {
+
+	static_assert( (CKeyframeBuffer::CAPACITY & (CKeyframeBuffer::CAPACITY - 1)) == 0, "La capacidad del buffer de keyframes debe ser potencia de dos" );
+
+	//______________________________________________________________________________
+
+	CKeyframeBuffer::CKeyframeBuffer() : _head(0),
+										 _count(0) {
+		// Nada que hacer
+	} // CKeyframeBuffer
+
+	//______________________________________________________________________________
+
+	void CKeyframeBuffer::clear() {
+		_head = _count = 0;
+	} // clear
+
+	//______________________________________________________________________________
+
+	bool CKeyframeBuffer::push(float time, const Vector3& position, const Quaternion& orientation) {
+		if(_count > 0 && time <= newest().time)
+			return false;
+
+		// Si esta lleno pisamos el mas antiguo
+		if(_count == CAPACITY) {
+			_head = (_head + 1) & (CAPACITY - 1);
+			--_count;
+		}
+
+		TKeyframe& keyframe = _keyframes[ (_head + _count) & (CAPACITY - 1) ];
+		keyframe.time = time;
+		keyframe.position = position;
+		keyframe.orientation = orientation;
+		++_count;
+
+		return true;
+	} // push
+
+	//______________________________________________________________________________
+
+	bool CKeyframeBuffer::sample(float time, bool hermite, Vector3& position, Quaternion& orientation) const {
+		if(_count == 0)
+			return false;
+
+		// Fuera del intervalo nos quedamos en el extremo
+		if(time <= oldest().time || _count == 1) {
+			position = oldest().position;
+			orientation = oldest().orientation;
+			return true;
+		}
+		if(time >= newest().time) {
+			position = newest().position;
+			orientation = newest().orientation;
+			return true;
+		}
+
+		// Buscamos el tramo desde el final: se muestrea cerca del keyframe
+		// mas reciente
+		unsigned int i = _count - 2;
+		while(i > 0 && at(i).time > time)
+			--i;
+
+		const TKeyframe& k1 = at(i);
+		const TKeyframe& k2 = at(i + 1);
+		float segment = k2.time - k1.time;
+		float s = (time - k1.time) / segment;
+
+		orientation = Quaternion::Slerp(s, k1.orientation, k2.orientation, true);
+
+		if(!hermite) {
+			position = k1.position + (k2.position - k1.position) * s;
+			return true;
+		}
+
+		// Tangentes de Catmull-Rom (para tiempos no uniformes), escaladas a la
+		// duracion del tramo. En los extremos usamos el propio tramo.
+		Vector3 m1, m2;
+		if(i > 0) {
+			const TKeyframe& k0 = at(i - 1);
+			m1 = (k2.position - k0.position) * ( segment / (k2.time - k0.time) );
+		}
+		else {
+			m1 = k2.position - k1.position;
+		}
+
+		if(i + 2 < _count) {
+			const TKeyframe& k3 = at(i + 2);
+			m2 = (k3.position - k1.position) * ( segment / (k3.time - k1.time) );
+		}
+		else {
+			m2 = k2.position - k1.position;
+		}
+
+		float s2 = s * s;
+		float s3 = s2 * s;
+		position = k1.position * (2.0f * s3 - 3.0f * s2 + 1.0f) +
+				   m1 * (s3 - 2.0f * s2 + s) +
+				   k2.position * (3.0f * s2 - 2.0f * s3) +
+				   m2 * (s3 - s2);
+
+		return true;
+	} // sample
+
+	//______________________________________________________________________________
+
+	Vector3 CKeyframeBuffer::getLastVelocity() const {
+		if(_count < 2)
+			return Vector3::ZERO;
+
+		const TKeyframe& last = newest();
+		const TKeyframe& previous = at(_count - 2);
+
+		return (last.position - previous.position) / (last.time - previous.time);
+	} // getLastVelocity
+
+	//______________________________________________________________________________
+
+	void CKeyframeBuffer::discardBefore(float time) {
+		// Nos quedamos con dos keyframes anteriores a time como minimo
+		while(_count > 2 && at(2).time <= time) {
+			_head = (_head + 1) & (CAPACITY - 1);
+			--_count;
+		}
+	} // discardBefore
+
+} // namespace Logic
@@ -0,0 +1,179 @@
+//---------------------------------------------------------------------------
+// KeyframeBuffer.h
+//---------------------------------------------------------------------------
+
+/**
+@file KeyframeBuffer.h
+
+Contiene la declaracin del buffer circular de keyframes que usan los
+interpoladores de red para reproducir el movimiento de las entidades
+remotas.
+
+@see Logic::CKeyframeBuffer
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_KeyframeBuffer_H
+#define __Logic_KeyframeBuffer_H
+
+#include "BaseSubsystems/Math.h"
+
+namespace Logic {
+
+	/**
+	Buffer circular de capacidad fija con las transformaciones (posicin y
+	orientacin) recibidas del servidor, cada una con su instante en ticks
+	del servidor.
+	<p>
+	No se interpola nada al recibir: sample calcula la transformacin de
+	cualquier instante entre el keyframe ms antiguo y el ms reciente en el
+	momento en que se necesita (al pintar). La orientacin se interpola con
+	slerp y la posicin con una curva de Hermite (tangentes de Catmull-Rom
+	sacadas de los keyframes vecinos) o linealmente.
+	<p>
+	Los keyframes tienen que llegar en orden; cuando el buffer se llena se
+	pisa el ms antiguo.
+
+	@ingroup logicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CKeyframeBuffer {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Nmero mximo de keyframes que se guardan (potencia de dos). */
+		static const unsigned int CAPACITY = 32;
+
+
+		// =======================================================================
+		//                              ESTRUCTURAS
+		// =======================================================================
+
+
+		/** Transformacin de la entidad en un instante. */
+		struct TKeyframe {
+			/** Instante en ticks del servidor. */
+			float time;
+			Vector3 position;
+			Quaternion orientation;
+		};
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CKeyframeBuffer();
+
+
+		// =======================================================================
+		//                           METODOS PUBLICOS
+		// =======================================================================
+
+
+		/** Vaca el buffer. */
+		void clear();
+
+		//________________________________________________________________________
+
+		/**
+		Aade un keyframe al final del buffer.
+
+		@param time Instante del keyframe en ticks del servidor.
+		@param position Posicin de la entidad.
+		@param orientation Orientacin de la entidad.
+		@return false si el keyframe no es posterior al ltimo (se descarta).
+		*/
+		bool push(float time, const Vector3& position, const Quaternion& orientation);
+
+		//________________________________________________________________________
+
+		/**
+		Calcula la transformacin de la entidad en un instante. Fuera del
+		intervalo cubierto por el buffer se devuelve el keyframe del extremo.
+
+		@param time Instante en ticks del servidor.
+		@param hermite true para interpolar la posicin con Hermite, false
+		para hacerlo linealmente.
+		@param position Parmetro de salida con la posicin.
+		@param orientation Parmetro de salida con la orientacin.
+		@return false si el buffer est vaco.
+		*/
+		bool sample(float time, bool hermite, Vector3& position, Quaternion& orientation) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve la velocidad (por tick) entre los dos ltimos keyframes. Se
+		usa para extrapolar cuando se acaba el buffer.
+		*/
+		Vector3 getLastVelocity() const;
+
+		//________________________________________________________________________
+
+		/**
+		Quita los keyframes que ya no hacen falta para muestrear a partir de
+		un instante. Se conservan los dos anteriores a ese instante, que son
+		los que necesita la interpolacin de Hermite.
+
+		@param time Instante a partir del cual se va a muestrear.
+		*/
+		void discardBefore(float time);
+
+		//________________________________________________________________________
+
+		/** Devuelve el nmero de keyframes del buffer. */
+		unsigned int size() const { return _count; }
+
+		/** Devuelve true si el buffer est vaco. */
+		bool empty() const { return _count == 0; }
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve un keyframe.
+
+		@param index ndice del keyframe, 0 es el ms antiguo.
+		*/
+		const TKeyframe& at(unsigned int index) const { return _keyframes[ (_head + index) & (CAPACITY - 1) ]; }
+
+		/** Devuelve el keyframe ms antiguo. */
+		const TKeyframe& oldest() const { return at(0); }
+
+		/** Devuelve el keyframe ms reciente. */
+		const TKeyframe& newest() const { return at(_count - 1); }
+
+	private:
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Keyframes del buffer. */
+		TKeyframe _keyframes[CAPACITY];
+
+		/** Posicin del keyframe ms antiguo en el array. */
+		unsigned int _head;
+
+		/** Nmero de keyframes del buffer. */
+		unsigned int _count;
+
+	}; // class CKeyframeBuffer
+
+} // namespace Logic
+
+#endif // __Logic_KeyframeBuffer_H
@@ -0,0 +1,414 @@
+//---------------------------------------------------------------------------
+// LagCompensation.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file LagCompensation.cpp
+
+Contiene la implementacin del gestor de compensacin de lag del servidor.
+
+@see Logic::CLagCompensation
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "LagCompensation.h"
+
+#include "Logic/Entity/Entity.h"
+#include "Logic/Entity/Components/PhysicController.h"
+#include "Logic/GameNetPlayersManager.h"
+
+#include "Physics/Server.h"
+#include "Physics/GeometryFactory.h"
+#include "Physics/RaycastHit.h"
+#include "Physics/SweepHit.h"
+
+#include "Net/Manager.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Logic {
+
+	namespace {
+
+		bool raycastHitComparator(const Physics::CRaycastHit& a, const Physics::CRaycastHit& b) {
+			return a.distance < b.distance;
+		}
+
+		bool sweepHitComparator(const Physics::CSweepHit& a, const Physics::CSweepHit& b) {
+			return a.distance < b.distance;
+		}
+
+	}
+
+	//______________________________________________________________________________
+
+	CLagCompensation* CLagCompensation::_instance = NULL;
+
+	//______________________________________________________________________________
+
+	CLagCompensation::CLagCompensation() : _currentTick(0),
+	                                       _fixedTimeStep(16) {
+
+		_instance = this;
+	} // CLagCompensation
+
+	//______________________________________________________________________________
+
+	CLagCompensation::~CLagCompensation() {
+		clear();
+		_instance = NULL;
+	} // ~CLagCompensation
+
+	//______________________________________________________________________________
+
+	bool CLagCompensation::Init() {
+		assert(!_instance && "Segunda inicializacin de Logic::CLagCompensation no permitida!");
+
+		new CLagCompensation();
+
+		return true;
+	} // Init
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::Release() {
+		assert(_instance && "Logic::CLagCompensation no est inicializado!");
+
+		if(_instance)
+			delete _instance;
+	} // Release
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::clear() {
+		for(unsigned int i = 0; i < _histories.size(); ++i)
+			delete _histories[i];
+
+		_histories.clear();
+
+		_rewoundEntities.clear();
+		_rewoundBottoms.clear();
+		_rewoundHeights.clear();
+		_rewoundRadius.clear();
+
+		_currentTick = 0;
+	} // clear
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::addEntity(CEntity* entity, float radius, float height, unsigned int interpolationTicks) {
+		THistory* history = NULL;
+		for(unsigned int i = 0; i < _histories.size() && history == NULL; ++i) {
+			if(_histories[i]->entity == entity)
+				history = _histories[i];
+		}
+
+		if(history == NULL) {
+			history = new THistory();
+			_histories.push_back(history);
+		}
+
+		history->entity = entity;
+		history->radius = radius;
+		history->height = height;
+		history->interpolationTicks = interpolationTicks;
+		history->count = 0;
+		history->lastTick = 0;
+	} // addEntity
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::removeEntity(CEntity* entity) {
+		for(unsigned int i = 0; i < _histories.size(); ++i) {
+			if(_histories[i]->entity == entity) {
+				delete _histories[i];
+				_histories[i] = _histories.back();
+				_histories.pop_back();
+				break;
+			}
+		}
+
+		// Puede que siga en las capsulas rebobinadas
+		for(unsigned int i = 0; i < _rewoundEntities.size(); ++i) {
+			if(_rewoundEntities[i] == entity)
+				_rewoundEntities[i] = NULL;
+		}
+	} // removeEntity
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::record(CEntity* entity, unsigned int tick, const Vector3& position) {
+		for(unsigned int i = 0; i < _histories.size(); ++i) {
+			THistory* history = _histories[i];
+			if(history->entity != entity)
+				continue;
+
+			// Varios fixed ticks pueden apuntar el mismo paso; nos quedamos
+			// con el ultimo
+			if(history->count == 0 || tick != history->lastTick) {
+				if(history->count < HISTORY_SIZE)
+					++history->count;
+			}
+
+			unsigned int slot = tick & (HISTORY_SIZE - 1);
+			history->positions[slot] = position;
+			history->ticks[slot] = tick;
+			history->lastTick = tick;
+
+			return;
+		}
+	} // record
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::setTime(unsigned int tick, unsigned int fixedTimeStep) {
+		_currentTick = tick;
+		_fixedTimeStep = fixedTimeStep > 0 ? fixedTimeStep : 1;
+	} // setTime
+
+	//______________________________________________________________________________
+
+	unsigned int CLagCompensation::getRewindTime(CEntity* shooter) const {
+		unsigned int interpolationTicks = 0;
+		for(unsigned int i = 0; i < _histories.size(); ++i) {
+			if(_histories[i]->entity == shooter) {
+				interpolationTicks = _histories[i]->interpolationTicks;
+				break;
+			}
+		}
+
+		unsigned int roundTripTime = 0;
+		CGameNetPlayersManager* playersMgr = CGameNetPlayersManager::getSingletonPtr();
+		Net::CManager* netMgr = Net::CManager::getSingletonPtr();
+		if( netMgr != NULL && playersMgr->existsByLogicId( shooter->getEntityID() ) )
+			roundTripTime = netMgr->getRoundTripTime( playersMgr->getPlayerByEntityId( shooter->getEntityID() ).getNetId() );
+
+		unsigned int rewindTime = roundTripTime + interpolationTicks * _fixedTimeStep;
+		return rewindTime < MAX_REWIND_TIME ? rewindTime : MAX_REWIND_TIME;
+	} // getRewindTime
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::rewind(CEntity* shooter) {
+		float tick = (float)_currentTick - (float)getRewindTime(shooter) / (float)_fixedTimeStep;
+
+		_rewoundEntities.clear();
+		_rewoundBottoms.clear();
+		_rewoundHeights.clear();
+		_rewoundRadius.clear();
+
+		for(unsigned int i = 0; i < _histories.size(); ++i) {
+			const THistory& history = *_histories[i];
+			if(history.entity == shooter || history.count == 0)
+				continue;
+
+			// El pie de la capsula es la posicion logica; la semiesfera
+			// inferior esta un radio por encima
+			Vector3 bottom = getPositionAt(history, tick);
+			bottom.y += history.radius;
+
+			_rewoundEntities.push_back(history.entity);
+			_rewoundBottoms.push_back(bottom);
+			_rewoundHeights.push_back(history.height);
+			_rewoundRadius.push_back(history.radius);
+		}
+	} // rewind
+
+	//______________________________________________________________________________
+
+	Vector3 CLagCompensation::getPositionAt(const THistory& history, float tick) const {
+		unsigned int newest = history.lastTick;
+		unsigned int oldest = newest - (history.count - 1);
+
+		// Fuera del historial nos quedamos con el extremo mas cercano
+		if( tick >= (float)newest )
+			return history.positions[newest & (HISTORY_SIZE - 1)];
+		if( tick <= (float)oldest )
+			return history.positions[oldest & (HISTORY_SIZE - 1)];
+
+		unsigned int before = (unsigned int)floor(tick);
+		unsigned int after = before + 1;
+		float alpha = tick - (float)before;
+
+		const Vector3& from = history.positions[before & (HISTORY_SIZE - 1)];
+		const Vector3& to = history.positions[after & (HISTORY_SIZE - 1)];
+
+		// Si falta alguno de los pasos (la entidad no hizo fixed tick) no
+		// interpolamos con basura
+		if(history.ticks[before & (HISTORY_SIZE - 1)] != before)
+			return to;
+		if(history.ticks[after & (HISTORY_SIZE - 1)] != after)
+			return from;
+
+		return from + (to - from) * alpha;
+	} // getPositionAt
+
+	//______________________________________________________________________________
+
+	bool CLagCompensation::intersectCapsule(const Vector3& origin, const Vector3& direction, float maxDistance,
+	                                        const Vector3& bottom, float height, float radius,
+	                                        float& distance, Vector3& normal) {
+
+		float radius2 = radius * radius;
+		float best = maxDistance;
+		bool hit = false;
+
+		// Si el origen esta dentro de la capsula el impacto es inmediato
+		float originY = origin.y < bottom.y ? bottom.y : (origin.y > bottom.y + height ? bottom.y + height : origin.y);
+		Vector3 closest(bottom.x, originY, bottom.z);
+		if( origin.squaredDistance(closest) <= radius2 ) {
+			distance = 0.0f;
+			normal = -direction;
+			return true;
+		}
+
+		// Parte cilindrica: la capsula es vertical, asi que basta con
+		// resolver la circunferencia en el plano XZ
+		float dx = origin.x - bottom.x;
+		float dz = origin.z - bottom.z;
+		float a = direction.x * direction.x + direction.z * direction.z;
+		if(a > 1e-6f) {
+			float b = dx * direction.x + dz * direction.z;
+			float c = dx * dx + dz * dz - radius2;
+			float discriminant = b * b - a * c;
+			if(discriminant >= 0.0f) {
+				float t = (-b - sqrt(discriminant)) / a;
+				float y = origin.y + t * direction.y;
+				if(t >= 0.0f && t <= best && y >= bottom.y && y <= bottom.y + height) {
+					best = t;
+					normal = Vector3(dx + t * direction.x, 0.0f, dz + t * direction.z) / radius;
+					hit = true;
+				}
+			}
+		}
+
+		// Semiesferas de los extremos
+		for(int cap = 0; cap < 2; ++cap) {
+			Vector3 center = bottom;
+			center.y += cap * height;
+
+			Vector3 toOrigin = origin - center;
+			float b = toOrigin.dotProduct(direction);
+			float c = toOrigin.squaredLength() - radius2;
+			float discriminant = b * b - c;
+			if(discriminant < 0.0f)
+				continue;
+
+			float t = -b - sqrt(discriminant);
+			if(t >= 0.0f && t <= best) {
+				best = t;
+				normal = (toOrigin + direction * t) / radius;
+				hit = true;
+			}
+		}
+
+		if(hit)
+			distance = best;
+
+		return hit;
+	} // intersectCapsule
+
+	//______________________________________________________________________________
+
+	bool CLagCompensation::isTracked(CEntity* entity) const {
+		for(unsigned int i = 0; i < _histories.size(); ++i) {
+			if(_histories[i]->entity == entity)
+				return true;
+		}
+
+		return false;
+	} // isTracked
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::raycastMultiple(const Ray& ray, float maxDistance, std::vector<Physics::CRaycastHit>& hits,
+	                                       bool sortResultingArray, unsigned int filterMask) const {
+
+		// El mundo y el resto de entidades se consultan a PhysX tal cual
+		unsigned int first = hits.size();
+		Physics::CServer::getSingletonPtr()->raycastMultiple(ray, maxDistance, hits, false, filterMask);
+
+		// Quitamos los jugadores en su posicion actual
+		unsigned int last = first;
+		for(unsigned int i = first; i < hits.size(); ++i) {
+			if( !isTracked(hits[i].entity) )
+				hits[last++] = hits[i];
+		}
+		hits.resize(last);
+
+		// Y los probamos en la posicion rebobinada
+		if(filterMask == 0 || (filterMask & Physics::CollisionGroup::ePLAYER)) {
+			float distance;
+			Vector3 normal;
+			for(unsigned int i = 0; i < _rewoundEntities.size(); ++i) {
+				if(_rewoundEntities[i] == NULL)
+					continue;
+
+				if( intersectCapsule(ray.getOrigin(), ray.getDirection(), maxDistance,
+				                     _rewoundBottoms[i], _rewoundHeights[i], _rewoundRadius[i], distance, normal) ) {
+
+					Physics::CRaycastHit hit;
+					hit.entity = _rewoundEntities[i];
+					hit.physicComponent = hit.entity->getComponent<CPhysicController>();
+					hit.distance = distance;
+					hit.impact = ray.getPoint(distance);
+					hit.normal = normal;
+
+					hits.push_back(hit);
+				}
+			}
+		}
+
+		if(sortResultingArray)
+			std::sort(hits.begin() + first, hits.end(), raycastHitComparator);
+	} // raycastMultiple
+
+	//______________________________________________________________________________
+
+	void CLagCompensation::sweepMultiple(float sphereRadius, const Vector3& position, const Vector3& unitDir, float distance,
+	                                     std::vector<Physics::CSweepHit>& hitSpots, bool sortResultingArray,
+	                                     unsigned int filterMask) const {
+
+		unsigned int first = hitSpots.size();
+		Physics::SphereGeometry sphere = Physics::CGeometryFactory::getSingletonPtr()->createSphere(sphereRadius);
+		Physics::CServer::getSingletonPtr()->sweepMultiple(sphere, position, unitDir, distance, hitSpots, false, filterMask);
+
+		unsigned int last = first;
+		for(unsigned int i = first; i < hitSpots.size(); ++i) {
+			if( !isTracked(hitSpots[i].entity) )
+				hitSpots[last++] = hitSpots[i];
+		}
+		hitSpots.resize(last);
+
+		// Barrer una esfera contra una capsula es lanzar un rayo contra la
+		// capsula engordada con el radio de la esfera
+		if(filterMask == 0 || (filterMask & Physics::CollisionGroup::ePLAYER)) {
+			float hitDistance;
+			Vector3 normal;
+			for(unsigned int i = 0; i < _rewoundEntities.size(); ++i) {
+				if(_rewoundEntities[i] == NULL)
+					continue;
+
+				if( intersectCapsule(position, unitDir, distance, _rewoundBottoms[i], _rewoundHeights[i],
+				                     _rewoundRadius[i] + sphereRadius, hitDistance, normal) ) {
+
+					Physics::CSweepHit hit;
+					hit.entity = _rewoundEntities[i];
+					hit.distance = hitDistance;
+					hit.normal = normal;
+					hit.impact = position + unitDir * hitDistance - normal * sphereRadius;
+
+					hitSpots.push_back(hit);
+				}
+			}
+		}
+
+		if(sortResultingArray)
+			std::sort(hitSpots.begin() + first, hitSpots.end(), sweepHitComparator);
+	} // sweepMultiple
+
+} // namespace Logic
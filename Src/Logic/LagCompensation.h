@@ -0,0 +1,335 @@
+//---------------------------------------------------------------------------
+// LagCompensation.h
+//---------------------------------------------------------------------------
+
+/**
+@file LagCompensation.h
+
+Contiene la declaracin del gestor de compensacin de lag del servidor.
+
+@see Logic::CLagCompensation
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_LagCompensation_H
+#define __Logic_LagCompensation_H
+
+#include "BaseSubsystems/Math.h"
+
+#include <vector>
+
+// Predeclaracion de clases
+namespace Logic {
+	class CEntity;
+};
+
+namespace Physics {
+	struct CRaycastHit;
+	struct CSweepHit;
+};
+
+namespace Logic {
+
+	/**
+	Gestor de compensacin de lag del servidor.
+	<p>
+	Guarda, para cada jugador con el componente CHitboxHistory, un buffer
+	circular con la posicin de su cpsula en cada paso del tick fijo. Cuando
+	un jugador dispara, el servidor puede "rebobinar" al resto de jugadores
+	al instante que vea el tirador (su ping ms el retardo de interpolacin
+	de los clientes) y comprobar los disparos contra esas cpsulas en lugar
+	de contra las actuales.
+	<p>
+	Rebobinar no toca la escena de fsicas: rewind calcula de una vez las
+	cpsulas histricas de todos los jugadores y las consultas las prueban
+	analticamente, as que una rfaga de escopeta paga un solo rebobinado y
+	un test rayo-cpsula por perdign y jugador. El resto del mundo se sigue
+	consultando a PhysX con la posicin actual.
+
+	@ingroup LogicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CLagCompensation {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Nmero de pasos de tick fijo que se recuerdan (potencia de dos). */
+		static const unsigned int HISTORY_SIZE = 32;
+
+		/** Mximo que se puede rebobinar en milisegundos. */
+		static const unsigned int MAX_REWIND_TIME = 250;
+
+
+		// =======================================================================
+		//                  METODOS DE INICIALIZACION Y ACTIVACION
+		// =======================================================================
+
+
+		/**
+		Devuelve la nica instancia de la clase CLagCompensation.
+
+		@return nica instancia de la clase CLagCompensation.
+		*/
+		static CLagCompensation* getSingletonPtr() { return _instance; }
+
+		//________________________________________________________________________
+
+		/**
+		Inicializa la instancia
+
+		@return Devuelve false si no se ha podido inicializar.
+		*/
+		static bool Init();
+
+		//________________________________________________________________________
+
+		/**
+		Libera la instancia de CLagCompensation. Debe llamarse al finalizar la
+		aplicacin.
+		*/
+		static void Release();
+
+		//________________________________________________________________________
+
+		/** Olvida todos los historiales (por ejemplo al descargar el mapa). */
+		void clear();
+
+
+		// =======================================================================
+		//                        METODOS DE LOS HISTORIALES
+		// =======================================================================
+
+
+		/**
+		Empieza a guardar el historial de una entidad. Si ya se guardaba se
+		empieza de cero.
+
+		@param entity Entidad cuyo historial se guarda.
+		@param radius Radio de la cpsula de la entidad.
+		@param height Altura de la parte cilndrica de la cpsula.
+		@param interpolationTicks Pasos de tick fijo que el cliente de la
+		entidad va por detrs del servidor al interpolar al resto.
+		*/
+		void addEntity(CEntity* entity, float radius, float height, unsigned int interpolationTicks);
+
+		//________________________________________________________________________
+
+		/**
+		Deja de guardar el historial de una entidad.
+
+		@param entity Entidad a olvidar.
+		*/
+		void removeEntity(CEntity* entity);
+
+		//________________________________________________________________________
+
+		/**
+		Apunta la posicin de una entidad en un paso del tick fijo.
+
+		@param entity Entidad registrada con addEntity.
+		@param tick Paso del tick fijo (CMap::getFixedTickCount).
+		@param position Posicin lgica de la entidad (pie de la cpsula).
+		*/
+		void record(CEntity* entity, unsigned int tick, const Vector3& position);
+
+		//________________________________________________________________________
+
+		/**
+		Fija el reloj de la simulacin. Lo actualiza CHitboxHistory en cada
+		paso del tick fijo.
+
+		@param tick Paso del tick fijo actual.
+		@param fixedTimeStep Milisegundos que dura cada paso.
+		*/
+		void setTime(unsigned int tick, unsigned int fixedTimeStep);
+
+
+		// =======================================================================
+		//                          METODOS DE CONSULTA
+		// =======================================================================
+
+
+		/**
+		Calcula cunto hay que rebobinar para ver el mundo como lo vea un
+		jugador: el tiempo de ida y vuelta de su conexin ms el retardo de
+		interpolacin de su cliente, sin pasar de MAX_REWIND_TIME.
+
+		@param shooter Jugador que dispara.
+		@return Milisegundos a rebobinar.
+		*/
+		unsigned int getRewindTime(CEntity* shooter) const;
+
+		//________________________________________________________________________
+
+		/**
+		Coloca las cpsulas de todos los jugadores donde estaban cuando
+		dispar el jugador dado. Hay que llamarlo antes de las consultas; las
+		cpsulas rebobinadas se usan hasta el siguiente rewind.
+
+		@param shooter Jugador que dispara. Su propia cpsula se ignora.
+		*/
+		void rewind(CEntity* shooter);
+
+		//________________________________________________________________________
+
+		/**
+		Igual que Physics::CServer::raycastMultiple, pero los jugadores con
+		historial se prueban en la posicin rebobinada. Los impactos de PhysX
+		contra esos jugadores se descartan.
+
+		@param ray Rayo que queremos disparar.
+		@param maxDistance Longitud mxima del rayo.
+		@param hits Vector en el que se devuelven los impactos.
+		@param sortResultingArray true para ordenar los impactos por distancia.
+		@param filterMask Grupos de colisin contra los que choca el rayo.
+		*/
+		void raycastMultiple(const Ray& ray, float maxDistance, std::vector<Physics::CRaycastHit>& hits,
+							 bool sortResultingArray = false, unsigned int filterMask = 0) const;
+
+		//________________________________________________________________________
+
+		/**
+		Igual que Physics::CServer::sweepMultiple con una esfera, pero los
+		jugadores con historial se prueban en la posicin rebobinada.
+
+		@param sphereRadius Radio de la esfera que se barre.
+		@param position Posicin inicial del centro de la esfera.
+		@param unitDir Direccin unitaria del barrido.
+		@param distance Distancia mxima del barrido.
+		@param hitSpots Vector en el que se devuelven los impactos.
+		@param sortResultingArray true para ordenar los impactos por distancia.
+		@param filterMask Grupos de colisin contra los que choca la esfera.
+		*/
+		void sweepMultiple(float sphereRadius, const Vector3& position, const Vector3& unitDir, float distance,
+						   std::vector<Physics::CSweepHit>& hitSpots, bool sortResultingArray = false,
+						   unsigned int filterMask = 0) const;
+
+	protected:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CLagCompensation();
+
+		//________________________________________________________________________
+
+		/** Destructor. */
+		~CLagCompensation();
+
+	private:
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/** Historial de una entidad (buffer circular indexado por paso). */
+		struct THistory {
+			CEntity* entity;
+			float radius;
+			float height;
+			unsigned int interpolationTicks;
+
+			Vector3 positions[HISTORY_SIZE];
+			unsigned int ticks[HISTORY_SIZE];
+
+			/** Nmero de posiciones vlidas (como mucho HISTORY_SIZE). */
+			unsigned int count;
+
+			/** Paso de la ltima posicin apuntada. */
+			unsigned int lastTick;
+		};
+
+
+		// =======================================================================
+		//                          METODOS PRIVADOS
+		// =======================================================================
+
+
+		/**
+		Devuelve la posicin que tena una entidad en un instante dado,
+		interpolando entre los dos pasos que lo rodean.
+
+		@param history Historial de la entidad.
+		@param tick Instante en pasos de tick fijo (puede tener decimales).
+		@return Posicin de la entidad en ese instante.
+		*/
+		Vector3 getPositionAt(const THistory& history, float tick) const;
+
+		//________________________________________________________________________
+
+		/**
+		Interseccin de un rayo con una cpsula vertical.
+
+		@param origin Origen del rayo.
+		@param direction Direccin unitaria del rayo.
+		@param maxDistance Longitud mxima del rayo.
+		@param bottom Centro de la semiesfera inferior.
+		@param height Altura de la parte cilndrica.
+		@param radius Radio de la cpsula.
+		@param distance Parmetro de salida con la distancia al impacto.
+		@param normal Parmetro de salida con la normal en el impacto.
+		@return true si el rayo toca la cpsula.
+		*/
+		static bool intersectCapsule(const Vector3& origin, const Vector3& direction, float maxDistance,
+									 const Vector3& bottom, float height, float radius,
+									 float& distance, Vector3& normal);
+
+		//________________________________________________________________________
+
+		/** Devuelve true si la entidad tiene historial. */
+		bool isTracked(CEntity* entity) const;
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** nica instancia de la clase. */
+		static CLagCompensation* _instance;
+
+		/** Historiales de las entidades. */
+		std::vector<THistory*> _histories;
+
+		/** Paso del tick fijo actual. */
+		unsigned int _currentTick;
+
+		/** Milisegundos de cada paso del tick fijo. */
+		unsigned int _fixedTimeStep;
+
+		/**
+		Cpsulas rebobinadas por el ltimo rewind, como estructura de arrays
+		para que las consultas las recorran seguidas.
+		*/
+		std::vector<CEntity*> _rewoundEntities;
+
+		/** Centro de la semiesfera inferior de cada cpsula rebobinada. */
+		std::vector<Vector3> _rewoundBottoms;
+
+		/** Altura de la parte cilndrica de cada cpsula rebobinada. */
+		std::vector<float> _rewoundHeights;
+
+		/** Radio de cada cpsula rebobinada. */
+		std::vector<float> _rewoundRadius;
+
+	}; // class CLagCompensation
+
+} // namespace Logic
+
+#endif // __Logic_LagCompensation_H
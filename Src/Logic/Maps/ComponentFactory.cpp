@@ -47,4 +47,43 @@ namespace Logic {
 
 	} // Init
 
+	//--------------------------------------------------------
+
+	TComponentID CComponentFactory::registerID(const std::string& name)
+	{
+		std::map<std::string, TComponentID>::const_iterator it = _ids.find(name);
+		if( it != _ids.end() )
+			return it->second;
+
+		TComponentID id = _ids.size();
+		_ids[name] = id;
+		_acceptedMessageTypes.resize(id + 1);
+
+		return id;
+	} // registerID
+
+	//--------------------------------------------------------
+
+	TComponentID CComponentFactory::getComponentID(const std::string& name) const
+	{
+		std::map<std::string, TComponentID>::const_iterator it = _ids.find(name);
+		return it != _ids.end() ? it->second : UNASSIGNED_COMPONENT_ID;
+	} // getComponentID
+
+	//--------------------------------------------------------
+
+	void CComponentFactory::setAcceptedMessageTypes(TComponentID id, const TMessageTypeSet& types)
+	{
+		assert(id < _acceptedMessageTypes.size() && "Tipo de componente no registrado");
+		_acceptedMessageTypes[id] = types;
+	} // setAcceptedMessageTypes
+
+	//--------------------------------------------------------
+
+	const TMessageTypeSet& CComponentFactory::getAcceptedMessageTypes(TComponentID id) const
+	{
+		assert(id < _acceptedMessageTypes.size() && "Tipo de componente no registrado");
+		return _acceptedMessageTypes[id];
+	} // getAcceptedMessageTypes
+
 } // namespace Logic
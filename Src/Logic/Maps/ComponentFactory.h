@@ -15,6 +15,10 @@ los punteros a funci
 #define __Logic_ComponentFactory_H
 
 #include "BaseSubsystems/Factory.h"
+#include "ComponentID.h"
+#include "Logic/Messages/Message.h"
+
+#include <vector>
 
 // Predeclaracin de clases para ahorrar tiempo de compilacin
 namespace Logic 
@@ -33,6 +37,12 @@ namespace Logic
 	Es usada para almacenar componentes 
 	en Logic::CEntityFactory donde todo el registro de componentes se realiza 
 	utilizando macros del preprocesador declarados en Logic::CComponent.
+	<p>
+	Adems asigna a cada tipo de componente un identificador numrico
+	consecutivo (TComponentID) que las entidades usan para indexar sus
+	componentes sin comparar cadenas, y guarda los tipos de mensaje que
+	acepta cada uno para que las entidades sepan a quin ofrecer cada
+	mensaje.
 
 	@ingroup logicGroup
 	@ingroup mapGroup
@@ -56,6 +66,46 @@ namespace Logic
 		*/
 		~CComponentFactory();
 
+		/**
+		Asigna un identificador numrico al tipo de componente dado. Si ya
+		tena uno devuelve el mismo.
+
+		@param name Nombre de la clase del componente.
+		@return Identificador del tipo de componente.
+		*/
+		TComponentID registerID(const std::string& name);
+
+		/**
+		Devuelve el identificador numrico de un tipo de componente.
+
+		@param name Nombre de la clase del componente.
+		@return Identificador del tipo o UNASSIGNED_COMPONENT_ID si no se ha
+		registrado.
+		*/
+		TComponentID getComponentID(const std::string& name) const;
+
+		/**
+		Nmero de tipos de componente registrados. Todos los identificadores
+		asignados son menores que este valor.
+		*/
+		unsigned int getComponentCount() const { return _ids.size(); }
+
+		/**
+		Establece los tipos de mensaje que acepta un tipo de componente.
+
+		@param id Identificador del tipo de componente.
+		@param types Tipos de mensaje que acepta.
+		*/
+		void setAcceptedMessageTypes(TComponentID id, const TMessageTypeSet& types);
+
+		/**
+		Devuelve los tipos de mensaje que acepta un tipo de componente.
+
+		@param id Identificador del tipo de componente.
+		@return Tipos de mensaje que acepta (vaco si no se ha establecido).
+		*/
+		const TMessageTypeSet& getAcceptedMessageTypes(TComponentID id) const;
+
 	protected:
 		/**
 		Constructor.
@@ -68,6 +118,12 @@ namespace Logic
 		*/
 		static CComponentFactory* _instance;
 
+		/** Identificadores asignados a cada tipo de componente. */
+		std::map<std::string, TComponentID> _ids;
+
+		/** Tipos de mensaje que acepta cada tipo de componente, por id. */
+		std::vector<TMessageTypeSet> _acceptedMessageTypes;
+
 	}; // class CComponentFactory
 
 } // namespace Logic
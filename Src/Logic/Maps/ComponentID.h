@@ -1,17 +1,33 @@
+/**
+@file ComponentID.h
+
+Contiene la definicin del tipo de identificacin numrica de los tipos
+de componente.
+
+@see Logic::TComponentID
+@see Logic::CComponentFactory
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
 #ifndef __Logic_ComponentID_H__
 #define __Logic_ComponentID_H__
 
-/*#include "iidentifier.h"
-#include <string>
+//---------------------------------------------------------------------------
 
 namespace Logic {
 
-	class CComponentID : public IIdentifier<std::string> {
-	public:
-		CComponentID(const std::string& id);
-		virtual ~CComponentID(void);
-	};
+	/**
+	Identificador de tipo de componente. La factora de componentes los
+	asigna de forma consecutiva (0, 1, 2...) segn se van registrando, de
+	modo que pueden usarse directamente como ndice de un array.
+	*/
+	typedef unsigned int TComponentID;
+
+	/** Valor de los tipos de componente que an no se han registrado. */
+	const TComponentID UNASSIGNED_COMPONENT_ID = 0xFFFFFFFF;
 
-};*/
+}
 
-#endif
+#endif // __Logic_ComponentID_H__
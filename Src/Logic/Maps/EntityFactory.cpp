@@ -30,6 +30,8 @@ del juego.
 #include <iostream>
 #include <fstream>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 
 // HACK. Debera leerse de algn fichero de configuracin
 #define BLUEPRINTS_FILE_PATH "./media/maps/"
@@ -37,13 +39,15 @@ del juego.
 /**
 Sobrecargamos el operador >> para la lectura de blueprints.
 Cada lnea equivaldr a una entidad donde la primera palabra es el tipo
-y las siguientes son los componentes que tiene.
+y las siguientes son los componentes que tiene, salvo pool=N, que indica
+el tamao del pool de la entidad.
 
 @param is Flujo de entrada.
 @param blueprint Tipo de dato blueprint que va a ser leido.
 */
 std::istream& operator>>(std::istream& is, Logic::CEntityFactory::TBluePrint& blueprint) {
 	is >> blueprint.type;
+	blueprint.poolSize = 0;
 	std::string aux;
 	getline(is,aux,'\n');
 	std::istringstream components(aux);
@@ -51,7 +55,9 @@ std::istream& operator>>(std::istream& is, Logic::CEntityFactory::TBluePrint& bl
 	while( !components.eof() ) {
 		aux.clear();
 		components >> aux;
-		if( !aux.empty() )
+		if( aux.compare(0, 5, "pool=") == 0 )
+			blueprint.poolSize = atoi( aux.c_str() + 5 );
+		else if( !aux.empty() )
 			blueprint.components.push_back(aux);
 	}
 
@@ -144,6 +150,21 @@ namespace Logic {
 				// Si el tipo ya estaba definido lo eliminamos.
 				if(_bluePrints.count(b.type))
 					_bluePrints.erase(b.type);
+
+				// Las entidades recicladas tienen los componentes del
+				// blueprint anterior
+				TEntityPoolMap::iterator poolIt = _pools.find(b.type);
+				if(poolIt != _pools.end()) {
+					clearPool(poolIt->second);
+					_pools.erase(poolIt);
+				}
+
+				if(b.poolSize > 0) {
+					TEntityPool pool;
+					memset( &pool.stats, 0, sizeof(TPoolStats) );
+					_pools[b.type] = pool;
+				}
+
 				// Aadimos a la tabla
 				TStringBluePrintPair elem(b.type,b);
 				_bluePrints.insert(elem);
@@ -189,74 +210,166 @@ namespace Logic {
 	//________________________________________________________________________
 
 	void CEntityFactory::unloadBluePrints() {
+		releasePools();
+		_pools.clear();
 		_bluePrints.clear();
 	} // unloadBluePrints
 	
 	//________________________________________________________________________
 
 	Logic::CEntity *CEntityFactory::assembleEntity(const std::string &type) {
+		// si el tipo no se encuentra registrado no gastamos id
+		if( !_bluePrints.count(type) )
+			return 0;
+
+		return assembleEntity( type, _idDispatcher->getNextId() );
+	} // assembleEntity
+
+
+	//________________________________________________________________________
+
+	Logic::CEntity *CEntityFactory::assembleEntity(const std::string &type, const TEntityID id) {
 		TBluePrintMap::const_iterator it;
 		it = _bluePrints.find(type);
 
-		// si el tipo se encuentra registrado.
-		if ( it != _bluePrints.end() ) {
-			CEntity* ent = new CEntity( _idDispatcher->getNextId() );
-			std::list<std::string>::const_iterator itc;
-			
-			// Aadimos todos sus componentes.
-			IComponent* comp;
-			for(itc = (*it).second.components.begin(); itc !=(*it).second.components.end(); ++itc) {
-				if( CComponentFactory::getSingletonPtr()->has(*itc) ) {
-					comp = CComponentFactory::getSingletonPtr()->create(*itc);
-				}
-				else {
-					std::cerr << *itc << std::endl;;
-					assert(!"Nombre erroneo de un componente, Mira a ver si estn todos bien escritos en el fichero de blueprints");
-					delete ent;
-					return 0;
-				}
+		// si el tipo no se encuentra registrado.
+		if ( it == _bluePrints.end() )
+			return 0;
 
-				if(comp)
-					ent->addComponent(comp, *itc);
-			}
-			return ent;
+		TEntityPoolMap::iterator poolIt = _pools.find(type);
+		if( poolIt == _pools.end() )
+			return buildEntity(it->second, id);
+
+		// Si al pool le quedan entidades recicladas nos ahorramos ensamblarla
+		TEntityPool& pool = poolIt->second;
+		++pool.stats.requests;
+
+		CEntity* ent;
+		if( !pool.freeEntities.empty() ) {
+			ent = pool.freeEntities.back();
+			pool.freeEntities.pop_back();
+			ent->setEntityID(id);
+			++pool.stats.hits;
+		}
+		else {
+			ent = buildEntity(it->second, id);
+			if(!ent)
+				return 0;
+
+			++pool.stats.allocations;
 		}
 
-		return 0;
+		if( ++pool.stats.inUse > pool.stats.peakInUse )
+			pool.stats.peakInUse = pool.stats.inUse;
+
+		return ent;
 	} // assembleEntity
 
+	//________________________________________________________________________
+
+	Logic::CEntity *CEntityFactory::buildEntity(const TBluePrint &bluePrint, const TEntityID id) {
+		CEntity* ent = new CEntity(id);
+		std::list<std::string>::const_iterator itc;
+		
+		// Aadimos todos sus componentes.
+		IComponent* comp;
+		for(itc = bluePrint.components.begin(); itc != bluePrint.components.end(); ++itc) {
+			if( CComponentFactory::getSingletonPtr()->has(*itc) ) {
+				comp = CComponentFactory::getSingletonPtr()->create(*itc);
+			}
+			else {
+				std::cerr << *itc << std::endl;;
+				assert(!"Nombre erroneo de un componente, Mira a ver si estn todos bien escritos en el fichero de blueprints");
+				delete ent;
+				return 0;
+			}
+
+			if(comp)
+				ent->addComponent(comp, *itc);
+		}
+
+		return ent;
+	} // buildEntity
 
 	//________________________________________________________________________
 
-	Logic::CEntity *CEntityFactory::assembleEntity(const std::string &type, const TEntityID id) {
-		TBluePrintMap::const_iterator it;
-		it = _bluePrints.find(type);
+	void CEntityFactory::releaseEntity(Logic::CEntity *entity) {
+		TEntityPoolMap::iterator poolIt = _pools.find( entity->getType() );
+		if( poolIt == _pools.end() ) {
+			delete entity;
+			return;
+		}
 
-		// si el tipo se encuentra registrado.
-		if ( it != _bluePrints.end() ) {
-			CEntity* ent = new CEntity(id);
-			std::list<std::string>::const_iterator itc;
-			
-			// Aadimos todos sus componentes.
-			IComponent* comp;
-			for(itc = (*it).second.components.begin(); itc !=(*it).second.components.end(); ++itc) {
-				if( CComponentFactory::getSingletonPtr()->has(*itc) ) {
-					comp = CComponentFactory::getSingletonPtr()->create((*itc));
-				}
-				else {
-					assert(!"Nombre erroneo de un componente, Mira a ver si estn todos bien escritos en el fichero de blueprints");
-					delete ent;
-					return 0;
-				}
+		TEntityPool& pool = poolIt->second;
+
+		// Las entidades del mapa anterior a releasePools no cuentan
+		if(pool.stats.inUse > 0)
+			--pool.stats.inUse;
+
+		if( entity->recycle() ) {
+			pool.freeEntities.push_back(entity);
+			++pool.stats.recycled;
+		}
+		else {
+			delete entity;
+			++pool.stats.discarded;
+		}
+	} // releaseEntity
+
+	//________________________________________________________________________
+
+	void CEntityFactory::prewarmPools() {
+		for(TEntityPoolMap::iterator it = _pools.begin(); it != _pools.end(); ++it) {
+			TEntityPool& pool = it->second;
+			const TBluePrint& bluePrint = _bluePrints[it->first];
 
-				if(comp)
-					ent->addComponent(comp, *itc);
+			while( pool.freeEntities.size() < bluePrint.poolSize ) {
+				// El id se asigna al sacarla del pool
+				CEntity* ent = buildEntity(bluePrint, 0);
+				if(!ent)
+					break;
+
+				pool.freeEntities.push_back(ent);
+				++pool.stats.allocations;
 			}
-			return ent;
 		}
+	} // prewarmPools
 
-		return 0;
-	} // assembleEntity
+	//________________________________________________________________________
+
+	void CEntityFactory::clearPool(TEntityPool &pool) {
+		for(unsigned int i = 0; i < pool.freeEntities.size(); ++i)
+			delete pool.freeEntities[i];
+
+		pool.freeEntities.clear();
+	} // clearPool
+
+	//________________________________________________________________________
+
+	void CEntityFactory::releasePools() {
+		for(TEntityPoolMap::iterator it = _pools.begin(); it != _pools.end(); ++it) {
+			clearPool(it->second);
+			memset( &it->second.stats, 0, sizeof(TPoolStats) );
+		}
+	} // releasePools
+
+	//________________________________________________________________________
+
+	const CEntityFactory::TPoolStats* CEntityFactory::getPoolStats(const std::string& type) const {
+		TEntityPoolMap::const_iterator it = _pools.find(type);
+		return it != _pools.end() ? &it->second.stats : NULL;
+	} // getPoolStats
+
+	//________________________________________________________________________
+
+	void CEntityFactory::printPoolStats() const {
+		for(TEntityPoolMap::const_iterator it = _pools.begin(); it != _pools.end(); ++it) {
+			const TPoolStats& stats = it->second.stats;
+			std::cout << "pool " << it->first << ": " << stats.hits << "/" << stats.requests << " reutilizadas, "
+					  << stats.allocations << " ensambladas, " << stats.recycled << " recicladas, "
+					  << stats.discarded << " destruidas, pico " << stats.peakInUse << std::endl;
+		}
+	} // printPoolStats
 	
 	//________________________________________________________________________
 
@@ -275,7 +388,9 @@ namespace Logic {
 			return entity;
 		} 
 		else {
-			delete entity;
+			// El spawn fallido ya ha apuntado el mapa en la entidad
+			entity->_map = NULL;
+			releaseEntity(entity);
 			return NULL;
 		}
 	}
@@ -299,7 +414,9 @@ namespace Logic {
 			return entity;
 		} 
 		else {
-			delete entity;
+			// El spawn fallido ya ha apuntado el mapa en la entidad
+			entity->_map = NULL;
+			releaseEntity(entity);
 			return NULL;
 		}
 	}
@@ -355,7 +472,7 @@ namespace Logic {
 		if( Net::CManager::getSingletonPtr()->imServer() && toClients )
 			Logic::CGameNetMsgManager::getSingletonPtr()->sendDestroyEntity( entity->getEntityID() );
 
-		delete entity;
+		releaseEntity(entity);
 
 	} // deleteEntity
 	
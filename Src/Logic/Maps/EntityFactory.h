@@ -21,6 +21,7 @@ del juego.
 #include <map>
 #include <string>
 #include <list>
+#include <vector>
 
 #include "EntityID.h"
 #include "EntityIdDispatcher.h"
@@ -96,6 +97,12 @@ namespace Logic {
 		Se puede cargar ms de un fichero con definiciones de entidades.
 		Si los tipo de entidad se encuentran repetidos siempre prevalece
 		el ltimo aadido.
+		<p>
+		Una palabra de la forma pool=N en lugar de un componente indica
+		que las entidades de ese tipo se reciclan en un pool que se
+		precalienta con N entidades al cargar el mapa (ver prewarmPools).
+		Slo tiene sentido en entidades efmeras cuyos componentes
+		redefinen IComponent::onRecycle.
 
 		@param filename Fichero con la descripcin de las entidades.
 		@return true si la carga se hizo correctamente.
@@ -240,6 +247,63 @@ namespace Logic {
 
 		//________________________________________________________________________
 
+		/**
+		Ensambla las entidades que faltan en cada pool para llegar al tamao
+		indicado en los blueprints. Se llama al cargar el mapa para no
+		reservar memoria durante la partida.
+		*/
+		void prewarmPools();
+
+		//________________________________________________________________________
+
+		/**
+		Destruye las entidades libres de todos los pools y pone a cero sus
+		estadsticas. Se llama al descargar el mapa.
+		*/
+		void releasePools();
+
+		//________________________________________________________________________
+
+		/**
+		Estadsticas de uso del pool de un tipo de entidad, para ajustar el
+		tamao de los pools en el fichero de blueprints.
+		*/
+		typedef struct {
+			/** Entidades pedidas al pool. */
+			unsigned int requests;
+			/** Peticiones servidas con una entidad reciclada. */
+			unsigned int hits;
+			/** Entidades ensambladas de cero, incluidas las del precalentado. */
+			unsigned int allocations;
+			/** Entidades devueltas al pool al destruirse. */
+			unsigned int recycled;
+			/** Entidades que no se han podido reciclar y se han destruido. */
+			unsigned int discarded;
+			/** Entidades del pool en uso en este momento. */
+			unsigned int inUse;
+			/** Mximo de entidades en uso a la vez. */
+			unsigned int peakInUse;
+		} TPoolStats;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve las estadsticas del pool de un tipo de entidad.
+
+		@param type Tipo de la entidad.
+		@return Estadsticas del pool o NULL si ese tipo no tiene pool.
+		*/
+		const TPoolStats* getPoolStats(const std::string& type) const;
+
+		//________________________________________________________________________
+
+		/**
+		Vuelca las estadsticas de todos los pools por la salida estndar.
+		*/
+		void printPoolStats() const;
+
+		//________________________________________________________________________
+
 		/**
 		Mtodo que dado un tipo de entidad, devuelve su informacion.
 
@@ -324,10 +388,33 @@ namespace Logic {
 			*/
 			std::list<std::string> components;
 
+			/**
+			Nmero de entidades con las que se precalienta su pool (0 si
+			las entidades de este tipo no se reciclan).
+			*/
+			unsigned int poolSize;
+
 		} TBluePrint;
 
 	protected:
 
+		/**
+		Pool de entidades recicladas de un tipo.
+		*/
+		typedef struct {
+			/** Entidades libres, listas para hacer spawn. */
+			std::vector<CEntity*> freeEntities;
+			/** Estadsticas de uso del pool. */
+			TPoolStats stats;
+		} TEntityPool;
+
+		/**
+		Tipo tabla para almacenar los pools por tipo de entidad.
+		*/
+		typedef std::map<std::string, TEntityPool> TEntityPoolMap;
+
+		//________________________________________________________________________
+
 		Logic::CEntity* initEntity(Logic::CEntity* entity, Map::CEntity* entityInfo, CMap *map, bool replicate, Map::CEntity* customInfoForClient = NULL);
 
 		//________________________________________________________________________
@@ -383,6 +470,29 @@ namespace Logic {
 
 		CEntity *assembleEntity(const std::string &type);
 
+		/**
+		Crea una entidad y todos los componentes de un blueprint, sin pasar
+		por el pool.
+
+		@param bluePrint Descripcin de la entidad.
+		@param id id de la entidad que se desea crear.
+		@return La entidad creada o NULL si no se pudo crear.
+		*/
+		CEntity *buildEntity(const TBluePrint &bluePrint, TEntityID id);
+
+		/**
+		Devuelve al pool de su tipo una entidad que ya est fuera del mapa
+		o la destruye si su tipo no tiene pool o no se puede reciclar.
+
+		@param entity Entidad que se libera.
+		*/
+		void releaseEntity(CEntity *entity);
+
+		/**
+		Destruye las entidades libres de un pool.
+		*/
+		void clearPool(TEntityPool &pool);
+
 		/**
 		Tipo lista de CEntity donde guardaremos los pendientes de borrar.
 		*/
@@ -409,6 +519,12 @@ namespace Logic {
 		*/
 		TBluePrintMap _bluePrints;
 
+		/**
+		Tabla con los pools de los tipos de entidad que tienen pool=N en su
+		blueprint.
+		*/
+		TEntityPoolMap _pools;
+
 		bool _dynamicCreation;
 
 		Logic::CEntityIdDispatcher<Logic::TEntityID>* _idDispatcher;
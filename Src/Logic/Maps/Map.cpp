@@ -12,8 +12,10 @@ Contiene la implementaci
 #include "Map.h"
 #include "Logic/Entity/Components/SpellType.h"
 #include "Logic/Entity/Entity.h"
+#include "Logic/Entity/Component.h"
 #include "Logic/Server.h"
 #include "EntityFactory.h"
+#include "ComponentFactory.h"
 
 #include "Map/MapParser.h"
 #include "Map/MapEntity.h"
@@ -21,11 +23,13 @@ Contiene la implementaci
 #include "Graphics/Server.h"
 #include "Graphics/Scene.h"
 #include "Logic/Maps/WorldState.h"
+#include "Logic/ProjectileSimulator.h"
 
 #include "Logic/Messages/MessageHudDebugData.h"
 
 #include <cassert>
 #include <fstream>
+#include <algorithm>
 
 using namespace std;
 
@@ -83,10 +87,16 @@ namespace Logic {
 
 	//--------------------------------------------------------
 
-	CMap::CMap(const std::string &name) : _numOfPlayers(0) {
+	CMap::CMap(const std::string &name) : _numOfPlayers(0), _fixedTickCount(0) {
 		_name = name;
 		_scene = Graphics::CServer::getSingletonPtr()->createScene(name);
 
+		// Un lote por cada tipo de componente registrado. Los lotes no se
+		// redimensionan despues para que se puedan recorrer por referencia
+		unsigned int componentCount = CComponentFactory::getSingletonPtr()->getComponentCount();
+		_batchedTick.resize(componentCount);
+		_batchedFixedTick.resize(componentCount);
+
 	} // CMap
 
 	//--------------------------------------------------------
@@ -101,8 +111,8 @@ namespace Logic {
 	//--------------------------------------------------------
 
 	bool CMap::activate() {
-		_acumTime = 0;
 		_fixedTimeStep = 16;
+		_fixedTickCount = 0;
 		Graphics::CServer::getSingletonPtr()->setScene(_scene);
 
 		auto it = _entityInfoTable.begin();
@@ -140,19 +150,51 @@ namespace Logic {
 	//---------------------------------------------------------
 
 	void CMap::wantsTick(CEntity* entity) {
-		_entitiesWithTick.push_front(entity);
-
 		auto it = _entityInfoTable.find( entity->getEntityID() );
-		it->second._tickIterator = _entitiesWithTick.begin();
+		if( it == _entityInfoTable.end() || it->second._wantsTick )
+			return;
+
+		// Se puede llamar en mitad del tick; se aade al final y el
+		// recorrido por indice la alcanza en la misma vuelta
+		it->second._wantsTick = true;
+		_entitiesWithTick.push_back(entity);
 	}
 
 	//---------------------------------------------------------
 
 	void CMap::wantsFixedTick(CEntity* entity) {
-		_entitiesWithFixedTick.push_front(entity);
-
 		auto it = _entityInfoTable.find( entity->getEntityID() );
-		it->second._fixedTickIterator = _entitiesWithFixedTick.begin();
+		if( it == _entityInfoTable.end() || it->second._wantsFixedTick )
+			return;
+
+		it->second._wantsFixedTick = true;
+		_entitiesWithFixedTick.push_back(entity);
+	}
+
+	//---------------------------------------------------------
+
+	void CMap::wantsBatchedTick(IComponent* component) {
+		assert( component->getTypeID() < _batchedTick.size() && "Tipo de componente registrado despues de crear el mapa" );
+		_batchedTick[ component->getTypeID() ].push_back(component);
+	}
+
+	//---------------------------------------------------------
+
+	void CMap::wantsBatchedFixedTick(IComponent* component) {
+		assert( component->getTypeID() < _batchedFixedTick.size() && "Tipo de componente registrado despues de crear el mapa" );
+		_batchedFixedTick[ component->getTypeID() ].push_back(component);
+	}
+
+	//---------------------------------------------------------
+
+	void CMap::removeBatchedComponent(IComponent* component) {
+		// Solo lo anulamos; se quitara al compactar el lote en el
+		// siguiente tick (puede que estemos dentro de uno)
+		TComponentArray& tickBatch = _batchedTick[ component->getTypeID() ];
+		std::replace(tickBatch.begin(), tickBatch.end(), component, (IComponent*)NULL);
+
+		TComponentArray& fixedTickBatch = _batchedFixedTick[ component->getTypeID() ];
+		std::replace(fixedTickBatch.begin(), fixedTickBatch.end(), component, (IComponent*)NULL);
 	}
 
 	//---------------------------------------------------------
@@ -170,7 +212,7 @@ namespace Logic {
 
 	//---------------------------------------------------------
 
-	void CMap::tick(unsigned int msecs) {
+	void CMap::tick(unsigned int msecs, unsigned int fixedSteps) {
 		// Comprobamos los timers de las entidades que tienen
 		// un tiempo de vida
 		checkTimeouts(msecs);
@@ -187,7 +229,7 @@ namespace Logic {
 		// de sus componentes (dependiendo del estado)
 		doTick(msecs);
 
-		doFixedTick(msecs);	
+		doFixedTick(fixedSteps);
 	} // tick
 
 	//--------------------------------------------------------
@@ -232,72 +274,117 @@ namespace Logic {
 	//--------------------------------------------------------
 	
 	void CMap::doTick(unsigned int msecs) {
-		// Ejecutamos el tick de las entidades que lo quieren
+		// Ejecutamos el tick de las entidades que lo quieren, compactando
+		// el array sobre la marcha
 		CEntity* entity;
-		std::list<CEntity*>::iterator it = _entitiesWithTick.begin();
-		while(it != _entitiesWithTick.end()) {
-			entity = *it;
+		unsigned int last = 0;
+		for(unsigned int i = 0; i < _entitiesWithTick.size(); ++i) {
+			entity = _entitiesWithTick[i];
+			if(entity == NULL)
+				continue;
 
 			if( !entity->tick(msecs) ) {
-				auto otherIt = _entityInfoTable.find( entity->getEntityID() );
-				otherIt->second._tickIterator = _entitiesWithTick.end();
-				it = _entitiesWithTick.erase(it);
+				_entityInfoTable.find( entity->getEntityID() )->second._wantsTick = false;
 				continue;
 			}
 
-			++it;
+			_entitiesWithTick[last++] = entity;
 		}
+		_entitiesWithTick.resize(last);
+
+		// Y despues los lotes, un tipo de componente detras de otro
+		for(unsigned int type = 0; type < _batchedTick.size(); ++type)
+			tickBatch(_batchedTick[type], msecs, false);
 	}
 
 	//--------------------------------------------------------
 	
-	void CMap::doFixedTick(unsigned int msecs) {
-		_acumTime += msecs;
-		unsigned int steps = _acumTime / _fixedTimeStep;
-		_acumTime = _acumTime % _fixedTimeStep; 
+	void CMap::doFixedTick(unsigned int steps) {
+		// El planificador de la aplicacin ya ha acumulado el tiempo y nos
+		// dice cuntos pasos tocan (los mismos que da la fsica)
+		for(unsigned int step = 0; step < steps; ++step) {
+			++_fixedTickCount;
 
-		// Ejecutamos el fixed tick
-		for(int i = 0; i < steps; ++i) {
 			CEntity* entity;
-			std::list<CEntity*>::iterator it = _entitiesWithFixedTick.begin();
-			while( it != _entitiesWithFixedTick.end() ) {
-				entity = *it;
+			unsigned int last = 0;
+			for(unsigned int i = 0; i < _entitiesWithFixedTick.size(); ++i) {
+				entity = _entitiesWithFixedTick[i];
+				if(entity == NULL)
+					continue;
 
 				if( !entity->fixedTick(_fixedTimeStep) ) {
-					auto otherIt = _entityInfoTable.find( entity->getEntityID() );
-					otherIt->second._fixedTickIterator = _entitiesWithFixedTick.end();
-					it = _entitiesWithFixedTick.erase(it);
+					_entityInfoTable.find( entity->getEntityID() )->second._wantsFixedTick = false;
 					//std::cout << "esta entidad no quiere fixed tick:  " << entity->getName() << std::endl;
 					continue;
 				}
 
-				++it;
+				_entitiesWithFixedTick[last++] = entity;
 			}
+			_entitiesWithFixedTick.resize(last);
+
+			for(unsigned int type = 0; type < _batchedFixedTick.size(); ++type)
+				tickBatch(_batchedFixedTick[type], _fixedTimeStep, true);
+
+			// Y los proyectiles ligeros, todos en un lote
+			CProjectileSimulator::getSingletonPtr()->fixedTick(this, _fixedTimeStep);
 		}
 	}
 
 	//--------------------------------------------------------
 
+	void CMap::tickBatch(TComponentArray& components, unsigned int msecs, bool fixed) {
+		IComponent* component;
+		unsigned int last = 0;
+		for(unsigned int i = 0; i < components.size(); ++i) {
+			component = components[i];
+			if(component == NULL)
+				continue;
+
+			if( component->isActivated() && !(fixed ? component->fixedTick(msecs) : component->tick(msecs)) )
+				continue;
+
+			components[last++] = component;
+		}
+		components.resize(last);
+	}
+
+	//--------------------------------------------------------
+
 	void CMap::addEntity(CEntity *entity) {
 		TEntityID entityId = entity->getEntityID();
 		// Aadimos la entidad si no existia
 		if( _entityInfoTable.find(entityId) == _entityInfoTable.end() ) {
-			// Insertamos las entidades en la listas que vamos a usar para recorrer
-			// y nos apuntamos el iterador (que nos hara falta mas tarde para los
-			// borrados).
-			_entitiesWithTick.push_front(entity);
-			std::list<CEntity*>::const_iterator tickIt = _entitiesWithTick.begin();
-
-			_entitiesWithFixedTick.push_front(entity);
-			std::list<CEntity*>::const_iterator fixedTickIt = _entitiesWithFixedTick.begin();
+			// Insertamos las entidades en los arrays que vamos a usar para
+			// recorrer; ellas solas se desapuntaran si no quieren ticks
+			_entitiesWithTick.push_back(entity);
+			_entitiesWithFixedTick.push_back(entity);
 
 			EntityInfo info;
 			info._entityPtr = entity;
-			info._tickIterator = tickIt;
-			info._fixedTickIterator = fixedTickIt;
+			info._wantsTick = true;
+			info._wantsFixedTick = true;
 
 			_entityInfoTable.insert( pair<TEntityID, EntityInfo>(entityId, info) );
 			//std::cout << "aadiendo al mapa " << entity->getName() << std::endl;
+
+			// A partir de ahora la transformacion buena es la del almacen
+			entity->_transformIndex = _transforms.add(entity, entity->_position, entity->_orientation);
+			entity->_transforms = &_transforms;
+
+			// Indices por nombre, tipo y posicion
+			unsigned int typeId = getTypeId( entity->getType() );
+			_entitiesByName[ entity->getName() ][entityId] = entity;
+			_entitiesByType[typeId][entityId] = entity;
+			_spatialIndex.add( entity, entity->getPosition(), typeId );
+
+			// Los componentes con tick por lotes se apuntan en el lote de su
+			// tipo en lugar de en la entidad
+			for(auto it = entity->_components.begin(); it != entity->_components.end(); ++it) {
+				if( (*it)->hasBatchedTick() ) {
+					wantsBatchedTick(*it);
+					wantsBatchedFixedTick(*it);
+				}
+			}
 		}
 	} // addEntity
 
@@ -312,14 +399,41 @@ namespace Logic {
 			if(info._entityPtr->isActivated())
 				info._entityPtr->deactivate();
 
+			// Quitamos sus componentes de los lotes antes de soltar el mapa
+			for(auto compIt = entity->_components.begin(); compIt != entity->_components.end(); ++compIt) {
+				if( (*compIt)->hasBatchedTick() )
+					removeBatchedComponent(*compIt);
+			}
+
 			info._entityPtr->_map = NULL;
 
-			// Borramos el elemento de cada lista en la que este
-			// presente
-			if( info._tickIterator != _entitiesWithTick.end() ) 
-				_entitiesWithTick.erase(info._tickIterator);
-			if( info._fixedTickIterator != _entitiesWithFixedTick.end() ) 
-				_entitiesWithFixedTick.erase(info._fixedTickIterator);
+			// Anulamos la entidad en cada array en el que este presente; se
+			// quitara al compactar (puede que estemos dentro de un tick)
+			if(info._wantsTick)
+				std::replace(_entitiesWithTick.begin(), _entitiesWithTick.end(), entity, (CEntity*)NULL);
+			if(info._wantsFixedTick)
+				std::replace(_entitiesWithFixedTick.begin(), _entitiesWithFixedTick.end(), entity, (CEntity*)NULL);
+
+			detachTransform(entity);
+
+			// La factoria puede reciclar la entidad, no puede quedar un
+			// cronometro de autodestruccion apuntandola
+			for(auto timeoutIt = _entitiesWithTimeout.begin(); timeoutIt != _entitiesWithTimeout.end(); ) {
+				if(timeoutIt->first == entity)
+					timeoutIt = _entitiesWithTimeout.erase(timeoutIt);
+				else
+					++timeoutIt;
+			}
+
+			_spatialIndex.remove(entity);
+			_entitiesByType[ getTypeId( entity->getType() ) ].erase( entity->getEntityID() );
+
+			auto nameIt = _entitiesByName.find( entity->getName() );
+			if( nameIt != _entitiesByName.end() ) {
+				nameIt->second.erase( entity->getEntityID() );
+				if( nameIt->second.empty() )
+					_entitiesByName.erase(nameIt);
+			}
 
 			_entityInfoTable.erase(it);
 		}
@@ -330,6 +444,9 @@ namespace Logic {
 	void CMap::destroyAllEntities() {
 		CEntityFactory* entityFactory = CEntityFactory::getSingletonPtr();
 
+		// El indice espacial toca las entidades, hay que vaciarlo antes
+		_spatialIndex.clear();
+
 		auto it = _entityInfoTable.begin();
 		auto end = _entityInfoTable.end();
 
@@ -344,14 +461,45 @@ namespace Logic {
 				info._entityPtr->deactivate();
 			}
 
+			info._entityPtr->_transforms = NULL;
+			info._entityPtr->_transformIndex = CTransformStore::INVALID_INDEX;
+
 			delete info._entityPtr;
 		}
 
 		_entityInfoTable.clear();
+		_entitiesWithTick.clear();
+		_entitiesWithFixedTick.clear();
+		_transforms.clear();
+
+		// Los ids de tipo se conservan: puede haber mascaras ya calculadas
+		_entitiesByName.clear();
+		for(unsigned int type = 0; type < _entitiesByType.size(); ++type)
+			_entitiesByType[type].clear();
+
+		for(unsigned int type = 0; type < _batchedTick.size(); ++type) {
+			_batchedTick[type].clear();
+			_batchedFixedTick[type].clear();
+		}
 	} // removeEntity
 
 	//--------------------------------------------------------
 
+	void CMap::detachTransform(CEntity* entity) {
+		if(entity->_transforms != &_transforms)
+			return;
+
+		entity->_position = _transforms.getPosition(entity->_transformIndex);
+		entity->_orientation = _transforms.getOrientation(entity->_transformIndex);
+
+		_transforms.remove(entity->_transformIndex);
+
+		entity->_transforms = NULL;
+		entity->_transformIndex = CTransformStore::INVALID_INDEX;
+	} // detachTransform
+
+	//--------------------------------------------------------
+
 	CEntity* CMap::getEntityByID(TEntityID entityID) {
 		auto it = _entityInfoTable.find(entityID);
 		return it != _entityInfoTable.end() ? it->second._entityPtr : NULL;
@@ -360,59 +508,78 @@ namespace Logic {
 	//--------------------------------------------------------
 
 	CEntity* CMap::getEntityByName(const std::string &name, CEntity *start) {
-		auto it = _entityInfoTable.begin();
-		auto end = _entityInfoTable.end();
-
-		// Si se defini entidad desde la que comenzar la bsqueda 
-		// cogemos su posicin y empezamos desde la siguiente.
-		if (start) {
-			it = _entityInfoTable.find( start->getEntityID() );
-			// si la entidad no existe devolvemos NULL.
-			if(it == end) return NULL;
-			
-			++it;
-		}
-		else
-			it = _entityInfoTable.begin();
-
-		for(; it != end; ++it) {
-			// si hay coincidencia de nombres devolvemos la entidad.
-			if (!it->second._entityPtr->getName().compare(name))
-				return it->second._entityPtr;
-		}
-		
-		// si no se encontr la entidad devolvemos NULL.
-		return NULL;
+		auto it = _entitiesByName.find(name);
+		if( it == _entitiesByName.end() )
+			return NULL;
 
+		return getNextEntity(it->second, start);
 	} // getEntityByName
 
 	//--------------------------------------------------------
 
 	CEntity* CMap::getEntityByType(const std::string &type, CEntity *start) {
-		auto it = _entityInfoTable.begin();
-		auto end = _entityInfoTable.end();
+		auto it = _typeIds.find(type);
+		if( it == _typeIds.end() )
+			return NULL;
 
-		// Si se defini entidad desde la que comenzar la bsqueda 
-		// cogemos su posicin y empezamos desde la siguiente.
-		if (start) {
-			it = _entityInfoTable.find( start->getEntityID() );
-			// si la entidad no existe devolvemos NULL.
-			if(it == end) return NULL;
-			
-			++it;
-		}
-		else
-			it = _entityInfoTable.begin();
+		return getNextEntity(_entitiesByType[it->second], start);
+	} // getEntityByType
 
-		for(; it != end; ++it) {
-			// si hay coincidencia de nombres devolvemos la entidad.
-			if (!it->second._entityPtr->getType().compare(type))
-				return it->second._entityPtr;
-		}
-		// si no se encontr la entidad devolvemos NULL.
-		return 0;
+	//--------------------------------------------------------
 
-	} // getEntityByType
+	CEntity* CMap::getNextEntity(const TEntityIdTable &entities, CEntity *start) {
+		if(start == NULL)
+			return entities.empty() ? NULL : entities.begin()->second;
+
+		// Como en la busqueda lineal, si start no esta en el mapa no hay siguiente
+		if( _entityInfoTable.find( start->getEntityID() ) == _entityInfoTable.end() )
+			return NULL;
+
+		auto it = entities.upper_bound( start->getEntityID() );
+		return it != entities.end() ? it->second : NULL;
+	} // getNextEntity
+
+	//--------------------------------------------------------
+
+	unsigned int CMap::getTypeId(const std::string &type) {
+		auto it = _typeIds.find(type);
+		if( it != _typeIds.end() )
+			return it->second;
+
+		unsigned int typeId = _entitiesByType.size();
+		assert(typeId < MAX_ENTITY_TYPES && "Demasiados tipos de entidad distintos en el mapa");
+
+		_typeIds[type] = typeId;
+		_entitiesByType.push_back( TEntityIdTable() );
+
+		return typeId;
+	} // getTypeId
+
+	//--------------------------------------------------------
+
+	TEntityTypeMask CMap::getTypeMask(const std::string &type) {
+		TEntityTypeMask mask;
+		mask.set( getTypeId(type) );
+		return mask;
+	} // getTypeMask
+
+	//--------------------------------------------------------
+
+	void CMap::getEntitiesInRadius(const Vector3 &center, float radius, std::vector<CEntity*> &entities, const TEntityTypeMask &types) const {
+		_spatialIndex.queryRadius(center, radius, types, entities);
+	} // getEntitiesInRadius
+
+	//--------------------------------------------------------
+
+	void CMap::getEntitiesInBox(const Vector3 &min, const Vector3 &max, std::vector<CEntity*> &entities, const TEntityTypeMask &types) const {
+		_spatialIndex.queryBox(min, max, types, entities);
+	} // getEntitiesInBox
+
+	//--------------------------------------------------------
+
+	void CMap::getEntitiesInFrustum(const Ogre::Plane *planes, unsigned int nbPlanes, std::vector<CEntity*> &entities, const TEntityTypeMask &types) const {
+		_spatialIndex.queryFrustum(planes, nbPlanes, types, entities);
+	} // getEntitiesInFrustum
 
 	//--------------------------------------------------------
 	//--------------------------------------------------------
@@ -14,13 +14,17 @@ Contiene la declaraci
 #include <map>
 #include <set>
 #include <list>
+#include <vector>
 #include <unordered_map>
 #include "EntityID.h"
+#include "TransformStore.h"
+#include "SpatialIndex.h"
 
 // Predeclaracin de clases para ahorrar tiempo de compilacin
 namespace Logic 
 {
 	class CEntity;
+	class IComponent;
 }
 
 namespace Map
@@ -44,6 +48,15 @@ namespace Logic
 	puramente lgicas. Gestiona la activacin y desactivacin de stas y
 	tiene tambin mtodos para buscar entidades, tanto por su nombre como 
 	por su tipo y por su identificador.
+	<p>
+	Las bsquedas por nombre y por tipo van a travs de tablas hash, y las
+	entidades estn apuntadas en un CSpatialIndex para poder pedir las que
+	hay en una zona (esfera, caja o frustum) filtrando por tipo.
+	<p>
+	El mapa guarda adems las transformaciones de sus entidades en un
+	CTransformStore y ejecuta por lotes el tick de los componentes que lo
+	piden (ver IComponent::enableBatchedTick): primero hace el tick de las
+	entidades y despus, tipo a tipo, el de esos componentes.
 
 	@ingroup logicGroup
 	@ingroup mapGroup
@@ -101,11 +114,14 @@ namespace Logic
 		Funcin llamada en cada frame para que se realicen las funciones
 		de actualizacin adecuadas.
 		<p>
-		Llamar a los mtodos tick() de todas las entidades.
+		Llamar a los mtodos tick() de todas las entidades y despus al
+		tick de los componentes que lo tienen por lotes. Por ltimo da los
+		pasos de tick fijo que le indique el planificador de la aplicacin.
 
 		@param msecs Milisegundos transcurridos desde el ltimo tick.
+		@param fixedSteps Pasos de tick fijo que hay que dar en este frame.
 		*/
-		void tick(unsigned int msecs);
+		void tick(unsigned int msecs, unsigned int fixedSteps);
 
 		/**
 		Aade una nueva entidad al mapa. Si la entidad ya estaba incluida
@@ -165,6 +181,62 @@ namespace Logic
 		*/
 		CEntity *getEntityByType(const std::string &type, CEntity *start = 0);
 
+		/**
+		Devuelve el id que el mapa asigna a un tipo de entidad. Los ids se
+		dan en orden de aparicin y se mantienen mientras viva el mapa.
+
+		@param type Nombre del tipo.
+		@return Id del tipo.
+		*/
+		unsigned int getTypeId(const std::string &type);
+
+		/**
+		Devuelve la mscara con el bit de un tipo de entidad. Las mscaras de
+		varios tipos se combinan con |.
+
+		@param type Nombre del tipo.
+		@return Mscara del tipo.
+		*/
+		TEntityTypeMask getTypeMask(const std::string &type);
+
+		/** Mscara que acepta todos los tipos de entidad. */
+		static TEntityTypeMask allTypes() { return TEntityTypeMask().set(); }
+
+		/**
+		Devuelve las entidades cuya posicin est dentro de una esfera.
+
+		@param center Centro de la esfera.
+		@param radius Radio de la esfera.
+		@param entities Parmetro de salida; las entidades se aaden al final.
+		@param types Tipos de entidad que interesan (por defecto todos).
+		*/
+		void getEntitiesInRadius(const Vector3 &center, float radius, std::vector<CEntity*> &entities, 
+								 const TEntityTypeMask &types = allTypes()) const;
+
+		/**
+		Devuelve las entidades cuya posicin est dentro de una caja alineada
+		con los ejes.
+
+		@param min Esquina mnima de la caja.
+		@param max Esquina mxima de la caja.
+		@param entities Parmetro de salida; las entidades se aaden al final.
+		@param types Tipos de entidad que interesan (por defecto todos).
+		*/
+		void getEntitiesInBox(const Vector3 &min, const Vector3 &max, std::vector<CEntity*> &entities, 
+							  const TEntityTypeMask &types = allTypes()) const;
+
+		/**
+		Devuelve las entidades cuya posicin est dentro de un frustum.
+
+		@param planes Planos del frustum, con las normales hacia dentro
+		(ver Ogre::Frustum::getFrustumPlanes).
+		@param nbPlanes Nmero de planos.
+		@param entities Parmetro de salida; las entidades se aaden al final.
+		@param types Tipos de entidad que interesan (por defecto todos).
+		*/
+		void getEntitiesInFrustum(const Ogre::Plane *planes, unsigned int nbPlanes, std::vector<CEntity*> &entities, 
+								  const TEntityTypeMask &types = allTypes()) const;
+
 		/**
 		Devuelve la escena grfica correspondiente a este mapa.
 
@@ -172,6 +244,14 @@ namespace Logic
 		*/
 		Graphics::CScene *getScene() {
 			return _scene;}
+
+		/**
+		Devuelve el almacn con las transformaciones de las entidades del
+		mapa. Sirve para recorrerlas todas sin pasar por cada entidad.
+
+		@return Almacn de transformaciones.
+		*/
+		const CTransformStore& getTransforms() const { return _transforms; }
 		
 		std::string getMapName(){return _name;}
 
@@ -203,32 +283,127 @@ namespace Logic
 
 		void setFixedTimeStep(unsigned int stepSize);
 
+		/** Devuelve los milisegundos que dura cada paso del tick fijo. */
+		unsigned int getFixedTimeStep() const { return _fixedTimeStep; }
+
+		/**
+		Devuelve el nmero de pasos de tick fijo ejecutados desde que se
+		activ el mapa. Sirve como reloj de la simulacin.
+		*/
+		unsigned int getFixedTickCount() const { return _fixedTickCount; }
+
 		void wantsTick(CEntity* entity);
 
 		void wantsFixedTick(CEntity* entity);
 
+		/**
+		Apunta un componente con tick por lotes en el lote de su tipo.
+
+		@param component Componente que quiere tick.
+		*/
+		void wantsBatchedTick(IComponent* component);
+
+		/**
+		Apunta un componente con tick por lotes en el lote de fixed tick de
+		su tipo.
+
+		@param component Componente que quiere fixed tick.
+		*/
+		void wantsBatchedFixedTick(IComponent* component);
+
+		/**
+		Quita un componente con tick por lotes de los lotes de su tipo.
+
+		@param component Componente a quitar.
+		*/
+		void removeBatchedComponent(IComponent* component);
+
 	private:
 
+		/** Array de entidades. */
+		typedef std::vector<CEntity*> TEntityArray;
+
+		/** Array de componentes. */
+		typedef std::vector<IComponent*> TComponentArray;
+
 		void checkTimeouts(unsigned int msecs);
 
 		void processComponentMessages();
 
 		void doTick(unsigned int msecs);
 
-		void doFixedTick(unsigned int msecs);
+		void doFixedTick(unsigned int steps);
+
+		/**
+		Ejecuta un lote de componentes, compactando el array sobre la marcha
+		igual que hace la entidad con los suyos.
+
+		@param components Componentes del lote.
+		@param msecs Milisegundos que se pasan al tick.
+		@param fixed true para llamar a fixedTick en lugar de a tick.
+		*/
+		void tickBatch(TComponentArray& components, unsigned int msecs, bool fixed);
+
+		/**
+		Devuelve la transformacin de la entidad al propio objeto y la quita
+		del almacn del mapa.
+
+		@param entity Entidad a la que quitar la transformacin.
+		*/
+		void detachTransform(CEntity* entity);
+
+		/** Entidades ordenadas por id, para recorrer las de un nombre o tipo. */
+		typedef std::map<TEntityID, CEntity*> TEntityIdTable;
+
+		/**
+		Devuelve la primera entidad de una tabla, o la siguiente a start si se
+		da. Si start no est en el mapa devuelve NULL.
+		*/
+		CEntity* getNextEntity(const TEntityIdTable &entities, CEntity *start);
 
 		struct EntityInfo {
 			CEntity* _entityPtr;
-			std::list<CEntity*>::const_iterator _tickIterator;
-			std::list<CEntity*>::const_iterator _fixedTickIterator;
+			/** true si la entidad est en _entitiesWithTick. */
+			bool _wantsTick;
+			/** true si la entidad est en _entitiesWithFixedTick. */
+			bool _wantsFixedTick;
 		};
 
 		//std::unordered_map<TEntityID, EntityInfo> _entityInfoTable;
 		std::map<TEntityID, EntityInfo> _entityInfoTable;
 
-		//std::list<CEntity*> _entityList;
-		std::list<CEntity*> _entitiesWithTick;
-		std::list<CEntity*> _entitiesWithFixedTick;
+		/**
+		Entidades que quieren tick. Se recorre por ndice y se compacta
+		durante el propio tick; las entidades que se quitan se ponen a NULL.
+		*/
+		TEntityArray _entitiesWithTick;
+
+		/** Entidades que quieren fixed tick. Igual que _entitiesWithTick. */
+		TEntityArray _entitiesWithFixedTick;
+
+		/**
+		Lotes de componentes con tick por lotes, indexados por TComponentID.
+		Se dimensiona al crear el mapa con el nmero de tipos registrados.
+		*/
+		std::vector<TComponentArray> _batchedTick;
+
+		/** Lotes de componentes con fixed tick por lotes. Igual que _batchedTick. */
+		std::vector<TComponentArray> _batchedFixedTick;
+
+		/** Transformaciones de las entidades del mapa. */
+		CTransformStore _transforms;
+
+		/** ndice espacial de las entidades del mapa. */
+		CSpatialIndex _spatialIndex;
+
+		/** Entidades por nombre. */
+		std::unordered_map<std::string, TEntityIdTable> _entitiesByName;
+
+		/** Ids de los tipos de entidad. */
+		std::unordered_map<std::string, unsigned int> _typeIds;
+
+		/** Entidades por tipo, indexadas por id de tipo. */
+		std::vector<TEntityIdTable> _entitiesByType;
 
 		/**
 		Lista de entidades que han sido marcadas para ser borradas en
@@ -264,8 +439,8 @@ namespace Logic
 		*/
 		unsigned int _fixedTimeStep;
 
-		/** Tiempo acumulado a tener en cuenta para el tick fijo. */
-		unsigned int _acumTime;
+		/** Pasos de tick fijo ejecutados desde la activacin del mapa. */
+		unsigned int _fixedTickCount;
 
 	}; // class CMap
 
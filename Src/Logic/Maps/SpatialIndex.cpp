@@ -0,0 +1,256 @@
+//---------------------------------------------------------------------------
+// SpatialIndex.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file SpatialIndex.cpp
+
+Contiene la implementacin del ndice espacial de las entidades de un mapa.
+
+@see Logic::CSpatialIndex
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "SpatialIndex.h"
+#include "Logic/Entity/Entity.h"
+
+#include <cassert>
+
+namespace Logic {
+
+	const float CSpatialIndex::DEFAULT_CELL_SIZE = 32.0f;
+
+	namespace {
+		/** Bits por coordenada en la clave de una celda. */
+		const unsigned int CELL_BITS = 21;
+
+		/** Desplazamiento para que las coordenadas negativas quepan en CELL_BITS. */
+		const long long CELL_OFFSET = 1LL << (CELL_BITS - 1);
+
+		const long long CELL_MASK = (1LL << CELL_BITS) - 1;
+	}
+
+	//________________________________________________________________________
+
+	CSpatialIndex::CSpatialIndex(float cellSize) : _cellSize(cellSize),
+												   _invCellSize(1.0f / cellSize) {
+
+		assert(cellSize > 0 && "El tamao de celda tiene que ser positivo");
+	} // CSpatialIndex
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::add(CEntity* entity, const Vector3& position, unsigned int typeId) {
+		assert(entity->_spatialIndex == NULL && "La entidad ya esta en un indice espacial");
+
+		TEntry entry;
+		entry.entity = entity;
+		entry.position = position;
+		entry.typeId = typeId;
+
+		insert( getCellKey(position), entry );
+		entity->_spatialIndex = this;
+	} // add
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::remove(CEntity* entity) {
+		assert(entity->_spatialIndex == this && "La entidad no esta en este indice espacial");
+
+		erase(entity);
+		entity->_spatialIndex = NULL;
+	} // remove
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::move(CEntity* entity, const Vector3& position) {
+		long long cellKey = getCellKey(position);
+
+		// Lo normal es que siga en la misma celda
+		if(cellKey == entity->_spatialCell) {
+			_cells[cellKey].entries[entity->_spatialSlot].position = position;
+			return;
+		}
+
+		TEntry entry = _cells[entity->_spatialCell].entries[entity->_spatialSlot];
+		entry.position = position;
+
+		erase(entity);
+		insert(cellKey, entry);
+	} // move
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::clear() {
+		for(TCellTable::iterator cellIt = _cells.begin(); cellIt != _cells.end(); ++cellIt) {
+			for(std::vector<TEntry>::iterator it = cellIt->second.entries.begin(); it != cellIt->second.entries.end(); ++it)
+				it->entity->_spatialIndex = NULL;
+		}
+
+		_cells.clear();
+	} // clear
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::queryRadius(const Vector3& center, float radius, const TEntityTypeMask& types, std::vector<CEntity*>& entities) const {
+		Vector3 extents(radius, radius, radius);
+		queryRange(center - extents, center + extents, &center, radius * radius, types, entities);
+	} // queryRadius
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::queryBox(const Vector3& min, const Vector3& max, const TEntityTypeMask& types, std::vector<CEntity*>& entities) const {
+		queryRange(min, max, NULL, 0, types, entities);
+	} // queryBox
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::queryFrustum(const Ogre::Plane* planes, unsigned int nbPlanes, const TEntityTypeMask& types, std::vector<CEntity*>& entities) const {
+		float halfCell = _cellSize * 0.5f;
+
+		for(TCellTable::const_iterator cellIt = _cells.begin(); cellIt != _cells.end(); ++cellIt) {
+			const TCell& cell = cellIt->second;
+			if( cell.entries.empty() )
+				continue;
+
+			// Descartamos la celda entera si queda fuera de algun plano
+			Vector3 cellCenter( (cell.x + 0.5f) * _cellSize, (cell.y + 0.5f) * _cellSize, (cell.z + 0.5f) * _cellSize );
+			bool outside = false;
+			for(unsigned int i = 0; i < nbPlanes && !outside; ++i) {
+				const Vector3& normal = planes[i].normal;
+				float projectedHalfSize = halfCell * ( fabs(normal.x) + fabs(normal.y) + fabs(normal.z) );
+				outside = normal.dotProduct(cellCenter) + planes[i].d < -projectedHalfSize;
+			}
+
+			if(outside)
+				continue;
+
+			for(std::vector<TEntry>::const_iterator it = cell.entries.begin(); it != cell.entries.end(); ++it) {
+				if( !types.test(it->typeId) )
+					continue;
+
+				bool inside = true;
+				for(unsigned int i = 0; i < nbPlanes && inside; ++i)
+					inside = planes[i].normal.dotProduct(it->position) + planes[i].d >= 0;
+
+				if(inside)
+					entities.push_back(it->entity);
+			}
+		}
+	} // queryFrustum
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::queryRange(const Vector3& min, const Vector3& max, const Vector3* center, float sqrRadius,
+								   const TEntityTypeMask& types, std::vector<CEntity*>& entities) const {
+
+		int minX = getCell(min.x), minY = getCell(min.y), minZ = getCell(min.z);
+		int maxX = getCell(max.x), maxY = getCell(max.y), maxZ = getCell(max.z);
+
+		// Si el volumen cubre mas celdas de las que hay ocupadas es mas barato
+		// recorrer las ocupadas
+		double rangeCells = (double)(maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+		bool scanAll = rangeCells > (double)_cells.size();
+
+		TCellTable::const_iterator cellIt = _cells.begin();
+		int x = minX, y = minY, z = minZ;
+
+		while(true) {
+			const TCell* cell = NULL;
+
+			if(scanAll) {
+				if( cellIt == _cells.end() )
+					break;
+
+				cell = &cellIt->second;
+				++cellIt;
+
+				if(cell->x < minX || cell->x > maxX || cell->y < minY || cell->y > maxY || cell->z < minZ || cell->z > maxZ)
+					continue;
+			}
+			else {
+				if(x > maxX)
+					break;
+
+				TCellTable::const_iterator found = _cells.find( getCellKey(x, y, z) );
+				if( found != _cells.end() )
+					cell = &found->second;
+
+				// Siguiente celda del rango
+				if(++z > maxZ) {
+					z = minZ;
+					if(++y > maxY) {
+						y = minY;
+						++x;
+					}
+				}
+
+				if(cell == NULL)
+					continue;
+			}
+
+			for(std::vector<TEntry>::const_iterator it = cell->entries.begin(); it != cell->entries.end(); ++it) {
+				if( !types.test(it->typeId) )
+					continue;
+
+				const Vector3& position = it->position;
+				if(position.x < min.x || position.x > max.x || position.y < min.y || position.y > max.y || position.z < min.z || position.z > max.z)
+					continue;
+
+				if( center != NULL && position.squaredDistance(*center) > sqrRadius )
+					continue;
+
+				entities.push_back(it->entity);
+			}
+		}
+	} // queryRange
+
+	//________________________________________________________________________
+
+	long long CSpatialIndex::getCellKey(int x, int y, int z) {
+		return ( ((x + CELL_OFFSET) & CELL_MASK) << (2 * CELL_BITS) ) |
+			   ( ((y + CELL_OFFSET) & CELL_MASK) << CELL_BITS ) |
+			   ( (z + CELL_OFFSET) & CELL_MASK );
+	} // getCellKey
+
+	//________________________________________________________________________
+
+	long long CSpatialIndex::getCellKey(const Vector3& position) const {
+		return getCellKey( getCell(position.x), getCell(position.y), getCell(position.z) );
+	} // getCellKey
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::insert(long long cellKey, const TEntry& entry) {
+		TCell& cell = _cells[cellKey];
+		if( cell.entries.empty() ) {
+			// Celda nueva (o vacia): la clave determina sus coordenadas
+			cell.x = getCell(entry.position.x);
+			cell.y = getCell(entry.position.y);
+			cell.z = getCell(entry.position.z);
+		}
+
+		entry.entity->_spatialCell = cellKey;
+		entry.entity->_spatialSlot = cell.entries.size();
+		cell.entries.push_back(entry);
+	} // insert
+
+	//________________________________________________________________________
+
+	void CSpatialIndex::erase(CEntity* entity) {
+		std::vector<TEntry>& entries = _cells[entity->_spatialCell].entries;
+		unsigned int slot = entity->_spatialSlot;
+
+		// Movemos la ultima entrada al hueco para no dejar agujeros
+		unsigned int last = entries.size() - 1;
+		if(slot != last) {
+			entries[slot] = entries[last];
+			entries[slot].entity->_spatialSlot = slot;
+		}
+
+		entries.pop_back();
+	} // erase
+
+} // namespace Logic
@@ -0,0 +1,245 @@
+//---------------------------------------------------------------------------
+// SpatialIndex.h
+//---------------------------------------------------------------------------
+
+/**
+@file SpatialIndex.h
+
+Contiene la declaracin del ndice espacial de las entidades de un mapa.
+
+@see Logic::CSpatialIndex
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_SpatialIndex_H
+#define __Logic_SpatialIndex_H
+
+#include "BaseSubsystems/Math.h"
+
+#include <OgrePlane.h>
+
+#include <bitset>
+#include <cmath>
+#include <vector>
+#include <unordered_map>
+
+// Predeclaracin de clases para ahorrar tiempo de compilacin
+namespace Logic {
+	class CEntity;
+}
+
+namespace Logic {
+
+	/** Nmero mximo de tipos de entidad distintos en un mapa. */
+	const unsigned int MAX_ENTITY_TYPES = 128;
+
+	/**
+	Mscara de tipos de entidad. El bit i corresponde al tipo con id i
+	(ver CMap::getTypeMask).
+	*/
+	typedef std::bitset<MAX_ENTITY_TYPES> TEntityTypeMask;
+
+	/**
+	ndice espacial de las entidades de un mapa: una rejilla uniforme en
+	3D guardada en una tabla hash, de modo que solo ocupan memoria las
+	celdas en las que hay alguna entidad.
+	<p>
+	Cada entidad se apunta en la celda que contiene su posicin. La entidad
+	guarda en qu celda y en qu hueco est, as que moverla, quitarla o
+	cambiarla de celda no requiere buscarla. CEntity::setPosition avisa al
+	ndice en cada movimiento y solo se toca la rejilla si cambia de celda.
+	<p>
+	Las consultas (esfera, caja alineada y frustum) recorren solo las celdas
+	que tocan el volumen y prueban la posicin de cada entidad, filtrando
+	por una mscara de tipos. Las entidades se tratan como puntos: quien
+	necesite tener en cuenta su tamao debe agrandar el volumen.
+
+	@ingroup logicGroup
+	@ingroup mapGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CSpatialIndex {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Tamao de celda por defecto (en unidades lgicas). */
+		static const float DEFAULT_CELL_SIZE;
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/**
+		Constructor.
+
+		@param cellSize Lado de las celdas de la rejilla.
+		*/
+		CSpatialIndex(float cellSize = DEFAULT_CELL_SIZE);
+
+
+		// =======================================================================
+		//                           METODOS PUBLICOS
+		// =======================================================================
+
+
+		/**
+		Apunta una entidad en el ndice.
+
+		@param entity Entidad a apuntar.
+		@param position Posicin de la entidad.
+		@param typeId Id del tipo de la entidad.
+		*/
+		void add(CEntity* entity, const Vector3& position, unsigned int typeId);
+
+		//________________________________________________________________________
+
+		/** Quita una entidad del ndice. */
+		void remove(CEntity* entity);
+
+		//________________________________________________________________________
+
+		/**
+		Actualiza la posicin de una entidad del ndice.
+
+		@param entity Entidad que se ha movido.
+		@param position Nueva posicin.
+		*/
+		void move(CEntity* entity, const Vector3& position);
+
+		//________________________________________________________________________
+
+		/** Vaca el ndice. */
+		void clear();
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve las entidades que estn dentro de una esfera.
+
+		@param center Centro de la esfera.
+		@param radius Radio de la esfera.
+		@param types Tipos de entidad que interesan.
+		@param entities Parmetro de salida; se aaden al final.
+		*/
+		void queryRadius(const Vector3& center, float radius, const TEntityTypeMask& types, std::vector<CEntity*>& entities) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve las entidades que estn dentro de una caja alineada con los
+		ejes.
+
+		@param min Esquina mnima de la caja.
+		@param max Esquina mxima de la caja.
+		@param types Tipos de entidad que interesan.
+		@param entities Parmetro de salida; se aaden al final.
+		*/
+		void queryBox(const Vector3& min, const Vector3& max, const TEntityTypeMask& types, std::vector<CEntity*>& entities) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve las entidades que estn dentro de un volumen convexo
+		delimitado por planos (tpicamente los 6 del frustum de una cmara).
+		Las normales de los planos tienen que apuntar hacia dentro, como las
+		de Ogre::Frustum::getFrustumPlanes.
+
+		@param planes Planos del volumen.
+		@param nbPlanes Nmero de planos.
+		@param types Tipos de entidad que interesan.
+		@param entities Parmetro de salida; se aaden al final.
+		*/
+		void queryFrustum(const Ogre::Plane* planes, unsigned int nbPlanes, const TEntityTypeMask& types, std::vector<CEntity*>& entities) const;
+
+	private:
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/**
+		Entidad apuntada en una celda. Se copia la posicin para no tener
+		que ir a la entidad al filtrar.
+		*/
+		struct TEntry {
+			CEntity* entity;
+			Vector3 position;
+			unsigned int typeId;
+		};
+
+		/** Celda de la rejilla. */
+		struct TCell {
+			/** Coordenadas de la celda. */
+			int x, y, z;
+			std::vector<TEntry> entries;
+		};
+
+		typedef std::unordered_map<long long, TCell> TCellTable;
+
+
+		// =======================================================================
+		//                            METODOS PRIVADOS
+		// =======================================================================
+
+
+		/** Devuelve la coordenada de celda de una coordenada del mundo. */
+		int getCell(float coordinate) const { return (int)floor(coordinate * _invCellSize); }
+
+		/** Devuelve la clave de la celda (x, y, z). */
+		static long long getCellKey(int x, int y, int z);
+
+		/** Devuelve la clave de la celda que contiene una posicin. */
+		long long getCellKey(const Vector3& position) const;
+
+		/** Apunta una entrada en una celda y se lo dice a su entidad. */
+		void insert(long long cellKey, const TEntry& entry);
+
+		/**
+		Recorre las celdas que tocan una caja y aade las entidades que caen
+		dentro de ella y, si se da, dentro de una esfera.
+
+		@param min Esquina mnima de la caja.
+		@param max Esquina mxima de la caja.
+		@param center Centro de la esfera o NULL si solo cuenta la caja.
+		@param sqrRadius Cuadrado del radio de la esfera.
+		@param types Tipos de entidad que interesan.
+		@param entities Parmetro de salida; se aaden al final.
+		*/
+		void queryRange(const Vector3& min, const Vector3& max, const Vector3* center, float sqrRadius, 
+						const TEntityTypeMask& types, std::vector<CEntity*>& entities) const;
+
+		/** Quita la entrada de una entidad de su celda. */
+		void erase(CEntity* entity);
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Celdas ocupadas (o que lo han estado) de la rejilla. */
+		TCellTable _cells;
+
+		/** Lado de las celdas y su inverso. */
+		float _cellSize;
+		float _invCellSize;
+
+	}; // class CSpatialIndex
+
+} // namespace Logic
+
+#endif // __Logic_SpatialIndex_H
@@ -0,0 +1,66 @@
+//---------------------------------------------------------------------------
+// TransformStore.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file TransformStore.cpp
+
+Contiene la implementacin del almacn de transformaciones de las
+entidades de un mapa.
+
+@see Logic::CTransformStore
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "TransformStore.h"
+#include "Logic/Entity/Entity.h"
+
+#include <cassert>
+
+namespace Logic {
+
+	CTransformStore::CTransformStore() {
+		// Nada que hacer
+	} // CTransformStore
+
+	//________________________________________________________________________
+
+	unsigned int CTransformStore::add(CEntity* entity, const Vector3& position, const Quaternion& orientation) {
+		_positions.push_back(position);
+		_orientations.push_back(orientation);
+		_entities.push_back(entity);
+
+		return _positions.size() - 1;
+	} // add
+
+	//________________________________________________________________________
+
+	void CTransformStore::remove(unsigned int index) {
+		assert(index < _positions.size() && "Indice de transformacion fuera de rango");
+
+		// Movemos la ultima transformacion al hueco para no dejar agujeros
+		unsigned int last = _positions.size() - 1;
+		if(index != last) {
+			_positions[index] = _positions[last];
+			_orientations[index] = _orientations[last];
+			_entities[index] = _entities[last];
+
+			_entities[index]->_transformIndex = index;
+		}
+
+		_positions.pop_back();
+		_orientations.pop_back();
+		_entities.pop_back();
+	} // remove
+
+	//________________________________________________________________________
+
+	void CTransformStore::clear() {
+		_positions.clear();
+		_orientations.clear();
+		_entities.clear();
+	} // clear
+
+} // namespace Logic
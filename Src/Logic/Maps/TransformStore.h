@@ -0,0 +1,164 @@
+//---------------------------------------------------------------------------
+// TransformStore.h
+//---------------------------------------------------------------------------
+
+/**
+@file TransformStore.h
+
+Contiene la declaracin del almacn de transformaciones de las entidades
+de un mapa.
+
+@see Logic::CTransformStore
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_TransformStore_H
+#define __Logic_TransformStore_H
+
+#include "BaseSubsystems/Math.h"
+
+#include <vector>
+#include <cstddef>
+
+// Predeclaracin de clases para ahorrar tiempo de compilacin
+namespace Logic {
+	class CEntity;
+}
+
+namespace Logic {
+
+	/**
+	Almacn de las transformaciones (posicin y orientacin) de todas las
+	entidades de un mapa, guardadas como estructura de arrays: un array de
+	posiciones, otro de orientaciones y otro con la entidad duea de cada
+	posicin.
+	<p>
+	Los arrays se mantienen compactos. Al quitar una transformacin se
+	mueve la ltima a su hueco y se actualiza el ndice de la entidad
+	movida, as que los ndices de una entidad pueden cambiar mientras est
+	en el mapa; fuera de CEntity no deben guardarse.
+	<p>
+	La idea es que quien necesite recorrer las transformaciones de todas
+	las entidades (snapshots, relevancia, consultas espaciales...) lo haga
+	sobre los arrays en lugar de ir entidad por entidad.
+
+	@ingroup logicGroup
+	@ingroup mapGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CTransformStore {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** ndice de las entidades que no estn en ningn almacn. */
+		static const unsigned int INVALID_INDEX = 0xFFFFFFFF;
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CTransformStore();
+
+
+		// =======================================================================
+		//                           METODOS PUBLICOS
+		// =======================================================================
+
+
+		/**
+		Reserva una transformacin para una entidad.
+
+		@param entity Entidad duea de la transformacin.
+		@param position Posicin inicial.
+		@param orientation Orientacin inicial.
+		@return ndice de la transformacin.
+		*/
+		unsigned int add(CEntity* entity, const Vector3& position, const Quaternion& orientation);
+
+		//________________________________________________________________________
+
+		/**
+		Libera una transformacin. La ltima transformacin del almacn pasa
+		a ocupar su ndice y se avisa a su entidad.
+
+		@param index ndice de la transformacin a liberar.
+		*/
+		void remove(unsigned int index);
+
+		//________________________________________________________________________
+
+		/** Vaca el almacn. */
+		void clear();
+
+		//________________________________________________________________________
+
+		/** Devuelve el nmero de transformaciones del almacn. */
+		unsigned int size() const { return _positions.size(); }
+
+		//________________________________________________________________________
+
+		/** Devuelve la posicin guardada en el ndice dado. */
+		Vector3& getPosition(unsigned int index) { return _positions[index]; }
+
+		/** Devuelve la posicin guardada en el ndice dado. */
+		const Vector3& getPosition(unsigned int index) const { return _positions[index]; }
+
+		//________________________________________________________________________
+
+		/** Devuelve la orientacin guardada en el ndice dado. */
+		Quaternion& getOrientation(unsigned int index) { return _orientations[index]; }
+
+		/** Devuelve la orientacin guardada en el ndice dado. */
+		const Quaternion& getOrientation(unsigned int index) const { return _orientations[index]; }
+
+		//________________________________________________________________________
+
+		/** Devuelve la entidad duea de la transformacin del ndice dado. */
+		CEntity* getEntity(unsigned int index) const { return _entities[index]; }
+
+		//________________________________________________________________________
+
+		/** Devuelve el array de posiciones (size() elementos). */
+		const Vector3* getPositions() const { return _positions.empty() ? NULL : &_positions[0]; }
+
+		/** Devuelve el array de orientaciones (size() elementos). */
+		const Quaternion* getOrientations() const { return _orientations.empty() ? NULL : &_orientations[0]; }
+
+		/** Devuelve el array de entidades dueas (size() elementos). */
+		CEntity* const* getEntities() const { return _entities.empty() ? NULL : &_entities[0]; }
+
+	private:
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Posiciones de las entidades. */
+		std::vector<Vector3> _positions;
+
+		/** Orientaciones de las entidades. */
+		std::vector<Quaternion> _orientations;
+
+		/** Entidad duea de cada transformacin. */
+		std::vector<CEntity*> _entities;
+
+	}; // class CTransformStore
+
+} // namespace Logic
+
+#endif // __Logic_TransformStore_H
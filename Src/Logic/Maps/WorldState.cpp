@@ -323,9 +323,9 @@ namespace Logic {
 			addEntity(entity);
 			//deserialize entity messages
 			for(int j = 0; j < messageSize ; ++j){
-				int typeMessage;
+				TMessageID typeMessage;
 				//read message type
-				worldState.read( &typeMessage, sizeof(int) );
+				worldState.deserialize(typeMessage);
 
 				//deserialize message
 				std::shared_ptr<CMessage> messageReceived( Logic::CMessageFactory::getSingletonPtr()->create(typeMessage) );
@@ -17,6 +17,9 @@ Contiene el tipo de datos de un mensaje.
 #include "BaseSubsystems/Math.h"
 #include "Net/Buffer.h"
 #include "Logic/Entity/MessageFactory.h"
+#include "Logic/Messages/MessagePool.h"
+
+#include <bitset>
 
 // Predeclaraciones
 namespace Logic {
@@ -104,7 +107,29 @@ namespace Logic {
 			SPELL_HUNGRY				= 0x00000043,//67
 			KILL_STREAK					= 0X00000044,//68
 			PARTICLE_START				= 0x00000045,//69
-			PARTICLE_STOP				= 0x00000046 //70
+			PARTICLE_STOP				= 0x00000046,//70
+			PLAYER_INPUT				= 0x00000047,//71
+			PLAYER_STATE				= 0x00000048,//72
+			PROJECTILE_SPAWN			= 0x00000049,//73
+			PROJECTILE_IMPACT			= 0x0000004A,//74
+			PROJECTILE_RECALL			= 0x0000004B,//75
+
+			// Nmero de tipos de mensaje. Los nuevos tipos van antes de este valor
+			NB_MESSAGE_TYPES
+		};
+
+		/**
+		Identificadores de red de los mensajes que comparten tipo con otro
+		mensaje (como CMessageMouse, que es de tipo CONTROL). El resto de
+		mensajes usan su TMessageType como identificador de red. Se numeran a
+		continuacin del ltimo tipo para que la tabla de la factora siga
+		siendo densa.
+		*/
+		enum TExtraMessageID {
+			MOUSE_ID					= NB_MESSAGE_TYPES,
+
+			// Nmero total de identificadores de red
+			NB_MESSAGE_IDS
 		};
 	}
 
@@ -167,6 +192,9 @@ namespace Logic {
 	*/
 	typedef Message::TMessageType TMessageType;
 
+	/** Conjunto de tipos de mensaje (un bit por TMessageType). */
+	typedef std::bitset<Message::NB_MESSAGE_TYPES> TMessageTypeSet;
+
 	/**
 	Tipo copia para los mensajes de control. Por simplicidad.
 	*/
@@ -228,6 +256,10 @@ namespace Logic {
 	*/
 	#define DEC_FACTORYMESSAGE(Class) \
 	public: \
+		/** \
+		Identificador de red del mensaje. Es lo primero que se serializa. \
+		*/ \
+		static const TMessageID ID; \
 		/** \
 		Crea un componente de la clase en la que se declara. \
 		*/ \
@@ -241,8 +273,12 @@ namespace Logic {
 	Macro para la implementacin de los mtodos necesarios para que
 	la factoria cree nuevas instancias del tipo de componentes y
 	para que el componente se registre en la factora.
+	<p>
+	El identificador de red debe ser el TMessageType del mensaje o, si
+	comparte tipo con otro mensaje, uno de Message::TExtraMessageID.
 	*/
-	#define IMP_FACTORYMESSAGE(Class) \
+	#define IMP_FACTORYMESSAGE(Class, id) \
+	const TMessageID Class::ID = id; \
 	CMessage* Class::create() \
 	{ \
 		CMessage* res = new Class(); \
@@ -250,9 +286,9 @@ namespace Logic {
 	} \
 	bool Class::regist() \
 	{ \
-		if (!CMessageFactory::getSingletonPtr()->has(#Class)) \
+		if (!CMessageFactory::getSingletonPtr()->has(Class::ID)) \
 		{ \
-			CMessageFactory::getSingletonPtr()->add(Class::create, #Class); \
+			CMessageFactory::getSingletonPtr()->add(Class::create, Class::ID); \
 		} \
 		return true; \
 	}
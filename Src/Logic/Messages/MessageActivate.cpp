@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageActivate);
+	IMP_FACTORYMESSAGE(CMessageActivate, Message::ACTIVATE);
 
 	CMessageActivate::CMessageActivate() : CMessage(Message::ACTIVATE) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageActivate::serialize() {
 		Net::CBuffer buffer( sizeof(int) );
-		buffer.serialize( std::string("CMessageActivate"), true );
+		buffer.serialize( ID );
 		buffer.serialize(_activate);
 		
 		return buffer;
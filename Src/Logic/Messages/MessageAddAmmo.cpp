@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddAmmo);
+	IMP_FACTORYMESSAGE(CMessageAddAmmo, Message::ADD_AMMO);
 
 	CMessageAddAmmo::CMessageAddAmmo() : CMessage(Message::ADD_AMMO) {
 		// Nada que hacer
@@ -32,7 +32,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageAddAmmo::serialize() {
 		Net::CBuffer buffer( sizeof(int) + sizeof(_weapon) + sizeof(_ammo) );
-		buffer.serialize(std::string("CMessageAddAmmo"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_weapon);
 		buffer.serialize(_ammo);
 		
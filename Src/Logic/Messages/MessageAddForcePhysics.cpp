@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddForcePhysics);
+	IMP_FACTORYMESSAGE(CMessageAddForcePhysics, Message::ADD_FORCE_PHYSICS);
 
 	CMessageAddForcePhysics::CMessageAddForcePhysics() : CMessage(Message::ADD_FORCE_PHYSICS) {
 		// Nada que hacer
@@ -49,7 +49,7 @@ namespace Logic {
 		// Tamao de la cabecera (int) + tipo de fuerza (int) + Vector3 (float * 3)
 		// + booleano de gravedad (bool).
 		Net::CBuffer buffer( (sizeof(int) * 2) + (sizeof(float) * 3) + sizeof(bool) );
-		buffer.serialize(std::string("CMessageAddForcePhysics"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_force);
 		// No uso la funcion de serializar por ser un enumerado (que dan problemillas).
 		buffer.write(&_forceMode, sizeof(_forceMode));
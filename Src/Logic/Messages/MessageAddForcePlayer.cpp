@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddForcePlayer);
+	IMP_FACTORYMESSAGE(CMessageAddForcePlayer, Message::ADDFORCEPLAYER);
 
 	CMessageAddForcePlayer::CMessageAddForcePlayer() : CMessage(Message::ADDFORCEPLAYER) {
 		// Nada que hacer
@@ -23,7 +23,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageAddForcePlayer::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(float));
-		buffer.serialize(std::string("CMessageAddForcePlayer"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_force);
 
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddLife);
+	IMP_FACTORYMESSAGE(CMessageAddLife, Message::ADD_LIFE);
 
 	CMessageAddLife::CMessageAddLife() : CMessage(Message::ADD_LIFE) {
 		// Nada que hacer
@@ -23,7 +23,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageAddLife::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_life));
-		buffer.serialize(std::string("CMessageAddLife"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_life);
 		
 		return buffer;
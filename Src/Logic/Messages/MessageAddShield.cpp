@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddShield);
+	IMP_FACTORYMESSAGE(CMessageAddShield, Message::ADD_SHIELD);
 
 	CMessageAddShield::CMessageAddShield() : CMessage(Message::ADD_SHIELD) {
 		// Nada que hacer
@@ -23,7 +23,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageAddShield::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_shield));
-		buffer.serialize(std::string("CMessageAddShield"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_shield);
 		
 		return buffer;
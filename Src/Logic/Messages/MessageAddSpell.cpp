@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddSpell);
+	IMP_FACTORYMESSAGE(CMessageAddSpell, Message::ADD_SPELL);
 
 	CMessageAddSpell::CMessageAddSpell() : CMessage(Message::ADD_SPELL) {
 		// Nada que hacer
@@ -24,7 +24,7 @@ namespace Logic {
 	Net::CBuffer CMessageAddSpell::serialize() {
 		
 		Net::CBuffer buffer(sizeof(int) + sizeof(_spell));
-		buffer.serialize(std::string("CMessageAddSpell"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_spell);
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAddWeapon);
+	IMP_FACTORYMESSAGE(CMessageAddWeapon, Message::ADD_WEAPON);
 
 	CMessageAddWeapon::CMessageAddWeapon() : CMessage(Message::ADD_WEAPON) {
 		// Nada que hacer
@@ -33,7 +33,7 @@ namespace Logic {
 	Net::CBuffer CMessageAddWeapon::serialize() {
 		
 		Net::CBuffer buffer(sizeof(int) + sizeof(_weapon) + sizeof(_ammo));
-		buffer.serialize(std::string("CMessageAddWeapon"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_weapon);
 		buffer.serialize(_ammo);
 		
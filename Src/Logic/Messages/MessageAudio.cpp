@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageAudio);
+	IMP_FACTORYMESSAGE(CMessageAudio, Message::AUDIO);
 
 	CMessageAudio::CMessageAudio() : CMessage(Message::AUDIO),
 									 _play3d(false),
@@ -88,7 +88,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageAudio::serialize() {
 		Net::CBuffer buffer;
-		buffer.serialize( std::string("CMessageAudio"), true );
+		buffer.serialize( ID );
 
 		// Mandamos el nombre del fichero de audio que queremos
 		// reproducir como un entero (usando el CRC)
@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageBlockShoot);
+	IMP_FACTORYMESSAGE(CMessageBlockShoot, Message::BLOCK_SHOOT);
 
 	CMessageBlockShoot::CMessageBlockShoot() : CMessage(Message::BLOCK_SHOOT),
 											   _canShoot(true) {
@@ -34,7 +34,7 @@ namespace Logic {
 	
 	Net::CBuffer CMessageBlockShoot::serialize() {
 		Net::CBuffer buffer( sizeof(int) + sizeof(bool) );
-		buffer.serialize(std::string("CMessageBlockShoot"), true);
+		buffer.serialize(ID);
 		buffer.write( &_canShoot, sizeof(bool) );
 		
 		return buffer;
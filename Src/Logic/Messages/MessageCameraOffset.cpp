@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageCameraOffset);
+	IMP_FACTORYMESSAGE(CMessageCameraOffset, Message::CAMERA_OFFSET);
 
 	CMessageCameraOffset::CMessageCameraOffset() : CMessage(Message::CAMERA_OFFSET) {
 		// Nada que hacer
@@ -30,7 +30,7 @@ namespace Logic {
 		Logic::TEntityID id = _entity->getEntityID();
 
 		Net::CBuffer buffer( sizeof(int) + sizeof(id) );
-		buffer.serialize(std::string("CMessageCameraOffset"), true);
+		buffer.serialize(ID);
 		buffer.serialize(id);
 		
 		return buffer;
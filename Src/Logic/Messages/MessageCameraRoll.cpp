@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageCameraRoll);
+	IMP_FACTORYMESSAGE(CMessageCameraRoll, Message::CAMERA_ROLL);
 
 	CMessageCameraRoll::CMessageCameraRoll() : CMessage(Message::CAMERA_ROLL) {
 		// Nada que hacer
@@ -30,7 +30,7 @@ namespace Logic {
 		Logic::TEntityID id = _entity->getEntityID();
 
 		Net::CBuffer buffer( sizeof(int) + sizeof(id) );
-		buffer.serialize(std::string("CMessageSetRelatedEntity"), true);
+		buffer.serialize(ID);
 		buffer.serialize(id);
 		
 		return buffer;
@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageCameraToEnemy);
+	IMP_FACTORYMESSAGE(CMessageCameraToEnemy, Message::CAMERA_TO_ENEMY);
 
 	CMessageCameraToEnemy::CMessageCameraToEnemy() : CMessage(Message::CAMERA_TO_ENEMY) {
 		// Nada que hacer
@@ -30,7 +30,7 @@ namespace Logic {
 	Net::CBuffer CMessageCameraToEnemy::serialize() {
 		
 		Net::CBuffer buffer(sizeof(int) + sizeof(Logic::TEntityID));
-		buffer.serialize(std::string("CMessageCameraToEnemy"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_entity->getEntityID());
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageChangeGravity);
+	IMP_FACTORYMESSAGE(CMessageChangeGravity, Message::CHANGE_GRAVITY);
 
 	CMessageChangeGravity::CMessageChangeGravity() : CMessage(Message::CHANGE_GRAVITY) {
 		// Nada que hacer
@@ -28,7 +28,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageChangeGravity::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_gravity));
-		buffer.serialize(std::string("CMessageChangeGravity"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_gravity);
 		
 		return buffer;
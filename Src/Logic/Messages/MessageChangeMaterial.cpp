@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageChangeMaterial);
+	IMP_FACTORYMESSAGE(CMessageChangeMaterial, Message::CHANGE_MATERIAL);
 
 	//__________________________________________________________________
 	
@@ -30,7 +30,7 @@ namespace Logic {
 	Net::CBuffer CMessageChangeMaterial::serialize() {
 		// Tamao de la cabecera (int) + nombre del material (string)
 		Net::CBuffer buffer( sizeof(int) + (sizeof(char) * _materialName.size()) );
-		buffer.serialize(std::string("CMessageChangeMaterial"), true);
+		buffer.serialize(ID);
 		// Serializamos el string sin hacerle el crc
 		buffer.serialize(_materialName, false);
 
@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageChangeMaterialHudWeapon);
+	IMP_FACTORYMESSAGE(CMessageChangeMaterialHudWeapon, Message::CHANGE_MATERIAL_HUD_WEAPON);
 
 	//__________________________________________________________________
 	
@@ -30,7 +30,7 @@ namespace Logic {
 	Net::CBuffer CMessageChangeMaterialHudWeapon::serialize() {
 		// Tamao de la cabecera (int) + nombre del material (string)
 		Net::CBuffer buffer( sizeof(int) + (sizeof(char) * _materialName.size()) );
-		buffer.serialize(std::string("CMessageChangeMaterialHudWeapon"), true);
+		buffer.serialize(ID);
 		// Serializamos el string sin hacerle el crc
 		buffer.serialize(_materialName, false);
 
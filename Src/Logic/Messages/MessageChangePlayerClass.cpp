@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageChangePlayerClass);
+	IMP_FACTORYMESSAGE(CMessageChangePlayerClass, Message::CHANGE_PLAYER_CLASS);
 
 	//__________________________________________________________________
 	
@@ -30,7 +30,7 @@ namespace Logic {
 	Net::CBuffer CMessageChangePlayerClass::serialize() {
 		// Tamao de la cabecera (int) + el tipo de la clase (unsigned int)
 		Net::CBuffer buffer( sizeof(int) + sizeof(_classType) );
-		buffer.serialize(std::string("CMessageChangePlayerClass"), true);
+		buffer.serialize(ID);
 		// Usamos directamente write para evitar problemas con unsigned int
 		buffer.write(&_classType, sizeof(_classType));
 
@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageChangeWeapon);
+	IMP_FACTORYMESSAGE(CMessageChangeWeapon, Message::CHANGE_WEAPON);
 
 	CMessageChangeWeapon::CMessageChangeWeapon() : CMessage(Message::CHANGE_WEAPON) {
 		// Nada que hacer
@@ -22,7 +22,7 @@ namespace Logic {
 	//----------------------------------------------------------
 	Net::CBuffer CMessageChangeWeapon::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_weapon));
-		buffer.serialize(std::string("CMessageChangeWeapon"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_weapon);
 		
 		return buffer;
@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageChangeWeaponGraphics);
+	IMP_FACTORYMESSAGE(CMessageChangeWeaponGraphics, Message::CHANGE_WEAPON_GRAPHICS);
 
 	CMessageChangeWeaponGraphics::CMessageChangeWeaponGraphics() : CMessage(Message::CHANGE_WEAPON_GRAPHICS) {
 		// Nada que hacer
@@ -22,7 +22,7 @@ namespace Logic {
 	//----------------------------------------------------------
 	Net::CBuffer CMessageChangeWeaponGraphics::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_weapon));
-		buffer.serialize(std::string("CMessageChangeWeaponGraphics"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_weapon);
 		
 		return buffer;
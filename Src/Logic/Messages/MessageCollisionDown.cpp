@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageCollisionDown);
+	IMP_FACTORYMESSAGE(CMessageCollisionDown, Message::COLLISION_DOWN);
 
 	CMessageCollisionDown::CMessageCollisionDown(): CMessage(Message::COLLISION_DOWN){
 		
@@ -25,7 +25,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageCollisionDown::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_collision));
-		buffer.serialize(std::string("CMessageCollisionDown"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_collision);
 		
 		return buffer;
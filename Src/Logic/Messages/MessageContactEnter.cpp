@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageContactEnter);
+	IMP_FACTORYMESSAGE(CMessageContactEnter, Message::CONTACT_ENTER);
 
 	CMessageContactEnter::CMessageContactEnter() : CMessage(Message::CONTACT_ENTER) {
 		// Nada que hacer
@@ -39,7 +39,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageContactEnter::serialize() {
 		Net::CBuffer buffer(sizeof(int)*2);
-		buffer.serialize(std::string("CMessageContactEnter"), true);
+		buffer.serialize(ID);
 		
 		TEntityID id = _entity->getEntityID();
 		buffer.write( &id, sizeof(id) );
@@ -7,7 +7,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageContactExit);
+	IMP_FACTORYMESSAGE(CMessageContactExit, Message::CONTACT_EXIT);
 
 	CMessageContactExit::CMessageContactExit() : CMessage(Message::CONTACT_EXIT) {
 		// Nada que hacer
@@ -26,7 +26,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageContactExit::serialize() {
 		Net::CBuffer buffer(sizeof(int)*2);
-		buffer.serialize(std::string("CMessageContactExit"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_entity);
 		
 		return buffer;
@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageControl);
+	IMP_FACTORYMESSAGE(CMessageControl, Message::CONTROL);
 
 	CMessageControl::CMessageControl( ) : CMessage(Message::CONTROL),
 										  _controlType(ControlType::UNASSIGNED),
@@ -39,7 +39,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageControl::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_controlType));
-		buffer.serialize(std::string("CMessageControl"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_seq);
 		buffer.serialize(_controlType);
 		
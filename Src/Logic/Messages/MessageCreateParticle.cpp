@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageCreateParticle);
+	IMP_FACTORYMESSAGE(CMessageCreateParticle, Message::CREATE_PARTICLE);
 
 	CMessageCreateParticle::CMessageCreateParticle() : CMessage(Message::CREATE_PARTICLE) {
 		// Nada que hacer
@@ -47,7 +47,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageCreateParticle::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_name)+ sizeof(_position));
-		buffer.serialize(std::string("CMessageCreateParticle"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_name, false);
 		buffer.serialize(_position);
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageDamageAmplifier);
+	IMP_FACTORYMESSAGE(CMessageDamageAmplifier, Message::DAMAGE_AMPLIFIER);
 
 	CMessageDamageAmplifier::CMessageDamageAmplifier() : CMessage(Message::DAMAGE_AMPLIFIER), _duration(0) {
 		// Nada que hacer
@@ -29,7 +29,7 @@ namespace Logic {
 	Net::CBuffer CMessageDamageAmplifier::serialize() {
 
 		Net::CBuffer buffer(2*sizeof(int));
-		buffer.serialize(std::string("CMessageDamageAmplifier"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_percentDamage);
 
 		return buffer;
@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageDamaged);
+	IMP_FACTORYMESSAGE(CMessageDamaged, Message::DAMAGED);
 
 	CMessageDamaged::CMessageDamaged() : CMessage(Message::DAMAGED) {
 		// Nada que hacer
@@ -40,7 +40,7 @@ namespace Logic {
 		Logic::TEntityID id = _entity->getEntityID();
 
 		Net::CBuffer buffer(sizeof(int) + sizeof(_damage) + sizeof(id));
-		buffer.serialize(std::string("CMessageDamaged"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_damage);
 		buffer.serialize(id);
 		
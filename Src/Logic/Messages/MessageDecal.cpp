@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageDecal);
+	IMP_FACTORYMESSAGE(CMessageDecal, Message::DECAL);
 
 	CMessageDecal::CMessageDecal() : CMessage(Message::DECAL) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageDecal::serialize() {
 		Net::CBuffer buffer( sizeof(int) + sizeof(_vPosition) + sizeof(_vTexture) + sizeof(_bRandomSize) );
-		buffer.serialize( std::string("CMessageDecal"), true );
+		buffer.serialize( ID );
 		buffer.serialize( _vPosition);
 		buffer.serialize( std::string(_vTexture),false);
 		buffer.serialize( _bRandomSize);
@@ -0,0 +1,171 @@
+#include "MessageDeltaSnapshot.h"
+
+namespace Logic {
+
+	CMessageDeltaSnapshot::CMessageDeltaSnapshot(TMessageType type) : CMessage(type),
+																	  _quantized(false),
+																	  _sequence(0),
+																	  _hasBaseline(false),
+																	  _baselineSequence(0),
+																	  _resolved(true) {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	CMessageDeltaSnapshot::~CMessageDeltaSnapshot() {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::setQuantized(bool quantized) {
+		_quantized = quantized;
+	}
+
+	//__________________________________________________________________
+
+	bool CMessageDeltaSnapshot::isQuantized() {
+		return _quantized;
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::setSequence(unsigned int sequence) {
+		_sequence = sequence;
+	}
+
+	//__________________________________________________________________
+
+	unsigned int CMessageDeltaSnapshot::getSequence() {
+		return _sequence;
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::setBaseline(unsigned int baselineSequence, const Net::TQuantizedTransform& baseline) {
+		_hasBaseline = true;
+		_baselineSequence = baselineSequence;
+		_baseline = baseline;
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::clearBaseline() {
+		_hasBaseline = false;
+		_baselineSequence = 0;
+	}
+
+	//__________________________________________________________________
+
+	bool CMessageDeltaSnapshot::hasBaseline() {
+		return _hasBaseline;
+	}
+
+	//__________________________________________________________________
+
+	unsigned int CMessageDeltaSnapshot::getBaselineSequence() {
+		return _baselineSequence;
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::resolveBaseline(const Net::TQuantizedTransform& baseline) {
+		if(!_resolved)
+			applyDeltas(baseline);
+	}
+
+	//__________________________________________________________________
+
+	bool CMessageDeltaSnapshot::isResolved() {
+		return _resolved;
+	}
+
+	//__________________________________________________________________
+
+	bool CMessageDeltaSnapshot::getLastState(Net::TQuantizedTransform& state) {
+		if( !_resolved || _transformBuffer.empty() )
+			return false;
+
+		state = _lastState;
+		return true;
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::serializeTransforms(Net::CBitWriter& writer) {
+		const Net::TPositionQuantization& quantization = Net::TPositionQuantization::getDefault();
+
+		writer.writeVarUInt(_sequence);
+		writer.writeBool(_hasBaseline);
+		if(_hasBaseline)
+			writer.writeVarUInt(_sequence - _baselineSequence);
+
+		// Cada transformacion se manda como diferencia respecto a la anterior,
+		// y la primera respecto a la baseline (si la hay)
+		writer.writeVarUInt( _transformBuffer.size() );
+		Net::TQuantizedTransform reference = _baseline;
+		for(unsigned int i = 0; i < _transformBuffer.size(); ++i) {
+			Net::TQuantizedTransform current(_transformBuffer[i], quantization);
+
+			if(i == 0 && !_hasBaseline)
+				writer.writeQuantizedTransform(current, quantization);
+			else
+				writer.writeTransformDelta(current, reference);
+
+			reference = current;
+		}
+
+		_lastState = reference;
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::deserializeTransforms(Net::CBitReader& reader) {
+		const Net::TPositionQuantization& quantization = Net::TPositionQuantization::getDefault();
+
+		_sequence = reader.readVarUInt();
+		_hasBaseline = reader.readBool();
+		_baselineSequence = _hasBaseline ? _sequence - reader.readVarUInt() : 0;
+
+		unsigned int bufferSize = reader.readVarUInt();
+
+		_transformBuffer.clear();
+		_transformBuffer.reserve(bufferSize);
+		_pendingDeltas.clear();
+
+		Net::TQuantizedTransform first;
+		if(!_hasBaseline && bufferSize > 0) {
+			first = reader.readQuantizedTransform(quantization);
+			_transformBuffer.push_back( first.toMatrix(quantization) );
+			--bufferSize;
+		}
+
+		_pendingDeltas.resize(bufferSize);
+		for(unsigned int i = 0; i < bufferSize; ++i) {
+			_pendingDeltas[i] = reader.readTransformDelta();
+		}
+
+		_resolved = false;
+		// Las snapshots completas no dependen de nada que tenga el cliente
+		if(!_hasBaseline)
+			applyDeltas(first);
+	}
+
+	//__________________________________________________________________
+
+	void CMessageDeltaSnapshot::applyDeltas(const Net::TQuantizedTransform& reference) {
+		const Net::TPositionQuantization& quantization = Net::TPositionQuantization::getDefault();
+
+		Net::TQuantizedTransform current = reference;
+		for(unsigned int i = 0; i < _pendingDeltas.size(); ++i) {
+			current = _pendingDeltas[i].apply(current);
+			_transformBuffer.push_back( current.toMatrix(quantization) );
+		}
+
+		_lastState = current;
+		_pendingDeltas.clear();
+		_resolved = true;
+	}
+
+};
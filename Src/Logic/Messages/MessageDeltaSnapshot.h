@@ -0,0 +1,91 @@
+#ifndef __Logic_MessageDeltaSnapshot_H
+#define __Logic_MessageDeltaSnapshot_H
+
+#include "Message.h"
+#include "Net/BitStream.h"
+
+#include <vector>
+
+namespace Logic {
+
+	/**
+	Clase base de las snapshots que llevan un buffer de transformaciones.
+	<p>
+	Cuando la snapshot va cuantizada, las transformaciones se codifican como
+	diferencias: cada una respecto a la anterior y la primera respecto a la
+	ltima transformacin que el cliente ha confirmado haber recibido (la
+	baseline). Si el servidor no tiene baseline para ese cliente la primera
+	transformacin se manda completa.
+	<p>
+	No se registra en la factora porque nunca viaja por si misma.
+	*/
+	class CMessageDeltaSnapshot : public CMessage {
+	public:
+		CMessageDeltaSnapshot(TMessageType type);
+		virtual ~CMessageDeltaSnapshot();
+
+		/**
+		Activa el envo de la snapshot empaquetada a nivel de bit (posiciones
+		cuantizadas, quaternions comprimidos y enteros de longitud variable).
+		*/
+		void setQuantized(bool quantized);
+		bool isQuantized();
+
+		/** Nmero de secuencia de la snapshot dentro de su entidad. */
+		void setSequence(unsigned int sequence);
+		unsigned int getSequence();
+
+		/**
+		Servidor: fija la baseline contra la que se codifica la snapshot.
+
+		@param baselineSequence Secuencia de la snapshot confirmada por el cliente.
+		@param baseline ltima transformacin de dicha snapshot.
+		*/
+		void setBaseline(unsigned int baselineSequence, const Net::TQuantizedTransform& baseline);
+
+		/** Servidor: la snapshot se codificar completa. */
+		void clearBaseline();
+
+		bool hasBaseline();
+		unsigned int getBaselineSequence();
+
+		/**
+		Cliente: reconstruye las transformaciones a partir de la baseline que
+		indica getBaselineSequence(). Las snapshots completas se resuelven
+		solas al deserializarse.
+		*/
+		void resolveBaseline(const Net::TQuantizedTransform& baseline);
+		bool isResolved();
+
+		/**
+		Devuelve la ltima transformacin cuantizada de la snapshot, que es
+		la que se usa como baseline de las siguientes.
+
+		@return false si la snapshot no lleva transformaciones.
+		*/
+		bool getLastState(Net::TQuantizedTransform& state);
+
+	protected:
+		void serializeTransforms(Net::CBitWriter& writer);
+		void deserializeTransforms(Net::CBitReader& reader);
+
+		std::vector<Matrix4> _transformBuffer;
+		bool _quantized;
+
+	private:
+		void applyDeltas(const Net::TQuantizedTransform& reference);
+
+		unsigned int _sequence;
+		bool _hasBaseline;
+		unsigned int _baselineSequence;
+		Net::TQuantizedTransform _baseline;
+
+		/** Diferencias ledas que esperan a que se resuelva la baseline. */
+		std::vector<Net::TQuantizedTransformDelta> _pendingDeltas;
+		bool _resolved;
+
+		Net::TQuantizedTransform _lastState;
+	};
+};
+
+#endif
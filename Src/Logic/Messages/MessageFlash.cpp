@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageFlash);
+	IMP_FACTORYMESSAGE(CMessageFlash, Message::FLASH);
 
 	CMessageFlash::CMessageFlash() : CMessage(Message::FLASH) {
 		// Nada que hacer
@@ -21,7 +21,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageFlash::serialize() {
 		Net::CBuffer buffer(sizeof(int));
-		buffer.serialize(std::string("CMessageFlash"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_flashFactor);
 		return buffer;
 	}//
@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHoundCharge);
+	IMP_FACTORYMESSAGE(CMessageHoundCharge, Message::HOUND_CHARGE);
 
 	//----------------------------------------------------------
 
@@ -23,7 +23,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageHoundCharge::serialize() {
 		Net::CBuffer buffer;
-		buffer.serialize( std::string("CMessageHoundCharge"), true );
+		buffer.serialize( ID );
 
 		buffer.write( &_isActive, sizeof(_isActive) );
 		// El resto de los atributos nos interesan solo si se
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHud);
+	IMP_FACTORYMESSAGE(CMessageHud, Message::HUD);
 
 	CMessageHud::CMessageHud() : CMessage(Message::HUD) {
 		// Nada que hacer
@@ -24,7 +24,7 @@ namespace Logic {
 	Net::CBuffer CMessageHud::serialize() {
 		
 		Net::CBuffer buffer(sizeof(int) + sizeof(_type));
-		buffer.serialize(std::string("CMessageHud"),true);
+		buffer.serialize(ID);
 		buffer.write(&_type,sizeof(_type));
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudAmmo);
+	IMP_FACTORYMESSAGE(CMessageHudAmmo, Message::HUD_AMMO);
 
 	CMessageHudAmmo::CMessageHudAmmo() : CMessage(Message::HUD_AMMO) {
 		// Nada que hacer
@@ -33,7 +33,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudAmmo::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_ammo) + sizeof(_weapon));
-		buffer.serialize(std::string("CMessageHudAmmo"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_ammo);
 		buffer.serialize(_weapon);
 		
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudDebug);
+	IMP_FACTORYMESSAGE(CMessageHudDebug, Message::HUD_DEBUG);
 
 	CMessageHudDebug::CMessageHudDebug() : CMessage(Message::HUD_DEBUG) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudDebug::serialize() {
 		Net::CBuffer buffer(sizeof(int));
-		buffer.serialize(std::string("CMessageHudDebug"),true);
+		buffer.serialize(ID);
 		
 		return buffer;
 	}//
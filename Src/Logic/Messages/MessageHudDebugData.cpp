@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudDebugData);
+	IMP_FACTORYMESSAGE(CMessageHudDebugData, Message::HUD_DEBUG_DATA);
 
 	CMessageHudDebugData::CMessageHudDebugData() : CMessage(Message::HUD_DEBUG_DATA) {
 		// Nada que hacer
@@ -54,7 +54,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudDebugData::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_key) + sizeof(_value));
-		buffer.serialize(std::string("CMessageHudDebugData"),true);
+		buffer.serialize(ID);
 
 		buffer.serialize(_key, false);
 		buffer.serialize(_value, false);
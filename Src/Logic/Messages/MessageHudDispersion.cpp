@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudDispersion);
+	IMP_FACTORYMESSAGE(CMessageHudDispersion, Message::HUD_DISPERSION);
 
 	CMessageHudDispersion::CMessageHudDispersion() : CMessage(Message::HUD_DISPERSION) {
 		// Nada que hacer
@@ -17,7 +17,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageHudDispersion::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_fWidth) + sizeof(_fHeight) + sizeof(_iTime) + sizeof(_bReset));
-		buffer.serialize(std::string("CMessageHudDispersion"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_fWidth);
 		buffer.serialize(_fHeight);
 		buffer.serialize(_iTime);
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudLife);
+	IMP_FACTORYMESSAGE(CMessageHudLife, Message::HUD_LIFE);
 
 	CMessageHudLife::CMessageHudLife() : CMessage(Message::HUD_LIFE) {
 		// Nada que hacer
@@ -23,7 +23,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudLife::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_life));
-		buffer.serialize(std::string("CMessageHudLife"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_life);
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudShield);
+	IMP_FACTORYMESSAGE(CMessageHudShield, Message::HUD_SHIELD);
 
 	CMessageHudShield::CMessageHudShield() : CMessage(Message::HUD_SHIELD) {
 		// Nada que hacer
@@ -23,7 +23,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudShield::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_shield));
-		buffer.serialize(std::string("CMessageHudShield"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_shield);
 		
 		return buffer;
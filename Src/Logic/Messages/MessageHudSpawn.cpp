@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudSpawn);
+	IMP_FACTORYMESSAGE(CMessageHudSpawn, Message::HUD_SPAWN);
 
 	CMessageHudSpawn::CMessageHudSpawn() : CMessage(Message::HUD_SPAWN) {
 		// Nada que hacer
@@ -23,7 +23,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudSpawn::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_time));
-		buffer.serialize(std::string("CMessageHudSpawn"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_time);
 		
 		return buffer;
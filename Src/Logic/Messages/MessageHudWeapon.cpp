@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageHudWeapon);
+	IMP_FACTORYMESSAGE(CMessageHudWeapon, Message::HUD_WEAPON);
 
 	CMessageHudWeapon::CMessageHudWeapon() : CMessage(Message::HUD_WEAPON) {
 		// Nada que hacer
@@ -33,7 +33,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageHudWeapon::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_ammo) + sizeof(_weapon));
-		buffer.serialize(std::string("CMessageHudWeapon"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_ammo);
 		buffer.serialize(_weapon);
 		
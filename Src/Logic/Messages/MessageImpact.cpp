@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageImpact);
+	IMP_FACTORYMESSAGE(CMessageImpact, Message::IMPACT);
 
 	CMessageImpact::CMessageImpact() : CMessage(Message::IMPACT) {
 		// Nada que hacer
@@ -30,7 +30,7 @@ namespace Logic {
 		Logic::TEntityID id = _entity->getEntityID();
 
 		Net::CBuffer buffer( sizeof(int) + sizeof(id) );
-		buffer.serialize(std::string("CMessageSetRelatedEntity"), true);
+		buffer.serialize(ID);
 		buffer.serialize(id);
 		
 		return buffer;
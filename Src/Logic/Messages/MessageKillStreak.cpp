@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageKillStreak);
+	IMP_FACTORYMESSAGE(CMessageKillStreak, Message::KILL_STREAK);
 
 	
 	CMessageKillStreak::CMessageKillStreak() : CMessage(Message::KILL_STREAK) {
@@ -14,7 +14,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageKillStreak::serialize() {
 		Net::CBuffer buffer(sizeof(int)*2);
-		buffer.serialize(std::string("CMessageKillStreak"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_killer);
 
 		return buffer;
@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageKinematicMove);
+	IMP_FACTORYMESSAGE(CMessageKinematicMove, Message::KINEMATIC_MOVE);
 
 	CMessageKinematicMove::CMessageKinematicMove() : CMessage(Message::KINEMATIC_MOVE) {
 		// Nada que hacer
@@ -24,7 +24,7 @@ namespace Logic {
 	//----------------------------------------------------------
 	Net::CBuffer CMessageKinematicMove::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_movement.x) * 3);
-		buffer.serialize(std::string("CMessageKinematicMove"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_movement);
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageMouse);
+	IMP_FACTORYMESSAGE(CMessageMouse, Message::MOUSE_ID);
 
 	CMessageMouse::CMessageMouse(): CMessageControl(){
 	} //
@@ -24,7 +24,7 @@ namespace Logic {
 	// para que hacer lo mismo dos veces?
 	Net::CBuffer CMessageMouse::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(float) * 2);
-		buffer.serialize(std::string("CMessageMouse"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_seq);
 		buffer.serialize(_mouse[0]);
 		buffer.serialize(_mouse[1]);
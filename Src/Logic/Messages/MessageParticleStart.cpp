@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageParticleStart);
+	IMP_FACTORYMESSAGE(CMessageParticleStart, Message::PARTICLE_START);
 
 	//----------------------------------------------------------
 
@@ -23,7 +23,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageParticleStart::serialize() {
 		Net::CBuffer buffer;
-		buffer.serialize( std::string("CMessageParticleStart"), true );
+		buffer.serialize( ID );
 
 		return buffer;
 	}//
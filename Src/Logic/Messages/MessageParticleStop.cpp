@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageParticleStop);
+	IMP_FACTORYMESSAGE(CMessageParticleStop, Message::PARTICLE_STOP);
 
 	//----------------------------------------------------------
 
@@ -23,7 +23,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageParticleStop::serialize() {
 		Net::CBuffer buffer;
-		buffer.serialize( std::string("CMessageParticleStop"), true );
+		buffer.serialize( ID );
 
 		return buffer;
 	}//
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageParticleVisibility);
+	IMP_FACTORYMESSAGE(CMessageParticleVisibility, Message::PARTICLE_VISIBILITY);
 
 	CMessageParticleVisibility::CMessageParticleVisibility() : CMessage(Message::PARTICLE_VISIBILITY) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageParticleVisibility::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(int) + sizeof(_visibility) );
-		buffer.serialize(std::string("CMessageParticleVisibility"), true);
+		buffer.serialize(ID);
 		buffer.serialize(std::string(_nameParticle), false);
 		buffer.serialize(_visibility);
 
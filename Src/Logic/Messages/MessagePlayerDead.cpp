@@ -7,7 +7,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessagePlayerDead);
+	IMP_FACTORYMESSAGE(CMessagePlayerDead, Message::PLAYER_DEAD);
 
 	
 	CMessagePlayerDead::CMessagePlayerDead() : CMessage(Message::PLAYER_DEAD),
@@ -18,7 +18,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessagePlayerDead::serialize() {
 		Net::CBuffer buffer( sizeof(int) * 2);
-		buffer.serialize(std::string("CMessagePlayerDead"), true);
+		buffer.serialize(ID);
 
 		int killerId = _killer == NULL ? -1 : _killer->getEntityID();
 		buffer.write( &killerId, sizeof(killerId) );
@@ -0,0 +1,89 @@
+#include "MessagePlayerInput.h"
+
+#include <string>
+
+namespace Logic {
+
+	IMP_FACTORYMESSAGE(CMessagePlayerInput, Message::PLAYER_INPUT);
+
+	CMessagePlayerInput::CMessagePlayerInput() : CMessage(Message::PLAYER_INPUT),
+												 _seq(0),
+												 _action(Control::UNASSIGNED),
+												 _orientation(Quaternion::IDENTITY) {
+		_displacementDir[0] = _displacementDir[1] = _displacementDir[2] = 0;
+	} //
+	//----------------------------------------------------------
+
+	void CMessagePlayerInput::setSeqNumber(unsigned int seq){
+		_seq = seq;
+	}//
+	//----------------------------------------------------------
+
+	unsigned int CMessagePlayerInput::getSeqNumber(){
+		return _seq;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerInput::setDisplacementDir(const Vector3& displacementDir){
+		_displacementDir[0] = (char)displacementDir.x;
+		_displacementDir[1] = (char)displacementDir.y;
+		_displacementDir[2] = (char)displacementDir.z;
+	}//
+	//----------------------------------------------------------
+
+	Vector3 CMessagePlayerInput::getDisplacementDir(){
+		return Vector3(_displacementDir[0], _displacementDir[1], _displacementDir[2]);
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerInput::setAction(ControlType action){
+		_action = action;
+	}//
+	//----------------------------------------------------------
+
+	ControlType CMessagePlayerInput::getAction(){
+		return _action;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerInput::setOrientation(const Quaternion& orientation){
+		_orientation = orientation;
+	}//
+	//----------------------------------------------------------
+
+	Quaternion CMessagePlayerInput::getOrientation(){
+		return _orientation;
+	}//
+	//----------------------------------------------------------
+
+	Net::CBuffer CMessagePlayerInput::serialize() {
+		// La accion siempre es un control de salto o UNASSIGNED, cabe en un byte
+		unsigned char action = _action == Control::UNASSIGNED ? 0xFF : (unsigned char)_action;
+
+		Net::CBuffer buffer( (sizeof(int) * 2) + (sizeof(char) * 4) + (sizeof(float) * 4) );
+		buffer.serialize(ID);
+		buffer.serialize(_seq);
+		buffer.serialize(_displacementDir[0]);
+		buffer.serialize(_displacementDir[1]);
+		buffer.serialize(_displacementDir[2]);
+		buffer.serialize(action);
+		buffer.serialize(_orientation);
+
+		return buffer;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerInput::deserialize(Net::CBuffer& buffer) {
+		unsigned char action;
+
+		buffer.deserialize(_seq);
+		buffer.deserialize(_displacementDir[0]);
+		buffer.deserialize(_displacementDir[1]);
+		buffer.deserialize(_displacementDir[2]);
+		buffer.deserialize(action);
+		buffer.deserialize(_orientation);
+
+		_action = action == 0xFF ? Control::UNASSIGNED : (ControlType)action;
+	}
+
+};
@@ -0,0 +1,50 @@
+#ifndef __Logic_MessagePlayerInput_H
+#define __Logic_MessagePlayerInput_H
+
+#include "Message.h"
+
+namespace Logic {
+
+	/**
+	Comando de entrada que el cliente manda al servidor en cada fixed tick:
+	la direccin de desplazamiento, el salto o esquiva que se haya pulsado
+	y la orientacin del jugador. El servidor lo simula con CAvatarController
+	y contesta con CMessagePlayerState.
+	*/
+	class CMessagePlayerInput : public CMessage{
+	DEC_FACTORYMESSAGE(CMessagePlayerInput);
+	public:
+		CMessagePlayerInput();
+		~CMessagePlayerInput(){};
+
+		void setSeqNumber(unsigned int seq);
+		unsigned int getSeqNumber();
+
+		void setDisplacementDir(const Vector3& displacementDir);
+		Vector3 getDisplacementDir();
+
+		void setAction(ControlType action);
+		ControlType getAction();
+
+		void setOrientation(const Quaternion& orientation);
+		Quaternion getOrientation();
+		
+		virtual Net::CBuffer serialize();
+		virtual void deserialize(Net::CBuffer& buffer);
+
+	protected:
+		unsigned int _seq;
+
+		/** Cada componente va entre -1 y 1, asi que viaja en un char. */
+		char _displacementDir[3];
+
+		/** Salto o esquiva del tick (Control::UNASSIGNED si no hay). */
+		ControlType _action;
+
+		Quaternion _orientation;
+	};
+	REG_FACTORYMESSAGE(CMessagePlayerInput);
+
+};
+
+#endif
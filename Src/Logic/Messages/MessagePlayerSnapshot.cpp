@@ -6,11 +6,11 @@ using namespace std;
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessagePlayerSnapshot);
+	IMP_FACTORYMESSAGE(CMessagePlayerSnapshot, Message::PLAYER_SNAPSHOT);
 
 	//__________________________________________________________________
 
-	CMessagePlayerSnapshot::CMessagePlayerSnapshot() : CMessage(Message::PLAYER_SNAPSHOT) {
+	CMessagePlayerSnapshot::CMessagePlayerSnapshot() : CMessageDeltaSnapshot(Message::PLAYER_SNAPSHOT) {
 		// Nada que hacer
 	}
 
@@ -28,7 +28,7 @@ namespace Logic {
 
 	//__________________________________________________________________
 		
-	vector<Matrix4> CMessagePlayerSnapshot::getTransformBuffer() {
+	const vector<Matrix4>& CMessagePlayerSnapshot::getTransformBuffer() const {
 		return _transformBuffer;
 	}
 
@@ -40,7 +40,7 @@ namespace Logic {
 
 	//__________________________________________________________________
 
-	vector<AnimInfo> CMessagePlayerSnapshot::getAnimationBuffer() {
+	const vector<AnimInfo>& CMessagePlayerSnapshot::getAnimationBuffer() const {
 		return _animationBuffer;
 	}
 
@@ -52,7 +52,7 @@ namespace Logic {
 
 	//__________________________________________________________________
 
-	vector<WeaponInfo> CMessagePlayerSnapshot::getWeaponBuffer() {
+	const vector<WeaponInfo>& CMessagePlayerSnapshot::getWeaponBuffer() const {
 		return _weaponBuffer;
 	}
 
@@ -64,12 +64,12 @@ namespace Logic {
 
 	//__________________________________________________________________
 
-	std::vector<AudioInfo> CMessagePlayerSnapshot::getAudioBuffer() {
+	const std::vector<AudioInfo>& CMessagePlayerSnapshot::getAudioBuffer() const {
 		return _audioBuffer;
 	}
 
 	//__________________________________________________________________
-		
+
 	Net::CBuffer CMessagePlayerSnapshot::serialize() {
 		// Tamao igual = cabecera(int) + tambuffer(int) + num matrices (5 floats * tamBuffer)
 		unsigned int transformBufferSize( _transformBuffer.size() ), animationBufferSize( _animationBuffer.size() ), audioBufferSize( _audioBuffer.size() ), weaponBufferSize( _weaponBuffer.size() );
@@ -77,7 +77,13 @@ namespace Logic {
 		unsigned char booleanMask;
 
 		Net::CBuffer buffer;
-		buffer.serialize(std::string("CMessagePlayerSnapshot"), true);
+		buffer.serialize(ID);
+		buffer.serialize(_quantized);
+
+		if(_quantized) {
+			serializeQuantized(buffer);
+			return buffer;
+		}
 		
 		// Copiamos las posiciones y rotaciones del player
 		buffer.serialize(transformBufferSize);
@@ -132,6 +138,13 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CMessagePlayerSnapshot::deserialize(Net::CBuffer& buffer) {
+		buffer.deserialize(_quantized);
+
+		if(_quantized) {
+			deserializeQuantized(buffer);
+			return;
+		}
+
 		int transformBufferSize, animationBufferSize, audioBufferSize, weaponBufferSize;
 		unsigned char booleanMask;
 		// Deserializar el tamao del buffer
@@ -189,4 +202,82 @@ namespace Logic {
 		}
 	}
 
+	//__________________________________________________________________
+
+	void CMessagePlayerSnapshot::serializeQuantized(Net::CBuffer& buffer) {
+		Net::CBitWriter writer(buffer);
+
+		// Transformaciones: codificadas como diferencias respecto a la baseline
+		serializeTransforms(writer);
+
+		// Animaciones: los ticks son pequeos, asi que usamos enteros de longitud
+		// variable y un bit por cada flag
+		writer.writeVarUInt( _animationBuffer.size() );
+		for(unsigned int i = 0; i < _animationBuffer.size(); ++i) {
+			writer.writeVarUInt(_animationBuffer[i].tick);
+			writer.writeString(_animationBuffer[i].animName);
+			writer.writeBool(_animationBuffer[i].loop);
+			writer.writeBool(_animationBuffer[i].stop);
+			writer.writeBool(_animationBuffer[i].exclude);
+			writer.writeVarInt(_animationBuffer[i].rewind);
+		}
+
+		// Sonidos
+		writer.writeVarUInt( _audioBuffer.size() );
+		for(unsigned int i = 0; i < _audioBuffer.size(); ++i) {
+			writer.writeVarUInt(_audioBuffer[i].tick);
+			writer.writeString(_audioBuffer[i].audioName);
+			writer.writeBool(_audioBuffer[i].loopSound);
+			writer.writeBool(_audioBuffer[i].play3d);
+			writer.writeBool(_audioBuffer[i].streamSound);
+			writer.writeBool(_audioBuffer[i].stopSound);
+		}
+
+		// Cambios de arma
+		writer.writeVarUInt( _weaponBuffer.size() );
+		for(unsigned int i = 0; i < _weaponBuffer.size(); ++i) {
+			writer.writeVarUInt(_weaponBuffer[i].tick);
+			writer.writeVarInt(_weaponBuffer[i].weapon);
+		}
+
+		writer.flush();
+	}
+
+	//__________________________________________________________________
+
+	void CMessagePlayerSnapshot::deserializeQuantized(Net::CBuffer& buffer) {
+		Net::CBitReader reader(buffer);
+
+		deserializeTransforms(reader);
+
+		_animationBuffer.clear();
+		_animationBuffer.resize( reader.readVarUInt() );
+		for(unsigned int i = 0; i < _animationBuffer.size(); ++i) {
+			_animationBuffer[i].tick	= reader.readVarUInt();
+			_animationBuffer[i].animName = reader.readString();
+			_animationBuffer[i].loop	= reader.readBool();
+			_animationBuffer[i].stop	= reader.readBool();
+			_animationBuffer[i].exclude	= reader.readBool();
+			_animationBuffer[i].rewind	= reader.readVarInt();
+		}
+
+		_audioBuffer.clear();
+		_audioBuffer.resize( reader.readVarUInt() );
+		for(unsigned int i = 0; i < _audioBuffer.size(); ++i) {
+			_audioBuffer[i].tick		= reader.readVarUInt();
+			_audioBuffer[i].audioName	= reader.readString();
+			_audioBuffer[i].loopSound	= reader.readBool();
+			_audioBuffer[i].play3d		= reader.readBool();
+			_audioBuffer[i].streamSound	= reader.readBool();
+			_audioBuffer[i].stopSound	= reader.readBool();
+		}
+
+		_weaponBuffer.clear();
+		_weaponBuffer.resize( reader.readVarUInt() );
+		for(unsigned int i = 0; i < _weaponBuffer.size(); ++i) {
+			_weaponBuffer[i].tick	= reader.readVarUInt();
+			_weaponBuffer[i].weapon	= reader.readVarInt();
+		}
+	}
+
 };
@@ -1,7 +1,7 @@
 #ifndef __Logic_MessagePlayerSnapshot_H
 #define __Logic_MessagePlayerSnapshot_H
 
-#include "Message.h"
+#include "MessageDeltaSnapshot.h"
 
 namespace Logic {
 
@@ -32,28 +32,30 @@ namespace Logic {
 	// No heredo de CMessageTransformSnapshot porque me
 	// da problemillas con el constructor (por querer hacer un bypass
 	// y llamar a CMessage directamente)
-	class CMessagePlayerSnapshot: public CMessage {
+	class CMessagePlayerSnapshot: public CMessageDeltaSnapshot {
 	DEC_FACTORYMESSAGE(CMessagePlayerSnapshot);
 	public:
 		CMessagePlayerSnapshot();
 		virtual ~CMessagePlayerSnapshot();
 
 		void setTransformBuffer(const std::vector<Matrix4>& buffer);
-		std::vector<Matrix4> getTransformBuffer();
+		const std::vector<Matrix4>& getTransformBuffer() const;
 		
 		void setAnimationBuffer(const std::vector<AnimInfo>& buffer);
-		std::vector<AnimInfo> getAnimationBuffer();
+		const std::vector<AnimInfo>& getAnimationBuffer() const;
 
 		void setAudioBuffer(const std::vector<AudioInfo>& buffer);
-		std::vector<AudioInfo> getAudioBuffer();
+		const std::vector<AudioInfo>& getAudioBuffer() const;
 
 		void setWeaponBuffer( const std::vector<WeaponInfo> &weaponBuffer );
-		std::vector<WeaponInfo> getWeaponBuffer();
+		const std::vector<WeaponInfo>& getWeaponBuffer() const;
 
 		virtual Net::CBuffer serialize();
 		virtual void deserialize(Net::CBuffer& buffer);
 	private:
-		 std::vector<Matrix4> _transformBuffer;
+		void serializeQuantized(Net::CBuffer& buffer);
+		void deserializeQuantized(Net::CBuffer& buffer);
+
 		 std::vector<AnimInfo> _animationBuffer;
 		 std::vector<AudioInfo> _audioBuffer;
 		 std::vector<WeaponInfo> _weaponBuffer;
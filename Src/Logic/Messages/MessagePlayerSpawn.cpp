@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessagePlayerSpawn);
+	IMP_FACTORYMESSAGE(CMessagePlayerSpawn, Message::PLAYER_SPAWN);
 	
 	
 	CMessagePlayerSpawn::CMessagePlayerSpawn() : CMessage(Message::PLAYER_SPAWN) {
@@ -41,7 +41,7 @@ namespace Logic {
 	Net::CBuffer CMessagePlayerSpawn::serialize() {
 		//3 del vector3 y 3 del quaternion
 		Net::CBuffer buffer(sizeof(int) + sizeof(float) * 6);
-		buffer.serialize(std::string("CMessagePlayerSpawn"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_position);
 		buffer.serialize(_orientation);
 		
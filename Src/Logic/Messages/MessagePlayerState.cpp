@@ -0,0 +1,77 @@
+#include "MessagePlayerState.h"
+
+#include <string>
+
+namespace Logic {
+
+	IMP_FACTORYMESSAGE(CMessagePlayerState, Message::PLAYER_STATE);
+
+	CMessagePlayerState::CMessagePlayerState() : CMessage(Message::PLAYER_STATE),
+												 _seq(0),
+												 _position(Vector3::ZERO),
+												 _momentum(Vector3::ZERO),
+												 _touchingGround(false) {
+		// Nada que hacer
+	} //
+	//----------------------------------------------------------
+
+	void CMessagePlayerState::setSeqNumber(unsigned int seq){
+		_seq = seq;
+	}//
+	//----------------------------------------------------------
+
+	unsigned int CMessagePlayerState::getSeqNumber(){
+		return _seq;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerState::setPosition(const Vector3& position){
+		_position = position;
+	}//
+	//----------------------------------------------------------
+
+	Vector3 CMessagePlayerState::getPosition(){
+		return _position;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerState::setMomentum(const Vector3& momentum){
+		_momentum = momentum;
+	}//
+	//----------------------------------------------------------
+
+	Vector3 CMessagePlayerState::getMomentum(){
+		return _momentum;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerState::setTouchingGround(bool touchingGround){
+		_touchingGround = touchingGround;
+	}//
+	//----------------------------------------------------------
+
+	bool CMessagePlayerState::getTouchingGround(){
+		return _touchingGround;
+	}//
+	//----------------------------------------------------------
+
+	Net::CBuffer CMessagePlayerState::serialize() {
+		Net::CBuffer buffer( (sizeof(int) * 2) + (sizeof(float) * 6) + sizeof(bool) );
+		buffer.serialize(ID);
+		buffer.serialize(_seq);
+		buffer.serialize(_position);
+		buffer.serialize(_momentum);
+		buffer.serialize(_touchingGround);
+
+		return buffer;
+	}//
+	//----------------------------------------------------------
+
+	void CMessagePlayerState::deserialize(Net::CBuffer& buffer) {
+		buffer.deserialize(_seq);
+		buffer.deserialize(_position);
+		buffer.deserialize(_momentum);
+		buffer.deserialize(_touchingGround);
+	}
+
+};
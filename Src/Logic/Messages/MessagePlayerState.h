@@ -0,0 +1,44 @@
+#ifndef __Logic_MessagePlayerState_H
+#define __Logic_MessagePlayerState_H
+
+#include "Message.h"
+
+namespace Logic {
+
+	/**
+	Estado autoritativo del movimiento de un jugador que el servidor manda a
+	su cliente tras simular sus comandos de entrada, junto con el nmero de
+	secuencia del ltimo comando procesado.
+	*/
+	class CMessagePlayerState : public CMessage{
+	DEC_FACTORYMESSAGE(CMessagePlayerState);
+	public:
+		CMessagePlayerState();
+		~CMessagePlayerState(){};
+
+		void setSeqNumber(unsigned int seq);
+		unsigned int getSeqNumber();
+
+		void setPosition(const Vector3& position);
+		Vector3 getPosition();
+
+		void setMomentum(const Vector3& momentum);
+		Vector3 getMomentum();
+
+		void setTouchingGround(bool touchingGround);
+		bool getTouchingGround();
+		
+		virtual Net::CBuffer serialize();
+		virtual void deserialize(Net::CBuffer& buffer);
+
+	protected:
+		unsigned int _seq;
+		Vector3 _position;
+		Vector3 _momentum;
+		bool _touchingGround;
+	};
+	REG_FACTORYMESSAGE(CMessagePlayerState);
+
+};
+
+#endif
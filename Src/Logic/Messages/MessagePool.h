@@ -0,0 +1,199 @@
+//---------------------------------------------------------------------------
+// MessagePool.h
+//---------------------------------------------------------------------------
+
+/**
+@file MessagePool.h
+
+Contiene el pool de memoria de los mensajes y la funcin createMessage que
+lo usa para crearlos.
+
+@see Logic::CMessageBlockPool
+@see Logic::CMessageAllocator
+@see Logic::createMessage
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_MessagePool_H
+#define __Logic_MessagePool_H
+
+#include <memory>
+#include <new>
+#include <cstddef>
+
+namespace Logic {
+
+	/**
+	Pool de bloques de memoria de tamao fijo. Hay un pool por cada tamao
+	de bloque, y todos los mensajes (junto con el contador de referencias
+	del shared_ptr) que ocupan lo mismo comparten pool.
+	<p>
+	Los bloques libres forman una lista enlazada, as que reservar y liberar
+	es sacar y meter de la cabeza de la lista. Cuando no quedan bloques se
+	reserva un trozo con BLOCKS_PER_CHUNK de golpe. La memoria nunca se
+	devuelve al sistema: el pool crece hasta el pico de mensajes vivos y a
+	partir de ah se reutiliza.
+	<p>
+	No es thread-safe; los mensajes slo se crean y destruyen desde el hilo
+	de la lgica.
+
+	@ingroup logicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	template <size_t Size>
+	class CMessageBlockPool {
+	public:
+
+		/** Alineamiento de los bloques. */
+		static const size_t ALIGNMENT = 16;
+
+		/** Tamao real de cada bloque (Size redondeado al alineamiento). */
+		static const size_t BLOCK_SIZE = (Size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+		/** Nmero de bloques que se reservan cada vez que el pool se queda sin ellos. */
+		static const size_t BLOCKS_PER_CHUNK = 64;
+
+		//________________________________________________________________________
+
+		/** Devuelve un bloque libre. */
+		static void* allocate() {
+			if(_freeList == NULL)
+				grow();
+
+			TBlock* block = _freeList;
+			_freeList = block->next;
+
+			return block;
+		}
+
+		//________________________________________________________________________
+
+		/** Devuelve un bloque al pool. */
+		static void deallocate(void* pointer) {
+			TBlock* block = static_cast<TBlock*>(pointer);
+			block->next = _freeList;
+			_freeList = block;
+		}
+
+	private:
+
+		/** Cabecera que ocupa un bloque mientras est libre. */
+		struct TBlock {
+			TBlock* next;
+		};
+
+		/** Reserva un trozo nuevo y mete sus bloques en la lista de libres. */
+		static void grow() {
+			char* chunk = static_cast<char*>( ::operator new(BLOCK_SIZE * BLOCKS_PER_CHUNK) );
+			for(size_t i = 0; i < BLOCKS_PER_CHUNK; ++i)
+				deallocate(chunk + i * BLOCK_SIZE);
+		}
+
+		/** Primer bloque libre. */
+		static TBlock* _freeList;
+
+	}; // class CMessageBlockPool
+
+	template <size_t Size>
+	typename CMessageBlockPool<Size>::TBlock* CMessageBlockPool<Size>::_freeList = NULL;
+
+	//________________________________________________________________________
+
+	/**
+	Allocator estndar que saca la memoria de CMessageBlockPool. Est pensado
+	para std::allocate_shared, que lo reenlaza (rebind) al tipo que guarda
+	juntos el mensaje y su contador de referencias, de modo que crear un
+	mensaje no pasa por el heap.
+
+	@ingroup logicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	template <class T>
+	class CMessageAllocator {
+	public:
+
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		template <class U>
+		struct rebind {
+			typedef CMessageAllocator<U> other;
+		};
+
+		CMessageAllocator() {}
+
+		template <class U>
+		CMessageAllocator(const CMessageAllocator<U>&) {}
+
+		pointer address(reference value) const { return &value; }
+		const_pointer address(const_reference value) const { return &value; }
+
+		pointer allocate(size_type n, const void* = 0) {
+			if(n == 1)
+				return static_cast<pointer>( CMessageBlockPool<sizeof(T)>::allocate() );
+
+			return static_cast<pointer>( ::operator new(n * sizeof(T)) );
+		}
+
+		void deallocate(pointer p, size_type n) {
+			if(n == 1)
+				CMessageBlockPool<sizeof(T)>::deallocate(p);
+			else
+				::operator delete(p);
+		}
+
+		void construct(pointer p, const T& value) { new(p) T(value); }
+		void destroy(pointer p) { p->~T(); }
+
+		size_type max_size() const { return size_t(-1) / sizeof(T); }
+
+	}; // class CMessageAllocator
+
+	template <class T, class U>
+	inline bool operator==(const CMessageAllocator<T>&, const CMessageAllocator<U>&) { return true; }
+
+	template <class T, class U>
+	inline bool operator!=(const CMessageAllocator<T>&, const CMessageAllocator<U>&) { return false; }
+
+	//________________________________________________________________________
+
+	/**
+	Crea un mensaje usando el pool de mensajes. Es la alternativa a
+	std::make_shared para los mensajes y devuelve el mismo tipo de puntero,
+	as que el mensaje puede guardarse el tiempo que haga falta.
+
+	@return Puntero compartido al mensaje creado.
+	*/
+	template <class T>
+	inline std::shared_ptr<T> createMessage() {
+		return std::allocate_shared<T>( CMessageAllocator<T>() );
+	}
+
+	/**
+	Crea un mensaje usando el pool de mensajes, pasando un argumento al
+	constructor.
+
+	@param arg Argumento del constructor del mensaje.
+	@return Puntero compartido al mensaje creado.
+	*/
+	template <class T, class A1>
+	inline std::shared_ptr<T> createMessage(const A1& arg) {
+		return std::allocate_shared<T>( CMessageAllocator<T>(), arg );
+	}
+
+} // namespace Logic
+
+#endif // __Logic_MessagePool_H
@@ -1,14 +1,15 @@
 #include "MessagePositionSnapshot.h"
 
 #include "Logic/Entity/MessageFactory.h"
+#include "Net/BitStream.h"
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessagePositionSnapshot);
+	IMP_FACTORYMESSAGE(CMessagePositionSnapshot, Message::POSITION_SNAPSHOT);
 
 	//__________________________________________________________________
 
-	CMessagePositionSnapshot::CMessagePositionSnapshot() : CMessage(Message::POSITION_SNAPSHOT) {
+	CMessagePositionSnapshot::CMessagePositionSnapshot() : CMessage(Message::POSITION_SNAPSHOT), _quantized(false) {
 		// Nada que hacer
 	}
 
@@ -30,13 +31,40 @@ namespace Logic {
 		return _positionBuffer;
 	}
 
+	//__________________________________________________________________
+
+	void CMessagePositionSnapshot::setQuantized(bool quantized) {
+		_quantized = quantized;
+	}
+
+	//__________________________________________________________________
+
+	bool CMessagePositionSnapshot::isQuantized() {
+		return _quantized;
+	}
+
 	//__________________________________________________________________
 		
 	Net::CBuffer CMessagePositionSnapshot::serialize() {
 		// Tamao igual = cabecera(int) + tambuffer(int) + num matrices (5 floats * tamBuffer)
 		int bufferSize = _positionBuffer.size();
 		Net::CBuffer buffer( (2 * sizeof(int)) + (bufferSize * 3 * sizeof(float)) );
-		buffer.serialize(std::string("CMessagePositionSnapshot"), true);
+		buffer.serialize(ID);
+		buffer.serialize(_quantized);
+
+		if(_quantized) {
+			const Net::TPositionQuantization& quantization = Net::TPositionQuantization::getDefault();
+
+			Net::CBitWriter writer(buffer);
+			writer.writeVarUInt(bufferSize);
+			for(int i = 0; i < bufferSize; ++i) {
+				writer.writePosition(_positionBuffer[i], quantization);
+			}
+			writer.flush();
+
+			return buffer;
+		}
+
 		buffer.serialize(bufferSize);
 		for(int i = 0; i < bufferSize; ++i) {
 			buffer.serialize(_positionBuffer[i]);
@@ -48,6 +76,23 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CMessagePositionSnapshot::deserialize(Net::CBuffer& buffer) {
+		buffer.deserialize(_quantized);
+
+		if(_quantized) {
+			const Net::TPositionQuantization& quantization = Net::TPositionQuantization::getDefault();
+
+			Net::CBitReader reader(buffer);
+			unsigned int bufferSize = reader.readVarUInt();
+
+			_positionBuffer.clear();
+			_positionBuffer.resize(bufferSize);
+			for(unsigned int i = 0; i < bufferSize; ++i) {
+				_positionBuffer[i] = reader.readPosition(quantization);
+			}
+
+			return;
+		}
+
 		int bufferSize;
 		// Deserializar el tamao del buffer
 		buffer.deserialize(bufferSize);
@@ -13,11 +13,19 @@ namespace Logic {
 
 		void setBuffer(const std::vector<Vector3> buffer);
 		std::vector<Vector3> getBuffer();
-		
+
+		/**
+		Activa el empaquetado a nivel de bit de la snapshot: cada posicion va
+		cuantizada y el numero de posiciones como entero de longitud variable.
+		*/
+		void setQuantized(bool quantized);
+		bool isQuantized();
+
 		virtual Net::CBuffer serialize();
 		virtual void deserialize(Net::CBuffer& buffer);
 	private:
 		 std::vector<Vector3> _positionBuffer;
+		 bool _quantized;
 	};
 	REG_FACTORYMESSAGE(CMessagePositionSnapshot);
 };
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessagePrimaryShoot);
+	IMP_FACTORYMESSAGE(CMessagePrimaryShoot, Message::PRIMARY_SHOOT);
 
 	CMessagePrimaryShoot::CMessagePrimaryShoot() : CMessage(Message::PRIMARY_SHOOT) {
 		// Nada que hacer
@@ -17,7 +17,7 @@ namespace Logic {
 
 	Net::CBuffer CMessagePrimaryShoot::serialize() {
 		Net::CBuffer buffer( sizeof(int) );
-		buffer.serialize( std::string("CMessagePrimaryShoot"), true );
+		buffer.serialize( ID );
 		buffer.serialize(_shoot);
 		
 		return buffer;
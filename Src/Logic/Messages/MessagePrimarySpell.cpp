@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessagePrimarySpell);
+	IMP_FACTORYMESSAGE(CMessagePrimarySpell, Message::PRIMARY_SPELL);
 
 	CMessagePrimarySpell::CMessagePrimarySpell() : CMessage(Message::PRIMARY_SPELL) {
 		// Nada que hacer
@@ -17,7 +17,7 @@ namespace Logic {
 
 	Net::CBuffer CMessagePrimarySpell::serialize() {
 		Net::CBuffer buffer( sizeof(int) );
-		buffer.serialize( std::string("CMessagePrimarySpell"), true );
+		buffer.serialize( ID );
 		buffer.serialize(_spell);
 		
 		return buffer;
@@ -0,0 +1,36 @@
+#include "MessageProjectileImpact.h"
+
+namespace Logic {
+
+	IMP_FACTORYMESSAGE(CMessageProjectileImpact, Message::PROJECTILE_IMPACT);
+
+	CMessageProjectileImpact::CMessageProjectileImpact() : CMessage(Message::PROJECTILE_IMPACT),
+														   _projectileId(0) {
+		// Nada que hacer
+	} //
+	//----------------------------------------------------------
+
+	void CMessageProjectileImpact::setProjectileId(unsigned int id){
+		_projectileId = id;
+	}//
+	//----------------------------------------------------------
+
+	unsigned int CMessageProjectileImpact::getProjectileId(){
+		return _projectileId;
+	}//
+	//----------------------------------------------------------
+
+	Net::CBuffer CMessageProjectileImpact::serialize() {
+		Net::CBuffer buffer( sizeof(int) * 2 );
+		buffer.serialize(ID);
+		buffer.serialize(_projectileId);
+
+		return buffer;
+	}//
+	//----------------------------------------------------------
+
+	void CMessageProjectileImpact::deserialize(Net::CBuffer& buffer) {
+		buffer.deserialize(_projectileId);
+	}
+
+};
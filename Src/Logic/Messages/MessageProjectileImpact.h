@@ -0,0 +1,31 @@
+#ifndef __Logic_MessageProjectileImpact_H
+#define __Logic_MessageProjectileImpact_H
+
+#include "Message.h"
+
+namespace Logic {
+
+	/**
+	Aviso del servidor de que un perdign ha impactado y hay que dejar de
+	pintarlo.
+	*/
+	class CMessageProjectileImpact : public CMessage{
+	DEC_FACTORYMESSAGE(CMessageProjectileImpact);
+	public:
+		CMessageProjectileImpact();
+		~CMessageProjectileImpact(){};
+
+		void setProjectileId(unsigned int id);
+		unsigned int getProjectileId();
+		
+		virtual Net::CBuffer serialize();
+		virtual void deserialize(Net::CBuffer& buffer);
+
+	protected:
+		unsigned int _projectileId;
+	};
+	REG_FACTORYMESSAGE(CMessageProjectileImpact);
+
+};
+
+#endif
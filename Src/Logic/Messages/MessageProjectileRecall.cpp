@@ -0,0 +1,24 @@
+#include "MessageProjectileRecall.h"
+
+namespace Logic {
+
+	IMP_FACTORYMESSAGE(CMessageProjectileRecall, Message::PROJECTILE_RECALL);
+
+	CMessageProjectileRecall::CMessageProjectileRecall() : CMessage(Message::PROJECTILE_RECALL) {
+		// Nada que hacer
+	} //
+	//----------------------------------------------------------
+
+	Net::CBuffer CMessageProjectileRecall::serialize() {
+		Net::CBuffer buffer( sizeof(int) );
+		buffer.serialize(ID);
+
+		return buffer;
+	}//
+	//----------------------------------------------------------
+
+	void CMessageProjectileRecall::deserialize(Net::CBuffer& buffer) {
+		// Nada que leer
+	}
+
+};
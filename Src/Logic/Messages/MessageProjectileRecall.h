@@ -0,0 +1,25 @@
+#ifndef __Logic_MessageProjectileRecall_H
+#define __Logic_MessageProjectileRecall_H
+
+#include "Message.h"
+
+namespace Logic {
+
+	/**
+	Orden de que los perdigones de la entidad que recibe el mensaje vuelvan
+	hacia ella (disparo secundario de la escopeta).
+	*/
+	class CMessageProjectileRecall : public CMessage{
+	DEC_FACTORYMESSAGE(CMessageProjectileRecall);
+	public:
+		CMessageProjectileRecall();
+		~CMessageProjectileRecall(){};
+		
+		virtual Net::CBuffer serialize();
+		virtual void deserialize(Net::CBuffer& buffer);
+	};
+	REG_FACTORYMESSAGE(CMessageProjectileRecall);
+
+};
+
+#endif
@@ -0,0 +1,64 @@
+#include "MessageProjectileSpawn.h"
+
+namespace Logic {
+
+	IMP_FACTORYMESSAGE(CMessageProjectileSpawn, Message::PROJECTILE_SPAWN);
+
+	CMessageProjectileSpawn::CMessageProjectileSpawn() : CMessage(Message::PROJECTILE_SPAWN) {
+		_volley.owner = 0;
+		_volley.firstId = 0;
+		_volley.nbProjectiles = 0;
+		_volley.origin = Vector3::ZERO;
+		_volley.direction = Vector3::ZERO;
+		_volley.dispersion = 0;
+		_volley.seed = 0;
+		_volley.speed = 0;
+		_volley.radius = 0;
+		_volley.returnHeight = 0;
+		_volley.damage = 0;
+	} //
+	//----------------------------------------------------------
+
+	void CMessageProjectileSpawn::setVolley(const CProjectileSimulator::TVolley& volley){
+		_volley = volley;
+	}//
+	//----------------------------------------------------------
+
+	const CProjectileSimulator::TVolley& CMessageProjectileSpawn::getVolley(){
+		return _volley;
+	}//
+	//----------------------------------------------------------
+
+	Net::CBuffer CMessageProjectileSpawn::serialize() {
+		// El dao no viaja, los clientes no lo aplican
+		Net::CBuffer buffer( (sizeof(int) * 5) + (sizeof(float) * 10) );
+		buffer.serialize(ID);
+		buffer.serialize(_volley.owner);
+		buffer.serialize(_volley.firstId);
+		buffer.serialize(_volley.nbProjectiles);
+		buffer.serialize(_volley.seed);
+		buffer.serialize(_volley.origin);
+		buffer.serialize(_volley.direction);
+		buffer.serialize(_volley.dispersion);
+		buffer.serialize(_volley.speed);
+		buffer.serialize(_volley.radius);
+		buffer.serialize(_volley.returnHeight);
+
+		return buffer;
+	}//
+	//----------------------------------------------------------
+
+	void CMessageProjectileSpawn::deserialize(Net::CBuffer& buffer) {
+		buffer.deserialize(_volley.owner);
+		buffer.deserialize(_volley.firstId);
+		buffer.deserialize(_volley.nbProjectiles);
+		buffer.deserialize(_volley.seed);
+		buffer.deserialize(_volley.origin);
+		buffer.deserialize(_volley.direction);
+		buffer.deserialize(_volley.dispersion);
+		buffer.deserialize(_volley.speed);
+		buffer.deserialize(_volley.radius);
+		buffer.deserialize(_volley.returnHeight);
+	}
+
+};
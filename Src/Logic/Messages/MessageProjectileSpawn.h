@@ -0,0 +1,33 @@
+#ifndef __Logic_MessageProjectileSpawn_H
+#define __Logic_MessageProjectileSpawn_H
+
+#include "Message.h"
+#include "Logic/ProjectileSimulator.h"
+
+namespace Logic {
+
+	/**
+	Rfaga de perdigones disparada en el servidor. Solo lleva los parmetros
+	de la rfaga: el cliente regenera los perdigones con la misma semilla
+	(ver CProjectileSimulator).
+	*/
+	class CMessageProjectileSpawn : public CMessage{
+	DEC_FACTORYMESSAGE(CMessageProjectileSpawn);
+	public:
+		CMessageProjectileSpawn();
+		~CMessageProjectileSpawn(){};
+
+		void setVolley(const CProjectileSimulator::TVolley& volley);
+		const CProjectileSimulator::TVolley& getVolley();
+		
+		virtual Net::CBuffer serialize();
+		virtual void deserialize(Net::CBuffer& buffer);
+
+	protected:
+		CProjectileSimulator::TVolley _volley;
+	};
+	REG_FACTORYMESSAGE(CMessageProjectileSpawn);
+
+};
+
+#endif
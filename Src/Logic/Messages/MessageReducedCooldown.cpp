@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageReducedCooldown);
+	IMP_FACTORYMESSAGE(CMessageReducedCooldown, Message::REDUCED_COOLDOWN);
 
 	CMessageReducedCooldown::CMessageReducedCooldown() : CMessage(Message::REDUCED_COOLDOWN), _duration(0) {
 		// Nada que hacer
@@ -29,7 +29,7 @@ namespace Logic {
 	Net::CBuffer CMessageReducedCooldown::serialize() {
 
 		Net::CBuffer buffer(2*sizeof(int));
-		buffer.serialize(std::string("CMessageReducedCooldown"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_percentCooldown);
 
 		return buffer;
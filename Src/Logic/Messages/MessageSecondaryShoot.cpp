@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSecondaryShoot);
+	IMP_FACTORYMESSAGE(CMessageSecondaryShoot, Message::SECONDARY_SHOOT);
 
 	CMessageSecondaryShoot::CMessageSecondaryShoot() : CMessage(Message::SECONDARY_SHOOT) {
 		// Nada que hacer
@@ -17,7 +17,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSecondaryShoot::serialize() {
 		Net::CBuffer buffer( sizeof(int) );
-		buffer.serialize( std::string("CMessageSecondaryShoot"), true );
+		buffer.serialize( ID );
 		buffer.serialize(_shoot);
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSecondarySpell);
+	IMP_FACTORYMESSAGE(CMessageSecondarySpell, Message::SECONDARY_SPELL);
 
 	CMessageSecondarySpell::CMessageSecondarySpell() : CMessage(Message::SECONDARY_SPELL) {
 		// Nada que hacer
@@ -17,7 +17,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSecondarySpell::serialize() {
 		Net::CBuffer buffer( sizeof(int) );
-		buffer.serialize( std::string("CMessageSecondarySpell"), true );
+		buffer.serialize( ID );
 		buffer.serialize(_spell);
 		
 		return buffer;
@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSetAnimation);
+	IMP_FACTORYMESSAGE(CMessageSetAnimation, Message::SET_ANIMATION);
 
 	CMessageSetAnimation::CMessageSetAnimation() : CMessage(Message::SET_ANIMATION) {
 		// Nada que hacer
@@ -56,7 +56,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSetAnimation::serialize() {
 		Net::CBuffer buffer((sizeof(int) * 2) + sizeof(bool) + sizeof(unsigned int));
-		buffer.serialize(std::string("CMessageSetAnimation"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_loop);
 		buffer.serialize(_rewind);
 		buffer.serialize(_animation, false);
@@ -9,7 +9,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSetOwner);
+	IMP_FACTORYMESSAGE(CMessageSetOwner, Message::SET_OWNER);
 
 	CMessageSetOwner::CMessageSetOwner() : CMessage(Message::SET_OWNER) {
 		// Nada que hacer
@@ -35,7 +35,7 @@ namespace Logic {
 		Logic::TEntityID id = _entity->getEntityID();
 
 		Net::CBuffer buffer( sizeof(int) + sizeof(id) );
-		buffer.serialize(std::string("CMessageSetOwner"), true);
+		buffer.serialize(ID);
 		buffer.serialize(id);
 		
 		return buffer;
@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSetPhysicPosition);
+	IMP_FACTORYMESSAGE(CMessageSetPhysicPosition, Message::SET_PHYSIC_POSITION);
 	
 	
 	CMessageSetPhysicPosition::CMessageSetPhysicPosition() : CMessage(Message::SET_PHYSIC_POSITION) {
@@ -35,7 +35,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSetPhysicPosition::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_position.x) * 3);
-		buffer.serialize(std::string("CMessageSetPhysicPosition"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_position);
 		buffer.serialize(_convertCoordsToLogicWorld);
 		
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSetReducedDamage);
+	IMP_FACTORYMESSAGE(CMessageSetReducedDamage, Message::SET_REDUCED_DAMAGE);
 
 	//__________________________________________________________________
 
@@ -35,7 +35,7 @@ namespace Logic {
 	Net::CBuffer CMessageSetReducedDamage::serialize() {
 		// Tamao de la cabecera (int) + porcentaje de reduccin (float)
 		Net::CBuffer buffer( sizeof(int) + sizeof(float) );
-		buffer.serialize( std::string("CMessageSetReducedDamage"), true );
+		buffer.serialize( ID );
 		buffer.serialize(_reducedDamage);
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSide);
+	IMP_FACTORYMESSAGE(CMessageSide, Message::SIDE);
 
 	CMessageSide::CMessageSide() : CMessage(Message::SIDE) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSide::serialize() {
 		Net::CBuffer buffer(sizeof(int));
-		buffer.serialize(std::string("CMessageSide"), true);
+		buffer.serialize(ID);
 		
 		return buffer;
 	}//
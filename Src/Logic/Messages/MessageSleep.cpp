@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSleep);
+	IMP_FACTORYMESSAGE(CMessageSleep, Message::SLEEP);
 
 	CMessageSleep::CMessageSleep() : CMessage(Message::SLEEP) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSleep::serialize() {
 		Net::CBuffer buffer(sizeof(int));
-		buffer.serialize(std::string("CMessageSleep"), true);
+		buffer.serialize(ID);
 		
 		return buffer;
 	}//
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSpawnIsLive);
+	IMP_FACTORYMESSAGE(CMessageSpawnIsLive, Message::SPAWN_IS_LIVE);
 
 	CMessageSpawnIsLive::CMessageSpawnIsLive() : CMessage(Message::SPAWN_IS_LIVE) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageSpawnIsLive::serialize() {
 		Net::CBuffer buffer( sizeof(int) );
-		buffer.serialize( std::string("CMessageSpawnIsLive"), true );
+		buffer.serialize( ID );
 
 		return buffer;
 	}//
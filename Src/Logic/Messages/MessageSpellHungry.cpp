@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSpellHungry);
+	IMP_FACTORYMESSAGE(CMessageSpellHungry, Message::SPELL_HUNGRY);
 
 	CMessageSpellHungry::CMessageSpellHungry() : CMessage(Message::SPELL_HUNGRY) {
 		// Nada que hacer
@@ -28,7 +28,7 @@ namespace Logic {
 		
 	Net::CBuffer CMessageSpellHungry::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_spellHungry));
-		buffer.serialize(std::string("CMessageSpellHungry"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_spellHungry);
 		
 		return buffer;
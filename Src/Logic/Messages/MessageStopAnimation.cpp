@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageStopAnimation);
+	IMP_FACTORYMESSAGE(CMessageStopAnimation, Message::STOP_ANIMATION);
 
 	CMessageStopAnimation::CMessageStopAnimation() : CMessage(Message::STOP_ANIMATION) {
 		// Nada que hacer
@@ -26,7 +26,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageStopAnimation::serialize() {
 		Net::CBuffer buffer((sizeof(int) * 2) + sizeof(bool));
-		buffer.serialize(std::string("CMessageStopAnimation"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_string, false);
 		
 		return buffer;
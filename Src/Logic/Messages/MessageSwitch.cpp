@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSwitch);
+	IMP_FACTORYMESSAGE(CMessageSwitch, Message::SWITCH);
 
 	CMessageSwitch::CMessageSwitch() : CMessage(Message::SWITCH) {
 		// Nada que hacer
@@ -25,7 +25,7 @@ namespace Logic {
 	
 	Net::CBuffer CMessageSwitch::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(unsigned char));
-		buffer.serialize(std::string("CMessageSwitch"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_change);
 		
 		return buffer;
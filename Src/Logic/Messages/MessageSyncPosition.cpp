@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageSyncPosition);
+	IMP_FACTORYMESSAGE(CMessageSyncPosition, Message::SYNC_POSITION);
 	
 	CMessageSyncPosition::CMessageSyncPosition() : CMessage(Message::SYNC_POSITION) {
 		// Nada que hacer
@@ -35,7 +35,7 @@ namespace Logic {
 		// El tamao de 3 floats para el Vector3 de direccion y 
 		// 3 floats para la orientacion (yaw,pitch,roll)
 		Net::CBuffer buffer( sizeof(int) + (sizeof(float)*3) );
-		buffer.serialize(std::string("CMessageSyncPosition"), true);
+		buffer.serialize(ID);
 		buffer.serialize(_position);
 		buffer.serialize(_orientation);
 		
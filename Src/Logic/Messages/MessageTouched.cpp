@@ -7,7 +7,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageTouched);
+	IMP_FACTORYMESSAGE(CMessageTouched, Message::TOUCHED);
 
 	CMessageTouched::CMessageTouched() : CMessage(Message::TOUCHED) {
 		// Nada que hacer
@@ -26,7 +26,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageTouched::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_entity->getEntityID()));
-		buffer.serialize(std::string("CMessageTouched"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_entity->getEntityID());
 		
 		return buffer;
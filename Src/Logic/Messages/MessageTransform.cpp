@@ -5,7 +5,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageTransform);
+	IMP_FACTORYMESSAGE(CMessageTransform, Message::SET_TRANSFORM);
 
 	CMessageTransform::CMessageTransform() : CMessage(Message::SET_TRANSFORM) {
 		// Nada que hacer
@@ -44,7 +44,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageTransform::serialize() {
 		Net::CBuffer buffer(sizeof(int)+( sizeof(float) * 6)+sizeof(bool));
-		buffer.serialize(std::string("CMessageTransform"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_position);
 		buffer.serialize(_orientation);
 		buffer.serialize(_convertCoordsToLogicWorld);
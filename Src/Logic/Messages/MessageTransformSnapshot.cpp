@@ -4,11 +4,11 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageTransformSnapshot);
+	IMP_FACTORYMESSAGE(CMessageTransformSnapshot, Message::TRANSFORM_SNAPSHOT);
 
 	//__________________________________________________________________
 
-	CMessageTransformSnapshot::CMessageTransformSnapshot() : CMessage(Message::TRANSFORM_SNAPSHOT) {
+	CMessageTransformSnapshot::CMessageTransformSnapshot() : CMessageDeltaSnapshot(Message::TRANSFORM_SNAPSHOT) {
 		// Nada que hacer
 	}
 
@@ -31,12 +31,22 @@ namespace Logic {
 	}
 
 	//__________________________________________________________________
-		
+
 	Net::CBuffer CMessageTransformSnapshot::serialize() {
 		// Tamao igual = cabecera(int) + tambuffer(int) + num matrices (5 floats * tamBuffer)
 		int bufferSize = _transformBuffer.size();
 		Net::CBuffer buffer( (2 * sizeof(int)) + (bufferSize * 5 * sizeof(float)) );
-		buffer.serialize(std::string("CMessageTransformSnapshot"), true);
+		buffer.serialize(ID);
+		buffer.serialize(_quantized);
+
+		if(_quantized) {
+			Net::CBitWriter writer(buffer);
+			serializeTransforms(writer);
+			writer.flush();
+
+			return buffer;
+		}
+
 		buffer.serialize(bufferSize);
 		for(int i = 0; i < bufferSize; ++i) {
 			buffer.serialize(_transformBuffer[i]);
@@ -48,6 +58,15 @@ namespace Logic {
 	//__________________________________________________________________
 
 	void CMessageTransformSnapshot::deserialize(Net::CBuffer& buffer) {
+		buffer.deserialize(_quantized);
+
+		if(_quantized) {
+			Net::CBitReader reader(buffer);
+			deserializeTransforms(reader);
+
+			return;
+		}
+
 		int bufferSize;
 		// Deserializar el tamao del buffer
 		buffer.deserialize(bufferSize);
@@ -1,11 +1,11 @@
 #ifndef __Logic_MessageTransformSnapshot_H
 #define __Logic_MessageTransformSnapshot_H
 
-#include "Message.h"
+#include "MessageDeltaSnapshot.h"
 
 namespace Logic {
 
-	class CMessageTransformSnapshot: public CMessage {
+	class CMessageTransformSnapshot: public CMessageDeltaSnapshot {
 	DEC_FACTORYMESSAGE(CMessageTransformSnapshot);
 	public:
 		CMessageTransformSnapshot();
@@ -13,11 +13,9 @@ namespace Logic {
 
 		void setBuffer(const std::vector<Matrix4> buffer);
 		std::vector<Matrix4> getBuffer();
-		
+
 		virtual Net::CBuffer serialize();
 		virtual void deserialize(Net::CBuffer& buffer);
-	private:
-		 std::vector<Matrix4> _transformBuffer;
 	};
 	REG_FACTORYMESSAGE(CMessageTransformSnapshot);
 };
@@ -6,7 +6,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageUntouched);
+	IMP_FACTORYMESSAGE(CMessageUntouched, Message::UNTOUCHED);
 
 	CMessageUntouched::CMessageUntouched() : CMessage(Message::UNTOUCHED) {
 		// Nada que hacer
@@ -25,7 +25,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageUntouched::serialize() {
 		Net::CBuffer buffer(sizeof(int) + sizeof(_entity->getEntityID()));
-		buffer.serialize(std::string("CMessageUntouched"),true);
+		buffer.serialize(ID);
 		buffer.serialize(_entity->getEntityID());
 		
 		return buffer;
@@ -4,7 +4,7 @@
 
 namespace Logic {
 
-	IMP_FACTORYMESSAGE(CMessageWakeUp);
+	IMP_FACTORYMESSAGE(CMessageWakeUp, Message::WAKEUP);
 
 	CMessageWakeUp::CMessageWakeUp() : CMessage(Message::WAKEUP) {
 		// Nada que hacer
@@ -13,7 +13,7 @@ namespace Logic {
 
 	Net::CBuffer CMessageWakeUp::serialize() {
 		Net::CBuffer buffer(sizeof(int));
-		buffer.serialize(std::string("CMessageWakeUp"), true);
+		buffer.serialize(ID);
 		
 		return buffer;
 	}//
@@ -0,0 +1,244 @@
+//---------------------------------------------------------------------------
+// NetRelevancy.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file NetRelevancy.cpp
+
+Contiene la implementacin del filtro de relevancia que decide qu
+entidades se replican a cada cliente.
+
+@see Logic::CNetRelevancy
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "NetRelevancy.h"
+
+#include "Logic/Server.h"
+#include "Logic/Maps/Map.h"
+#include "Logic/Entity/Entity.h"
+#include "Logic/GameNetPlayersManager.h"
+#include "Logic/PlayerInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+namespace Logic {
+
+	const float CNetRelevancy::DEFAULT_INTEREST_RADIUS = 300.0f;
+
+	namespace {
+		/** Peso de una entidad en el borde del radio de inters respecto a una pegada al avatar. */
+		const float MIN_DISTANCE_WEIGHT = 0.25f;
+
+		/** Presupuesto que se puede acumular, en milisegundos de ancho de banda. */
+		const unsigned int MAX_BUDGET_MSECS = 250;
+
+		/** Antigedad que se supone a una entidad que an no se le ha mandado a un cliente. */
+		const float NEVER_SENT_AGE = 1000.0f;
+	}
+
+	//______________________________________________________________________________
+
+	CNetRelevancy::CNetRelevancy() : _bandwidth(DEFAULT_BANDWIDTH),
+									 _time(0) {
+
+		setInterestRadius(DEFAULT_INTEREST_RADIUS);
+	} // CNetRelevancy
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::setInterestRadius(float radius) {
+		assert(radius > 0 && "El radio de interes tiene que ser positivo");
+
+		_interestRadius = radius;
+		_sqrInterestRadius = radius * radius;
+
+		// Las celdas dependen del radio
+		_grid.clear();
+	} // setInterestRadius
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::update(unsigned int msecs) {
+		_time += msecs;
+
+		for(TClientTable::iterator it = _clients.begin(); it != _clients.end(); ++it)
+			it->second.alive = false;
+
+		CMap* map = CServer::getSingletonPtr()->getMap();
+		CGameNetPlayersManager* playersMgr = CGameNetPlayersManager::getSingletonPtr();
+
+		int frameBudget = (int)(_bandwidth * msecs / 1000);
+		int maxBudget = (int)(_bandwidth * MAX_BUDGET_MSECS / 1000);
+
+		for(CGameNetPlayersManager::iterator it = playersMgr->begin(); it != playersMgr->end(); ++it) {
+			TClientInterest& client = _clients[ it->getNetId() ];
+			client.alive = true;
+			client.budget = std::min(client.budget + frameBudget, maxBudget);
+
+			std::pair<TEntityID, bool> avatarId = it->getEntityId();
+			CEntity* avatar = avatarId.second && it->isSpawned() ? map->getEntityByID(avatarId.first) : NULL;
+
+			client.hasAvatar = avatar != NULL;
+			if(client.hasAvatar) {
+				client.avatar = avatarId.first;
+				client.position = avatar->getPosition();
+			}
+		}
+
+		// Olvidamos a los clientes desconectados
+		for(TClientTable::iterator it = _clients.begin(); it != _clients.end(); ) {
+			if(it->second.alive)
+				++it;
+			else
+				_clients.erase(it++);
+		}
+	} // update
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::buildGrid(const std::vector<TEntityID>& entities) {
+		// Vaciamos las celdas sin liberarlas, en una partida se repiten
+		for(TGrid::iterator it = _grid.begin(); it != _grid.end(); ++it)
+			it->second.clear();
+
+		CMap* map = CServer::getSingletonPtr()->getMap();
+
+		TGridEntry entry;
+		for(std::vector<TEntityID>::const_iterator it = entities.begin(); it != entities.end(); ++it) {
+			CEntity* entity = map->getEntityByID(*it);
+			if(entity == NULL)
+				continue;
+
+			entry.entity = *it;
+			entry.position = entity->getPosition();
+			_grid[ getCellKey( getCell(entry.position.x), getCell(entry.position.z) ) ].push_back(entry);
+		}
+	} // buildGrid
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::getInterestSet(Net::NetID clientId, std::vector<TCandidate>& candidates) const {
+		candidates.clear();
+
+		TClientTable::const_iterator clientIt = _clients.find(clientId);
+		if(clientIt == _clients.end())
+			return;
+
+		const TClientInterest& client = clientIt->second;
+
+		TCandidate candidate;
+		if(!client.hasAvatar) {
+			// Sin avatar le interesa todo, solo priorizamos por antiguedad
+			for(TGrid::const_iterator cellIt = _grid.begin(); cellIt != _grid.end(); ++cellIt) {
+				for(std::vector<TGridEntry>::const_iterator it = cellIt->second.begin(); it != cellIt->second.end(); ++it) {
+					candidate.entity = it->entity;
+					candidate.priority = getAge(client, it->entity);
+					candidates.push_back(candidate);
+				}
+			}
+		}
+		else {
+			// Miramos las celdas que rodean al avatar
+			int cellX = getCell(client.position.x);
+			int cellZ = getCell(client.position.z);
+
+			for(int x = cellX - 1; x <= cellX + 1; ++x) {
+				for(int z = cellZ - 1; z <= cellZ + 1; ++z) {
+					TGrid::const_iterator cellIt = _grid.find( getCellKey(x, z) );
+					if(cellIt == _grid.end())
+						continue;
+
+					for(std::vector<TGridEntry>::const_iterator it = cellIt->second.begin(); it != cellIt->second.end(); ++it) {
+						if(it->entity == client.avatar)
+							continue;
+
+						float sqrDistance = it->position.squaredDistance(client.position);
+						if(sqrDistance > _sqrInterestRadius)
+							continue;
+
+						// Las entidades cercanas pesan mas que las del borde
+						float distanceWeight = 1.0f - (1.0f - MIN_DISTANCE_WEIGHT) * (sqrt(sqrDistance) / _interestRadius);
+
+						candidate.entity = it->entity;
+						candidate.priority = getAge(client, it->entity) * distanceWeight;
+						candidates.push_back(candidate);
+					}
+				}
+			}
+		}
+
+		std::sort( candidates.begin(), candidates.end() );
+	} // getInterestSet
+
+	//______________________________________________________________________________
+
+	bool CNetRelevancy::isRelevant(Net::NetID clientId, TEntityID entityId) const {
+		TClientTable::const_iterator clientIt = _clients.find(clientId);
+		if(clientIt == _clients.end() || !clientIt->second.hasAvatar || clientIt->second.avatar == entityId)
+			return true;
+
+		CEntity* entity = CServer::getSingletonPtr()->getMap()->getEntityByID(entityId);
+		if(entity == NULL)
+			return true;
+
+		return entity->getPosition().squaredDistance(clientIt->second.position) <= _sqrInterestRadius;
+	} // isRelevant
+
+	//______________________________________________________________________________
+
+	bool CNetRelevancy::hasBudget(Net::NetID clientId) const {
+		TClientTable::const_iterator clientIt = _clients.find(clientId);
+		return clientIt != _clients.end() && clientIt->second.budget > 0;
+	} // hasBudget
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::snapshotSent(Net::NetID clientId, TEntityID entityId, unsigned int size) {
+		TClientTable::iterator clientIt = _clients.find(clientId);
+		if(clientIt == _clients.end())
+			return;
+
+		clientIt->second.budget -= size;
+		clientIt->second.lastSent[entityId] = _time;
+	} // snapshotSent
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::removeEntity(TEntityID entityId) {
+		for(TClientTable::iterator it = _clients.begin(); it != _clients.end(); ++it)
+			it->second.lastSent.erase(entityId);
+	} // removeEntity
+
+	//______________________________________________________________________________
+
+	void CNetRelevancy::clear() {
+		_clients.clear();
+		_grid.clear();
+		_time = 0;
+	} // clear
+
+	//______________________________________________________________________________
+
+	float CNetRelevancy::getAge(const TClientInterest& client, TEntityID entityId) const {
+		std::map<TEntityID, unsigned int>::const_iterator it = client.lastSent.find(entityId);
+		return it != client.lastSent.end() ? (float)(_time - it->second) : NEVER_SENT_AGE;
+	} // getAge
+
+	//______________________________________________________________________________
+
+	long long CNetRelevancy::getCellKey(int x, int z) const {
+		return ( (long long)x << 32 ) | (unsigned int)z;
+	} // getCellKey
+
+	//______________________________________________________________________________
+
+	int CNetRelevancy::getCell(float coordinate) const {
+		return (int)floor(coordinate / _interestRadius);
+	} // getCell
+
+} // namespace Logic
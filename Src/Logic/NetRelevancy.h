@@ -0,0 +1,268 @@
+//---------------------------------------------------------------------------
+// NetRelevancy.h
+//---------------------------------------------------------------------------
+
+/**
+@file NetRelevancy.h
+
+Contiene la declaracin del filtro de relevancia que decide qu entidades
+se replican a cada cliente.
+
+@see Logic::CNetRelevancy
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_NetRelevancy_H
+#define __Logic_NetRelevancy_H
+
+#include "BaseSubsystems/Math.h"
+
+#include <map>
+#include <vector>
+#include <unordered_map>
+
+// Predeclaracion del typedef NetID
+namespace Net {
+	typedef unsigned int NetID;
+};
+
+namespace Logic {
+
+	// Predeclaracion del typedef TEntityID
+	typedef unsigned int TEntityID;
+
+	/**
+	Filtro de relevancia (area of interest) para la replicacin en el
+	servidor.
+	<p>
+	Cada cliente solo se interesa por las entidades que estn a menos de
+	un radio de su avatar. Para no comparar cada cliente con cada entidad,
+	las entidades con snapshot pendiente se reparten en una rejilla sobre el
+	plano XZ con celdas del tamao del radio, de modo que a cada cliente le
+	basta mirar las 3x3 celdas que rodean a su avatar.
+	<p>
+	Las entidades del conjunto de inters se ordenan por prioridad: crece
+	con el tiempo que lleva sin mandarse esa entidad a ese cliente y baja con
+	la distancia. Cada cliente tiene un presupuesto de bytes por segundo y se
+	le mandan snapshots en orden de prioridad hasta agotarlo; lo que no
+	cabe gana prioridad para el siguiente frame.
+	<p>
+	Un cliente sin avatar (muerto o sin spawnear) se interesa por todo,
+	porque su cmara puede estar en cualquier parte.
+
+	@ingroup LogicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CNetRelevancy {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Radio de inters por defecto (en unidades lgicas). */
+		static const float DEFAULT_INTEREST_RADIUS;
+
+		/** Presupuesto de snapshots por cliente por defecto (bytes por segundo). */
+		static const unsigned int DEFAULT_BANDWIDTH = 32 * 1024;
+
+
+		// =======================================================================
+		//                              ESTRUCTURAS
+		// =======================================================================
+
+
+		/** Entidad del conjunto de inters de un cliente. */
+		struct TCandidate {
+			TEntityID entity;
+			float priority;
+
+			bool operator<(const TCandidate& other) const { return priority > other.priority; }
+		};
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CNetRelevancy();
+
+
+		// =======================================================================
+		//                           METODOS PUBLICOS
+		// =======================================================================
+
+
+		/**
+		Fija el radio de inters de los clientes.
+
+		@param radius Distancia mxima (en unidades lgicas) a la que una
+		entidad es relevante para un cliente.
+		*/
+		void setInterestRadius(float radius);
+
+		//________________________________________________________________________
+
+		/**
+		Fija el presupuesto de snapshots de cada cliente.
+
+		@param bytesPerSecond Bytes por segundo que puede gastar cada cliente.
+		*/
+		void setBandwidth(unsigned int bytesPerSecond) { _bandwidth = bytesPerSecond; }
+
+		//________________________________________________________________________
+
+		/**
+		Actualiza la posicin del avatar de cada cliente conectado, le suma el
+		presupuesto del frame y olvida a los clientes que se han ido.
+
+		@param msecs Milisegundos transcurridos desde el ltimo tick.
+		*/
+		void update(unsigned int msecs);
+
+		//________________________________________________________________________
+
+		/**
+		Reparte en la rejilla las entidades que tienen algo que replicar este
+		frame.
+
+		@param entities Entidades con snapshot pendiente.
+		*/
+		void buildGrid(const std::vector<TEntityID>& entities);
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve las entidades de la rejilla relevantes para un cliente,
+		ordenadas de mayor a menor prioridad. El avatar del propio cliente no
+		se incluye: el cliente lo simula l mismo.
+
+		@param client Id de red del cliente.
+		@param candidates Parmetro de salida con el conjunto de inters.
+		*/
+		void getInterestSet(Net::NetID client, std::vector<TCandidate>& candidates) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve true si a una entidad le interesa a un cliente. Se usa para
+		los mensajes que solo se perciben cerca de la entidad.
+
+		@param client Id de red del cliente.
+		@param entity Id de la entidad.
+		*/
+		bool isRelevant(Net::NetID client, TEntityID entity) const;
+
+		//________________________________________________________________________
+
+		/** Devuelve true si al cliente le queda presupuesto en este frame. */
+		bool hasBudget(Net::NetID client) const;
+
+		//________________________________________________________________________
+
+		/**
+		Apunta que se ha mandado una snapshot de una entidad a un cliente.
+
+		@param client Id de red del cliente.
+		@param entity Id de la entidad.
+		@param size Bytes gastados.
+		*/
+		void snapshotSent(Net::NetID client, TEntityID entity, unsigned int size);
+
+		//________________________________________________________________________
+
+		/** Olvida todo lo relativo a una entidad (al destruirse). */
+		void removeEntity(TEntityID entity);
+
+		//________________________________________________________________________
+
+		/** Olvida todos los clientes y entidades. */
+		void clear();
+
+	private:
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/** Estado de replicacin de un cliente. */
+		struct TClientInterest {
+			/** Avatar del cliente y si est vivo. */
+			TEntityID avatar;
+			bool hasAvatar;
+			Vector3 position;
+
+			/** Bytes que le quedan por gastar (puede quedar en negativo). */
+			int budget;
+
+			/** Momento (reloj interno) en que se le mand cada entidad por ltima vez. */
+			std::map<TEntityID, unsigned int> lastSent;
+
+			/** true si sigue conectado en el ltimo update. */
+			bool alive;
+
+			TClientInterest() : avatar(0), hasAvatar(false), position(Vector3::ZERO), budget(0), alive(true) { }
+		};
+
+		/** Entidad de la rejilla. */
+		struct TGridEntry {
+			TEntityID entity;
+			Vector3 position;
+		};
+
+		typedef std::map<Net::NetID, TClientInterest> TClientTable;
+		typedef std::unordered_map<long long, std::vector<TGridEntry> > TGrid;
+
+
+		// =======================================================================
+		//                            METODOS PRIVADOS
+		// =======================================================================
+
+
+		/** Devuelve los milisegundos que lleva un cliente sin recibir una entidad. */
+		float getAge(const TClientInterest& client, TEntityID entity) const;
+
+		/** Devuelve la clave de la celda de la rejilla que contiene (x, z). */
+		long long getCellKey(int x, int z) const;
+
+		/** Devuelve la celda de la rejilla en la que cae una coordenada. */
+		int getCell(float coordinate) const;
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Estado de cada cliente conectado. */
+		TClientTable _clients;
+
+		/** Rejilla con las entidades pendientes de replicar. */
+		TGrid _grid;
+
+		/** Radio de inters y su cuadrado. */
+		float _interestRadius;
+		float _sqrInterestRadius;
+
+		/** Presupuesto de cada cliente (bytes por segundo). */
+		unsigned int _bandwidth;
+
+		/** Reloj interno en milisegundos. */
+		unsigned int _time;
+
+	}; // class CNetRelevancy
+
+} // namespace Logic
+
+#endif // __Logic_NetRelevancy_H
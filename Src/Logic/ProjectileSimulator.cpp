@@ -0,0 +1,509 @@
+//---------------------------------------------------------------------------
+// ProjectileSimulator.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file ProjectileSimulator.cpp
+
+Contiene la implementacin del simulador de proyectiles ligeros (los
+perdigones de la escopeta).
+
+@see Logic::CProjectileSimulator
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "ProjectileSimulator.h"
+
+#include "Logic/Server.h"
+#include "Logic/Maps/Map.h"
+#include "Logic/Maps/EntityFactory.h"
+#include "Logic/Entity/Entity.h"
+#include "Logic/Entity/Components/ShotGun.h"
+#include "Logic/Entity/Components/ScreamerShieldDamageNotifier.h"
+#include "Logic/GameNetPlayersManager.h"
+#include "Logic/Messages/MessageDamaged.h"
+#include "Logic/Messages/MessageAddAmmo.h"
+#include "Logic/Messages/MessageProjectileSpawn.h"
+#include "Logic/Messages/MessageProjectileImpact.h"
+#include "Logic/Messages/MessageProjectileRecall.h"
+
+#include "Map/MapEntity.h"
+#include "Physics/Server.h"
+#include "Physics/GeometryFactory.h"
+#include "Graphics/Scene.h"
+#include "Graphics/Entity.h"
+#include "Audio/Server.h"
+#include "Net/Manager.h"
+
+#include <sstream>
+#include <cassert>
+
+namespace Logic {
+
+	namespace {
+		/** Grupos de colisin contra los que chocan los perdigones (los del antiguo CMagneticBullet). */
+		const unsigned int PROJECTILE_FILTER_MASK = Physics::CollisionGroup::eWORLD | Physics::CollisionGroup::ePLAYER |
+													Physics::CollisionGroup::eFIREBALL | Physics::CollisionGroup::eSCREAMER_SHIELD |
+													Physics::CollisionGroup::eHITBOX;
+
+		/** Malla de los perdigones. */
+		const char* PROJECTILE_MESH = "esfera.mesh";
+
+		/** Desplazamiento respecto al dueo del punto al que vuelven los perdigones. */
+		const Vector3 RETURN_OFFSET(1.5f, 0.0f, 0.0f);
+
+		/** Devuelve un float uniforme en [0, 1] y avanza la semilla. */
+		float nextRandom(unsigned int& seed) {
+			seed = seed * 1103515245 + 12345;
+			return ( (seed >> 16) & 0x7FFF ) / 32767.0f;
+		}
+
+		/** Devuelve true si la entidad es parte del escenario. */
+		bool isWorld(CEntity* entity) {
+			const std::string& type = entity->getType();
+			return type == "PhysicWorld" || type == "World" || type == "PhysicAndGraphicWorld";
+		}
+
+		/** Crea una entidad de efecto (chispas, sangre...) en una posicin. */
+		void createEffect(const std::string& name, CMap* map, const Vector3& position) {
+			CEntityFactory* entityFactory = CEntityFactory::getSingletonPtr();
+			CEntity* effect = entityFactory->createEntity( entityFactory->getInfo(name), map, position, Quaternion::IDENTITY );
+			effect->activate();
+			effect->start();
+		}
+
+		/** Manda el dao de un perdign a una entidad. */
+		void sendDamage(CEntity* impactEntity, CEntity* owner, float damage) {
+			std::shared_ptr<CMessageDamaged> damageDone = createMessage<CMessageDamaged>();
+			damageDone->setDamage(damage);
+			damageDone->setEnemy(owner);
+			impactEntity->emitMessage(damageDone);
+		}
+	}
+
+	//______________________________________________________________________________
+
+	CProjectileSimulator* CProjectileSimulator::_instance = NULL;
+
+	//______________________________________________________________________________
+
+	CProjectileSimulator::CProjectileSimulator() : _nbProjectiles(0),
+												   _nextId(0),
+												   _nextSeed(1) {
+
+		_instance = this;
+	} // CProjectileSimulator
+
+	//______________________________________________________________________________
+
+	CProjectileSimulator::~CProjectileSimulator() {
+		clear();
+		_instance = NULL;
+	} // ~CProjectileSimulator
+
+	//______________________________________________________________________________
+
+	bool CProjectileSimulator::Init() {
+		assert(!_instance && "Segunda inicializacin de Logic::CProjectileSimulator no permitida!");
+
+		new CProjectileSimulator();
+
+		return true;
+	} // Init
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::Release() {
+		assert(_instance && "Logic::CProjectileSimulator no est inicializado!");
+
+		if(_instance)
+			delete _instance;
+	} // Release
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::clear() {
+		_nbProjectiles = 0;
+
+		// Las entidades graficas son de la escena del mapa actual
+		CServer* logicServer = CServer::getSingletonPtr();
+		CMap* map = logicServer != NULL ? logicServer->getMap() : NULL;
+		for(unsigned int i = 0; i < _graphics.size(); ++i) {
+			if(map != NULL)
+				map->getScene()->removeEntity(_graphics[i]);
+
+			delete _graphics[i];
+		}
+
+		_graphics.clear();
+		_freeGraphics.clear();
+	} // clear
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::fire(TVolley& volley) {
+		volley.firstId = _nextId;
+		volley.seed = _nextSeed;
+
+		_nextId += volley.nbProjectiles;
+		nextRandom(_nextSeed);
+
+		spawnVolley(volley);
+
+		// A los clientes solo les mandamos los parametros de la rafaga
+		Net::CManager* netMgr = Net::CManager::getSingletonPtr();
+		if( netMgr->imServer() ) {
+			CEntity* owner = CServer::getSingletonPtr()->getMap()->getEntityByID(volley.owner);
+			if(owner != NULL) {
+				std::shared_ptr<CMessageProjectileSpawn> spawnMsg = createMessage<CMessageProjectileSpawn>();
+				spawnMsg->setVolley(volley);
+				owner->emitMessage(spawnMsg);
+			}
+		}
+	} // fire
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::replicateVolley(const TVolley& volley) {
+		spawnVolley(volley);
+	} // replicateVolley
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::recall(TEntityID owner) {
+		bool found = false;
+		for(unsigned int i = 0; i < _nbProjectiles; ++i) {
+			if(_projectiles[i].owner == owner) {
+				_projectiles[i].returning = true;
+				found = true;
+			}
+		}
+
+		Net::CManager* netMgr = Net::CManager::getSingletonPtr();
+		if( found && netMgr->imServer() ) {
+			CEntity* ownerEntity = CServer::getSingletonPtr()->getMap()->getEntityByID(owner);
+			if(ownerEntity != NULL)
+				ownerEntity->emitMessage( createMessage<CMessageProjectileRecall>() );
+		}
+	} // recall
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::replicateImpact(unsigned int id) {
+		for(unsigned int i = 0; i < _nbProjectiles; ++i) {
+			if(_projectiles[i].id == id) {
+				destroyProjectile(i);
+				return;
+			}
+		}
+	} // replicateImpact
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::fixedTick(CMap* map, unsigned int msecs) {
+		if(_nbProjectiles == 0)
+			return;
+
+		Net::CManager* netMgr = Net::CManager::getSingletonPtr();
+		bool authoritative = !netMgr->imClient();
+
+		// Primero las direcciones: los que vuelven buscan a su dueo
+		for(unsigned int i = 0; i < _nbProjectiles; ) {
+			TProjectile& projectile = _projectiles[i];
+			CEntity* owner = map->getEntityByID(projectile.owner);
+
+			if(projectile.ticksLeft == 0 || (projectile.returning && owner == NULL) ) {
+				destroyProjectile(i);
+				continue;
+			}
+
+			--projectile.ticksLeft;
+			if(projectile.returning) {
+				Vector3 target = owner->getPosition() + RETURN_OFFSET + Vector3(0, projectile.returnHeight, 0);
+				projectile.direction = target - projectile.position;
+				projectile.direction.normalise();
+			}
+
+			++i;
+		}
+
+		// Los clientes solo mueven lo que pintan, los impactos les llegan del
+		// servidor
+		if(!authoritative) {
+			for(unsigned int i = 0; i < _nbProjectiles; ++i) {
+				TProjectile& projectile = _projectiles[i];
+				projectile.position += projectile.direction * projectile.speed;
+				if(projectile.graphics != NULL)
+					projectile.graphics->setPosition(projectile.position);
+			}
+
+			return;
+		}
+
+		// Un lote de sweeps por cada radio distinto (normalmente solo hay uno)
+		Physics::CServer* physicsServer = Physics::CServer::getSingletonPtr();
+		Physics::CGeometryFactory* geometryFactory = Physics::CGeometryFactory::getSingletonPtr();
+
+		for(unsigned int i = 0; i < _nbProjectiles; ++i) {
+			Physics::CSweepQuery& query = _queries[i];
+			query.position = _projectiles[i].position;
+			query.unitDir = _projectiles[i].direction;
+			query.distance = _projectiles[i].speed;
+			query.filterMask = PROJECTILE_FILTER_MASK;
+			query.single = false;
+		}
+
+		_hits.clear();
+		unsigned int first = 0;
+		while(first < _nbProjectiles) {
+			// Los proyectiles de una rafaga estan juntos en el pool, asi que
+			// agrupamos tramos consecutivos con el mismo radio
+			unsigned int last = first + 1;
+			while(last < _nbProjectiles && _projectiles[last].radius == _projectiles[first].radius)
+				++last;
+
+			Physics::SphereGeometry sphere = geometryFactory->createSphere(_projectiles[first].radius);
+			physicsServer->sweepBatch(sphere, _queries + first, last - first, _results + first, _hits, true);
+
+			first = last;
+		}
+
+		// Resolvemos los impactos. Al destruir un proyectil el ultimo ocupa
+		// su hueco, asi que recorremos el pool hacia atras para no perder
+		// ningun resultado.
+		for(int i = _nbProjectiles - 1; i >= 0; --i) {
+			TProjectile& projectile = _projectiles[i];
+			CEntity* owner = map->getEntityByID(projectile.owner);
+
+			bool destroyed = false;
+			CEntity* lastEntity = NULL;
+			for(unsigned int j = 0; j < _results[i].nbHits && !destroyed; ++j) {
+				const Physics::CSweepHit& hit = _hits[ _results[i].firstHit + j ];
+
+				// Una entidad con varias formas solo cuenta una vez
+				if(hit.entity == NULL || hit.entity == lastEntity)
+					continue;
+
+				lastEntity = hit.entity;
+				Vector3 impactPosition = projectile.position + projectile.direction * hit.distance;
+
+				Vector3 previousPosition = projectile.position;
+				projectile.position = impactPosition;
+				destroyed = impact(projectile, owner, hit.entity);
+				if(!destroyed)
+					projectile.position = previousPosition;
+			}
+
+			if(destroyed) {
+				if( netMgr->imServer() && owner != NULL ) {
+					std::shared_ptr<CMessageProjectileImpact> impactMsg = createMessage<CMessageProjectileImpact>();
+					impactMsg->setProjectileId(projectile.id);
+					owner->emitMessage(impactMsg);
+				}
+
+				destroyProjectile(i);
+			}
+			else {
+				projectile.position += projectile.direction * projectile.speed;
+				if(projectile.graphics != NULL)
+					projectile.graphics->setPosition(projectile.position);
+			}
+		}
+	} // fixedTick
+
+	//______________________________________________________________________________
+
+	Vector3 CProjectileSimulator::getPelletDirection(const Vector3& direction, float dispersion, unsigned int& seed) {
+		// Igual que Vector3::randomDeviant pero con nuestro generador
+		Ogre::Radian angle( nextRandom(seed) * dispersion * 0.01f );
+		Ogre::Radian roll( nextRandom(seed) * Math::PI * 2.0f );
+
+		Vector3 up = direction.perpendicular();
+		up = Quaternion(roll, direction) * up;
+
+		Vector3 pelletDirection = Quaternion(angle, up) * direction;
+		pelletDirection.normalise();
+
+		return pelletDirection;
+	} // getPelletDirection
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::spawnVolley(const TVolley& volley) {
+		CMap* map = CServer::getSingletonPtr()->getMap();
+		bool render = !Net::CManager::getSingletonPtr()->imServer();
+
+		unsigned int seed = volley.seed;
+		for(unsigned int i = 0; i < volley.nbProjectiles; ++i) {
+			Vector3 direction = getPelletDirection(volley.direction, volley.dispersion, seed);
+
+			if(_nbProjectiles == MAX_PROJECTILES) {
+				// Pool lleno: el perdigon mas antiguo deja su hueco
+				destroyProjectile(0);
+			}
+
+			TProjectile& projectile = _projectiles[_nbProjectiles++];
+			projectile.id = volley.firstId + i;
+			projectile.owner = volley.owner;
+			projectile.position = volley.origin;
+			projectile.direction = direction;
+			projectile.speed = volley.speed;
+			projectile.radius = volley.radius;
+			projectile.returnHeight = volley.returnHeight;
+			projectile.damage = volley.damage;
+			projectile.returning = false;
+			projectile.ticksLeft = MAX_LIFETIME_TICKS;
+			projectile.graphics = render ? acquireGraphics(map) : NULL;
+
+			if(projectile.graphics != NULL)
+				projectile.graphics->setPosition(projectile.position);
+		}
+	} // spawnVolley
+
+	//______________________________________________________________________________
+
+	bool CProjectileSimulator::impact(TProjectile& projectile, CEntity* owner, CEntity* impactEntity) {
+		CMap* map = impactEntity->getMap();
+
+		if( isWorld(impactEntity) ) {
+			if(owner != NULL) {
+				CShotGun* shotGun = owner->getComponent<CShotGun>();
+				if(shotGun != NULL)
+					shotGun->projectileImpact(projectile.position, impactEntity);
+			}
+
+			// Particulas de colision
+			createEffect("BulletSpark", map, projectile.position);
+
+			int randomValue = Math::unifRand(2);
+			std::string ricochetSound = (randomValue == 1 ? "weapons/hit/ric3.wav" : "weapons/hit/ric2.wav");
+			Audio::CServer::getSingletonPtr()->playSound3D(ricochetSound, projectile.position, Vector3::ZERO, false, false);
+
+			return true;
+		}
+
+		if(owner == NULL)
+			return false;
+
+		// Al dueo solo le afecta cuando vuelve: recupera la municion
+		if(impactEntity == owner) {
+			if(!projectile.returning)
+				return false;
+
+			std::shared_ptr<CMessageAddAmmo> addAmmoMsg = createMessage<CMessageAddAmmo>();
+			addAmmoMsg->setAddAmmo(1);
+			addAmmoMsg->setAddWeapon(WeaponType::eSHOTGUN);
+			owner->emitMessage(addAmmoMsg);
+
+			return true;
+		}
+
+		const std::string& entityType = impactEntity->getType();
+		float damage = projectile.damage;
+
+		CGameNetPlayersManager* playersMgr = CGameNetPlayersManager::getSingletonPtr();
+		TEntityID playerId = owner->getEntityID();
+
+		if(entityType == "FireBall") {
+			// Lo suyo seria incendiar el perdigon y cambiarle el efecto
+		}
+		else if(entityType == "ScreamerShield") {
+			// Nuestro propio escudo no nos para
+			CEntity* screamerShieldOwner = impactEntity->getComponent<CScreamerShieldDamageNotifier>()->getOwner();
+			if(screamerShieldOwner != owner) {
+				TEntityID enemyId = impactEntity->getEntityID();
+
+				if( playersMgr->existsByLogicId(enemyId) ) {
+					TeamFaction::Enum enemyTeam = playersMgr->getTeamUsingEntityId(enemyId);
+					TeamFaction::Enum myTeam = playersMgr->getTeamUsingEntityId(playerId);
+
+					if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam)
+						sendDamage(impactEntity, owner, damage);
+				}
+				else {
+					sendDamage(impactEntity, owner, damage);
+				}
+			}
+
+			createEffect("ScreamerShieldHit", map, projectile.position);
+		}
+		else {
+			TEntityID enemyId = impactEntity->getEntityID();
+
+			if( playersMgr->existsByLogicId(enemyId) ) {
+				TeamFaction::Enum enemyTeam = playersMgr->getTeamUsingEntityId(enemyId);
+				TeamFaction::Enum myTeam = playersMgr->getTeamUsingEntityId(playerId);
+
+				if( !playersMgr->friendlyFireIsActive() && enemyId != playerId ) {
+					if(enemyTeam == TeamFaction::eNONE || myTeam == TeamFaction::eNONE || enemyTeam != myTeam)
+						sendDamage(impactEntity, owner, damage);
+				}
+				else {
+					sendDamage(impactEntity, owner, damage);
+				}
+			}
+			else {
+				sendDamage(impactEntity, owner, damage);
+			}
+
+			// Particulas de sangre
+			createEffect("BloodStrike", map, projectile.position);
+		}
+
+		// A los jugadores los atraviesa
+		return false;
+	} // impact
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::destroyProjectile(unsigned int slot) {
+		assert(slot < _nbProjectiles && "Hueco del pool de proyectiles fuera de rango");
+
+		if(_projectiles[slot].graphics != NULL)
+			releaseGraphics(_projectiles[slot].graphics);
+
+		// Movemos el ultimo al hueco para no dejar agujeros
+		unsigned int last = --_nbProjectiles;
+		if(slot != last) {
+			_projectiles[slot] = _projectiles[last];
+			_queries[slot] = _queries[last];
+			_results[slot] = _results[last];
+		}
+	} // destroyProjectile
+
+	//______________________________________________________________________________
+
+	Graphics::CEntity* CProjectileSimulator::acquireGraphics(CMap* map) {
+		Graphics::CEntity* graphics;
+
+		if( !_freeGraphics.empty() ) {
+			graphics = _freeGraphics.back();
+			_freeGraphics.pop_back();
+		}
+		else {
+			std::stringstream name;
+			name << "Projectile_" << _graphics.size();
+
+			graphics = new Graphics::CEntity(name.str(), PROJECTILE_MESH);
+			if( !map->getScene()->addEntity(graphics) ) {
+				delete graphics;
+				return NULL;
+			}
+
+			_graphics.push_back(graphics);
+		}
+
+		graphics->setVisible(true);
+		return graphics;
+	} // acquireGraphics
+
+	//______________________________________________________________________________
+
+	void CProjectileSimulator::releaseGraphics(Graphics::CEntity* graphics) {
+		graphics->setVisible(false);
+		_freeGraphics.push_back(graphics);
+	} // releaseGraphics
+
+} // namespace Logic
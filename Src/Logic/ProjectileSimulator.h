@@ -0,0 +1,330 @@
+//---------------------------------------------------------------------------
+// ProjectileSimulator.h
+//---------------------------------------------------------------------------
+
+/**
+@file ProjectileSimulator.h
+
+Contiene la declaracin del simulador de proyectiles ligeros (los
+perdigones de la escopeta).
+
+@see Logic::CProjectileSimulator
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_ProjectileSimulator_H
+#define __Logic_ProjectileSimulator_H
+
+#include "BaseSubsystems/Math.h"
+#include "Physics/QueryBatch.h"
+#include "Physics/SweepHit.h"
+
+#include <vector>
+
+// Predeclaracion de clases
+namespace Logic {
+	class CEntity;
+	class CMap;
+};
+
+namespace Graphics {
+	class CEntity;
+};
+
+namespace Logic {
+
+	// Predeclaracion del typedef TEntityID
+	typedef unsigned int TEntityID;
+
+	/**
+	Simulador de proyectiles de vida corta.
+	<p>
+	Los perdigones de la escopeta ya no son entidades: cada uno es un struct
+	en un pool de tamao fijo, sin componentes, actores de PhysX ni rplica
+	por entidad. En cada paso del tick fijo se barre una esfera por
+	perdign vivo y todos los barridos van a PhysX en un nico lote
+	(Physics::CServer::sweepBatch).
+	<p>
+	La simulacin corre igual en todas las mquinas, pero solo la autoritativa
+	(el servidor o el single player) aplica los impactos. Por la red viajan
+	nicamente los parmetros de la rfaga (origen, direccin, dispersin y
+	semilla: las direcciones de los perdigones se regeneran igual en el
+	cliente), la orden de retorno del disparo secundario y los impactos.
+	Los clientes solo pintan los perdigones, con un pool de entidades
+	grficas que se reciclan.
+	<p>
+	Un perdign se destruye al chocar con el mundo o al volver a su dueo;
+	a los jugadores los atraviesa hacindoles dao al entrar en ellos.
+
+	@ingroup LogicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CProjectileSimulator {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Nmero mximo de proyectiles vivos a la vez. */
+		static const unsigned int MAX_PROJECTILES = 512;
+
+		/** Pasos de tick fijo que vive como mucho un proyectil. */
+		static const unsigned int MAX_LIFETIME_TICKS = 600;
+
+
+		// =======================================================================
+		//                              ESTRUCTURAS
+		// =======================================================================
+
+
+		/** Parmetros de una rfaga, tal y como se replican a los clientes. */
+		struct TVolley {
+			/** Entidad que dispara. */
+			TEntityID owner;
+			/** Id del primer perdign, el resto van seguidos. */
+			unsigned int firstId;
+			/** Nmero de perdigones. */
+			unsigned int nbProjectiles;
+			/** Punto de salida de los perdigones. */
+			Vector3 origin;
+			/** Direccin en la que apunta el arma. */
+			Vector3 direction;
+			/** Dispersin del arma, con el formato del arquetipo. */
+			float dispersion;
+			/** Semilla de la que salen las direcciones de los perdigones. */
+			unsigned int seed;
+			/** Desplazamiento de cada perdign por paso de tick fijo. */
+			float speed;
+			/** Radio de los perdigones. */
+			float radius;
+			/** Altura sobre el dueo a la que vuelven los perdigones. */
+			float returnHeight;
+			/** Dao por perdign. */
+			float damage;
+		};
+
+
+		// =======================================================================
+		//                  METODOS DE INICIALIZACION Y ACTIVACION
+		// =======================================================================
+
+
+		/**
+		Devuelve la nica instancia de la clase CProjectileSimulator.
+
+		@return nica instancia de la clase CProjectileSimulator.
+		*/
+		static CProjectileSimulator* getSingletonPtr() { return _instance; }
+
+		//________________________________________________________________________
+
+		/**
+		Inicializa la instancia
+
+		@return Devuelve false si no se ha podido inicializar.
+		*/
+		static bool Init();
+
+		//________________________________________________________________________
+
+		/**
+		Libera la instancia de CProjectileSimulator. Debe llamarse al finalizar
+		la aplicacin.
+		*/
+		static void Release();
+
+		//________________________________________________________________________
+
+		/**
+		Destruye todos los proyectiles y las entidades grficas del pool. Hay
+		que llamarlo antes de destruir el mapa.
+		*/
+		void clear();
+
+
+		// =======================================================================
+		//                       METODOS DE LOS PROYECTILES
+		// =======================================================================
+
+
+		/**
+		Dispara una rfaga. En el servidor la replica a los clientes a travs
+		de la entidad que dispara.
+
+		@param volley Parmetros de la rfaga. Los campos firstId y seed los
+		rellena el simulador.
+		*/
+		void fire(TVolley& volley);
+
+		//________________________________________________________________________
+
+		/**
+		Crea los perdigones de una rfaga que ha disparado el servidor.
+
+		@param volley Parmetros de la rfaga recibidos por la red.
+		*/
+		void replicateVolley(const TVolley& volley);
+
+		//________________________________________________________________________
+
+		/**
+		Hace que todos los perdigones de una entidad vuelvan hacia ella.
+
+		@param owner Entidad duea de los perdigones.
+		*/
+		void recall(TEntityID owner);
+
+		//________________________________________________________________________
+
+		/**
+		Destruye un perdign que el servidor ha dado por impactado.
+
+		@param id Id del perdign.
+		*/
+		void replicateImpact(unsigned int id);
+
+		//________________________________________________________________________
+
+		/**
+		Avanza un paso todos los proyectiles.
+
+		@param map Mapa en el que viven los proyectiles.
+		@param msecs Duracin del paso del tick fijo.
+		*/
+		void fixedTick(CMap* map, unsigned int msecs);
+
+		//________________________________________________________________________
+
+		/** Devuelve el nmero de proyectiles vivos. */
+		unsigned int getNbProjectiles() const { return _nbProjectiles; }
+
+		//________________________________________________________________________
+
+		/**
+		Genera la direccin de un perdign a partir de la direccin del arma.
+		Es determinista para que el cliente obtenga las mismas direcciones con
+		la misma semilla.
+
+		@param direction Direccin unitaria del arma.
+		@param dispersion Dispersin del arma, con el formato del arquetipo.
+		@param seed Semilla del generador, se actualiza en cada llamada.
+		@return Direccin unitaria del perdign.
+		*/
+		static Vector3 getPelletDirection(const Vector3& direction, float dispersion, unsigned int& seed);
+
+	private:
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/** Estado de un proyectil. */
+		struct TProjectile {
+			unsigned int id;
+			TEntityID owner;
+			Vector3 position;
+			Vector3 direction;
+			float speed;
+			float radius;
+			float returnHeight;
+			float damage;
+			bool returning;
+			unsigned int ticksLeft;
+
+			/** Representacin grfica (solo en las mquinas que pintan). */
+			Graphics::CEntity* graphics;
+		};
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CProjectileSimulator();
+
+		//________________________________________________________________________
+
+		/** Destructor. */
+		~CProjectileSimulator();
+
+
+		// =======================================================================
+		//                            METODOS PRIVADOS
+		// =======================================================================
+
+
+		/** Aade los perdigones de una rfaga al pool. */
+		void spawnVolley(const TVolley& volley);
+
+		//________________________________________________________________________
+
+		/**
+		Aplica el impacto de un proyectil contra una entidad.
+
+		@return true si el proyectil se destruye con el impacto.
+		*/
+		bool impact(TProjectile& projectile, CEntity* owner, CEntity* impactEntity);
+
+		//________________________________________________________________________
+
+		/**
+		Quita el proyectil del hueco dado del pool, moviendo el ltimo a su
+		lugar.
+		*/
+		void destroyProjectile(unsigned int slot);
+
+		//________________________________________________________________________
+
+		/** Saca una entidad grfica del pool (o crea una nueva). */
+		Graphics::CEntity* acquireGraphics(CMap* map);
+
+		//________________________________________________________________________
+
+		/** Devuelve una entidad grfica al pool. */
+		void releaseGraphics(Graphics::CEntity* graphics);
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** nica instancia de la clase. */
+		static CProjectileSimulator* _instance;
+
+		/** Proyectiles vivos, compactados al principio del array. */
+		TProjectile _projectiles[MAX_PROJECTILES];
+		unsigned int _nbProjectiles;
+
+		/** Id que recibir el siguiente perdign disparado. */
+		unsigned int _nextId;
+
+		/** Semilla de la siguiente rfaga. */
+		unsigned int _nextSeed;
+
+		/** Buffers del lote de sweeps, se reutilizan de un paso a otro. */
+		Physics::CSweepQuery _queries[MAX_PROJECTILES];
+		Physics::CQueryResult _results[MAX_PROJECTILES];
+		std::vector<Physics::CSweepHit> _hits;
+
+		/** Entidades grficas creadas y las que estn libres. */
+		std::vector<Graphics::CEntity*> _graphics;
+		std::vector<Graphics::CEntity*> _freeGraphics;
+
+	}; // class CProjectileSimulator
+
+} // namespace Logic
+
+#endif // __Logic_ProjectileSimulator_H
@@ -16,6 +16,9 @@ la gesti
 #include "Logic/GameSpawnManager.h"
 #include "Logic/Maps/PreloadResourceManager.h"
 #include "Logic/GameNetPlayersManager.h"
+#include "Logic/SnapshotHistory.h"
+#include "Logic/LagCompensation.h"
+#include "Logic/ProjectileSimulator.h"
 #include "Logic/Maps/EntityFactory.h"
 #include "Logic/Maps/GUIManager.h"
 #include "Logic/Maps/WorldState.h"
@@ -33,6 +36,7 @@ namespace Logic {
 
 	CServer::CServer() : _map(0), 
 						 _player(0), 
+						 _preloadResourceManager(0),
 						 COMPONENT_CONSTRUCTOR_COUNTER(0), 
 						 COMPONENT_DESTRUCTOR_COUNTER(0),
 						 MESSAGE_CONSTRUCTOR_COUNTER(0),
@@ -130,6 +134,18 @@ namespace Logic {
 		if(!Logic::CWorldState::Init())
 			return false;
 
+		// Inicializamos el historial de snapshots enviadas/recibidas
+		if(!Logic::CSnapshotHistory::Init())
+			return false;
+
+		// Inicializamos el historial de hitboxes para la compensacion de lag
+		if(!Logic::CLagCompensation::Init())
+			return false;
+
+		// Inicializamos el simulador de proyectiles ligeros
+		if(!Logic::CProjectileSimulator::Init())
+			return false;
+
 		return true;
 
 	} // open
@@ -158,6 +174,12 @@ namespace Logic {
 
 		CGameNetPlayersManager::Release();
 
+		CSnapshotHistory::Release();
+
+		CLagCompensation::Release();
+
+		CProjectileSimulator::Release();
+
 	} // close
 
 	//--------------------------------------------------------
@@ -169,6 +191,9 @@ namespace Logic {
 
 		if(_map = CMap::createMapFromFile(filename))
 		{
+			// Reservamos ya las entidades efimeras que se reciclan
+			CEntityFactory::getSingletonPtr()->prewarmPools();
+
 			std::cout << "loadlevel terminado: "<< _map->getMapName() << std::endl;
 			return true;
 		}
@@ -184,7 +209,12 @@ namespace Logic {
 		_guiManager->deactivate();
 		if(_map)
 		{
-			_preloadResourceManager->unloadResources(_map->getMapName());
+			// Los perdigones pintan en la escena del mapa
+			CProjectileSimulator::getSingletonPtr()->clear();
+
+			// El gestor de precarga no se inicializa (ver open)
+			if( _preloadResourceManager )
+				_preloadResourceManager->unloadResources(_map->getMapName());
 			_map->deactivate();
 			_gameSpawnManager->deactivate();
 			_gameNetMsgManager->deactivate();
@@ -193,7 +223,11 @@ namespace Logic {
 			_map = 0;
 		}
 		_player = 0;
+
+		CSnapshotHistory::getSingletonPtr()->clear();
+		CLagCompensation::getSingletonPtr()->clear();
 		
+		Logic::CEntityFactory::getSingletonPtr()->releasePools();
 		Logic::CEntityFactory::getSingletonPtr()->releaseDispatcher();
 	} // unLoadLevel
 
@@ -203,7 +237,8 @@ namespace Logic {
 		_gameSpawnManager->activate();
 		_gameNetMsgManager->activate();
 		_guiManager->activate();
-		_preloadResourceManager->preloadResources(_map->getMapName());
+		if( _preloadResourceManager )
+			_preloadResourceManager->preloadResources(_map->getMapName());
 		CGameNetPlayersManager::getSingletonPtr()->activate();
 		CLightManager::getSingletonPtr()->activate();
 
@@ -234,9 +269,12 @@ namespace Logic {
 
 	//---------------------------------------------------------
 
-	void CServer::tick(unsigned int msecs) {
+	void CServer::tick(unsigned int msecs, unsigned int fixedSteps) {
 		// Hacemos el tick al gestor del mapa.
-		_map->tick(msecs);
+		_map->tick(msecs, fixedSteps);
+
+		// Repartimos entre los clientes lo que ha generado el frame
+		_gameNetMsgManager->tick(msecs);
 
 		//_guiManager->tick(msecs);
 		//tick de GUI
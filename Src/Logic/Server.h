@@ -87,8 +87,9 @@ namespace Logic
 		Llamar al mtodo tick() del mapa.
 
 		@param msecs Milisegundos transcurridos desde el ltimo tick.
+		@param fixedSteps Pasos de tick fijo que hay que dar en este frame.
 		*/
-		void tick(unsigned int msecs);
+		void tick(unsigned int msecs, unsigned int fixedSteps);
 
 		/**
 		Funcin que activa el mapa en curso.
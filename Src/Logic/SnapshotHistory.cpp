@@ -0,0 +1,218 @@
+//---------------------------------------------------------------------------
+// SnapshotHistory.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file SnapshotHistory.cpp
+
+Contiene la implementacin del historial de snapshots que usan servidor y
+clientes para codificar las snapshots como diferencias.
+
+@see Logic::CSnapshotHistory
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "SnapshotHistory.h"
+
+#include "Net/Manager.h"
+#include "Net/paquete.h"
+#include "Net/conexion.h"
+#include "Net/buffer.h"
+
+#include <cassert>
+
+namespace Logic {
+
+	CSnapshotHistory* CSnapshotHistory::_instance = NULL;
+
+	//______________________________________________________________________________
+
+	CSnapshotHistory::CSnapshotHistory() {
+		_instance = this;
+	} // CSnapshotHistory
+
+	//______________________________________________________________________________
+
+	CSnapshotHistory::~CSnapshotHistory() {
+		_instance = NULL;
+	} // ~CSnapshotHistory
+
+	//______________________________________________________________________________
+
+	bool CSnapshotHistory::Init() {
+		assert(!_instance && "Segunda inicializacin de Logic::CSnapshotHistory no permitida!");
+
+		new CSnapshotHistory();
+
+		return true;
+	} // Init
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::Release() {
+		assert(_instance && "Logic::CSnapshotHistory no est inicializado!");
+
+		if(_instance)
+			delete _instance;
+	} // Release
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::clear() {
+		_sent.clear();
+		_received.clear();
+		_pendingAcks.clear();
+	} // clear
+
+	//______________________________________________________________________________
+
+	const CSnapshotHistory::TSnapshotRecord* CSnapshotHistory::TEntityHistory::find(unsigned int sequence) const {
+		const TSnapshotRecord& record = records[sequence % HISTORY_SIZE];
+		return (record.valid && record.sequence == sequence) ? &record : NULL;
+	} // find
+
+	//______________________________________________________________________________
+
+	bool CSnapshotHistory::getBaseline(Net::NetID client, TEntityID entity, unsigned int& sequence, Net::TQuantizedTransform& baseline) {
+		auto clientIt = _sent.find(client);
+		if( clientIt == _sent.end() )
+			return false;
+
+		auto entityIt = clientIt->second.find(entity);
+		if( entityIt == clientIt->second.end() || !entityIt->second.hasAck )
+			return false;
+
+		// Si la snapshot confirmada ya se ha sobrescrito (llevamos demasiadas
+		// snapshots sin confirmacion) mandamos la snapshot completa
+		const TSnapshotRecord* record = entityIt->second.find(entityIt->second.lastAcked);
+		if(record == NULL)
+			return false;
+
+		sequence = record->sequence;
+		baseline = record->state;
+
+		return true;
+	} // getBaseline
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::snapshotSent(Net::NetID client, TEntityID entity, unsigned int sequence, const Net::TQuantizedTransform& state) {
+		TSnapshotRecord& record = _sent[client][entity].records[sequence % HISTORY_SIZE];
+		record.sequence = sequence;
+		record.state = state;
+		record.valid = true;
+	} // snapshotSent
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::processAcks(Net::CPaquete* packet) {
+		Net::NetID client = packet->getConexion()->getId();
+
+		Net::CBuffer buffer = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
+
+		Net::NetMessageType msgType;
+		buffer.read( &msgType, sizeof(msgType) );
+
+		auto clientIt = _sent.find(client);
+
+		Net::CBitReader reader(buffer);
+		unsigned int nbAcks = reader.readVarUInt();
+		for(unsigned int i = 0; i < nbAcks; ++i) {
+			TEntityID entity = reader.readVarUInt();
+			unsigned int sequence = reader.readVarUInt();
+
+			if( clientIt == _sent.end() )
+				continue;
+
+			auto entityIt = clientIt->second.find(entity);
+			// Solo aceptamos confirmaciones de snapshots que realmente hemos
+			// mandado y que sean mas nuevas que la baseline actual (los paquetes
+			// de confirmacion no son fiables y pueden llegar desordenados)
+			if( entityIt == clientIt->second.end() || entityIt->second.find(sequence) == NULL )
+				continue;
+
+			TEntityHistory& history = entityIt->second;
+			if( !history.hasAck || (int)(sequence - history.lastAcked) > 0 ) {
+				history.lastAcked = sequence;
+				history.hasAck = true;
+			}
+		}
+	} // processAcks
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::removeClient(Net::NetID client) {
+		_sent.erase(client);
+	} // removeClient
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::snapshotReceived(TEntityID entity, unsigned int sequence, const Net::TQuantizedTransform& state) {
+		TSnapshotRecord& record = _received[entity].records[sequence % HISTORY_SIZE];
+		record.sequence = sequence;
+		record.state = state;
+		record.valid = true;
+
+		// Basta con confirmar la ultima snapshot de cada entidad (las snapshots
+		// no son fiables y pueden llegar desordenadas)
+		auto ackIt = _pendingAcks.find(entity);
+		if( ackIt == _pendingAcks.end() )
+			_pendingAcks[entity] = sequence;
+		else if( ackIt->second < sequence )
+			ackIt->second = sequence;
+	} // snapshotReceived
+
+	//______________________________________________________________________________
+
+	bool CSnapshotHistory::getReceived(TEntityID entity, unsigned int sequence, Net::TQuantizedTransform& state) {
+		auto entityIt = _received.find(entity);
+		if( entityIt == _received.end() )
+			return false;
+
+		const TSnapshotRecord* record = entityIt->second.find(sequence);
+		if(record == NULL)
+			return false;
+
+		state = record->state;
+		return true;
+	} // getReceived
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::sendAcks() {
+		if( _pendingAcks.empty() )
+			return;
+
+		Net::NetMessageType msgType = Net::SNAPSHOT_ACK;
+		Net::CBuffer ackBuffer;
+		ackBuffer.write( &msgType, sizeof(msgType) );
+
+		Net::CBitWriter writer(ackBuffer);
+		writer.writeVarUInt( _pendingAcks.size() );
+		for(auto it = _pendingAcks.begin(); it != _pendingAcks.end(); ++it) {
+			writer.writeVarUInt(it->first);
+			writer.writeVarUInt(it->second);
+		}
+		writer.flush();
+
+		// Las confirmaciones viajan por su propio canal y sin fiabilidad: si se
+		// pierde una, la siguiente la reemplaza
+		Net::CManager::getSingletonPtr()->broadcast( ackBuffer.getbuffer(), ackBuffer.getSize(), Net::ACK_CHANNEL );
+
+		_pendingAcks.clear();
+	} // sendAcks
+
+	//______________________________________________________________________________
+
+	void CSnapshotHistory::removeEntity(TEntityID entity) {
+		for(auto it = _sent.begin(); it != _sent.end(); ++it) {
+			it->second.erase(entity);
+		}
+
+		_received.erase(entity);
+		_pendingAcks.erase(entity);
+	} // removeEntity
+
+} // namespace Logic
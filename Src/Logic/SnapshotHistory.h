@@ -0,0 +1,261 @@
+//---------------------------------------------------------------------------
+// SnapshotHistory.h
+//---------------------------------------------------------------------------
+
+/**
+@file SnapshotHistory.h
+
+Contiene la declaracin del historial de snapshots que usan servidor y
+clientes para codificar las snapshots como diferencias.
+
+@see Logic::CSnapshotHistory
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Logic_SnapshotHistory_H
+#define __Logic_SnapshotHistory_H
+
+#include "Net/BitStream.h"
+
+#include <map>
+
+// Predeclaracion del typedef NetID
+namespace Net {
+	typedef unsigned int NetID;
+	class CPaquete;
+};
+
+namespace Logic {
+
+	// Predeclaracion del typedef TEntityID
+	typedef unsigned int TEntityID;
+
+	/**
+	Historial de las snapshots de transformaciones enviadas y recibidas.
+	<p>
+	En el servidor guarda, para cada cliente y cada entidad, la ltima
+	transformacin de las snapshots que se le han mandado y cul es la
+	ltima que el cliente ha confirmado. Esa transformacin confirmada es la
+	baseline contra la que se codifica la siguiente snapshot. Si el cliente
+	no ha confirmado nada o la snapshot confirmada ya no est en el historial
+	(por ejemplo tras perder varias confirmaciones) se manda la snapshot
+	completa.
+	<p>
+	En el cliente guarda las transformaciones de las snapshots recibidas para
+	poder resolver las diferencias, y acumula las confirmaciones pendientes
+	para mandarlas al servidor en un nico paquete por frame.
+
+	@ingroup LogicGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CSnapshotHistory {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Nmero de snapshots que se recuerdan por entidad. */
+		static const unsigned int HISTORY_SIZE = 32;
+
+
+		// =======================================================================
+		//                  METODOS DE INICIALIZACION Y ACTIVACION
+		// =======================================================================
+
+
+		/**
+		Devuelve la nica instancia de la clase CSnapshotHistory.
+
+		@return nica instancia de la clase CSnapshotHistory.
+		*/
+		static CSnapshotHistory* getSingletonPtr() { return _instance; }
+
+		//________________________________________________________________________
+
+		/**
+		Inicializa la instancia
+
+		@return Devuelve false si no se ha podido inicializar.
+		*/
+		static bool Init();
+
+		//________________________________________________________________________
+
+		/**
+		Libera la instancia de CSnapshotHistory. Debe llamarse al finalizar la
+		aplicacin.
+		*/
+		static void Release();
+
+		//________________________________________________________________________
+
+		/** Olvida todo el historial (por ejemplo al descargar el mapa). */
+		void clear();
+
+
+		// =======================================================================
+		//                           METODOS DEL SERVIDOR
+		// =======================================================================
+
+
+		/**
+		Devuelve la baseline que tiene el cliente dado para una entidad.
+
+		@param client Id de red del cliente.
+		@param entity Entidad de la que se manda la snapshot.
+		@param sequence Parmetro de salida con la secuencia de la baseline.
+		@param baseline Parmetro de salida con la transformacin de la baseline.
+		@return false si hay que mandar la snapshot completa.
+		*/
+		bool getBaseline(Net::NetID client, TEntityID entity, unsigned int& sequence, Net::TQuantizedTransform& baseline);
+
+		//________________________________________________________________________
+
+		/**
+		Registra una snapshot enviada a un cliente.
+
+		@param client Id de red del cliente.
+		@param entity Entidad de la snapshot.
+		@param sequence Secuencia de la snapshot.
+		@param state ltima transformacin de la snapshot.
+		*/
+		void snapshotSent(Net::NetID client, TEntityID entity, unsigned int sequence, const Net::TQuantizedTransform& state);
+
+		//________________________________________________________________________
+
+		/**
+		Procesa un paquete de confirmacin de snapshots enviado por un cliente.
+
+		@param packet Paquete SNAPSHOT_ACK recibido.
+		*/
+		void processAcks(Net::CPaquete* packet);
+
+		//________________________________________________________________________
+
+		/** Olvida el historial de un cliente que se ha desconectado. */
+		void removeClient(Net::NetID client);
+
+
+		// =======================================================================
+		//                           METODOS DEL CLIENTE
+		// =======================================================================
+
+
+		/**
+		Registra una snapshot recibida y la apunta para confirmarla.
+
+		@param entity Entidad de la snapshot.
+		@param sequence Secuencia de la snapshot.
+		@param state ltima transformacin de la snapshot.
+		*/
+		void snapshotReceived(TEntityID entity, unsigned int sequence, const Net::TQuantizedTransform& state);
+
+		//________________________________________________________________________
+
+		/**
+		Busca la transformacin de una snapshot recibida.
+
+		@param entity Entidad de la snapshot.
+		@param sequence Secuencia de la snapshot.
+		@param state Parmetro de salida con la transformacin.
+		@return false si la snapshot ya no est en el historial.
+		*/
+		bool getReceived(TEntityID entity, unsigned int sequence, Net::TQuantizedTransform& state);
+
+		//________________________________________________________________________
+
+		/**
+		Manda al servidor las confirmaciones pendientes en un nico paquete no
+		fiable. Debe llamarse una vez por frame.
+		*/
+		void sendAcks();
+
+
+		// =======================================================================
+		//                          METODOS COMUNES
+		// =======================================================================
+
+
+		/** Olvida el historial de una entidad que se ha destruido. */
+		void removeEntity(TEntityID entity);
+
+	protected:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CSnapshotHistory();
+
+		//________________________________________________________________________
+
+		/** Destructor. */
+		~CSnapshotHistory();
+
+	private:
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/** Entrada del historial. */
+		struct TSnapshotRecord {
+			unsigned int sequence;
+			bool valid;
+			Net::TQuantizedTransform state;
+
+			TSnapshotRecord() : sequence(0), valid(false) { }
+		};
+
+		/** Historial de una entidad (buffer circular indexado por secuencia). */
+		struct TEntityHistory {
+			TSnapshotRecord records[HISTORY_SIZE];
+
+			/** Servidor: ltima secuencia confirmada por el cliente. */
+			unsigned int lastAcked;
+			bool hasAck;
+
+			TEntityHistory() : lastAcked(0), hasAck(false) { }
+
+			/** Devuelve la entrada de la secuencia dada o NULL si ya se ha sobrescrito. */
+			const TSnapshotRecord* find(unsigned int sequence) const;
+		};
+
+		typedef std::map<TEntityID, TEntityHistory> TEntityHistoryTable;
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** nica instancia de la clase. */
+		static CSnapshotHistory* _instance;
+
+		/** Servidor: historial de cada cliente. */
+		std::map<Net::NetID, TEntityHistoryTable> _sent;
+
+		/** Cliente: historial de snapshots recibidas. */
+		TEntityHistoryTable _received;
+
+		/** Cliente: ltima secuencia recibida por entidad pendiente de confirmar. */
+		std::map<TEntityID, unsigned int> _pendingAcks;
+
+	}; // class CSnapshotHistory
+
+} // namespace Logic
+
+#endif // __Logic_SnapshotHistory_H
@@ -0,0 +1,478 @@
+/**
+@file BitStream.cpp
+
+Contiene la implementacin de las clases que permiten escribir y leer datos
+empaquetados a nivel de bit sobre un Net::CBuffer.
+
+@see Net::CBitWriter
+@see Net::CBitReader
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "BitStream.h"
+#include "buffer.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace Net {
+
+	namespace {
+		/** Rango de las componentes que se envan en la compresin smallest three. */
+		const float QUATERNION_RANGE = 0.70710678f;
+
+		/** Mscara con los nbBits bits menos significativos a uno. */
+		inline unsigned long long bitMask(unsigned int nbBits) {
+			return (1ULL << nbBits) - 1;
+		}
+	}
+
+	//__________________________________________________________________
+
+	TPositionQuantization::TPositionQuantization(const Vector3& minCorner, const Vector3& maxCorner, float maxStep) : min(minCorner),
+																													 max(maxCorner),
+																													 precision(maxStep) {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	unsigned int TPositionQuantization::getBits(unsigned int axis) const {
+		float steps = (max[axis] - min[axis]) / precision;
+		unsigned int nbBits = 1;
+		while(nbBits < 32 && (float)(bitMask(nbBits)) < steps) {
+			++nbBits;
+		}
+
+		return nbBits;
+	}
+
+	//__________________________________________________________________
+
+	TPositionQuantization& TPositionQuantization::getDefault() {
+		static TPositionQuantization defaultQuantization( Vector3(-2048.0f, -2048.0f, -2048.0f),
+														  Vector3(2048.0f, 2048.0f, 2048.0f),
+														  1.0f / 32.0f );
+
+		return defaultQuantization;
+	}
+
+	//__________________________________________________________________
+
+	unsigned int quantizeFloat(float value, float min, float max, unsigned int nbBits) {
+		if(value < min) value = min;
+		if(value > max) value = max;
+
+		// Con 32 bits el paso en float redondea a 2^32, que ya no cabe en un
+		// unsigned int, asi que calculamos en double y saturamos
+		unsigned long long steps = bitMask(nbBits);
+		double scaled = ( (double)(value - min) / (max - min) ) * (double)steps + 0.5;
+		return scaled >= (double)steps ? (unsigned int)steps : (unsigned int)scaled;
+	}
+
+	//__________________________________________________________________
+
+	float dequantizeFloat(unsigned int value, float min, float max, unsigned int nbBits) {
+		float steps = (float)bitMask(nbBits);
+		return min + ( (float)value / steps ) * (max - min);
+	}
+
+	//__________________________________________________________________
+
+	unsigned int packQuaternion(const Quaternion& orientation, unsigned int bitsPerComponent) {
+		// Buscamos la componente de mayor valor absoluto (w, x, y, z)
+		unsigned int largest = 0;
+		for(unsigned int i = 1; i < 4; ++i) {
+			if( fabs(orientation[i]) > fabs(orientation[largest]) )
+				largest = i;
+		}
+
+		// q y -q representan la misma rotacion, asi que forzamos que la
+		// componente omitida sea positiva para no tener que mandar su signo
+		float sign = orientation[largest] < 0 ? -1.0f : 1.0f;
+
+		// Empaquetamos en el mismo orden en el que se escriben los bits:
+		// primero el indice y despues las componentes restantes
+		unsigned int packed = largest;
+		unsigned int shift = 2;
+		for(unsigned int i = 0; i < 4; ++i) {
+			if(i != largest) {
+				packed |= quantizeFloat(orientation[i] * sign, -QUATERNION_RANGE, QUATERNION_RANGE, bitsPerComponent) << shift;
+				shift += bitsPerComponent;
+			}
+		}
+
+		return packed;
+	}
+
+	//__________________________________________________________________
+
+	Quaternion unpackQuaternion(unsigned int packed, unsigned int bitsPerComponent) {
+		unsigned int largest = packed & 3;
+		unsigned int shift = 2;
+
+		Quaternion orientation;
+		float sum = 0.0f;
+		for(unsigned int i = 0; i < 4; ++i) {
+			if(i != largest) {
+				unsigned int component = (unsigned int)( (packed >> shift) & bitMask(bitsPerComponent) );
+				orientation[i] = dequantizeFloat(component, -QUATERNION_RANGE, QUATERNION_RANGE, bitsPerComponent);
+				sum += orientation[i] * orientation[i];
+				shift += bitsPerComponent;
+			}
+		}
+
+		// Recuperamos la componente omitida a partir de las otras tres
+		orientation[largest] = sum < 1.0f ? sqrt(1.0f - sum) : 0.0f;
+		orientation.normalise();
+
+		return orientation;
+	}
+
+	//__________________________________________________________________
+
+	TQuantizedTransform::TQuantizedTransform() : orientation(0) {
+		position[0] = position[1] = position[2] = 0;
+	}
+
+	//__________________________________________________________________
+
+	TQuantizedTransform::TQuantizedTransform(const Matrix4& transform, const TPositionQuantization& quantization) {
+		Vector3 translation = transform.getTrans();
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			position[axis] = quantizeFloat(translation[axis], quantization.min[axis], quantization.max[axis], quantization.getBits(axis));
+		}
+
+		Quaternion rotation = transform.extractQuaternion();
+		rotation.normalise();
+		orientation = packQuaternion(rotation);
+	}
+
+	//__________________________________________________________________
+
+	Matrix4 TQuantizedTransform::toMatrix(const TPositionQuantization& quantization) const {
+		Vector3 translation;
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			translation[axis] = dequantizeFloat(position[axis], quantization.min[axis], quantization.max[axis], quantization.getBits(axis));
+		}
+
+		Matrix4 transform;
+		transform.makeTransform(translation, Vector3::UNIT_SCALE, unpackQuaternion(orientation));
+
+		return transform;
+	}
+
+	//__________________________________________________________________
+
+	TQuantizedTransform TQuantizedTransformDelta::apply(const TQuantizedTransform& reference) const {
+		TQuantizedTransform result;
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			result.position[axis] = reference.position[axis] + (unsigned int)position[axis];
+		}
+		result.orientation = orientationChanged ? orientation : reference.orientation;
+
+		return result;
+	}
+
+	//__________________________________________________________________
+
+	CBitWriter::CBitWriter(CBuffer& buffer) : _buffer(buffer),
+											  _scratch(0),
+											  _scratchBits(0) {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	CBitWriter::~CBitWriter() {
+		flush();
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeBits(unsigned int value, unsigned int nbBits) {
+		assert(nbBits > 0 && nbBits <= 32 && "CBitWriter::writeBits - Numero de bits no valido");
+
+		_scratch |= ( (unsigned long long)value & bitMask(nbBits) ) << _scratchBits;
+		_scratchBits += nbBits;
+
+		// Volcamos de 4 en 4 bytes para no llamar al buffer por cada byte
+		if(_scratchBits >= 32) {
+			byte out[4];
+			for(int i = 0; i < 4; ++i) {
+				out[i] = (byte)(_scratch >> (i * 8));
+			}
+			_buffer.write(out, sizeof(out));
+
+			_scratch >>= 32;
+			_scratchBits -= 32;
+		}
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeBool(bool value) {
+		writeBits(value ? 1 : 0, 1);
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeVarUInt(unsigned int value) {
+		while(value >= 0x80) {
+			writeBits( (value & 0x7F) | 0x80, 8 );
+			value >>= 7;
+		}
+		writeBits(value, 8);
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeVarInt(int value) {
+		writeVarUInt( (unsigned int)( (value << 1) ^ (value >> 31) ) );
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeFloat(float value) {
+		unsigned int bits;
+		memcpy(&bits, &value, sizeof(bits));
+		writeBits(bits, 32);
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeQuantizedFloat(float value, float min, float max, unsigned int nbBits) {
+		writeBits( quantizeFloat(value, min, max, nbBits), nbBits );
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writePosition(const Vector3& position, const TPositionQuantization& quantization) {
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			writeQuantizedFloat(position[axis], quantization.min[axis], quantization.max[axis], quantization.getBits(axis));
+		}
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeQuaternion(const Quaternion& orientation, unsigned int bitsPerComponent) {
+		writeBits( packQuaternion(orientation, bitsPerComponent), 2 + (3 * bitsPerComponent) );
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeTransform(const Matrix4& transform, const TPositionQuantization& quantization) {
+		writeQuantizedTransform( TQuantizedTransform(transform, quantization), quantization );
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeQuantizedTransform(const TQuantizedTransform& transform, const TPositionQuantization& quantization) {
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			writeBits( transform.position[axis], quantization.getBits(axis) );
+		}
+		writeBits(transform.orientation, 32);
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeTransformDelta(const TQuantizedTransform& transform, const TQuantizedTransform& reference) {
+		bool positionChanged = transform.position[0] != reference.position[0] ||
+							   transform.position[1] != reference.position[1] ||
+							   transform.position[2] != reference.position[2];
+
+		writeBool(positionChanged);
+		if(positionChanged) {
+			for(unsigned int axis = 0; axis < 3; ++axis) {
+				writeVarInt( (int)(transform.position[axis] - reference.position[axis]) );
+			}
+		}
+
+		bool orientationChanged = transform.orientation != reference.orientation;
+		writeBool(orientationChanged);
+		if(orientationChanged)
+			writeBits(transform.orientation, 32);
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::writeString(const std::string& value) {
+		writeVarUInt( value.size() );
+		for(unsigned int i = 0; i < value.size(); ++i) {
+			writeBits( (unsigned char)value[i], 8 );
+		}
+	}
+
+	//__________________________________________________________________
+
+	void CBitWriter::flush() {
+		while(_scratchBits > 0) {
+			byte out = (byte)_scratch;
+			_buffer.write(&out, sizeof(out));
+
+			_scratch >>= 8;
+			_scratchBits = _scratchBits > 8 ? _scratchBits - 8 : 0;
+		}
+
+		_scratch = 0;
+	}
+
+	//__________________________________________________________________
+
+	CBitReader::CBitReader(CBuffer& buffer) : _buffer(buffer),
+											  _scratch(0),
+											  _scratchBits(0) {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	CBitReader::~CBitReader() {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	unsigned int CBitReader::readBits(unsigned int nbBits) {
+		assert(nbBits > 0 && nbBits <= 32 && "CBitReader::readBits - Numero de bits no valido");
+
+		// Leemos solo los bytes que necesitamos para no pasarnos del
+		// bloque de bits
+		while(_scratchBits < nbBits) {
+			byte in;
+			_buffer.read(&in, sizeof(in));
+
+			_scratch |= (unsigned long long)in << _scratchBits;
+			_scratchBits += 8;
+		}
+
+		unsigned int value = (unsigned int)( _scratch & bitMask(nbBits) );
+		_scratch >>= nbBits;
+		_scratchBits -= nbBits;
+
+		return value;
+	}
+
+	//__________________________________________________________________
+
+	bool CBitReader::readBool() {
+		return readBits(1) != 0;
+	}
+
+	//__________________________________________________________________
+
+	unsigned int CBitReader::readVarUInt() {
+		unsigned int value = 0;
+		unsigned int shift = 0;
+		unsigned int group;
+		do {
+			group = readBits(8);
+			value |= (group & 0x7F) << shift;
+			shift += 7;
+		} while( (group & 0x80) && shift < 35 );
+
+		return value;
+	}
+
+	//__________________________________________________________________
+
+	int CBitReader::readVarInt() {
+		unsigned int value = readVarUInt();
+		return (int)(value >> 1) ^ -(int)(value & 1);
+	}
+
+	//__________________________________________________________________
+
+	float CBitReader::readFloat() {
+		unsigned int bits = readBits(32);
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+
+		return value;
+	}
+
+	//__________________________________________________________________
+
+	float CBitReader::readQuantizedFloat(float min, float max, unsigned int nbBits) {
+		return dequantizeFloat( readBits(nbBits), min, max, nbBits );
+	}
+
+	//__________________________________________________________________
+
+	Vector3 CBitReader::readPosition(const TPositionQuantization& quantization) {
+		Vector3 position;
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			position[axis] = readQuantizedFloat(quantization.min[axis], quantization.max[axis], quantization.getBits(axis));
+		}
+
+		return position;
+	}
+
+	//__________________________________________________________________
+
+	Quaternion CBitReader::readQuaternion(unsigned int bitsPerComponent) {
+		return unpackQuaternion( readBits( 2 + (3 * bitsPerComponent) ), bitsPerComponent );
+	}
+
+	//__________________________________________________________________
+
+	Matrix4 CBitReader::readTransform(const TPositionQuantization& quantization) {
+		return readQuantizedTransform(quantization).toMatrix(quantization);
+	}
+
+	//__________________________________________________________________
+
+	TQuantizedTransform CBitReader::readQuantizedTransform(const TPositionQuantization& quantization) {
+		TQuantizedTransform transform;
+		for(unsigned int axis = 0; axis < 3; ++axis) {
+			transform.position[axis] = readBits( quantization.getBits(axis) );
+		}
+		transform.orientation = readBits(32);
+
+		return transform;
+	}
+
+	//__________________________________________________________________
+
+	TQuantizedTransformDelta CBitReader::readTransformDelta() {
+		TQuantizedTransformDelta delta;
+		if( readBool() ) {
+			for(unsigned int axis = 0; axis < 3; ++axis) {
+				delta.position[axis] = readVarInt();
+			}
+		}
+		else {
+			delta.position[0] = delta.position[1] = delta.position[2] = 0;
+		}
+
+		delta.orientationChanged = readBool();
+		delta.orientation = delta.orientationChanged ? readBits(32) : 0;
+
+		return delta;
+	}
+
+	//__________________________________________________________________
+
+	std::string CBitReader::readString() {
+		unsigned int size = readVarUInt();
+
+		std::string value;
+		value.reserve(size);
+		for(unsigned int i = 0; i < size; ++i) {
+			value.push_back( (char)readBits(8) );
+		}
+
+		return value;
+	}
+
+	//__________________________________________________________________
+
+	void CBitReader::align() {
+		_scratch = 0;
+		_scratchBits = 0;
+	}
+
+} // namespace Net
@@ -0,0 +1,457 @@
+//---------------------------------------------------------------------------
+// BitStream.h
+//---------------------------------------------------------------------------
+
+/**
+@file BitStream.h
+
+Contiene la declaracin de las clases que permiten escribir y leer datos
+empaquetados a nivel de bit sobre un Net::CBuffer.
+
+@see Net::CBitWriter
+@see Net::CBitReader
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Net_BitStream_H
+#define __Net_BitStream_H
+
+#include "BaseSubsystems/Math.h"
+
+#include <string>
+
+namespace Net {
+
+	class CBuffer;
+
+	/**
+	Parmetros de cuantizacin de posiciones. Cada eje se codifica con el
+	nmero mnimo de bits necesario para representar el rango [min, max]
+	con la precisin dada.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	struct TPositionQuantization {
+		/** Esquina inferior del volumen representable. */
+		Vector3 min;
+
+		/** Esquina superior del volumen representable. */
+		Vector3 max;
+
+		/** Tamao mximo del paso de cuantizacin (en unidades del mundo). */
+		float precision;
+
+		//________________________________________________________________________
+
+		/** Constructor por parmetro. */
+		TPositionQuantization(const Vector3& minCorner, const Vector3& maxCorner, float maxStep);
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve el nmero de bits que se usan para codificar un eje.
+
+		@param axis Eje (0 = x, 1 = y, 2 = z).
+		@return Nmero de bits del eje (como mximo 32).
+		*/
+		unsigned int getBits(unsigned int axis) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve la cuantizacin que usan por defecto las snapshots. Por defecto
+		cubre un cubo de 4096 unidades de lado con pasos de 1/32 de unidad
+		(18 bits por eje).
+		*/
+		static TPositionQuantization& getDefault();
+	};
+
+	//________________________________________________________________________
+
+	/**
+	Transformacin cuantizada tal y como viaja por la red. Al trabajar con
+	enteros, servidor y cliente obtienen exactamente los mismos valores, lo
+	que permite codificar una transformacin como diferencia respecto a otra.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	struct TQuantizedTransform {
+		/** Posicin cuantizada (un entero por eje). */
+		unsigned int position[3];
+
+		/** Orientacin comprimida con smallest three (ndice + tres componentes). */
+		unsigned int orientation;
+
+		//________________________________________________________________________
+
+		/** Constructor por defecto. Transformacin nula. */
+		TQuantizedTransform();
+
+		//________________________________________________________________________
+
+		/**
+		Constructor por parmetro. Cuantiza la transformacin dada (la escala
+		se ignora).
+
+		@param transform Transformacin a cuantizar.
+		@param quantization Parmetros de cuantizacin de la posicin.
+		*/
+		TQuantizedTransform(const Matrix4& transform, const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/** Reconstruye la transformacin a partir de los valores cuantizados. */
+		Matrix4 toMatrix(const TPositionQuantization& quantization) const;
+	};
+
+	//________________________________________________________________________
+
+	/**
+	Diferencia entre dos transformaciones cuantizadas. La posicin se guarda
+	como diferencia por eje y la orientacin slo si ha cambiado.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	struct TQuantizedTransformDelta {
+		/** Diferencia de la posicin en pasos de cuantizacin. */
+		int position[3];
+
+		/** true si la orientacin es distinta de la de referencia. */
+		bool orientationChanged;
+
+		/** Nueva orientacin (slo vlida si orientationChanged). */
+		unsigned int orientation;
+
+		//________________________________________________________________________
+
+		/**
+		Aplica la diferencia sobre una transformacin de referencia.
+
+		@param reference Transformacin respecto a la que se calcul la diferencia.
+		@return Transformacin resultante.
+		*/
+		TQuantizedTransform apply(const TQuantizedTransform& reference) const;
+	};
+
+	//________________________________________________________________________
+
+	/** Cuantiza un float en el rango [min, max] usando nbBits bits. */
+	unsigned int quantizeFloat(float value, float min, float max, unsigned int nbBits);
+
+	/** Operacin inversa de quantizeFloat. */
+	float dequantizeFloat(unsigned int value, float min, float max, unsigned int nbBits);
+
+	/**
+	Comprime un quaternion unitario con smallest three. El resultado ocupa
+	2 + 3 * bitsPerComponent bits.
+	*/
+	unsigned int packQuaternion(const Quaternion& orientation, unsigned int bitsPerComponent = 10);
+
+	/** Operacin inversa de packQuaternion. */
+	Quaternion unpackQuaternion(unsigned int packed, unsigned int bitsPerComponent = 10);
+
+	//________________________________________________________________________
+
+	/**
+	Escritor de bits. Va acumulando los valores en un registro temporal y
+	vuelca al buffer los bytes completos. Al terminar hay que llamar a
+	flush() (o destruir el escritor) para volcar el ltimo byte parcial.
+	<p>
+	Los datos se escriben a partir de la posicin actual del buffer, por lo
+	que es posible mezclar escrituras normales del buffer con bloques de bits
+	siempre que cada bloque termine con un flush().
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CBitWriter {
+	public:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/**
+		Constructor por parmetro.
+
+		@param buffer Buffer en el que se van a escribir los datos.
+		*/
+		CBitWriter(CBuffer& buffer);
+
+		//________________________________________________________________________
+
+		/** Destructor. Vuelca los bits pendientes. */
+		~CBitWriter();
+
+
+		// =======================================================================
+		//                          METODOS DE ESCRITURA
+		// =======================================================================
+
+
+		/**
+		Escribe los nbBits bits menos significativos del valor dado.
+
+		@param value Valor a escribir.
+		@param nbBits Nmero de bits (entre 1 y 32).
+		*/
+		void writeBits(unsigned int value, unsigned int nbBits);
+
+		//________________________________________________________________________
+
+		/** Escribe un booleano usando un solo bit. */
+		void writeBool(bool value);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe un entero sin signo de longitud variable: grupos de 7 bits
+		precedidos de un bit de continuacin. Los valores menores de 128
+		ocupan un byte.
+		*/
+		void writeVarUInt(unsigned int value);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe un entero con signo de longitud variable (codificacin zig-zag),
+		de manera que los valores pequeos en valor absoluto ocupan poco.
+		*/
+		void writeVarInt(int value);
+
+		//________________________________________________________________________
+
+		/** Escribe un float sin cuantizar (32 bits). */
+		void writeFloat(float value);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe un float cuantizado en el rango [min, max]. Los valores fuera
+		del rango se saturan.
+
+		@param value Valor a escribir.
+		@param min Valor mnimo representable.
+		@param max Valor mximo representable.
+		@param nbBits Nmero de bits a usar.
+		*/
+		void writeQuantizedFloat(float value, float min, float max, unsigned int nbBits);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe una posicin cuantizada.
+
+		@param position Posicin a escribir.
+		@param quantization Parmetros de cuantizacin.
+		*/
+		void writePosition(const Vector3& position, const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe un quaternion unitario usando la compresin "smallest three":
+		se omite la componente de mayor valor absoluto (que se recupera a partir
+		de las otras tres) y se cuantizan las restantes en el rango
+		[-1/sqrt(2), 1/sqrt(2)].
+
+		@param orientation Quaternion a escribir.
+		@param bitsPerComponent Bits usados para cada una de las tres componentes.
+		*/
+		void writeQuaternion(const Quaternion& orientation, unsigned int bitsPerComponent = 10);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe una transformacin (posicin y orientacin). La escala se ignora.
+
+		@param transform Transformacin a escribir.
+		@param quantization Parmetros de cuantizacin de la posicin.
+		*/
+		void writeTransform(const Matrix4& transform, const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/** Escribe una transformacin ya cuantizada. */
+		void writeQuantizedTransform(const TQuantizedTransform& transform, const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/**
+		Escribe una transformacin como diferencia respecto a otra. Si la
+		posicin no ha cambiado slo se escribe un bit, y si lo ha hecho se
+		escribe la diferencia de cada eje como entero de longitud variable. La
+		orientacin se manda completa slo cuando ha cambiado.
+
+		@param transform Transformacin a escribir.
+		@param reference Transformacin de referencia que tiene el otro extremo.
+		*/
+		void writeTransformDelta(const TQuantizedTransform& transform, const TQuantizedTransform& reference);
+
+		//________________________________________________________________________
+
+		/** Escribe un string precedido de su longitud. */
+		void writeString(const std::string& value);
+
+		//________________________________________________________________________
+
+		/**
+		Vuelca al buffer los bits pendientes completando el ltimo byte con
+		ceros. Tras el flush se puede seguir escribiendo en el buffer de forma
+		normal.
+		*/
+		void flush();
+
+	private:
+
+		/** Buffer en el que escribimos. */
+		CBuffer& _buffer;
+
+		/** Registro en el que se acumulan los bits pendientes de volcar. */
+		unsigned long long _scratch;
+
+		/** Nmero de bits vlidos en el registro. */
+		unsigned int _scratchBits;
+
+	}; // class CBitWriter
+
+	/**
+	Lector de bits. Lee del buffer los bytes estrictamente necesarios, de modo
+	que tras leer un bloque escrito con CBitWriter el puntero de lectura del
+	buffer queda justo detrs de dicho bloque.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CBitReader {
+	public:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/**
+		Constructor por parmetro.
+
+		@param buffer Buffer del que se van a leer los datos.
+		*/
+		CBitReader(CBuffer& buffer);
+
+		//________________________________________________________________________
+
+		/** Destructor. */
+		~CBitReader();
+
+
+		// =======================================================================
+		//                           METODOS DE LECTURA
+		// =======================================================================
+
+
+		/** Lee un valor de nbBits bits (entre 1 y 32). */
+		unsigned int readBits(unsigned int nbBits);
+
+		//________________________________________________________________________
+
+		/** Lee un booleano de un bit. */
+		bool readBool();
+
+		//________________________________________________________________________
+
+		/** Lee un entero sin signo de longitud variable. */
+		unsigned int readVarUInt();
+
+		//________________________________________________________________________
+
+		/** Lee un entero con signo de longitud variable. */
+		int readVarInt();
+
+		//________________________________________________________________________
+
+		/** Lee un float sin cuantizar. */
+		float readFloat();
+
+		//________________________________________________________________________
+
+		/** Lee un float cuantizado. Los parmetros deben coincidir con los de la escritura. */
+		float readQuantizedFloat(float min, float max, unsigned int nbBits);
+
+		//________________________________________________________________________
+
+		/** Lee una posicin cuantizada. */
+		Vector3 readPosition(const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/** Lee un quaternion comprimido con writeQuaternion. */
+		Quaternion readQuaternion(unsigned int bitsPerComponent = 10);
+
+		//________________________________________________________________________
+
+		/** Lee una transformacin escrita con writeTransform. */
+		Matrix4 readTransform(const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/** Lee una transformacin escrita con writeQuantizedTransform. */
+		TQuantizedTransform readQuantizedTransform(const TPositionQuantization& quantization);
+
+		//________________________________________________________________________
+
+		/**
+		Lee una diferencia escrita con writeTransformDelta. Para obtener la
+		transformacin hay que aplicarla sobre la misma referencia que se us
+		al escribirla.
+		*/
+		TQuantizedTransformDelta readTransformDelta();
+
+		//________________________________________________________________________
+
+		/** Lee un string escrito con writeString. */
+		std::string readString();
+
+		//________________________________________________________________________
+
+		/** Descarta los bits que quedan del ltimo byte ledo. */
+		void align();
+
+	private:
+
+		/** Buffer del que leemos. */
+		CBuffer& _buffer;
+
+		/** Registro con los bits ledos pendientes de consumir. */
+		unsigned long long _scratch;
+
+		/** Nmero de bits vlidos en el registro. */
+		unsigned int _scratchBits;
+
+	}; // class CBitReader
+
+} // namespace Net
+
+#endif // __Net_BitStream_H
@@ -0,0 +1,108 @@
+/**
+@file BufferPool.cpp
+
+Contiene la implementacin del pool de memoria que utilizan los buffers de red
+para reservar su almacenamiento.
+
+@see Net::CBufferPool
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "BufferPool.h"
+
+#include <boost/thread/tss.hpp>
+
+namespace Net {
+
+	namespace {
+		/** Pool de cada hilo. Se destruye automticamente al terminar el hilo. */
+		boost::thread_specific_ptr<CBufferPool> threadPool;
+	}
+
+	//__________________________________________________________________
+
+	CBufferPool::CBufferPool() : _nbAcquired(0),
+								 _nbReused(0) {
+
+		size_t classSize;
+		_freeBlocks.resize( getSizeClass(MAX_BLOCK_SIZE, classSize) + 1 );
+	}
+
+	//__________________________________________________________________
+
+	CBufferPool::~CBufferPool() {
+		for(unsigned int i = 0; i < _freeBlocks.size(); ++i) {
+			for(unsigned int j = 0; j < _freeBlocks[i].size(); ++j) {
+				delete [] _freeBlocks[i][j];
+			}
+		}
+	}
+
+	//__________________________________________________________________
+
+	CBufferPool* CBufferPool::getThreadPool() {
+		CBufferPool* pool = threadPool.get();
+		if(pool == NULL) {
+			pool = new CBufferPool();
+			threadPool.reset(pool);
+		}
+
+		return pool;
+	}
+
+	//__________________________________________________________________
+
+	int CBufferPool::getSizeClass(size_t size, size_t& classSize) const {
+		if(size > MAX_BLOCK_SIZE) {
+			classSize = size;
+			return -1;
+		}
+
+		int sizeClass = 0;
+		classSize = MIN_BLOCK_SIZE;
+		while(classSize < size) {
+			classSize <<= 1;
+			++sizeClass;
+		}
+
+		return sizeClass;
+	}
+
+	//__________________________________________________________________
+
+	byte* CBufferPool::acquire(size_t size, size_t& granted) {
+		++_nbAcquired;
+
+		int sizeClass = getSizeClass(size, granted);
+		if(sizeClass >= 0 && !_freeBlocks[sizeClass].empty()) {
+			byte* block = _freeBlocks[sizeClass].back();
+			_freeBlocks[sizeClass].pop_back();
+			++_nbReused;
+
+			return block;
+		}
+
+		return new byte[granted];
+	}
+
+	//__________________________________________________________________
+
+	void CBufferPool::release(byte* block, size_t size) {
+		if(block == NULL)
+			return;
+
+		size_t classSize;
+		int sizeClass = getSizeClass(size, classSize);
+		// Solo guardamos los bloques que tienen exactamente el tamao de
+		// su clase y mientras no superemos el mximo de bloques libres
+		if(sizeClass >= 0 && classSize == size && _freeBlocks[sizeClass].size() < MAX_FREE_BLOCKS) {
+			_freeBlocks[sizeClass].push_back(block);
+		}
+		else {
+			delete [] block;
+		}
+	}
+
+} // namespace Net
@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------
+// BufferPool.h
+//---------------------------------------------------------------------------
+
+/**
+@file BufferPool.h
+
+Contiene la declaracin del pool de memoria que utilizan los buffers de red
+para reservar su almacenamiento.
+
+@see Net::CBufferPool
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Net_BufferPool_H
+#define __Net_BufferPool_H
+
+#include <vector>
+#include <cstddef>
+
+namespace Net {
+
+	typedef unsigned char byte;
+
+	/**
+	Pool de bloques de memoria para los buffers de red.
+	<p>
+	Los bloques se agrupan en clases de tamao potencia de dos (desde
+	MIN_BLOCK_SIZE hasta MAX_BLOCK_SIZE). Cuando un buffer libera su memoria
+	el bloque no se devuelve al sistema, sino que se guarda en la lista de
+	bloques libres de su clase para ser reutilizado por el siguiente buffer
+	que pida un tamao similar. Las peticiones mayores que MAX_BLOCK_SIZE
+	se sirven directamente con new.
+	<p>
+	Existe un pool por hilo, de manera que no es necesario ningn tipo de
+	sincronizacin para reservar o liberar bloques. Un bloque reservado en
+	un hilo puede liberarse sin problemas desde otro, ya que todos los bloques
+	se reservan con new [] y su clase se deduce a partir de su tamao.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CBufferPool {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Tamao del bloque ms pequeo que sirve el pool. */
+		static const size_t MIN_BLOCK_SIZE = 64;
+
+		/** Tamao del bloque ms grande que sirve el pool. */
+		static const size_t MAX_BLOCK_SIZE = 64 * 1024;
+
+		/** Nmero mximo de bloques libres que se guardan por cada clase. */
+		static const size_t MAX_FREE_BLOCKS = 256;
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CBufferPool();
+
+		//________________________________________________________________________
+
+		/** Destructor. Devuelve al sistema todos los bloques libres. */
+		~CBufferPool();
+
+
+		// =======================================================================
+		//                            METODOS PUBLICOS
+		// =======================================================================
+
+
+		/**
+		Devuelve el pool asociado al hilo que hace la llamada. Si el hilo todava
+		no tena pool se crea uno.
+
+		@return Pool del hilo actual.
+		*/
+		static CBufferPool* getThreadPool();
+
+		//________________________________________________________________________
+
+		/**
+		Reserva un bloque de al menos el tamao pedido.
+
+		@param size Tamao mnimo (en bytes) que debe tener el bloque.
+		@param granted Parmetro de salida en el que se indica el tamao real
+		del bloque devuelto (siempre mayor o igual que size).
+		@return Puntero al bloque reservado.
+		*/
+		byte* acquire(size_t size, size_t& granted);
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve un bloque al pool.
+
+		@param block Bloque a liberar. Debe haber sido obtenido con acquire.
+		@param size Tamao del bloque tal y como lo devolvi acquire.
+		*/
+		void release(byte* block, size_t size);
+
+		//________________________________________________________________________
+
+		/** Devuelve el nmero de peticiones atendidas por el pool. */
+		unsigned int getNbAcquired() const { return _nbAcquired; }
+
+		//________________________________________________________________________
+
+		/** Devuelve el nmero de peticiones que se sirvieron reutilizando un bloque. */
+		unsigned int getNbReused() const { return _nbReused; }
+
+
+	private:
+
+
+		// =======================================================================
+		//                          METODOS PRIVADOS
+		// =======================================================================
+
+
+		/**
+		Calcula la clase de tamao a la que pertenece un bloque.
+
+		@param size Tamao del bloque.
+		@param classSize Parmetro de salida con el tamao de la clase.
+		@return ndice de la clase o -1 si el tamao excede MAX_BLOCK_SIZE.
+		*/
+		int getSizeClass(size_t size, size_t& classSize) const;
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Listas de bloques libres. Una por cada clase de tamao. */
+		std::vector< std::vector<byte*> > _freeBlocks;
+
+		/** Nmero de peticiones atendidas. */
+		unsigned int _nbAcquired;
+
+		/** Nmero de peticiones atendidas reutilizando un bloque libre. */
+		unsigned int _nbReused;
+
+	}; // class CBufferPool
+
+} // namespace Net
+
+#endif // __Net_BufferPool_H
@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------
+// LatencyHistogram.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file LatencyHistogram.cpp
+
+Contiene la implementacin del histograma de latencias de red.
+
+@see Net::CLatencyHistogram
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "LatencyHistogram.h"
+
+#if defined(_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	include <windows.h>
+#else
+#	include <time.h>
+#endif
+
+namespace Net {
+
+	CLatencyHistogram::CLatencyHistogram() {
+		reset();
+	} // CLatencyHistogram
+
+	//________________________________________________________________________
+
+	void CLatencyHistogram::addSample(unsigned int microseconds) {
+		unsigned int bucket = 0;
+		while(bucket < NB_BUCKETS - 1 && microseconds >= getBucketLimit(bucket))
+			++bucket;
+
+		++_buckets[bucket];
+		++_count;
+		_sum += microseconds;
+
+		if(microseconds > _max)
+			_max = microseconds;
+	} // addSample
+
+	//________________________________________________________________________
+
+	void CLatencyHistogram::reset() {
+		for(unsigned int i = 0; i < NB_BUCKETS; ++i)
+			_buckets[i] = 0;
+
+		_count = 0;
+		_sum = 0;
+		_max = 0;
+	} // reset
+
+	//________________________________________________________________________
+
+	unsigned int CLatencyHistogram::getBucketLimit(unsigned int bucket) {
+		return bucket < NB_BUCKETS - 1 ? (1u << bucket) : 0xFFFFFFFF;
+	} // getBucketLimit
+
+	//________________________________________________________________________
+
+	float CLatencyHistogram::getMean() const {
+		return _count > 0 ? (float)( (double)_sum / _count ) : 0.0f;
+	} // getMean
+
+	//________________________________________________________________________
+
+	unsigned int CLatencyHistogram::getPercentile(float percentile) const {
+		if(_count == 0)
+			return 0;
+
+		unsigned int target = (unsigned int)(percentile * _count);
+		unsigned int accumulated = 0;
+		for(unsigned int i = 0; i < NB_BUCKETS; ++i) {
+			accumulated += _buckets[i];
+			if(accumulated > target)
+				return getBucketLimit(i) < _max ? getBucketLimit(i) : _max;
+		}
+
+		return _max;
+	} // getPercentile
+
+	//________________________________________________________________________
+
+	unsigned long long CLatencyHistogram::getTimestamp() {
+#if defined(_WIN32)
+		static LARGE_INTEGER frequency = { 0 };
+		if(frequency.QuadPart == 0)
+			QueryPerformanceFrequency(&frequency);
+
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+
+		// Separamos la division para no desbordar con contadores grandes
+		unsigned long long seconds = counter.QuadPart / frequency.QuadPart;
+		unsigned long long remainder = counter.QuadPart % frequency.QuadPart;
+		return seconds * 1000000 + (remainder * 1000000) / frequency.QuadPart;
+#else
+		timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return (unsigned long long)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+	} // getTimestamp
+
+} // namespace Net
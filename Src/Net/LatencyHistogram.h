@@ -0,0 +1,136 @@
+//---------------------------------------------------------------------------
+// LatencyHistogram.h
+//---------------------------------------------------------------------------
+
+/**
+@file LatencyHistogram.h
+
+Contiene la declaracin del histograma de latencias de red.
+
+@see Net::CLatencyHistogram
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Net_LatencyHistogram_H
+#define __Net_LatencyHistogram_H
+
+namespace Net {
+
+	/**
+	Histograma de latencias en microsegundos. Los cubos son potencias de dos:
+	el cubo i cuenta las muestras en [2^(i-1), 2^i) (el cubo 0 las de 0 us) y
+	el ltimo acumula todo lo que no cabe en los anteriores.
+	<p>
+	No es thread-safe: cada histograma debe actualizarse y consultarse desde
+	un nico hilo.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CLatencyHistogram {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Nmero de cubos. El ltimo empieza en 2^(NB_BUCKETS - 2) us (~0.5 s). */
+		static const unsigned int NB_BUCKETS = 21;
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/** Constructor por defecto. */
+		CLatencyHistogram();
+
+
+		// =======================================================================
+		//                           METODOS PUBLICOS
+		// =======================================================================
+
+
+		/**
+		Aade una muestra.
+
+		@param microseconds Latencia medida.
+		*/
+		void addSample(unsigned int microseconds);
+
+		//________________________________________________________________________
+
+		/** Borra todas las muestras. */
+		void reset();
+
+		//________________________________________________________________________
+
+		/** Nmero de muestras. */
+		unsigned int getCount() const { return _count; }
+
+		//________________________________________________________________________
+
+		/** Nmero de muestras del cubo dado. */
+		unsigned int getBucket(unsigned int bucket) const { return _buckets[bucket]; }
+
+		//________________________________________________________________________
+
+		/** Lmite superior (exclusivo) en microsegundos del cubo dado. */
+		static unsigned int getBucketLimit(unsigned int bucket);
+
+		//________________________________________________________________________
+
+		/** Latencia media en microsegundos. */
+		float getMean() const;
+
+		//________________________________________________________________________
+
+		/** Latencia mxima en microsegundos. */
+		unsigned int getMax() const { return _max; }
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve una cota superior del percentil dado (el lmite del cubo en
+		el que cae).
+
+		@param percentile Percentil entre 0 y 1 (por ejemplo 0.99f).
+		@return Latencia en microsegundos.
+		*/
+		unsigned int getPercentile(float percentile) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve el instante actual en microsegundos medido con el reloj de
+		alta resolucin del sistema. Los valores son comparables entre hilos.
+		*/
+		static unsigned long long getTimestamp();
+
+	private:
+
+		/** Muestras de cada cubo. */
+		unsigned int _buckets[NB_BUCKETS];
+
+		/** Nmero total de muestras. */
+		unsigned int _count;
+
+		/** Suma de todas las muestras, para la media. */
+		unsigned long long _sum;
+
+		/** Mayor muestra. */
+		unsigned int _max;
+
+	}; // class CLatencyHistogram
+
+} // namespace Net
+
+#endif // __Net_LatencyHistogram_H
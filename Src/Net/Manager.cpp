@@ -23,7 +23,12 @@ la gesti
 #include "factoriaredenet.h"
 #include "factoriared.h"
 #include "NetIdDispatcher.h"
+#include "NetThread.h"
+#include "paquete.h"
+#include "conexion.h"
+#include "PacketLog.h"
 #include <cassert>
+#include <cstring>
 
 namespace Net {
 
@@ -34,7 +39,11 @@ namespace Net {
 	CManager::CManager(): _factoriaRed(0), 
 						  _servidorRed(0), 
 						  _clienteRed(0),
-						  _idDispatcher(0) {
+						  _idDispatcher(0),
+						  _pendingFlush(false),
+						  _ioThread(0),
+						  _recorder(0),
+						  _replayServer(false) {
 
 		_instance = this;
 	} // CManager
@@ -97,37 +106,100 @@ namespace Net {
 
 	//---------------------------------------------------------
 
-	void CManager::broadcast(void* data, size_t longdata) {
+	NetDelivery CManager::getDelivery(NetChannel channel) {
+		switch(channel) {
+			case ACK_CHANNEL:
+			case SNAPSHOT_CHANNEL:
+				return UNRELIABLE_SEQUENCED;
+			case EFFECT_CHANNEL:
+				return UNRELIABLE;
+			default:
+				return RELIABLE;
+		}
+	} // getDelivery
+
+	//---------------------------------------------------------
+
+	void CManager::broadcast(void* data, size_t longdata, NetChannel channel) {
+		NetDelivery delivery = getDelivery(channel);
+
+		// Lo encolado tiene que llegar antes que esto
+		if(delivery == RELIABLE)
+			flush();
+
+		// Con hilo de red cada envio es una orden para el
+		if(_ioThread) {
+			for(TConnectionTable::const_iterator it = _connections.begin(); it != _connections.end(); ++it)
+				_ioThread->send(it->second, data, longdata, channel, delivery);
+
+			_ioThread->flush();
+			return;
+		}
+
 		// Si hay jugadores conectados
 		if(!_connections.empty()) {
 			// Si somos el servidor realizar un broadcast a todos los clientes
 			if(_servidorRed)
-				_servidorRed->sendAll(data, longdata, 0, 1);
+				_servidorRed->sendAll(data, longdata, channel, delivery);
 
 			// Si somos el cliente enviamos la informacion al servidor
 			if(_clienteRed)
-				_clienteRed->sendData(getConnection(_idDispatcher->getServerId()), data, longdata, 0, 1);
+				_clienteRed->sendData(getConnection(_idDispatcher->getServerId()), data, longdata, channel, delivery);
 		}
 	} // send
 
 	//---------------------------------------------------------
 
-	void CManager::sendTo(Net::NetID id, void* data, size_t longdata) {
+	void CManager::sendTo(Net::NetID id, void* data, size_t longdata, NetChannel channel) {
+		NetDelivery delivery = getDelivery(channel);
+
+		if(delivery == RELIABLE)
+			flush();
+
+		if(_ioThread) {
+			if(_clienteRed)
+				id = _idDispatcher->getServerId();
+
+			TConnectionTable::const_iterator it = _connections.find(id);
+			if( it != _connections.end() ) {
+				_ioThread->send(it->second, data, longdata, channel, delivery);
+				_ioThread->flush();
+			}
+			return;
+		}
+
 		if(!_connections.empty()) {
 			// Si somos el servidor mandamos el mensaje al cliente que nos han indicado
 			// por parametro
 			if(_servidorRed)
-				_servidorRed->sendData(_connections.find(id)->second, data, longdata, 0, 1);
+				_servidorRed->sendData(_connections.find(id)->second, data, longdata, channel, delivery);
 
 			// Si somos el cliente enviamos la informacin al servidor
 			if(_clienteRed)
-				_clienteRed->sendData(getConnection(_idDispatcher->getServerId()), data, longdata, 0, 1);
+				_clienteRed->sendData(getConnection(_idDispatcher->getServerId()), data, longdata, channel, delivery);
 		}
 	} // send
 
 	//---------------------------------------------------------
 
-	void CManager::broadcastIgnoring(Net::NetID id, void* data, size_t longdata) {
+	void CManager::broadcastIgnoring(Net::NetID id, void* data, size_t longdata, NetChannel channel) {
+		NetDelivery delivery = getDelivery(channel);
+
+		if(delivery == RELIABLE)
+			flush();
+
+		if(_ioThread) {
+			if(_servidorRed) {
+				for(TConnectionTable::const_iterator it = _connections.begin(); it != _connections.end(); ++it) {
+					if(it->first != id)
+						_ioThread->send(it->second, data, longdata, channel, delivery);
+				}
+
+				_ioThread->flush();
+			}
+			return;
+		}
+
 		// Si hay jugadores conectados
 		if(!_connections.empty()) {
 			// Si somos el servidor realizar un broadcast a todos los clientes
@@ -135,18 +207,160 @@ namespace Net {
 				TConnectionTable::iterator it = _connections.find(id);
 				assert(it != _connections.end() && "broadcastIgnoring no puede ejecutarse porque no existe ninguna conexion con el id dado");
 
-				_servidorRed->sendAllExcept(data, longdata, 0, 1, it->second);
+				_servidorRed->sendAllExcept(data, longdata, channel, delivery, it->second);
 			}
 		}
 	} // sendAllExcept
 
 	//---------------------------------------------------------
 
+	void CManager::enqueue(void* data, size_t longdata, unsigned long long coalesceKey, NetChannel channel) {
+		// Encolamos en la cola de cada destinatario para que se respete el
+		// orden con lo que se les mande por separado
+		for(TConnectionTable::const_iterator it = _connections.begin(); it != _connections.end(); ++it)
+			queueRecord(it->first, data, longdata, coalesceKey, channel);
+	} // enqueue
+
+	//---------------------------------------------------------
+
+	void CManager::enqueueTo(Net::NetID id, void* data, size_t longdata, unsigned long long coalesceKey, NetChannel channel) {
+		if(_clienteRed)
+			id = _idDispatcher->getServerId();
+
+		if( _connections.count(id) )
+			queueRecord(id, data, longdata, coalesceKey, channel);
+	} // enqueueTo
+
+	//---------------------------------------------------------
+
+	void CManager::queueRecord(NetID id, void* data, size_t longdata, unsigned long long coalesceKey, NetChannel channel) {
+		TOutgoingQueue& queue = _outgoing[ TQueueKey(id, channel) ];
+
+		if(coalesceKey != 0) {
+			// El mensaje anterior con la misma clave queda obsoleto. No lo
+			// reemplazamos en su sitio para no adelantar el nuevo respecto a
+			// lo que se haya encolado entre medias
+			std::map<unsigned long long, unsigned int>::iterator it = queue.coalesced.find(coalesceKey);
+			if( it != queue.coalesced.end() )
+				queue.records[it->second].alive = false;
+
+			queue.coalesced[coalesceKey] = queue.records.size();
+		}
+
+		TQueuedRecord record;
+		record.offset = queue.data.size();
+		record.size = longdata;
+		record.alive = true;
+		queue.records.push_back(record);
+
+		unsigned char* bytes = (unsigned char*)data;
+		queue.data.insert(queue.data.end(), bytes, bytes + longdata);
+
+		_pendingFlush = true;
+	} // queueRecord
+
+	//---------------------------------------------------------
+
+	void CManager::flush() {
+		if(!_pendingFlush)
+			return;
+
+		_pendingFlush = false;
+
+		NetMessageType batchType = MESSAGE_BATCH;
+		CBuffer batch(MAX_BATCH_SIZE);
+
+		for(TOutgoingQueueTable::iterator it = _outgoing.begin(); it != _outgoing.end(); ++it) {
+			TOutgoingQueue& queue = it->second;
+			NetID id = it->first.first;
+			NetChannel channel = it->first.second;
+
+			batch.reset();
+			unsigned int nbBatched = 0;
+			const TQueuedRecord* firstBatched = NULL;
+
+			for(unsigned int i = 0; i < queue.records.size(); ++i) {
+				const TQueuedRecord& record = queue.records[i];
+				if(!record.alive)
+					continue;
+
+				// Cabecera: tipo del lote y, por cada mensaje, su tamao como
+				// entero de longitud variable (1 byte para mensajes < 128 bytes)
+				unsigned int recordSize = record.size + 5;
+				if( nbBatched > 0 && batch.getSize() + recordSize > MAX_BATCH_SIZE ) {
+					if(nbBatched == 1)
+						sendQueued(id, &queue.data[firstBatched->offset], firstBatched->size, channel);
+					else
+						sendQueued(id, batch.getbuffer(), batch.getSize(), channel);
+
+					batch.reset();
+					nbBatched = 0;
+				}
+
+				if(nbBatched == 0) {
+					batch.write(&batchType, sizeof(batchType));
+					firstBatched = &record;
+				}
+
+				unsigned int size = record.size;
+				while(size >= 0x80) {
+					unsigned char byte = (unsigned char)(size & 0x7F) | 0x80;
+					batch.write(&byte, sizeof(byte));
+					size >>= 7;
+				}
+				unsigned char byte = (unsigned char)size;
+				batch.write(&byte, sizeof(byte));
+				batch.write(&queue.data[record.offset], record.size);
+
+				++nbBatched;
+			}
+
+			// Un nico mensaje se manda tal cual, sin cabecera de lote
+			if(nbBatched == 1)
+				sendQueued(id, &queue.data[firstBatched->offset], firstBatched->size, channel);
+			else if(nbBatched > 1)
+				sendQueued(id, batch.getbuffer(), batch.getSize(), channel);
+
+			queue.data.clear();
+			queue.records.clear();
+			queue.coalesced.clear();
+		}
+
+		// Un nico vaciado del host para todo el frame
+		if(_ioThread)
+			_ioThread->flush();
+		else if(_servidorRed)
+			_servidorRed->flush();
+		if(_clienteRed)
+			_clienteRed->flush();
+	} // flush
+
+	//---------------------------------------------------------
+
+	void CManager::sendQueued(NetID id, void* data, size_t longdata, NetChannel channel) {
+		TConnectionTable::const_iterator it = _connections.find(id);
+		if( it == _connections.end() )
+			return;
+
+		if(_ioThread)
+			_ioThread->send(it->second, data, longdata, channel, getDelivery(channel));
+		else if(_servidorRed)
+			_servidorRed->queueData(it->second, data, longdata, channel, getDelivery(channel));
+		else if(_clienteRed)
+			_clienteRed->queueData(it->second, data, longdata, channel, getDelivery(channel));
+	} // sendQueued
+
+	//---------------------------------------------------------
+
 	void CManager::tick(unsigned int msecs) 
 	{
 		_paquetes.clear();
 		Net::CManager::getSingletonPtr()->getPackets(_paquetes);
 
+		// Todos los paquetes del frame se graban con la misma hora, la de
+		// cuando los recoge la logica
+		unsigned long long now = _recorder ? CLatencyHistogram::getTimestamp() : 0;
+
 		for(std::vector<Net::CPaquete*>::iterator iterp = _paquetes.begin();iterp != _paquetes.end();++iterp) {
 			Net::CPaquete* paquete = *iterp;
 			// El mensaje debe ser de tipo CONEXION
@@ -155,17 +369,17 @@ namespace Net {
 			{
 				case Net::CONEXION:
 					connect(paquete->getConexion());
+					// Se graba despues de asignarle el id
+					recordPacket(paquete, now);
 					for(auto iter = _observers.begin();iter != _observers.end();++iter)
 						(*iter)->connectionPacketReceived(paquete);
 					break;
 				case Net::DATOS:
-					if(!internalData(paquete)){ // Analiza si trae contenido -> TODO: ver funcion
-						//std::cout << "mensaje recibido:  " <<  _observers.size() << std::endl;
-						for(auto iter = _observers.begin();iter != _observers.end();++iter)
-							(*iter)->dataPacketReceived(paquete);
-					}
+					recordPacket(paquete, now);
+					dispatchData(paquete);
 					break;
 				case Net::DESCONEXION:
+					recordPacket(paquete, now);
 					for(auto iter = _observers.begin();iter != _observers.end();++iter)
 						(*iter)->disconnectionPacketReceived(paquete);
 					disconnect(paquete->getConexion());
@@ -229,11 +443,72 @@ namespace Net {
 
 	//---------------------------------------------------------
 
+	void CManager::dispatchData(Net::CPaquete* packet)
+	{
+		Net::CBuffer data = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
+		Net::NetMessageType msg;
+		data.read(&msg,sizeof(msg));
+
+		if(msg != Net::MESSAGE_BATCH) {
+			notifyData(packet);
+			return;
+		}
+
+		// Cada mensaje del lote se procesa como un paquete independiente. Los
+		// subpaquetes son vistas sobre el paquete original, que sigue vivo
+		// mientras se notifican
+		Net::CPaquete subPacket(Net::DATOS, 0, 0, packet->getConexion(), packet->getCanal());
+
+		// El contenido lo manda el otro extremo: un tamao truncado, demasiado
+		// largo o que se sale del paquete descarta el resto del lote
+		byte* current = packet->getData() + sizeof(msg);
+		byte* end = packet->getData() + packet->getDataLength();
+		while(current < end) {
+			unsigned int size = 0;
+			unsigned int shift = 0;
+			byte sizeByte;
+			do {
+				if(current == end || shift > 28)
+					return;
+
+				sizeByte = *current++;
+				size |= (unsigned int)(sizeByte & 0x7F) << shift;
+				shift += 7;
+			} while(sizeByte & 0x80);
+
+			if(size > (size_t)(end - current))
+				return;
+
+			// Lotes anidados y mensajes sin tipo no los genera nunca flush()
+			Net::NetMessageType subMsg;
+			if(size >= sizeof(subMsg)) {
+				memcpy(&subMsg, current, sizeof(subMsg));
+				if(subMsg != Net::MESSAGE_BATCH) {
+					subPacket.setDataView(current, size);
+					notifyData(&subPacket);
+				}
+			}
+
+			current += size;
+		}
+	} // dispatchData
+
+	//---------------------------------------------------------
+
+	void CManager::notifyData(Net::CPaquete* packet)
+	{
+		if(!internalData(packet)){ // Analiza si trae contenido -> TODO: ver funcion
+			//std::cout << "mensaje recibido:  " <<  _observers.size() << std::endl;
+			for(auto iter = _observers.begin();iter != _observers.end();++iter)
+				(*iter)->dataPacketReceived(packet);
+		}
+	} // notifyData
+
+	//---------------------------------------------------------
+
 	bool CManager::internalData(Net::CPaquete* packet)
 	{
-		Net::CBuffer data;
-		data.write(packet->getData(),packet->getDataLength());
-		data.reset();
+		Net::CBuffer data = Net::CBuffer::createView(packet->getData(), packet->getDataLength());
 
 		Net::NetMessageType msg;
 		data.read(&msg,sizeof(msg));
@@ -263,14 +538,48 @@ namespace Net {
 		CBuffer buf;// Avisamos al cliente de cual es su nuevo ID	
 			buf.write(&type,sizeof(type));		
 			buf.write(&nextId,sizeof(nextId));// Escribimos el id del cliente
-		_servidorRed->sendData(connection, buf.getbuffer(),buf.getSize(),0,1);
+		if(_ioThread) {
+			_ioThread->send(connection, buf.getbuffer(), buf.getSize(), DEFAULT_CHANNEL, RELIABLE);
+			_ioThread->flush();
+		}
+		else {
+			_servidorRed->sendData(connection, buf.getbuffer(),buf.getSize(),DEFAULT_CHANNEL,RELIABLE);
+		}
 	} // connect
 
 	//---------------------------------------------------------
 
 	void CManager::disconnect(CConexion* connection) {
+		if(_ioThread) {
+			// El hilo de red cierra y destruye la conexion cuando haya mandado
+			// lo que tuviera pendiente para ella
+			NetID id = _servidorRed ? connection->getId() : _idDispatcher->getServerId();
+			TConnectionTable::iterator it = _connections.find(id);
+			if( it == _connections.end() )
+				return;
+
+			_ioThread->disconnect(it->second);
+			_connections.erase(it);
+			_latencies.erase(id);
+
+			if(_servidorRed) {
+				for(unsigned int channel = 0; channel < NB_CHANNELS; ++channel)
+					_outgoing.erase( TQueueKey(id, (NetChannel)channel) );
+
+				_idDispatcher->returnClientId(id);
+			}
+			else {
+				_outgoing.clear();
+			}
+
+			return;
+		}
+
 		if(_servidorRed) {
 			unsigned int clientId = connection->getId();
+			for(unsigned int channel = 0; channel < NB_CHANNELS; ++channel)
+				_outgoing.erase( TQueueKey(clientId, (NetChannel)channel) );
+
 
 			_servidorRed->disconnect(connection);
 			removeConnection(clientId);
@@ -278,6 +587,7 @@ namespace Net {
 			_idDispatcher->returnClientId(clientId);
 		}
 		else if(_clienteRed) {
+			_outgoing.clear();
 			_clienteRed->disconnect(getConnection(_idDispatcher->getServerId()));
 			removeConnection(_idDispatcher->getServerId());
 		}
@@ -314,6 +624,16 @@ namespace Net {
 	//---------------------------------------------------------
 
 	void CManager::deactivateNetwork() {
+		// Mandamos lo que quede pendiente antes de cerrar
+		flush();
+		_outgoing.clear();
+
+		stopRecording();
+		_replayServer = false;
+
+		stopIOThread();
+		_latencies.clear();
+
 		if(_servidorRed) {
 			_servidorRed->deInit(); // TODO analizar que haga disconnect de todo; antes if(_conexion) disconnect (OJO estaba comentado)
 			delete _servidorRed;
@@ -334,7 +654,161 @@ namespace Net {
 
 	//---------------------------------------------------------
 
+	void CManager::startIOThread() {
+		if(_ioThread || (!_servidorRed && !_clienteRed))
+			return;
+
+		// Lo que estuviera encolado sale por el camino sincrono
+		flush();
+
+		_ioThread = new CNetThread(_servidorRed, _clienteRed);
+		_ioThread->start();
+	} // startIOThread
+
+	//---------------------------------------------------------
+
+	void CManager::stopIOThread() {
+		if(!_ioThread)
+			return;
+
+		// stop manda lo pendiente antes de terminar
+		_ioThread->stop();
+		delete _ioThread;
+		_ioThread = 0;
+	} // stopIOThread
+
+	//---------------------------------------------------------
+
+	const CManager::TConnectionLatency* CManager::getLatency(NetID id) const {
+		std::map<NetID, TConnectionLatency>::const_iterator it = _latencies.find(id);
+		return it != _latencies.end() ? &it->second : NULL;
+	} // getLatency
+
+	//---------------------------------------------------------
+
+	unsigned int CManager::getRoundTripTime(NetID id) const {
+		if(_ioThread) {
+			const TConnectionLatency* latency = getLatency(id);
+			return latency != NULL ? latency->roundTripTime : 0;
+		}
+
+		TConnectionTable::const_iterator it = _connections.find(id);
+		return it != _connections.end() ? it->second->getRoundTripTime() : 0;
+	} // getRoundTripTime
+
+	//---------------------------------------------------------
+
+	bool CManager::startRecording(const std::string& fileName) {
+		stopRecording();
+
+		_recorder = new CPacketRecorder();
+		if( !_recorder->open(fileName) ) {
+			delete _recorder;
+			_recorder = 0;
+			return false;
+		}
+
+		return true;
+	} // startRecording
+
+	//---------------------------------------------------------
+
+	void CManager::stopRecording() {
+		if(!_recorder)
+			return;
+
+		_recorder->close();
+		delete _recorder;
+		_recorder = 0;
+	} // stopRecording
+
+	//---------------------------------------------------------
+
+	void CManager::recordPacket(Net::CPaquete* packet, unsigned long long timestamp) {
+		if(!_recorder)
+			return;
+
+		NetID id = packet->getConexion()->getId();
+		_recorder->record(packet, id, getRoundTripTime(id), timestamp);
+	} // recordPacket
+
+	//---------------------------------------------------------
+
+	void CManager::activateAsReplayServer(int clients) {
+		assert(!_servidorRed && !_clienteRed && "La red ya esta activada");
+
+		if(_idDispatcher)
+			delete _idDispatcher;
+		_idDispatcher = new CNetIdDispatcher(clients);
+
+		_replayServer = true;
+		_id = _idDispatcher->getServerId();
+	} // activateAsReplayServer
+
+	//---------------------------------------------------------
+
+	void CManager::replayPacket(Net::CPaquete* packet) {
+		assert(_replayServer && "El manager no esta reproduciendo una grabacion");
+
+		CConexion* connection = packet->getConexion();
+		NetID id = connection->getId();
+
+		switch(packet->getTipo()) {
+			case Net::CONEXION:
+				// El id ya viene asignado de la grabacion y no hay cliente al
+				// que mandarle el ASSIGNED_ID
+				addConnection(id, connection);
+				for(auto iter = _observers.begin();iter != _observers.end();++iter)
+					(*iter)->connectionPacketReceived(packet);
+				break;
+			case Net::DATOS:
+				dispatchData(packet);
+				break;
+			case Net::DESCONEXION:
+				for(auto iter = _observers.begin();iter != _observers.end();++iter)
+					(*iter)->disconnectionPacketReceived(packet);
+
+				for(unsigned int channel = 0; channel < NB_CHANNELS; ++channel)
+					_outgoing.erase( TQueueKey(id, (NetChannel)channel) );
+				removeConnection(id);
+				break;
+		}
+	} // replayPacket
+
+	//---------------------------------------------------------
+
 	void CManager::getPackets(std::vector<Net::CPaquete*>& _paquetes) {
+		if(_ioThread) {
+			_received.clear();
+			_ioThread->getReceived(_received);
+
+			unsigned long long now = CLatencyHistogram::getTimestamp();
+			for(unsigned int i = 0; i < _received.size(); ++i) {
+				CNetThread::TReceived& received = _received[i];
+
+				// Muestra de latencia de envio medida en el hilo de red
+				if(received.packet == NULL) {
+					if( _connections.count(received.id) ) {
+						TConnectionLatency& latency = _latencies[received.id];
+						latency.send.addSample( (unsigned int)received.time );
+						latency.roundTripTime = received.roundTripTime;
+					}
+
+					continue;
+				}
+
+				if(received.packet->getTipo() == Net::DATOS) {
+					TConnectionLatency& latency = _latencies[received.packet->getConexion()->getId()];
+					latency.receive.addSample( (unsigned int)(now - received.time) );
+					latency.roundTripTime = received.roundTripTime;
+				}
+
+				_paquetes.push_back(received.packet);
+			}
+
+			return;
+		}
+
 		if(_servidorRed)
 			_servidorRed->service(_paquetes);
 		if(_clienteRed)
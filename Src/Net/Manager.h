@@ -24,6 +24,10 @@ la gesti
 #include <queue>
 #include <map>
 
+#include "LatencyHistogram.h"
+#include "NetThread.h"
+#include "PacketLog.h"
+
 // Predeclaracion de clases
 namespace Net {
 	class CBuffer;
@@ -89,7 +93,28 @@ namespace Net {
 		CREATE_CUSTOM_ENTITY,
 		DESTROY_ENTITY,
 		DEACTIVATE_ENTITY,
-		ACTIVATE_ENTITY
+		ACTIVATE_ENTITY,
+		SNAPSHOT_ACK,
+		MESSAGE_BATCH
+	};
+
+	/**
+	Canales lgicos que se crean sobre cada conexin. Cada canal tiene un
+	tipo de entrega fijo (ver CManager::getDelivery): ENet ordena cada canal
+	por separado, as que lo que se pierde en un canal no fiable no retiene
+	lo que va por los dems.
+	*/
+	enum NetChannel {
+		/** Canal por defecto, fiable y ordenado. Por aqu viajan los eventos del juego. */
+		DEFAULT_CHANNEL,
+		/** Confirmaciones de snapshots. No fiable y secuenciado. */
+		ACK_CHANNEL,
+		/** Snapshots y mensajes de estado que dejan obsoletos a los anteriores. No fiable y secuenciado. */
+		SNAPSHOT_CHANNEL,
+		/** Efectos puntuales (partculas, sonidos) que no importa perder. No fiable y sin orden. */
+		EFFECT_CHANNEL,
+		/** Nmero de canales. */
+		NB_CHANNELS
 	};
 
 	/**
@@ -115,6 +140,26 @@ namespace Net {
 	public:
 
 
+		// =======================================================================
+		//                          ESTRUCTURAS PUBLICAS
+		// =======================================================================
+
+
+		/**
+		Latencias de una conexin medidas en el hilo de red: desde que llega un
+		paquete hasta que la lgica lo recoge y desde que la lgica pide un
+		envo hasta que se entrega a ENet. Tambin se guarda el ltimo tiempo
+		de ida y vuelta que ha publicado el hilo de red.
+		*/
+		struct TConnectionLatency {
+			CLatencyHistogram receive;
+			CLatencyHistogram send;
+			unsigned int roundTripTime;
+
+			TConnectionLatency() : roundTripTime(0) { }
+		};
+
+
 		// =======================================================================
 		//                            CLASS IOBSERVER
 		// =======================================================================
@@ -199,7 +244,7 @@ namespace Net {
 		@param timeout Tiempo mximo de espera para conectar con la mquina remota.
 		@return true si la conexin se realiz con xito.
 		*/
-		bool connectTo(char* address, int port, int channels = 1, unsigned int timeout = 5);
+		bool connectTo(char* address, int port, int channels = NB_CHANNELS, unsigned int timeout = 5);
 
 		//________________________________________________________________________
 
@@ -218,8 +263,10 @@ namespace Net {
 
 		@param data Datos a enviar.
 		@param longdata Tamao de los datos a enviar.
+		@param channel Canal lgico por el que se mandan los datos. De l
+		depende si el envo es fiable.
 		*/
-		void broadcast(void* data, size_t longdata);
+		void broadcast(void* data, size_t longdata, NetChannel channel = DEFAULT_CHANNEL);
 
 		//________________________________________________________________________
 
@@ -230,8 +277,9 @@ namespace Net {
 		@param id Id de red del cliente que queremos que NO reciba el mensaje.
 		@param data Datos a enviar.
 		@param longdata Tamao de los datos a enviar.
+		@param channel Canal lgico por el que se mandan los datos.
 		*/
-		void broadcastIgnoring(Net::NetID id, void* data, size_t longdata);
+		void broadcastIgnoring(Net::NetID id, void* data, size_t longdata, NetChannel channel = DEFAULT_CHANNEL);
 
 		//________________________________________________________________________
 
@@ -241,8 +289,157 @@ namespace Net {
 		@param id Id de red del cliente al que queremos mandar el mensaje.
 		@param data Datos a enviar.
 		@param longdata Tamao de los datos a enviar.
+		@param channel Canal lgico por el que se mandan los datos. De l
+		depende si el envo es fiable.
+		*/
+		void sendTo(Net::NetID id, void* data, size_t longdata, NetChannel channel = DEFAULT_CHANNEL);
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve el tipo de entrega de los paquetes de un canal.
+
+		@param channel Canal lgico.
+		@return Tipo de entrega del canal.
+		*/
+		static NetDelivery getDelivery(NetChannel channel);
+
+		//________________________________________________________________________
+
+		/**
+		Encola datos para mandarlos a todos los destinatarios de un
+		broadcast en el prximo flush(). Todo lo encolado para un mismo
+		destinatario y canal se empaqueta en el menor nmero posible de
+		paquetes MESSAGE_BATCH.
+
+		@param data Datos a enviar.
+		@param longdata Tamao de los datos a enviar.
+		@param coalesceKey Si es distinta de 0, los datos sustituyen a los que
+		estuvieran encolados con la misma clave (mensajes que dejan obsoletos
+		a los anteriores, como las sincronizaciones de posicin).
+		@param channel Canal lgico por el que se mandan los datos.
+		*/
+		void enqueue(void* data, size_t longdata, unsigned long long coalesceKey = 0, NetChannel channel = DEFAULT_CHANNEL);
+
+		//________________________________________________________________________
+
+		/**
+		Encola datos para mandarlos al cliente con el id de red dado en
+		el prximo flush().
+
+		@param id Id de red del cliente al que queremos mandar el mensaje.
+		@param data Datos a enviar.
+		@param longdata Tamao de los datos a enviar.
+		@param coalesceKey Clave de sustitucin (ver enqueue).
+		@param channel Canal lgico por el que se mandan los datos.
+		*/
+		void enqueueTo(Net::NetID id, void* data, size_t longdata, unsigned long long coalesceKey = 0, NetChannel channel = DEFAULT_CHANNEL);
+
+		//________________________________________________________________________
+
+		/**
+		Manda todo lo encolado con enqueue y enqueueTo. Debe llamarse una vez
+		por frame. Los envos fiables inmediatos (broadcast, sendTo...) hacen
+		antes un flush para no alterar el orden de llegada.
+		*/
+		void flush();
+
+		//________________________________________________________________________
+
+		/**
+		Arranca el hilo dedicado de red. A partir de ese momento el host de
+		ENet slo se toca desde ese hilo: tick() recoge lo que ha recibido y
+		los envos se le pasan por una cola, de modo que la lgica nunca se
+		bloquea en el socket. Debe llamarse despus de activateAsServer (o de
+		connectTo en el cliente).
+		*/
+		void startIOThread();
+
+		//________________________________________________________________________
+
+		/** Para el hilo dedicado de red y vuelve al modo sncrono. */
+		void stopIOThread();
+
+		//________________________________________________________________________
+
+		/** true si el hilo dedicado de red est arrancado. */
+		bool isIOThreadRunning() { return _ioThread != NULL; }
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve los histogramas de latencia de una conexin. Slo se
+		rellenan mientras el hilo dedicado de red est arrancado.
+
+		@param id Id de red de la conexin.
+		@return Latencias de la conexin o NULL si no hay ninguna medida.
+		*/
+		const TConnectionLatency* getLatency(NetID id) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve el tiempo de ida y vuelta de una conexin segn lo mide la
+		capa de red. Con el hilo dedicado de red arrancado el peer de ENet
+		slo se toca desde ese hilo, as que se devuelve la ltima medida que
+		ha mandado por la cola de entrada.
+
+		@param id Id de red de la conexin.
+		@return Tiempo de ida y vuelta en milisegundos, 0 si no hay conexin.
 		*/
-		void sendTo(Net::NetID id, void* data, size_t longdata);
+		unsigned int getRoundTripTime(NetID id) const;
+
+
+		// =======================================================================
+		//                       GRABACIN Y REPRODUCCIN
+		// =======================================================================
+
+
+		/**
+		Empieza a grabar en un fichero todos los paquetes que se reciben (ver
+		CPacketRecorder). La grabacin termina con stopRecording o al
+		desactivar la red.
+
+		@param fileName Ruta del fichero.
+		@return false si no se ha podido crear el fichero.
+		*/
+		bool startRecording(const std::string& fileName);
+
+		//________________________________________________________________________
+
+		/** Termina la grabacin de paquetes. */
+		void stopRecording();
+
+		//________________________________________________________________________
+
+		/** true si se estn grabando los paquetes recibidos. */
+		bool isRecording() const { return _recorder != NULL; }
+
+		//________________________________________________________________________
+
+		/**
+		Activa el manager como servidor sin host de red. Los paquetes no
+		llegan por la red sino que se inyectan con replayPacket y lo que se
+		manda a los clientes se descarta despus de montarlo, as que el coste
+		de la lgica de red del servidor es el mismo que en una partida real.
+
+		@param clients Nmero de clientes que soporta el servidor.
+		*/
+		void activateAsReplayServer(int clients = 16);
+
+		//________________________________________________________________________
+
+		/**
+		Procesa un paquete grabado como si acabara de llegar: los de conexin
+		registran la conexin con el id que traen (el que se le asign al
+		grabar), los de datos se reparten a los observadores y los de
+		desconexin eliminan la conexin.
+
+		@param packet Paquete a procesar. Su conexin tiene que ser un
+		CConexionReplay creado con new; el manager se queda con ella al
+		procesar el paquete de conexin y la destruye con el de desconexin.
+		*/
+		void replayPacket(Net::CPaquete* packet);
 
 
 		// =======================================================================
@@ -270,6 +467,8 @@ namespace Net {
 		@param clients Nmero de clientes que soporta el servidor.
 		@param maxinbw Ancho de banda entrante.
 		@param maxoutbw Ancho de banda saliente.
+		@note Los canales los pide cada cliente al conectarse (ver connectTo);
+		el host de ENet del servidor acepta los que le pidan.
 		*/
 		void activateAsServer(int port, int clients = 16, unsigned int maxinbw = 0, unsigned int maxoutbw = 0);
 
@@ -291,7 +490,7 @@ namespace Net {
 
 		@return true si el manager se est ejecutando como servidor.
 		*/
-		bool imServer() { return _servidorRed != NULL; }
+		bool imServer() { return _servidorRed != NULL || _replayServer; }
 
 		//________________________________________________________________________
 
@@ -426,6 +625,36 @@ namespace Net {
 
 		//________________________________________________________________________
 
+		/**
+		Notifica a los observadores un paquete de datos. Los paquetes
+		MESSAGE_BATCH se deshacen y se notifica cada uno de los paquetes que
+		contienen como si hubieran llegado por separado.
+
+		@param packet Paquete de datos recibido.
+		*/
+		void dispatchData(Net::CPaquete* packet);
+
+		//________________________________________________________________________
+
+		/**
+		Notifica a los observadores un paquete de datos que no es un lote.
+
+		@param packet Paquete de datos recibido.
+		*/
+		void notifyData(Net::CPaquete* packet);
+
+		//________________________________________________________________________
+
+		/**
+		Graba un paquete recibido si hay una grabacin en curso.
+
+		@param packet Paquete recibido.
+		@param timestamp Hora de llegada.
+		*/
+		void recordPacket(Net::CPaquete* packet, unsigned long long timestamp);
+
+		//________________________________________________________________________
+
 
 
 
@@ -466,6 +695,57 @@ namespace Net {
 		*/
 		bool removeConnection(NetID id);
 
+		//________________________________________________________________________
+
+		/**
+		Encola datos en la cola de un destinatario.
+
+		@param id Id de red del destinatario.
+		@param data Datos a encolar.
+		@param longdata Tamao de los datos.
+		@param coalesceKey Clave de sustitucin (0 si no se sustituye nada).
+		@param channel Canal lgico.
+		*/
+		void queueRecord(NetID id, void* data, size_t longdata, unsigned long long coalesceKey, NetChannel channel);
+
+		//________________________________________________________________________
+
+		/**
+		Manda un paquete ya montado sin vaciar el host de ENet.
+		*/
+		void sendQueued(NetID id, void* data, size_t longdata, NetChannel channel);
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/** Tamao mximo de un paquete MESSAGE_BATCH, para no fragmentar en UDP. */
+		static const unsigned int MAX_BATCH_SIZE = 1200;
+
+		/** Mensaje encolado. Sus datos estn en TOutgoingQueue::data. */
+		struct TQueuedRecord {
+			unsigned int offset;
+			unsigned int size;
+			bool alive;
+		};
+
+		/** Cola de salida de un destinatario y canal. */
+		struct TOutgoingQueue {
+			/** Datos de todos los mensajes encolados, uno detrs de otro. */
+			std::vector<unsigned char> data;
+
+			/** Mensajes encolados en orden de envo. */
+			std::vector<TQueuedRecord> records;
+
+			/** ltimo mensaje encolado con cada clave de sustitucin. */
+			std::map<unsigned long long, unsigned int> coalesced;
+		};
+
+		typedef std::pair<NetID, NetChannel> TQueueKey;
+		typedef std::map<TQueueKey, TOutgoingQueue> TOutgoingQueueTable;
+
 
 		// =======================================================================
 		//                          MIEMBROS PRIVADOS
@@ -509,6 +789,27 @@ namespace Net {
 		/** Asigna ids de red */
 		CNetIdDispatcher* _idDispatcher;
 
+		/** Colas de salida por destinatario y canal. */
+		TOutgoingQueueTable _outgoing;
+
+		/** true si hay algo encolado en _outgoing. */
+		bool _pendingFlush;
+
+		/** Hilo dedicado de red (NULL en modo sncrono). */
+		CNetThread* _ioThread;
+
+		/** Lo recogido del hilo de red en el ltimo getPackets. */
+		std::vector<CNetThread::TReceived> _received;
+
+		/** Latencias de cada conexin. */
+		std::map<NetID, TConnectionLatency> _latencies;
+
+		/** Grabacin en curso (NULL si no se graba). */
+		CPacketRecorder* _recorder;
+
+		/** true si el manager es un servidor sin host que reproduce una grabacin. */
+		bool _replayServer;
+
 	}; // class CManager
 
 } // namespace Net
@@ -0,0 +1,246 @@
+//---------------------------------------------------------------------------
+// NetThread.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file NetThread.cpp
+
+Contiene la implementacin del hilo dedicado de entrada/salida de red.
+
+@see Net::CNetThread
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "NetThread.h"
+#include "LatencyHistogram.h"
+#include "servidor.h"
+#include "cliente.h"
+#include "conexion.h"
+#include "paquete.h"
+
+#include <boost/thread/thread.hpp>
+
+#include <cstring>
+
+namespace Net {
+
+	CNetThread::CNetThread(CServidor* server, CCliente* client) : _server(server),
+	                                                              _client(client),
+	                                                              _thread(NULL),
+	                                                              _running(false),
+	                                                              _commands(RING_CAPACITY),
+	                                                              _received(RING_CAPACITY),
+	                                                              _nextBacklog(0) {
+
+		assert( (server == NULL) != (client == NULL) && "El hilo de red necesita un servidor o un cliente" );
+	} // CNetThread
+
+	//________________________________________________________________________
+
+	CNetThread::~CNetThread() {
+		stop();
+	} // ~CNetThread
+
+	//________________________________________________________________________
+
+	void CNetThread::start() {
+		if(_thread != NULL)
+			return;
+
+		_running = true;
+		_thread = new boost::thread(&CNetThread::run, this);
+	} // start
+
+	//________________________________________________________________________
+
+	void CNetThread::stop() {
+		if(_thread == NULL)
+			return;
+
+		_running = false;
+		_thread->join();
+		delete _thread;
+		_thread = NULL;
+
+		// El hilo ya no existe, asi que podemos consumir su cola de entrada
+		TReceived received;
+		while( _received.pop(received) )
+			delete received.packet;
+
+		for(unsigned int i = _nextBacklog; i < _backlog.size(); ++i)
+			delete _backlog[i].packet;
+
+		_backlog.clear();
+		_nextBacklog = 0;
+	} // stop
+
+	//________________________________________________________________________
+
+	void CNetThread::send(CConexion* connection, void* data, size_t longdata, int channel, NetDelivery delivery) {
+		TCommand command;
+		command.type = SEND;
+		command.connection = connection;
+		command.data = new byte[longdata];
+		command.size = longdata;
+		command.channel = channel;
+		command.delivery = delivery;
+		command.timestamp = CLatencyHistogram::getTimestamp();
+
+		memcpy(command.data, data, longdata);
+
+		pushCommand(command);
+	} // send
+
+	//________________________________________________________________________
+
+	void CNetThread::flush() {
+		TCommand command;
+		command.type = FLUSH;
+		command.connection = NULL;
+		command.data = NULL;
+
+		pushCommand(command);
+	} // flush
+
+	//________________________________________________________________________
+
+	void CNetThread::disconnect(CConexion* connection) {
+		TCommand command;
+		command.type = DISCONNECT;
+		command.connection = connection;
+		command.data = NULL;
+
+		pushCommand(command);
+	} // disconnect
+
+	//________________________________________________________________________
+
+	void CNetThread::getReceived(std::vector<TReceived>& received) {
+		TReceived element;
+		while( _received.pop(element) )
+			received.push_back(element);
+	} // getReceived
+
+	//________________________________________________________________________
+
+	void CNetThread::pushCommand(const TCommand& command) {
+		// Solo se llena si el hilo de red lleva mucho sin ejecutarse
+		while( !_commands.push(command) )
+			boost::this_thread::yield();
+	} // pushCommand
+
+	//________________________________________________________________________
+
+	bool CNetThread::receivePackets() {
+		while( _nextBacklog < _backlog.size() && _received.push(_backlog[_nextBacklog]) )
+			++_nextBacklog;
+
+		// Si la logica no recoge los paquetes dejamos de leer del socket; ENet
+		// se encarga de retenerlos mientras tanto
+		if( _nextBacklog < _backlog.size() )
+			return false;
+
+		_backlog.clear();
+		_nextBacklog = 0;
+
+		_servicePackets.clear();
+		if(_server)
+			_server->service(_servicePackets);
+		else
+			_client->service(_servicePackets);
+
+		unsigned long long now = CLatencyHistogram::getTimestamp();
+		for(unsigned int i = 0; i < _servicePackets.size(); ++i) {
+			TReceived received;
+			received.packet = _servicePackets[i];
+			received.id = 0;
+			received.time = now;
+
+			CConexion* connection = received.packet->getConexion();
+			received.roundTripTime = connection != NULL ? connection->getRoundTripTime() : 0;
+
+			// En cuanto uno no cabe, los siguientes van detras para no desordenarlos
+			if( !_backlog.empty() || !_received.push(received) )
+				_backlog.push_back(received);
+		}
+
+		return !_servicePackets.empty();
+	} // receivePackets
+
+	//________________________________________________________________________
+
+	bool CNetThread::processCommands() {
+		bool processed = false;
+		bool pendingFlush = false;
+
+		TCommand command;
+		while( _commands.pop(command) ) {
+			processed = true;
+
+			switch(command.type) {
+				case SEND: {
+					if(_server)
+						_server->queueData(command.connection, command.data, command.size, command.channel, command.delivery);
+					else
+						_client->queueData(command.connection, command.data, command.size, command.channel, command.delivery);
+
+					pendingFlush = true;
+
+					// La muestra solo es estadistica: si no cabe se pierde
+					TReceived sample;
+					sample.packet = NULL;
+					sample.id = command.connection->getId();
+					sample.time = CLatencyHistogram::getTimestamp() - command.timestamp;
+					sample.roundTripTime = command.connection->getRoundTripTime();
+					_received.push(sample);
+
+					delete [] command.data;
+					break;
+				}
+				case FLUSH: {
+					pendingFlush = true;
+					break;
+				}
+				case DISCONNECT: {
+					if(_server)
+						_server->disconnect(command.connection);
+					else
+						_client->disconnect(command.connection);
+
+					delete command.connection;
+					break;
+				}
+			}
+		}
+
+		// Un solo vaciado del host por cada tanda de ordenes
+		if(pendingFlush) {
+			if(_server)
+				_server->flush();
+			else
+				_client->flush();
+		}
+
+		return processed;
+	} // processCommands
+
+	//________________________________________________________________________
+
+	void CNetThread::run() {
+		while(_running) {
+			bool busy = processCommands();
+			busy = receivePackets() || busy;
+
+			// Si no ha habido trabajo cedemos la CPU un momento en vez de
+			// quedarnos girando
+			if(!busy)
+				boost::this_thread::sleep( boost::posix_time::milliseconds(1) );
+		}
+
+		// Mandamos lo que la logica haya dejado pedido antes de parar
+		processCommands();
+	} // run
+
+} // namespace Net
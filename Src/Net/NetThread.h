@@ -0,0 +1,279 @@
+//---------------------------------------------------------------------------
+// NetThread.h
+//---------------------------------------------------------------------------
+
+/**
+@file NetThread.h
+
+Contiene la declaracin del hilo dedicado de entrada/salida de red.
+
+@see Net::CNetThread
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Net_NetThread_H
+#define __Net_NetThread_H
+
+#include "SPSCRing.h"
+#include "conexion.h"
+
+#include <vector>
+#include <cstddef>
+
+// Predeclaracion de clases
+namespace Net {
+	class CServidor;
+	class CCliente;
+	class CConexion;
+	class CPaquete;
+
+	typedef unsigned int NetID;
+	typedef unsigned char byte;
+};
+
+namespace boost {
+	class thread;
+};
+
+namespace Net {
+
+	/**
+	Hilo dedicado de entrada/salida de red. Mientras est arrancado es el
+	nico que toca el host de ENet (a travs de CServidor o CCliente): hace
+	el service, manda lo que le pide la lgica y vaca el host.
+	<p>
+	La comunicacin con el hilo de la lgica se hace con dos colas sin
+	bloqueos CSPSCRing: por una van las rdenes de envo (la lgica produce,
+	el hilo de red consume) y por la otra los paquetes recibidos (al revs).
+	Por la cola de entrada tambin vuelven las latencias de envo medidas en
+	el hilo de red, para que los histogramas se actualicen siempre desde el
+	hilo de la lgica. Cada elemento lleva adems el tiempo de ida y vuelta
+	de su conexin, que slo se puede leer del peer de ENet en este hilo.
+	<p>
+	El hilo de red nunca se queda esperando a la lgica: si la cola de
+	entrada est llena las muestras de latencia se descartan y los paquetes
+	esperan en una lista propia, sin leer ms del socket hasta que quepan.
+	As sigue atendiendo las rdenes de envo aunque la lgica tarde en
+	recoger lo recibido.
+	<p>
+	Las conexiones que se cierran desde la lgica se destruyen en el hilo de
+	red tras procesar los envos pendientes hacia ellas.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CNetThread {
+	public:
+
+
+		// =======================================================================
+		//                              CONSTANTES
+		// =======================================================================
+
+
+		/** Capacidad de cada una de las colas (potencia de dos). */
+		static const unsigned int RING_CAPACITY = 4096;
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PUBLICAS
+		// =======================================================================
+
+
+		/** Elemento de la cola de entrada. */
+		struct TReceived {
+			/** Paquete recibido, o NULL si es una muestra de latencia de envo. */
+			CPaquete* packet;
+
+			/** Id de red de la conexin a la que se ha mandado (slo muestras). */
+			NetID id;
+
+			/**
+			Paquetes: instante de llegada al hilo de red.
+			Muestras: latencia de envo en microsegundos.
+			*/
+			unsigned long long time;
+
+			/** Tiempo de ida y vuelta de la conexin en milisegundos, ledo en el hilo de red. */
+			unsigned int roundTripTime;
+		};
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/**
+		Constructor por parmetro. Slo uno de los dos debe ser distinto de NULL.
+
+		@param server Servidor de red del que se encargar el hilo.
+		@param client Cliente de red del que se encargar el hilo.
+		*/
+		CNetThread(CServidor* server, CCliente* client);
+
+		//________________________________________________________________________
+
+		/** Destructor. Para el hilo si est arrancado. */
+		~CNetThread();
+
+
+		// =======================================================================
+		//                   METODOS DEL HILO DE LA LOGICA
+		// =======================================================================
+
+
+		/** Arranca el hilo. */
+		void start();
+
+		//________________________________________________________________________
+
+		/**
+		Para el hilo. Antes de terminar manda todo lo que hubiera pendiente.
+		Los paquetes recibidos que no se hayan recogido se descartan.
+		*/
+		void stop();
+
+		//________________________________________________________________________
+
+		/**
+		Pide el envo de datos por una conexin. Los datos se copian.
+
+		@param connection Conexin por la que mandar los datos.
+		@param data Datos a enviar.
+		@param longdata Tamao de los datos.
+		@param channel Canal lgico.
+		@param delivery Tipo de entrega de los datos.
+		*/
+		void send(CConexion* connection, void* data, size_t longdata, int channel, NetDelivery delivery);
+
+		//________________________________________________________________________
+
+		/** Pide que se vace el host de ENet. */
+		void flush();
+
+		//________________________________________________________________________
+
+		/**
+		Pide que se cierre una conexin. El hilo de red la desconecta y la
+		destruye despus de mandar lo que tuviera pendiente, as que tras esta
+		llamada la lgica no debe volver a usarla.
+
+		@param connection Conexin a cerrar.
+		*/
+		void disconnect(CConexion* connection);
+
+		//________________________________________________________________________
+
+		/**
+		Recoge lo que ha llegado a la cola de entrada.
+
+		@param received Vector en el que se aaden los elementos recibidos.
+		*/
+		void getReceived(std::vector<TReceived>& received);
+
+	private:
+
+
+		// =======================================================================
+		//                          ESTRUCTURAS PRIVADAS
+		// =======================================================================
+
+
+		/** Tipos de orden de la cola de salida. */
+		enum TCommandType {
+			SEND,
+			FLUSH,
+			DISCONNECT
+		};
+
+		/** Elemento de la cola de salida. */
+		struct TCommand {
+			TCommandType type;
+			CConexion* connection;
+			byte* data;
+			size_t size;
+			int channel;
+			NetDelivery delivery;
+
+			/** Instante en el que la lgica pidi el envo. */
+			unsigned long long timestamp;
+		};
+
+
+		// =======================================================================
+		//                          METODOS PRIVADOS
+		// =======================================================================
+
+
+		/** Bucle del hilo de red. */
+		void run();
+
+		//________________________________________________________________________
+
+		/**
+		Ejecuta todas las rdenes pendientes.
+
+		@return true si se ha ejecutado alguna.
+		*/
+		bool processCommands();
+
+		//________________________________________________________________________
+
+		/** Mete una orden en la cola de salida, esperando si est llena. */
+		void pushCommand(const TCommand& command);
+
+		//________________________________________________________________________
+
+		/**
+		Pasa a la cola de entrada los paquetes que no cupieron la ltima vez
+		y, si ya no queda ninguno, lee del socket.
+
+		@return true si se ha ledo algn paquete.
+		*/
+		bool receivePackets();
+
+
+		// =======================================================================
+		//                          MIEMBROS PRIVADOS
+		// =======================================================================
+
+
+		/** Servidor de red (NULL si somos cliente). */
+		CServidor* _server;
+
+		/** Cliente de red (NULL si somos servidor). */
+		CCliente* _client;
+
+		/** Hilo de red. */
+		boost::thread* _thread;
+
+		/** false para pedir al hilo que termine. */
+		volatile bool _running;
+
+		/** rdenes de la lgica para el hilo de red. */
+		CSPSCRing<TCommand> _commands;
+
+		/** Paquetes y latencias del hilo de red para la lgica. */
+		CSPSCRing<TReceived> _received;
+
+		/** Paquetes devueltos por el ltimo service (slo hilo de red). */
+		std::vector<CPaquete*> _servicePackets;
+
+		/**
+		Paquetes recibidos que no cupieron en la cola de entrada, en orden de
+		llegada, y el primero de ellos an sin pasar (slo hilo de red).
+		*/
+		std::vector<TReceived> _backlog;
+		unsigned int _nextBacklog;
+
+	}; // class CNetThread
+
+} // namespace Net
+
+#endif // __Net_NetThread_H
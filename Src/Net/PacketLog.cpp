@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------
+// PacketLog.cpp
+//---------------------------------------------------------------------------
+
+/**
+@file PacketLog.cpp
+
+Contiene la implementacin de las clases que graban y leen los registros
+de paquetes recibidos por la red.
+
+@see Net::CPacketRecorder
+@see Net::CPacketPlayback
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#include "PacketLog.h"
+#include "LatencyHistogram.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace Net {
+
+	namespace {
+		/** Cabecera de los ficheros de registro. */
+		const char LOG_MAGIC[4] = { 'G', 'N', 'E', 'T' };
+		const unsigned char LOG_VERSION = 1;
+	}
+
+	//--------------------------------------------------------
+
+	CPacketRecorder::CPacketRecorder() : _startTime(0), _lastTime(0), _nbPackets(0) {
+		// Nada que hacer
+	} // CPacketRecorder
+
+	//--------------------------------------------------------
+
+	CPacketRecorder::~CPacketRecorder() {
+		close();
+	} // ~CPacketRecorder
+
+	//--------------------------------------------------------
+
+	bool CPacketRecorder::open(const std::string& fileName) {
+		close();
+
+		_file.open(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if( !_file.is_open() )
+			return false;
+
+		_file.write(LOG_MAGIC, sizeof(LOG_MAGIC));
+		_file.put(LOG_VERSION);
+
+		_startTime = CLatencyHistogram::getTimestamp();
+		_lastTime = 0;
+		_nbPackets = 0;
+
+		return _file.good();
+	} // open
+
+	//--------------------------------------------------------
+
+	void CPacketRecorder::close() {
+		if( _file.is_open() )
+			_file.close();
+	} // close
+
+	//--------------------------------------------------------
+
+	void CPacketRecorder::record(CPaquete* packet, NetID id, unsigned int roundTripTime, unsigned long long timestamp) {
+		assert( _file.is_open() && "El registro de paquetes no esta abierto" );
+
+		unsigned long long time = timestamp > _startTime ? timestamp - _startTime : 0;
+		if(time < _lastTime)
+			time = _lastTime;
+
+		writeVarInt(time - _lastTime);
+		writeVarInt(packet->getTipo());
+		writeVarInt(id);
+		writeVarInt(packet->getCanal());
+		writeVarInt(roundTripTime);
+		writeVarInt(packet->getDataLength());
+		if(packet->getDataLength() > 0)
+			_file.write( (const char*)packet->getData(), packet->getDataLength() );
+
+		_lastTime = time;
+		++_nbPackets;
+	} // record
+
+	//--------------------------------------------------------
+
+	void CPacketRecorder::writeVarInt(unsigned long long value) {
+		while(value >= 0x80) {
+			_file.put( (char)((value & 0x7F) | 0x80) );
+			value >>= 7;
+		}
+		_file.put( (char)value );
+	} // writeVarInt
+
+	//--------------------------------------------------------
+
+	CPacketPlayback::CPacketPlayback() : _lastTime(0) {
+		// Nada que hacer
+	} // CPacketPlayback
+
+	//--------------------------------------------------------
+
+	bool CPacketPlayback::open(const std::string& fileName) {
+		if( _file.is_open() )
+			_file.close();
+
+		_file.open(fileName.c_str(), std::ios::in | std::ios::binary);
+		if( !_file.is_open() )
+			return false;
+
+		char magic[sizeof(LOG_MAGIC)];
+		_file.read(magic, sizeof(magic));
+		int version = _file.get();
+
+		_lastTime = 0;
+
+		return _file.good() && memcmp(magic, LOG_MAGIC, sizeof(LOG_MAGIC)) == 0 && version == LOG_VERSION;
+	} // open
+
+	//--------------------------------------------------------
+
+	bool CPacketPlayback::next(TRecordedPacket& packet) {
+		unsigned long long delta, type, id, channel, roundTripTime, size;
+		if( !readVarInt(delta) || !readVarInt(type) || !readVarInt(id) || !readVarInt(channel) ||
+			!readVarInt(roundTripTime) || !readVarInt(size) )
+			return false;
+
+		_lastTime += delta;
+
+		packet.time = _lastTime;
+		packet.type = (TipoPaquete)type;
+		packet.id = (NetID)id;
+		packet.channel = (unsigned char)channel;
+		packet.roundTripTime = (unsigned int)roundTripTime;
+		packet.data.resize( (size_t)size );
+		if(size > 0)
+			_file.read( (char*)&packet.data[0], (std::streamsize)size );
+
+		return _file.good();
+	} // next
+
+	//--------------------------------------------------------
+
+	bool CPacketPlayback::readVarInt(unsigned long long& value) {
+		value = 0;
+		unsigned int shift = 0;
+
+		int next;
+		do {
+			next = _file.get();
+			if(next == EOF || shift > 63)
+				return false;
+
+			value |= (unsigned long long)(next & 0x7F) << shift;
+			shift += 7;
+		} while(next & 0x80);
+
+		return true;
+	} // readVarInt
+
+} // namespace Net
@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------
+// PacketLog.h
+//---------------------------------------------------------------------------
+
+/**
+@file PacketLog.h
+
+Contiene la declaracin de las clases que graban y leen los registros de
+paquetes recibidos por la red.
+
+@see Net::CPacketRecorder
+@see Net::CPacketPlayback
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Net_PacketLog_H
+#define __Net_PacketLog_H
+
+#include "paquete.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Net {
+
+	/**
+	Paquete ledo de un registro.
+	*/
+	struct TRecordedPacket {
+		/** Microsegundos desde que empez la grabacin. */
+		unsigned long long time;
+		/** Tipo del paquete (datos, conexin o desconexin). */
+		TipoPaquete type;
+		/** Id de red de la conexin por la que lleg. */
+		NetID id;
+		/** Canal por el que lleg. */
+		unsigned char channel;
+		/** Tiempo de ida y vuelta de la conexin cuando lleg, en ms. */
+		unsigned int roundTripTime;
+		/** Contenido del paquete. */
+		std::vector<unsigned char> data;
+
+		TRecordedPacket() : time(0), type(DATOS), id(0), channel(0), roundTripTime(0) { }
+	};
+
+	//________________________________________________________________________
+
+	/**
+	Graba en un fichero binario los paquetes que recibe CManager.
+	<p>
+	El fichero empieza con una cabecera ("GNET" y la versin) y sigue con un
+	registro por paquete. Todos los enteros se escriben con longitud variable
+	(7 bits por byte, igual que los tamaos de MESSAGE_BATCH), as que un
+	paquete pequeo ocupa solo unos bytes ms que su contenido:
+
+	<pre>
+	incremento de tiempo (us) | tipo | id de red | canal | rtt (ms) | tamao | datos
+	</pre>
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CPacketRecorder {
+	public:
+
+		/** Constructor por defecto. */
+		CPacketRecorder();
+
+		/** Destructor. Cierra el fichero si est abierto. */
+		~CPacketRecorder();
+
+		/**
+		Crea el fichero y escribe la cabecera. El tiempo de los paquetes se
+		cuenta desde este momento.
+
+		@param fileName Ruta del fichero.
+		@return false si no se ha podido crear el fichero.
+		*/
+		bool open(const std::string& fileName);
+
+		/** Cierra el fichero. */
+		void close();
+
+		/**
+		Graba un paquete.
+
+		@param packet Paquete recibido.
+		@param id Id de red de la conexin por la que ha llegado.
+		@param roundTripTime Tiempo de ida y vuelta de la conexin en ms.
+		@param timestamp Hora de llegada (CLatencyHistogram::getTimestamp).
+		*/
+		void record(CPaquete* packet, NetID id, unsigned int roundTripTime, unsigned long long timestamp);
+
+		/** Devuelve el nmero de paquetes grabados. */
+		unsigned int getNbPackets() const { return _nbPackets; }
+
+	private:
+
+		/** Escribe un entero con longitud variable. */
+		void writeVarInt(unsigned long long value);
+
+		/** Fichero de salida. */
+		std::ofstream _file;
+
+		/** Hora a la que empez la grabacin. */
+		unsigned long long _startTime;
+
+		/** Tiempo (desde el comienzo) del ltimo paquete grabado. */
+		unsigned long long _lastTime;
+
+		/** Paquetes grabados. */
+		unsigned int _nbPackets;
+	};
+
+	//________________________________________________________________________
+
+	/**
+	Lee los paquetes de un fichero grabado con CPacketRecorder.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	class CPacketPlayback {
+	public:
+
+		/** Constructor por defecto. */
+		CPacketPlayback();
+
+		/**
+		Abre un fichero y comprueba la cabecera.
+
+		@param fileName Ruta del fichero.
+		@return false si el fichero no existe o no es un registro de paquetes.
+		*/
+		bool open(const std::string& fileName);
+
+		/**
+		Lee el siguiente paquete.
+
+		@param packet Paquete en el que se deja lo ledo.
+		@return false si no quedan paquetes o el fichero est truncado.
+		*/
+		bool next(TRecordedPacket& packet);
+
+	private:
+
+		/** Lee un entero con longitud variable. */
+		bool readVarInt(unsigned long long& value);
+
+		/** Fichero de entrada. */
+		std::ifstream _file;
+
+		/** Tiempo del ltimo paquete ledo. */
+		unsigned long long _lastTime;
+	};
+
+} // namespace Net
+
+#endif // __Net_PacketLog_H
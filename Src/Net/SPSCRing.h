@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------
+// SPSCRing.h
+//---------------------------------------------------------------------------
+
+/**
+@file SPSCRing.h
+
+Contiene la declaracin e implementacin de la cola circular sin bloqueos
+que comunica el hilo de la lgica con el hilo de red.
+
+@see Net::CSPSCRing
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __Net_SPSCRing_H
+#define __Net_SPSCRing_H
+
+#include <vector>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#	include <intrin.h>
+#	pragma intrinsic(_ReadWriteBarrier)
+#endif
+
+namespace Net {
+
+	/**
+	Cola circular de capacidad fija para un nico productor y un nico
+	consumidor (cada uno en su hilo). No usa ningn tipo de bloqueo: el
+	productor slo escribe el ndice de escritura y el consumidor slo el de
+	lectura, de modo que basta con que la publicacin de cada ndice tenga
+	semntica release y su lectura acquire.
+	<p>
+	Si la cola est llena push() devuelve false y es el productor quien decide
+	si reintentar o descartar.
+
+	@ingroup NetGroup
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	template <typename T>
+	class CSPSCRing {
+	public:
+
+
+		// =======================================================================
+		//                      CONSTRUCTORES Y DESTRUCTOR
+		// =======================================================================
+
+
+		/**
+		Constructor por parmetro.
+
+		@param capacity Nmero de elementos. Debe ser potencia de dos.
+		*/
+		CSPSCRing(unsigned int capacity) : _slots(capacity),
+		                                   _mask(capacity - 1),
+		                                   _head(0),
+		                                   _tail(0) {
+
+			assert( capacity > 0 && (capacity & (capacity - 1)) == 0 && "La capacidad de la cola debe ser potencia de dos" );
+		}
+
+
+		// =======================================================================
+		//                           METODOS PUBLICOS
+		// =======================================================================
+
+
+		/**
+		Productor: aade un elemento al final de la cola.
+
+		@param value Elemento a aadir.
+		@return false si la cola est llena.
+		*/
+		bool push(const T& value) {
+			unsigned int tail = _tail;
+			if( tail - loadAcquire(&_head) > _mask )
+				return false;
+
+			_slots[tail & _mask] = value;
+			storeRelease(&_tail, tail + 1);
+
+			return true;
+		}
+
+		//________________________________________________________________________
+
+		/**
+		Consumidor: saca el primer elemento de la cola.
+
+		@param value Parmetro de salida con el elemento.
+		@return false si la cola est vaca.
+		*/
+		bool pop(T& value) {
+			unsigned int head = _head;
+			if( head == loadAcquire(&_tail) )
+				return false;
+
+			value = _slots[head & _mask];
+			storeRelease(&_head, head + 1);
+
+			return true;
+		}
+
+		//________________________________________________________________________
+
+		/** Consumidor: true si no hay nada que sacar. */
+		bool empty() const {
+			return _head == loadAcquire(&_tail);
+		}
+
+	private:
+
+		/** Lectura con semntica acquire. */
+		static unsigned int loadAcquire(const volatile unsigned int* value) {
+#if defined(_MSC_VER)
+			// En x86/x64 las lecturas volatile de MSVC ya son acquire; la
+			// barrera evita que el compilador reordene
+			unsigned int result = *value;
+			_ReadWriteBarrier();
+			return result;
+#else
+			return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+		}
+
+		/** Escritura con semntica release. */
+		static void storeRelease(volatile unsigned int* target, unsigned int value) {
+#if defined(_MSC_VER)
+			_ReadWriteBarrier();
+			*target = value;
+#else
+			__atomic_store_n(target, value, __ATOMIC_RELEASE);
+#endif
+		}
+
+		/** Almacenamiento de los elementos. */
+		std::vector<T> _slots;
+
+		/** Mscara para convertir los ndices en posiciones. */
+		unsigned int _mask;
+
+		/** ndice de lectura. Slo lo escribe el consumidor. */
+		volatile unsigned int _head;
+
+		/** Separa los dos ndices para que no compartan lnea de cach. */
+		char _padding[64];
+
+		/** ndice de escritura. Slo lo escribe el productor. */
+		volatile unsigned int _tail;
+
+	}; // class CSPSCRing
+
+} // namespace Net
+
+#endif // __Net_SPSCRing_H
@@ -13,6 +13,7 @@
  */
 
 #include "buffer.h"
+#include "BufferPool.h"
 #include "memory.h"
 #include "Map/MapEntity.h"
 
@@ -24,11 +25,11 @@ namespace Net {
 		// Creamos un nuevo wrapper para alojar los datos del buffer
 		_wrapperPtr = new BufferWrapper;
 
-		// Inicializamos los datos propios del buffer
-		_wrapperPtr->_current = _wrapperPtr->_begin = new byte[initsize];
-		_wrapperPtr->_maxsize = initsize;
+		// Inicializamos los datos propios del buffer con memoria del pool
+		_wrapperPtr->_current = _wrapperPtr->_begin = CBufferPool::getThreadPool()->acquire(initsize, _wrapperPtr->_maxsize);
 		_wrapperPtr->_size = 0;
 		_wrapperPtr->_delta = delta;
+		_wrapperPtr->_storage = POOLED;
 
 		// Tenemos una referencia de este buffer
 		_wrapperPtr->_refCount = 1;
@@ -54,6 +55,7 @@ namespace Net {
 		_wrapperPtr->_maxsize = bufferSize;
 		_wrapperPtr->_size = bufferSize;
 		_wrapperPtr->_delta = 100;
+		_wrapperPtr->_storage = ADOPTED;
 
 		// Tenemos una referencia de este buffer
 		_wrapperPtr->_refCount = 1;
@@ -61,6 +63,27 @@ namespace Net {
 
 	//__________________________________________________________________
 
+	CBuffer::CBuffer(BufferWrapper* wrapper) : _wrapperPtr(wrapper) {
+		// Nada que hacer
+	}
+
+	//__________________________________________________________________
+
+	CBuffer CBuffer::createView(const byte* data, size_t dataLength) {
+		// Creamos un wrapper que apunta a los datos dados sin copiarlos
+		BufferWrapper* wrapper = new BufferWrapper;
+		wrapper->_current = wrapper->_begin = const_cast<byte*>(data);
+		wrapper->_maxsize = dataLength;
+		wrapper->_size = dataLength;
+		wrapper->_delta = 100;
+		wrapper->_storage = VIEW;
+		wrapper->_refCount = 1;
+
+		return CBuffer(wrapper);
+	}
+
+	//__________________________________________________________________
+
 	CBuffer& CBuffer::operator=(const CBuffer& source) {
 		if(this == &source) {
 			return *this;
@@ -73,8 +96,7 @@ namespace Net {
 		// Comprobar si se trata de la ltima referencia para
 		// destruir el objeto
 		if(--(_wrapperPtr->_refCount) == 0) {
-			delete [] _wrapperPtr->_begin;
-			delete _wrapperPtr;
+			releaseWrapper();
 		}
 		
 		// Apuntamos al objeto que nos pasan
@@ -87,13 +109,31 @@ namespace Net {
 
 	CBuffer::~CBuffer() {
 		if(--(_wrapperPtr->_refCount) == 0) {
-			delete [] _wrapperPtr->_begin;
-			delete _wrapperPtr;
+			releaseWrapper();
 		}
 	}
 
 	//__________________________________________________________________
 
+	void CBuffer::releaseWrapper() {
+		switch(_wrapperPtr->_storage) {
+			case POOLED:
+				CBufferPool::getThreadPool()->release(_wrapperPtr->_begin, _wrapperPtr->_maxsize);
+				break;
+			case ADOPTED:
+				delete [] _wrapperPtr->_begin;
+				break;
+			case VIEW:
+				// Los datos no son nuestros
+				break;
+		}
+
+		delete _wrapperPtr;
+		_wrapperPtr = NULL;
+	}
+
+	//__________________________________________________________________
+
 	byte* CBuffer::getbuffer() {
 		return _wrapperPtr->_begin;
 	}
@@ -118,22 +158,25 @@ namespace Net {
 		
 		// Creamos un nuevo wrapper y copiamos los datos del buffer
 		_wrapperPtr = new BufferWrapper;
-		_wrapperPtr->_begin = new byte [tempBufferData->_maxsize];
-		//cambiado el int i a unsigned porque es sin signo (ERA WARNING)
-		for(unsigned int i = 0; i < tempBufferData->_size; ++i) {
-			_wrapperPtr->_begin[i] = tempBufferData->_begin[i];
-		}
+		_wrapperPtr->_begin = CBufferPool::getThreadPool()->acquire(tempBufferData->_maxsize, _wrapperPtr->_maxsize);
+		memcpy(_wrapperPtr->_begin, tempBufferData->_begin, tempBufferData->_size);
 
 		// Seteamos el offset de nuestro puntero current
 		_wrapperPtr->_current = _wrapperPtr->_begin + (tempBufferData->_current - tempBufferData->_begin);
 		
 		// Copiamos el resto de datos
-		_wrapperPtr->_maxsize = tempBufferData->_maxsize;
 		_wrapperPtr->_size = tempBufferData->_size;
 		_wrapperPtr->_delta = tempBufferData->_delta;
+		_wrapperPtr->_storage = POOLED;
 
 		// Seteamos el contador de referencias a uno
 		_wrapperPtr->_refCount = 1;
+
+		// Si el wrapper anterior era una vista que solo nos tenia
+		// a nosotros lo liberamos (sin tocar sus datos)
+		if(tempBufferData->_refCount == 0) {
+			delete tempBufferData;
+		}
 	}
 
 	//__________________________________________________________________
@@ -150,12 +193,12 @@ namespace Net {
 	//__________________________________________________________________
 
 	void CBuffer::write(void* data, size_t datalength) {
-		if(_wrapperPtr->_refCount > 1) {
+		if(_wrapperPtr->_refCount > 1 || _wrapperPtr->_storage == VIEW) {
 			createOwnInstance();
 		}
 
-		while(_wrapperPtr->_size + datalength >= _wrapperPtr->_maxsize)
-			realloc();
+		if(_wrapperPtr->_size + datalength > _wrapperPtr->_maxsize)
+			realloc(_wrapperPtr->_size + datalength);
 		
 		memcpy(_wrapperPtr->_current,data,datalength);
 		_wrapperPtr->_current+=datalength;
@@ -175,14 +218,28 @@ namespace Net {
 
 	//__________________________________________________________________
 
-	void CBuffer::realloc() {
-		byte* newbuffer = new byte[_wrapperPtr->_maxsize + _wrapperPtr->_delta];
+	void CBuffer::realloc(size_t minSize) {
+		// Crecimiento geometrico: duplicamos la capacidad (o crecemos al
+		// menos delta) hasta que quepan los datos pedidos
+		size_t newSize = _wrapperPtr->_maxsize * 2;
+		if(newSize < _wrapperPtr->_maxsize + _wrapperPtr->_delta)
+			newSize = _wrapperPtr->_maxsize + _wrapperPtr->_delta;
+		if(newSize < minSize)
+			newSize = minSize;
+
+		CBufferPool* pool = CBufferPool::getThreadPool();
+
+		byte* newbuffer = pool->acquire(newSize, newSize);
 		memcpy(newbuffer, _wrapperPtr->_begin, _wrapperPtr->_size);
-		delete[] _wrapperPtr->_begin;
+		if(_wrapperPtr->_storage == POOLED)
+			pool->release(_wrapperPtr->_begin, _wrapperPtr->_maxsize);
+		else
+			delete [] _wrapperPtr->_begin;
 		
 		_wrapperPtr->_begin = newbuffer;
 		_wrapperPtr->_current = _wrapperPtr->_begin + _wrapperPtr->_size;
-		_wrapperPtr->_maxsize += _wrapperPtr->_delta;	
+		_wrapperPtr->_maxsize = newSize;
+		_wrapperPtr->_storage = POOLED;
 	}
 
 	//__________________________________________________________________
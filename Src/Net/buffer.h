@@ -31,6 +31,15 @@ namespace Net {
 
 	Buffer para almacenar los datos que van a ser transmitidos por la red.
 	Reajusta su tamao de forma dinmica e implementa copy-on-write.
+	<p>
+	La memoria se obtiene del pool de bloques del hilo actual (ver
+	Net::CBufferPool) y crece de forma geomtrica, por lo que escribir
+	n bytes cuesta un nmero logartmico de reservas y copias.
+	<p>
+	Tambin puede construirse como una vista de solo lectura sobre datos
+	ajenos (ver createView), lo que permite deserializar un paquete recibido
+	sin copiar su contenido. Si se escribe en una vista, el buffer hace
+	primero su propia copia de los datos.
 
 	@author Francisco Aisa Garca
 	@author Rubn Mulero Guerrero
@@ -50,7 +59,9 @@ namespace Net {
 		Crea un buffer dinmico.
 
 		@param initsize Tamao inicial del buffer.
-		@param delta Indica cuanto crecer el buffer cada vez que se necesite ampliarlo.
+		@param delta Crecimiento mnimo del buffer cada vez que se necesite ampliarlo.
+		Normalmente el buffer duplica su capacidad, por lo que este valor solo
+		tiene efecto en buffers muy pequeos.
 		*/
 		CBuffer(size_t initsize = 100, size_t delta = 100);
 
@@ -98,6 +109,27 @@ namespace Net {
 		CBuffer& operator=(const CBuffer& source);
 
 
+		// =======================================================================
+		//                          METODOS ESTATICOS
+		// =======================================================================
+
+
+		/**
+		Construye un buffer de solo lectura que apunta a los datos dados sin
+		copiarlos. El puntero de lectura queda colocado al principio, por lo
+		que no es necesario llamar a reset() antes de leer.
+
+		IMPORTANTE: El buffer NO se hace cargo de los datos, por lo que estos
+		deben seguir siendo vlidos mientras se lea de la vista (por ejemplo,
+		durante el procesado de un CPaquete).
+
+		@param data Datos sobre los que se construye la vista.
+		@param dataLength Tamao de los datos.
+		@return Buffer que lee directamente de los datos dados.
+		*/
+		static CBuffer createView(const byte* data, size_t dataLength);
+
+
 		// =======================================================================
 		//                               GETTERS
 		// =======================================================================
@@ -389,22 +421,44 @@ namespace Net {
 
 		/**
 		Se encarga de ampliar la memoria reservada para el buffer y rellenar dicha
-		memoria.
+		memoria. La capacidad se duplica (o crece al menos delta) hasta que
+		caben minSize bytes.
+
+		@param minSize Tamao mnimo que debe poder alojar el buffer.
 		*/
-		void realloc();
+		void realloc(size_t minSize);
 
 		//________________________________________________________________________
 
 		/**
-		Crea una instancia propia del buffer. Util para copy-on-write.
+		Crea una instancia propia del buffer. Util para copy-on-write y para
+		poder escribir en las vistas.
 		*/
 		void createOwnInstance();
 
+		//________________________________________________________________________
+
+		/**
+		Libera el wrapper actual y su memoria en funcin del tipo de
+		almacenamiento. Solo debe llamarse cuando no quedan ms referencias.
+		*/
+		void releaseWrapper();
+
 
 		// =======================================================================
 		//                          MIEMBROS PRIVADOS
 		// =======================================================================
 
+		/** Tipos de almacenamiento que puede tener un buffer. */
+		enum TStorage {
+			/** Memoria obtenida del pool de bloques. */
+			POOLED,
+			/** Memoria adoptada reservada con new []. */
+			ADOPTED,
+			/** Memoria ajena de solo lectura. El buffer no la libera. */
+			VIEW
+		};
+
 		/** Wrapper para facilitar el uso de copy-on-write. */
 		struct BufferWrapper {
 			/** Puntero al comienzo del buffer. */
@@ -419,8 +473,11 @@ namespace Net {
 			/** Tamao de la memoria logica ocupada. */
 			size_t _size;
 			
-			/** Tamao de los incrementos de memoria en los resizes. */
+			/** Tamao mnimo de los incrementos de memoria en los resizes. */
 			size_t _delta;
+
+			/** Procedencia de la memoria apuntada por _begin. */
+			TStorage _storage;
 		
 			/** Contador de referencias para copy-on-write. */
 			unsigned int _refCount;
@@ -428,6 +485,16 @@ namespace Net {
 
 		/** Wrapper de los campos privados para usar copy-on-write. */
 		BufferWrapper* _wrapperPtr;
+
+		//________________________________________________________________________
+
+		/**
+		Construye un buffer a partir de un wrapper ya inicializado. Usado por
+		createView.
+
+		@param wrapper Wrapper del que se hace cargo el buffer.
+		*/
+		CBuffer(BufferWrapper* wrapper);
 	};
 
 } // namespace Net
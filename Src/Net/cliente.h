@@ -68,9 +68,25 @@ public:
 	 * @param data son los datos a enviar
 	 * @param longData tamao de los datos a enviar
 	 * @param channel canal lgico por el que se enviarn los datos
-	 * @param reliable indica si el cliente debe comprobar que los datos han sido recibidos por la mquina remota
+	 * @param delivery indica si los datos deben llegar con seguridad y en orden (ver NetDelivery)
 	 */
-	virtual void sendData(CConexion* conexion, void* data, int longData, int channel, bool reliable)=0;
+	virtual void sendData(CConexion* conexion, void* data, int longData, int channel, NetDelivery delivery)=0;
+
+	/**
+	 * Encola datos en una conexin sin forzar su envo. Los datos saldrn
+	 * en la siguiente llamada a flush() (o al siguiente envo normal).
+	 * @param conexion por la que enviar los datos
+	 * @param data son los datos a enviar
+	 * @param longData tamao de los datos a enviar
+	 * @param channel canal lgico por el que se enviarn los datos
+	 * @param delivery indica si los datos deben llegar con seguridad y en orden (ver NetDelivery)
+	 */
+	virtual void queueData(CConexion* conexion, void* data, int longData, int channel, NetDelivery delivery)=0;
+
+	/**
+	 * Enva todos los datos encolados con queueData.
+	 */
+	virtual void flush()=0;
 	
 	/**
 	 * Refresca el cliente obteniendo todos los paquetes recibidos despus de la ltima llamada a este mtodo
@@ -117,11 +117,16 @@ namespace Net {
 		return listaConexiones.begin();
 	}
 
-	void CClienteENet::sendData(CConexion* conexion, void* data, int longData, int channel, bool reliable)
+	void CClienteENet::sendData(CConexion* conexion, void* data, int longData, int channel, NetDelivery delivery)
 	{
-		enet_uint32 rel = 0;
-		if(reliable)
-			rel = ENET_PACKET_FLAG_RELIABLE;
+		queueData(conexion, data, longData, channel, delivery);
+
+		enet_host_flush (client);
+	}
+
+	void CClienteENet::queueData(CConexion* conexion, void* data, int longData, int channel, NetDelivery delivery)
+	{
+		enet_uint32 rel = getPacketFlags(delivery);
 
 
 		
@@ -133,6 +138,10 @@ namespace Net {
 
 		if(DEBUG_CLIENT)
 			fprintf (stdout, "Packet send ");
+	}
+
+	void CClienteENet::flush()
+	{
 		enet_host_flush (client);
 	}
 
@@ -68,9 +68,20 @@ public:
 	 * @param data son los datos a enviar
 	 * @param longData tamao de los datos a enviar
 	 * @param channel canal lgico por el que se enviarn los datos
-	 * @param reliable indica si el cliente debe comprobar que los datos han sido recibidos por la mquina remota
+	 * @param delivery indica si los datos deben llegar con seguridad y en orden (ver NetDelivery)
 	 */
-	void sendData(CConexion* conexion, void* data, int longData, int channel, bool reliable);
+	void sendData(CConexion* conexion, void* data, int longData, int channel, NetDelivery delivery);
+
+	/**
+	 * Encola datos en una conexin sin vaciar el host de ENet.
+	 * @see flush
+	 */
+	void queueData(CConexion* conexion, void* data, int longData, int channel, NetDelivery delivery);
+
+	/**
+	 * Vaca el host de ENet mandando todo lo encolado.
+	 */
+	void flush();
 
 	/**
 	 * Refresca el cliente obteniendo todos los paquetes recibidos despus de la ltima llamada a este mtodo
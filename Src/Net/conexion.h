@@ -27,6 +27,18 @@ namespace Net {
 	*/
 	typedef unsigned int NetID;
 
+	/**
+	Forma en que se entregan los paquetes de un canal.
+	*/
+	enum NetDelivery {
+		/** Fiable y en orden respecto al resto del canal. */
+		RELIABLE,
+		/** Sin fiabilidad; lo que llega ms viejo que lo ltimo recibido en el canal se descarta. */
+		UNRELIABLE_SEQUENCED,
+		/** Sin fiabilidad ni orden. */
+		UNRELIABLE
+	};
+
 class CConexion {
 
 public:
@@ -34,6 +46,9 @@ public:
 	virtual short getPort()=0;
 	virtual void setId(NetID id)=0;
 	virtual NetID getId()=0;
+
+	/** Devuelve el tiempo medio de ida y vuelta de la conexin en milisegundos. */
+	virtual unsigned int getRoundTripTime()=0;
 };
 
 
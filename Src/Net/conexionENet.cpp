@@ -37,6 +37,12 @@ namespace Net {
 		return _id;
 	}
 
+	unsigned int CConexionENet::getRoundTripTime()
+	{
+		// ENet lo mide con sus propios pings y confirmaciones
+		return _peer->roundTripTime;
+	}
+
 	int CConexionENet::getAddress()
 	{
 		return _peer->address.host;
@@ -34,6 +34,8 @@ public:
 
 	NetID getId();
 
+	unsigned int getRoundTripTime();
+
     void setENetPeer(ENetPeer* p);
 
 	ENetPeer* getENetPeer();
@@ -42,6 +44,20 @@ private:
 	NetID _id;
 };
 
+/**
+Devuelve los flags de paquete de ENet para un tipo de entrega.
+*/
+inline enet_uint32 getPacketFlags(NetDelivery delivery) {
+	switch(delivery) {
+		case RELIABLE:
+			return ENET_PACKET_FLAG_RELIABLE;
+		case UNRELIABLE:
+			return ENET_PACKET_FLAG_UNSEQUENCED;
+		default:
+			return 0;
+	}
+}
+
 
 } // namespace Net
 
@@ -0,0 +1,53 @@
+//---------------------------------------------------------------------------
+// conexionReplay.h
+//---------------------------------------------------------------------------
+
+/**
+@file conexionReplay.h
+
+Representa la conexin de un cliente grabado cuyos paquetes se estn
+reproduciendo. No hay peer detrs: lo que se le manda se descarta.
+
+@see Net::CConexionReplay
+
+@author Francisco Aisa Garca
+@date Junio, 2013
+*/
+
+#ifndef __CONEXIONREPLAY_H
+#define __CONEXIONREPLAY_H
+
+#include "conexion.h"
+
+namespace Net {
+
+/**
+Conexin de un cliente grabado (ver CManager::activateAsReplayServer).
+El tiempo de ida y vuelta es el que tena la conexin original en el
+momento de grabar cada paquete.
+*/
+class CConexionReplay: public CConexion {
+public:
+	CConexionReplay(NetID id):_id(id),_roundTripTime(0){}
+
+	int getAddress() { return 0; }
+
+	short getPort() { return 0; }
+
+	void setId(NetID id) { _id = id; }
+
+	NetID getId() { return _id; }
+
+	unsigned int getRoundTripTime() { return _roundTripTime; }
+
+	/** Fija el tiempo de ida y vuelta grabado, en milisegundos. */
+	void setRoundTripTime(unsigned int roundTripTime) { _roundTripTime = roundTripTime; }
+
+private:
+	NetID _id;
+	unsigned int _roundTripTime;
+};
+
+} // namespace Net
+
+#endif // __CONEXIONREPLAY_H
@@ -25,6 +25,7 @@ namespace Net {
 	{
 		_data = 0;
 		_dataLength = 0;
+		_ownsData = false;
 		_tipoPaquete = tipo;
 		setData(data,dataLength);
 		_conexion = conexion;
@@ -33,7 +34,7 @@ namespace Net {
 
 	CPaquete::~CPaquete()
 	{
-		if(_data != 0)
+		if(_ownsData)
 			delete[] _data;
 	}
 
@@ -44,8 +45,12 @@ namespace Net {
 
 	void CPaquete::setData(byte* data, size_t length)
 	{
-		if (_data != 0)
+		if (_ownsData)
 			delete[] _data;
+
+		_data = 0;
+		_dataLength = 0;
+		_ownsData = false;
 	
 		if((data == 0)||(length == 0))
 			return;
@@ -53,6 +58,17 @@ namespace Net {
 		_data = new byte[length];
 		memcpy(_data, data, length);
 		_dataLength = length;
+		_ownsData = true;
+	}
+
+	void CPaquete::setDataView(byte* data, size_t length)
+	{
+		if (_ownsData)
+			delete[] _data;
+
+		_data = data;
+		_dataLength = length;
+		_ownsData = false;
 	}
 
 	size_t CPaquete::getDataLength()
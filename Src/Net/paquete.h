@@ -66,6 +66,12 @@ public:
 	 */
 	void setData(byte* data, size_t length);
 
+	/**
+	 * Hace que el paquete apunte a datos ajenos sin copiarlos. El paquete
+	 * no los libera, as que deben seguir vivos mientras se use.
+	 */
+	void setDataView(byte* data, size_t length);
+
 	/**
 	 * Obtener el tamao de los datos del paquete
 	 */ 
@@ -105,6 +111,7 @@ protected:
 	unsigned char _canal;
 	size_t _dataLength;
 	byte* _data;
+	bool _ownsData;
 	TipoPaquete _tipoPaquete;
 	CConexion* _conexion;
 
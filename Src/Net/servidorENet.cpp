@@ -148,11 +148,16 @@ namespace Net {
 	}
 
 
-	void CServidorENet::sendData(CConexion* conexion, void* data, size_t longData, int channel, bool reliable)
+	void CServidorENet::sendData(CConexion* conexion, void* data, size_t longData, int channel, NetDelivery delivery)
 	{
-		enet_uint32 rel = 0;
-		if(reliable)
-			rel = ENET_PACKET_FLAG_RELIABLE;
+		queueData(conexion, data, longData, channel, delivery);
+
+		enet_host_flush (server);
+	}
+
+	void CServidorENet::queueData(CConexion* conexion, void* data, size_t longData, int channel, NetDelivery delivery)
+	{
+		enet_uint32 rel = getPacketFlags(delivery);
 		
 		ENetPacket * packet = enet_packet_create (data, 
 												  longData, 
@@ -162,15 +167,17 @@ namespace Net {
 
 		if(DEBUG_SERVER)
 			fprintf (stdout, "Packet send ");
+	}
+
+	void CServidorENet::flush()
+	{
 		enet_host_flush (server);
 	}
 
 
-	void CServidorENet::sendAll(void* data, size_t longData, int channel, bool reliable)
+	void CServidorENet::sendAll(void* data, size_t longData, int channel, NetDelivery delivery)
 	{
-		enet_uint32 rel = 0;
-		if(reliable)
-			rel = ENET_PACKET_FLAG_RELIABLE;
+		enet_uint32 rel = getPacketFlags(delivery);
 
 		ENetPacket * packet = enet_packet_create (data,longData,rel);
 	    
@@ -184,10 +191,8 @@ namespace Net {
 		enet_host_flush (server);
 	}
 
-	void CServidorENet::sendAllExcept(void* data, size_t longData, int channel, bool reliable, CConexion* conexion) {
-		enet_uint32 rel = 0;
-		if(reliable)
-			rel = ENET_PACKET_FLAG_RELIABLE;
+	void CServidorENet::sendAllExcept(void* data, size_t longData, int channel, NetDelivery delivery, CConexion* conexion) {
+		enet_uint32 rel = getPacketFlags(delivery);
 
 		ENetPacket * packet = enet_packet_create (data,longData,rel);
 	    
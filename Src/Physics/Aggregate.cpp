@@ -183,7 +183,8 @@ namespace Physics {
 			}
 		}
 
-		// Aadimos el agregado a la escena
+		// Aadimos el agregado a la escena (esperando a que PhysX no est simulando)
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
 		Physics::CServer::getSingletonPtr()->getActiveScene()->addAggregate(*_aggregate);
 	}
 
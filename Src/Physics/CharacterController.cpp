@@ -67,6 +67,8 @@ namespace Physics {
 		// Destruimos el actor de physx asociado al controller. El gestor de controladores
 		// en su release ya se encarga de desligar el controlador de la escena.
 		if(_controller != NULL) {
+			// No se pueden quitar actores mientras PhysX simula
+			Physics::CServer::getSingletonPtr()->fetchSimulation();
 			_controller->release();
 			_controller = NULL;
 		}
@@ -124,6 +126,9 @@ namespace Physics {
 		desc.callback = _collisionManager;   // Establecer gestor de colisiones
 		desc.userData = (void *) component;  // Anotar el componente lgico asociado al controller
 
+		// No se pueden aadir actores mientras PhysX simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		// Retorna un PxController que podemos castear a capsule controller por ser nuestro caso
 		_controller = static_cast<PxCapsuleController*>( _controllerManager->createController(*_physxSDK, _scene, desc) );
 
@@ -149,6 +154,9 @@ namespace Physics {
 		// de la gravedad, ya que physX no lo hace por nosotros.
 		PxVec3 disp = Vector3ToPxVec3(movement);
 
+		// PhysX no admite mover controllers mientras simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		// Garantiza que los players no se solapen. Empuja las capsulas cuando se van a 
 		// solapar.
 		_controllerManager->computeInteractions(msecs);
@@ -164,6 +172,9 @@ namespace Physics {
 	//________________________________________________________________________
 
 	unsigned CCharacterController::move(const Vector3& movement, unsigned int customFilterMask, unsigned int msecs) {
+		// PhysX no admite mover controllers mientras simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		PxVec3 disp = Vector3ToPxVec3(movement);
 		PxControllerFilters filters(customFilterMask);
 		PxFilterData data;
@@ -213,6 +224,9 @@ namespace Physics {
 		// Activamos todos los shapes del componente por completo en PhysX
 		// Para ello, obtenemos todos sus shapes y ponemos los flags a true
 
+		// Los flags de los shapes no se pueden cambiar mientras PhysX simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		int nbShapes = _controller->getActor()->getNbShapes();
 		PxShape** actorShapes = new PxShape* [nbShapes];
 		_controller->getActor()->getShapes(actorShapes, nbShapes);
@@ -234,6 +248,9 @@ namespace Physics {
 		// Desactivamos todos los shapes del componente por completo en PhysX
 		// Para ello, obtenemos todos sus shapes y ponemos los flags a false
 
+		// Los flags de los shapes no se pueden cambiar mientras PhysX simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		int nbShapes = _controller->getActor()->getNbShapes();
 		PxShape** actorShapes = new PxShape* [nbShapes];
 		_controller->getActor()->getShapes(actorShapes, nbShapes);
@@ -71,6 +71,7 @@ namespace Physics {
 
 		// Si todo ha ido bien, creamos el actor
 		if(_cloth) {
+			Physics::CServer::getSingletonPtr()->fetchSimulation();
 			_scene->addActor(*_cloth); 
 		}
 		else {
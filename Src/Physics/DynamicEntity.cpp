@@ -116,7 +116,8 @@ namespace Physics {
 		// Establecer los filtros en base al grupo de colision
 		Physics::CServer::getSingletonPtr()->setupFiltering(_dynamicActor, group, groupList);
 
-		// Aadir el actor a la escena
+		// Aadir el actor a la escena (esperando a que PhysX no est simulando)
+		physicsServer->fetchSimulation();
 		scene->addActor(*_dynamicActor);
 	}
 
@@ -95,7 +95,8 @@ namespace Physics {
 								  *bufferCollection, *sceneCollection, userRefs);
 
 
-		// Aadir entidades fsicas a la escena
+		// Aadir entidades fsicas a la escena (esperando a que PhysX no est simulando)
+		physicsServer->fetchSimulation();
 		physics->addCollection(*sceneCollection, *scene);
 
 		// Buscar una entidad de tipo PxRigidActor. Asumimos que hay exactamente 1 en el fichero.
@@ -143,6 +144,9 @@ namespace Physics {
 		// Activamos todos los shapes del componente por completo en PhysX
 		// Para ello, obtenemos todos sus shapes y ponemos los flags a true
 
+		// Los flags de los shapes no se pueden cambiar mientras PhysX simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		int nbShapes = _actor->getNbShapes();
 		PxShape** actorShapes = new PxShape* [nbShapes];
 		_actor->getShapes(actorShapes, nbShapes);
@@ -167,6 +171,9 @@ namespace Physics {
 		// Desactivamos todos los shapes del componente por completo en PhysX
 		// Para ello, obtenemos todos sus shapes y ponemos los flags a false
 
+		// Los flags de los shapes no se pueden cambiar mientras PhysX simula
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
+
 		int nbShapes = _actor->getNbShapes();
 		PxShape** actorShapes = new PxShape* [nbShapes];
 		_actor->getShapes(actorShapes, nbShapes);
@@ -100,6 +100,7 @@ namespace Physics {
 	#if PX_SUPPORT_GPU_PHYSX
 		_fluid->setParticleBaseFlag(PxParticleBaseFlag::eGPU, _runOnGPU);
 	#endif
+		Physics::CServer::getSingletonPtr()->fetchSimulation();
 		_scene->addActor(*_fluid);
 		assert(_fluid->getScene() && "PxScene::addActor failed\n");
 
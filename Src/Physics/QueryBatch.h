@@ -0,0 +1,94 @@
+/**
+@file QueryBatch.h
+
+Contiene la declaracin de los structs que describen las queries
+de un lote y sus resultados.
+
+@see Physics::CRaycastQuery
+@see Physics::CSweepQuery
+@see Physics::CQueryResult
+
+@author Francisco Aisa Garca.
+@date Junio, 2013.
+*/
+
+#ifndef __Physics_QueryBatch_H
+#define __Physics_QueryBatch_H
+
+#include "BaseSubsystems/Math.h"
+
+namespace Physics {
+
+	/**
+	Raycast de un lote de queries (ver CServer::raycastBatch).
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	struct CRaycastQuery {
+		/** Rayo que queremos disparar. */
+		Ray ray;
+		/** Longitud mxima del rayo. */
+		float maxDistance;
+		/** Grupos de colisin contra los que choca el rayo (0 para todos). */
+		unsigned int filterMask;
+		/** true si solo interesa el impacto ms cercano. */
+		bool single;
+
+		CRaycastQuery(): maxDistance(0), filterMask(0), single(false) {};
+
+		CRaycastQuery(const Ray& ray, float maxDistance, unsigned int filterMask = 0, bool single = false) :
+			ray(ray), maxDistance(maxDistance), filterMask(filterMask), single(single) {};
+	};
+
+	//________________________________________________________________________
+
+	/**
+	Sweep de un lote de queries (ver CServer::sweepBatch). Todos los sweeps
+	de un lote barren la misma geometra.
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	struct CSweepQuery {
+		/** Posicin inicial del centro de la geometra. */
+		Vector3 position;
+		/** Direccin unitaria del barrido. */
+		Vector3 unitDir;
+		/** Distancia mxima del barrido. */
+		float distance;
+		/** Grupos de colisin contra los que choca la geometra (0 para todos). */
+		unsigned int filterMask;
+		/** true si solo interesa el impacto ms cercano. */
+		bool single;
+
+		CSweepQuery(): position( Vector3::ZERO ), unitDir( Vector3::ZERO ), distance(0), filterMask(0), single(false) {};
+
+		CSweepQuery(const Vector3& position, const Vector3& unitDir, float distance, unsigned int filterMask = 0, bool single = false) :
+			position(position), unitDir(unitDir), distance(distance), filterMask(filterMask), single(single) {};
+	};
+
+	//________________________________________________________________________
+
+	/**
+	Resultado de una query de un lote: el tramo del array compacto de hits
+	que le corresponde.
+
+	@author Francisco Aisa Garca
+	@date Junio, 2013
+	*/
+
+	struct CQueryResult {
+		/** Posicin en el array de hits del primer impacto de la query. */
+		unsigned int firstHit;
+		/** Nmero de impactos de la query. */
+		unsigned int nbHits;
+
+		CQueryResult(): firstHit(0), nbHits(0) {};
+	};
+
+} // namespace Physics
+
+#endif
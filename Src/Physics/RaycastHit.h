@@ -15,6 +15,8 @@ informaci
 
 #include "BaseSubsystems/Math.h"
 
+#include <string>
+
 namespace Logic {
 	class CEntity;
 	class IPhysics;
@@ -35,8 +37,12 @@ namespace Physics {
 		Logic::CEntity* entity;
 		/** Puntero al componente fisico de la entidad golpeada. */
 		Logic::IPhysics* physicComponent;
-		/** Nombre del collider golpeado, unknown en el caso de no tener un nombre asignado.*/
-		std::string colliderName;
+		/** 
+		Nombre del collider golpeado, unknown en el caso de no tener un nombre asignado.
+		Apunta a una cadena internada por el servidor de fsicas, as que dos hits del
+		mismo collider comparten puntero y rellenar el hit no copia cadenas.
+		*/
+		const std::string* colliderName;
 		/** Distancia desde el punto de salida del ray hasta el golpeo. */
 		float distance;
 		/** Punto de impacto del raycast. */
@@ -44,7 +50,14 @@ namespace Physics {
 		/** Normal de impacto del raycast. */
 		Vector3 normal;
 
-		CRaycastHit(): entity(0), distance(-1), impact( Vector3::ZERO ), normal( Vector3::ZERO ) {};
+		CRaycastHit(): entity(0), physicComponent(0), colliderName( &unknownColliderName() ), 
+					   distance(-1), impact( Vector3::ZERO ), normal( Vector3::ZERO ) {};
+
+		/** Nombre que se da a los colliders sin nombre. */
+		static const std::string& unknownColliderName() {
+			static const std::string unknown("unknown");
+			return unknown;
+		}
 	}; 
 
 } // namespace Physics
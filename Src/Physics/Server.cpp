@@ -24,6 +24,8 @@ Contiene la implementaci
 #include <assert.h>
 #include <algorithm>
 
+#include <boost/thread/thread.hpp>
+
 #include <PxPhysicsAPI.h>
 #include <extensions\PxExtensionsAPI.h>
 #include <extensions\PxVisualDebuggerExt.h> 
@@ -39,7 +41,40 @@ namespace Physics {
 
 	//________________________________________________________________________
 
-	CServer::CServer() : _cudaContextManager(NULL), _scene(NULL) {
+	CServer::CServer() : _cpuDispatcher(NULL),
+						 _cudaContextManager(NULL), 
+						 _scene(NULL),
+						 _fixedTime(16),
+						 _subSteps(2),
+						 _pipelined(false),
+						 _simulating(false) {
+
+		// Hilos de trabajo de PhysX en funcin de los ncleos de la mquina
+		setWorkerThreads(0);
+
+		// Buffers de trabajo de las queries. Crecen si alguna query no cabe.
+		_raycastBufferSize = 256;
+		_raycastBuffer = new PxRaycastHit [_raycastBufferSize];
+
+		_sweepBufferSize = 32;
+		_sweepBuffer = new PxSweepHit [_sweepBufferSize];
+
+		_overlapBufferSize = 32;
+		_overlapBuffer = new PxShape* [_overlapBufferSize];
+
+		// Las batched queries se crean con la escena, la primera vez que se usan
+		_raycastBatch = _sweepBatch = NULL;
+
+		_batchRaycastResultsSize = 16;
+		_batchRaycastResults = new PxRaycastQueryResult [_batchRaycastResultsSize];
+		_batchRaycastHitsSize = 256;
+		_batchRaycastHits = new PxRaycastHit [_batchRaycastHitsSize];
+
+		_batchSweepResultsSize = 16;
+		_batchSweepResults = new PxSweepQueryResult [_batchSweepResultsSize];
+		_batchSweepHitsSize = 64;
+		_batchSweepHits = new PxSweepHit [_batchSweepHitsSize];
+
 		// Crear gestor de errores
 		_errorManager = new CErrorManager();
 
@@ -171,6 +206,15 @@ namespace Physics {
 			delete _errorManager;
 			_errorManager = NULL;
 		}
+
+		delete [] _raycastBuffer;
+		delete [] _sweepBuffer;
+		delete [] _overlapBuffer;
+
+		delete [] _batchRaycastResults;
+		delete [] _batchRaycastHits;
+		delete [] _batchSweepResults;
+		delete [] _batchSweepHits;
 	} 
 
 	//________________________________________________________________________
@@ -203,6 +247,9 @@ namespace Physics {
 	void CServer::destroyActor(physx::PxActor *actor) {
 		assert(_scene);
 
+		// No se pueden quitar actores mientras PhysX simula
+		fetchSimulation();
+
 		// Eliminar el actor de la escena
 		_scene->removeActor(*actor);
 
@@ -215,6 +262,9 @@ namespace Physics {
 	void CServer::destroyAggregate(physx::PxAggregate* aggregate) {
 		assert(_scene);
 
+		// No se pueden quitar agregados mientras PhysX simula
+		fetchSimulation();
+
 		/*unsigned int nbActors = aggregate->getNbActors();
 		PxActor** actorsBuffer = new PxActor* [nbActors];
 
@@ -235,31 +285,90 @@ namespace Physics {
 
 	//________________________________________________________________________
 
-	bool CServer::tick(unsigned int msecs) {
+	bool CServer::tick(unsigned int steps) {
 		assert(_scene);
-		_acumTime += msecs;
 
-		// Realizamos varias simulaciones en funcin del timestep (fixedTime) fijado.
-		while(_acumTime >= _fixedTime){
+		// Si quedaba un step en curso lo terminamos antes de lanzar otro
+		fetchSimulation();
+
+		// Cada paso fijo se simula en _subSteps steps
+		const float stepSize = _fixedTime * 0.001f / _subSteps;
+		unsigned int pending = steps * _subSteps;
+
+		bool simulated = false;
+		while(pending > 0){
 			// Simulamos un timestep
 			// La llamada a simulate provoca que PhysX mueva a los actores fsicos durante
 			// el tiempo especificado.
-			_scene->simulate(_fixedTime * 0.001f);
-			_acumTime -= _fixedTime;
+			_scene->simulate(stepSize);
+			--pending;
+			simulated = true;
 			// Si an tenemos que hacer ms simulaciones, le pedimos a PhysX que nos devuelva
 			// los resultados.
-			if(_acumTime >= _fixedTime) {
+			if(pending > 0) {
 				// fetchResults provoca que se disparen las llamadas a los callbacks como
 				// onTrigger y onContact. La variable booleana indica que queremos que esta
 				// llamada sea bloqueante.
 				_scene->fetchResults(true);
 			}
 		}
+
+		// En modo segmentado dejamos que PhysX siga con el ltimo step mientras
+		// se termina el frame. Los resultados se recogen en fetchSimulation.
+		if(_pipelined && simulated) {
+			_simulating = true;
+			return true;
+		}
+
 		return _scene->fetchResults(true);
 	}
 
 	//________________________________________________________________________
 
+	void CServer::setFixedTimeStep(unsigned int msecs, unsigned int subSteps) {
+		assert(msecs > 0 && subSteps > 0);
+
+		_fixedTime = msecs;
+		_subSteps = subSteps;
+	}
+
+	//________________________________________________________________________
+
+	void CServer::fetchSimulation() const {
+		if(!_simulating)
+			return;
+
+		// Bloqueante: puede que PhysX an no haya terminado el step
+		_scene->fetchResults(true);
+		_simulating = false;
+	}
+
+	//________________________________________________________________________
+
+	void CServer::setPipelined(bool pipelined) {
+		// Al desactivarlo no puede quedar ningn step pendiente
+		if(!pipelined && _scene != NULL)
+			fetchSimulation();
+
+		_pipelined = pipelined;
+	}
+
+	//________________________________________________________________________
+
+	void CServer::setWorkerThreads(unsigned int nbThreads) {
+		if(nbThreads == 0) {
+			// Dejamos un ncleo para el hilo principal, que mientras PhysX 
+			// simula termina el frame. hardware_concurrency devuelve 0 si no
+			// sabe cuntos ncleos hay.
+			unsigned int nbCores = boost::thread::hardware_concurrency();
+			nbThreads = nbCores > 1 ? nbCores - 1 : 1;
+		}
+
+		_nbWorkerThreads = nbThreads;
+	}
+
+	//________________________________________________________________________
+
 	void CServer::createScene() {
 		assert(_instance);
 	
@@ -274,8 +383,7 @@ namespace Physics {
 
 		// Establecer un gestor de tareas por CPU
 		if (!sceneDesc.cpuDispatcher) {
-			int mNbThreads = 1; // hilos de ejecucin
-			_cpuDispatcher  = PxDefaultCpuDispatcherCreate(mNbThreads);
+			_cpuDispatcher  = PxDefaultCpuDispatcherCreate(_nbWorkerThreads);
 			assert (_cpuDispatcher && "Error en PxDefaultCpuDispatcherCreate");
 
 			sceneDesc.cpuDispatcher = _cpuDispatcher;
@@ -294,8 +402,7 @@ namespace Physics {
 
 		// Crear la escena fsica
 		_scene = _physics->createScene(sceneDesc);
-		_acumTime = 0;
-		_fixedTime = 8;
+		_simulating = false;
 		assert(_scene && "Error en PxPhysics::createScene");
 
 		// Activamos la notificacin de eventos entre entidades kinemticas.
@@ -311,9 +418,20 @@ namespace Physics {
 		assert(_instance);
 
 		if (_scene) {
+			fetchSimulation();
+
+			// Las batched queries pertenecen a la escena
+			releaseBatches();
+
 			_scene->release();
 			_scene = NULL;
 		}
+
+		// El dispatcher se crea con cada escena, y con l sus hilos
+		if (_cpuDispatcher) {
+			_cpuDispatcher->release();
+			_cpuDispatcher = NULL;
+		}
 	}
 
 	//________________________________________________________________________
@@ -359,6 +477,9 @@ namespace Physics {
 	//________________________________________________________________________
 
 	void CServer::setupFiltering(PxRigidActor* actor, int group, const std::vector<int>& groupList) {
+		// Los filtros de los shapes no se pueden cambiar mientras PhysX simula
+		fetchSimulation();
+
 		// El grupo de colision equivale al numero de desplazamientos que podemos realizar,
 		// que en nuestro caso son 32 debido a que tenemos un entero de 32 bits.
 		PxU32 filterGroup = (1 << group);
@@ -399,14 +520,33 @@ namespace Physics {
 
 	//________________________________________________________________________
 	
-	bool raycastComparator(const CRaycastHit& hit1, const CRaycastHit& hit2) { 
-		return hit1.distance < hit2.distance; 
+	namespace {
+
+		bool raycastComparator(const PxRaycastHit& hit1, const PxRaycastHit& hit2) { 
+			return hit1.distance < hit2.distance; 
+		}
+
+		bool sweepComparator(const PxSweepHit& hit1, const PxSweepHit& hit2) { 
+			return hit1.distance < hit2.distance; 
+		}
+
+		/** Rellena un CSweepHit a partir de un impacto de PhysX. */
+		void fillSweepHit(const PxSweepHit& pxHit, CSweepHit& hit) {
+			IPhysics* component = static_cast<IPhysics*>( pxHit.shape->getActor().userData );
+
+			hit.distance = pxHit.distance;
+			hit.impact = PxVec3ToVector3(pxHit.impact);
+			hit.normal = PxVec3ToVector3(pxHit.normal);
+			hit.entity = component->getEntity();
+		}
+
 	}
 
 	//________________________________________________________________________
 
-	void CServer::raycastMultiple(const Ray& ray, float maxDistance, std::vector<CRaycastHit>& hits, bool sortResultingArray,
-								  unsigned int filterMask) const {
+	unsigned int CServer::raycastToBuffer(const Ray& ray, float maxDistance, bool sortResultingArray, unsigned int filterMask) const {
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
 
 		// Establecer parmettros del rayo
 		PxVec3 origin = Vector3ToPxVec3( ray.getOrigin() );      // origen
@@ -418,69 +558,102 @@ namespace Physics {
 		// Variable que indicara si existe un elemento bloqueante
 		bool blockingHit;
 
-		// Reservamos memoria para el buffer de colisiones
-		PxU32 bufferSize = 256;
-		PxRaycastHit* hitBuffer = new(std::nothrow) PxRaycastHit [bufferSize];
-		assert(hitBuffer != NULL && "Error: Fallo en la reserva de memoria");
-
-		unsigned int nbHits;
-		// Si nos pasan como mscara la 0, hacemos una query normal. En caso contrario
-		// hacemos la query usando el filtro que nos dan.
-		if(filterMask == 0) {
-			nbHits = _scene->raycastMultiple(origin, unitDir, maxDistance, outputFlags, hitBuffer, bufferSize, blockingHit);
-		}
-		else {
-			PxSceneQueryFilterData filters;
+		// Si nos pasan como mscara la 0, hacemos una query normal (el filtro por
+		// defecto). En caso contrario hacemos la query usando el filtro que nos dan.
+		PxSceneQueryFilterData filters;
+		if(filterMask != 0) {
 			filters.data.word0 = filterMask;
-			nbHits = _scene->raycastMultiple(origin, unitDir, maxDistance, outputFlags, hitBuffer, bufferSize, blockingHit, filters);
 		}
 
+		PxI32 nbHits = _scene->raycastMultiple(origin, unitDir, maxDistance, outputFlags, _raycastBuffer, _raycastBufferSize, blockingHit, filters);
 		while(nbHits == -1) {
 			// Si el buffer se ha desbordado aumentamos su tamao al doble
-			// y volvemos ha realizar la query
-			delete [] hitBuffer;
+			// y volvemos ha realizar la query. El buffer se queda con el nuevo
+			// tamao para las siguientes queries.
+			delete [] _raycastBuffer;
 		
-			bufferSize *= 2;
-			hitBuffer = new(std::nothrow) PxRaycastHit [bufferSize];
-			assert(hitBuffer != NULL && "Error en la reserva de memoria");
+			_raycastBufferSize *= 2;
+			_raycastBuffer = new(std::nothrow) PxRaycastHit [_raycastBufferSize];
+			assert(_raycastBuffer != NULL && "Error en la reserva de memoria");
 
 			// Realizamos de nuevo la query
-			nbHits = _scene->raycastMultiple(origin, unitDir, maxDistance, outputFlags, hitBuffer, bufferSize, blockingHit);
+			nbHits = _scene->raycastMultiple(origin, unitDir, maxDistance, outputFlags, _raycastBuffer, _raycastBufferSize, blockingHit, filters);
 		}
 
-		if(nbHits > 0) {
-			// Si hemos golpeado a otras entidades creamos un buffer
-			hits.reserve(nbHits);
+		if(sortResultingArray) {
+			// Ordenamos los impactos por distancia
+			std::sort(_raycastBuffer, _raycastBuffer + nbHits, raycastComparator);
+		}
 
-			// Rellenamos el buffer con un puntero a cada una de las entidades golpeadas
-			IPhysics* component;
-			CRaycastHit raycastHit;
-			for(int i = 0; i < nbHits; ++i) {
-				PxRigidActor& actor = hitBuffer[i].shape->getActor();
-				component = static_cast<IPhysics*>(actor.userData);
+		return nbHits;
+	}
 
-				raycastHit.entity			= component->getEntity();
-				raycastHit.physicComponent	= component;
-				raycastHit.colliderName		= component->collidersHaveName() ? actor.getName() : "unknown";
-				raycastHit.distance			= hitBuffer[i].distance;
-				raycastHit.impact			= PxVec3ToVector3(hitBuffer[i].impact);
-				raycastHit.normal			= PxVec3ToVector3(hitBuffer[i].normal);
+	//________________________________________________________________________
 
-				hits.push_back(raycastHit);
-			}
+	void CServer::fillRaycastHit(const PxRaycastHit& pxHit, CRaycastHit& hit) const {
+		PxRigidActor& actor = pxHit.shape->getActor();
+		IPhysics* component = static_cast<IPhysics*>(actor.userData);
+
+		hit.entity			= component->getEntity();
+		hit.physicComponent	= component;
+		hit.colliderName	= component->collidersHaveName() ? internColliderName( actor.getName() ) : &CRaycastHit::unknownColliderName();
+		hit.distance		= pxHit.distance;
+		hit.impact			= PxVec3ToVector3(pxHit.impact);
+		hit.normal			= PxVec3ToVector3(pxHit.normal);
+	}
+
+	//________________________________________________________________________
+
+	const std::string* CServer::internColliderName(const char* name) const {
+		if(name == NULL)
+			return &CRaycastHit::unknownColliderName();
+
+		// Lo normal es haber visto ya este nombre
+		std::unordered_map<const char*, const std::string*>::const_iterator it = _colliderNamesByActorName.find(name);
+		if( it != _colliderNamesByActorName.end() )
+			return it->second;
+
+		const std::string* interned = &*_colliderNames.insert(name).first;
+		_colliderNamesByActorName[name] = interned;
+
+		return interned;
+	}
+
+	//________________________________________________________________________
+
+	void CServer::raycastMultiple(const Ray& ray, float maxDistance, std::vector<CRaycastHit>& hits, bool sortResultingArray,
+								  unsigned int filterMask) const {
+
+		unsigned int nbHits = raycastToBuffer(ray, maxDistance, sortResultingArray, filterMask);
+
+		// Los impactos se aaden al final. Si el vector del que llama ya tiene
+		// capacidad suficiente no se reserva memoria.
+		unsigned int first = hits.size();
+		hits.resize(first + nbHits);
+		for(unsigned int i = 0; i < nbHits; ++i) {
+			fillRaycastHit(_raycastBuffer[i], hits[first + i]);
 		}
+	}
 
-		delete [] hitBuffer;
+	//________________________________________________________________________
 
-		if( !hits.empty() && sortResultingArray ) {
-			// Ordenamos el vector de resultados
-			std::sort(hits.begin(), hits.end(), raycastComparator);
+	unsigned int CServer::raycastMultiple(const Ray& ray, float maxDistance, CRaycastHit* hits, unsigned int maxHits, 
+										  bool sortResultingArray, unsigned int filterMask) const {
+
+		unsigned int nbHits = std::min( raycastToBuffer(ray, maxDistance, sortResultingArray, filterMask), maxHits );
+		for(unsigned int i = 0; i < nbHits; ++i) {
+			fillRaycastHit(_raycastBuffer[i], hits[i]);
 		}
+
+		return nbHits;
 	}
 
 	//________________________________________________________________________
 
 	bool CServer::raycastSingle(const Ray& ray, float maxDistance, CRaycastHit& hit, unsigned int filterMask) const {
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
+
 		// Establecer parmettros del rayo
 		PxVec3 origin = Vector3ToPxVec3( ray.getOrigin() );      // origen     
 		PxVec3 unitDir = Vector3ToPxVec3( ray.getDirection() );  // direccin normalizada
@@ -506,15 +679,7 @@ namespace Physics {
 		
 		// Introducimos la informacin devuelta en la estructura que vamos a devolver
 		if(validEntity) {
-			PxRigidActor& actor = hitSpot.shape->getActor();
-			IPhysics* physicComponent = static_cast<IPhysics*>(actor.userData);
-
-			hit.entity			= physicComponent->getEntity();
-			hit.physicComponent	= physicComponent;
-			hit.colliderName	= physicComponent->collidersHaveName() ? actor.getName() : "unknown";
-			hit.distance		= hitSpot.distance;
-			hit.impact			= PxVec3ToVector3( hitSpot.impact );
-			hit.normal			= PxVec3ToVector3( hitSpot.normal );
+			fillRaycastHit(hitSpot, hit);
 		}
 
 		return validEntity;
@@ -523,6 +688,9 @@ namespace Physics {
 	//________________________________________________________________________
 
 	bool CServer::raycastAny(const Ray& ray, float maxDistance, unsigned int filterMask) const {
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
+
 		// Establecer parmettros del rayo
 		PxVec3 origin = Vector3ToPxVec3( ray.getOrigin() );      // origen     
 		PxVec3 unitDir = Vector3ToPxVec3( ray.getDirection() );  // direccin normalizada
@@ -541,81 +709,80 @@ namespace Physics {
 
 	//________________________________________________________________________
 
-	bool sweepComparator(const CSweepHit& hit1, const CSweepHit& hit2) { 
-		return hit1.distance < hit2.distance; 
-	}
-
-	//________________________________________________________________________
+	unsigned int CServer::sweepToBuffer(const PxGeometry& geometry, const Vector3& position, const Vector3& unitDir, 
+										float distance, bool sortResultingArray, unsigned int filterMask) const {
 
-	void CServer::sweepMultiple(const physx::PxGeometry& geometry, const Vector3& position,
-								const Vector3& unitDir, float distance, std::vector<CSweepHit>& hitSpots, 
-								bool sortResultingArray, unsigned int filterMask) const {
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
 
 		// Booleano que indicara si hay elementos que bloquean el hit
 		bool blockingHit;
 		// La situamos en la posicion dada
 		PxTransform pose( Vector3ToPxVec3(position) );
-		// Seteamos el tamao del buffer de colisiones a 5
-		PxU32 bufferSize = 5;
-		// Reservamos memoria para el buffer
-		PxSweepHit* hitBuffer = new(std::nothrow) PxSweepHit [bufferSize];
-		assert(hitBuffer != NULL && "Error en la reserva de memoria");
+		PxVec3 direction = Vector3ToPxVec3(unitDir);
 
 		// Seteamos los flags de sweep
 		const PxSceneQueryFlags outputFlags = PxSceneQueryFlag::eDISTANCE			| 
 											  PxSceneQueryFlag::eIMPACT				| 
 											  PxSceneQueryFlag::eNORMAL;
 
-		unsigned int nbHits;
-		// Si nos pasan como mscara la 0, hacemos una query normal. En caso contrario
-		// hacemos la query usando el filtro que nos dan.
-		if(filterMask == 0) {
-			nbHits = _scene->sweepMultiple(geometry, pose, Vector3ToPxVec3(unitDir), distance, outputFlags, hitBuffer, bufferSize, blockingHit);
-		}
-		else {
-			PxSceneQueryFilterData filters;
+		// Si nos pasan como mscara la 0, hacemos una query normal (el filtro por
+		// defecto). En caso contrario hacemos la query usando el filtro que nos dan.
+		PxSceneQueryFilterData filters;
+		if(filterMask != 0) {
 			filters.data.word0 = filterMask;
-			nbHits = _scene->sweepMultiple(geometry, pose, Vector3ToPxVec3(unitDir), distance, outputFlags, hitBuffer, bufferSize, blockingHit, filters);
 		}
 
+		PxI32 nbHits = _scene->sweepMultiple(geometry, pose, direction, distance, outputFlags, _sweepBuffer, _sweepBufferSize, blockingHit, filters);
 		while(nbHits == -1) {
 			// Si el buffer se ha desbordado aumentamos su tamao al doble
 			// y volvemos ha realizar la query
-			delete [] hitBuffer;
+			delete [] _sweepBuffer;
 		
-			bufferSize *= 2;
-			hitBuffer = new(std::nothrow) PxSweepHit [bufferSize];
-			assert(hitBuffer != NULL && "Error en la reserva de memoria");
+			_sweepBufferSize *= 2;
+			_sweepBuffer = new(std::nothrow) PxSweepHit [_sweepBufferSize];
+			assert(_sweepBuffer != NULL && "Error en la reserva de memoria");
 
 			// Realizamos de nuevo la query
-			nbHits = _scene->sweepMultiple(geometry, pose, Vector3ToPxVec3(unitDir), 100, outputFlags, hitBuffer, bufferSize, blockingHit);
+			nbHits = _scene->sweepMultiple(geometry, pose, direction, distance, outputFlags, _sweepBuffer, _sweepBufferSize, blockingHit, filters);
 		}
 
-		if(nbHits > 0) {
-			// Si hemos golpeado a otras entidades creamos un buffer
-			hitSpots.reserve(nbHits);
+		if(sortResultingArray) {
+			// Ordenamos los impactos por distancia
+			std::sort(_sweepBuffer, _sweepBuffer + nbHits, sweepComparator);
+		}
 
-			IPhysics* component;
-			CSweepHit sweepHit;
-			// Rellenamos el buffer con un puntero a cada una de las entidades golpeadas
-			for(int i = 0; i < nbHits; ++i) {
-				component = static_cast<IPhysics*>( hitBuffer[i].shape->getActor().userData );
+		return nbHits;
+	}
 
-				sweepHit.distance = hitBuffer[i].distance;
-				sweepHit.impact = PxVec3ToVector3(hitBuffer[i].impact);
-				sweepHit.normal = PxVec3ToVector3(hitBuffer[i].normal);
-				sweepHit.entity = component->getEntity();
-				
-				hitSpots.push_back(sweepHit);
-			}
+	//________________________________________________________________________
+
+	void CServer::sweepMultiple(const physx::PxGeometry& geometry, const Vector3& position,
+								const Vector3& unitDir, float distance, std::vector<CSweepHit>& hitSpots, 
+								bool sortResultingArray, unsigned int filterMask) const {
+
+		unsigned int nbHits = sweepToBuffer(geometry, position, unitDir, distance, sortResultingArray, filterMask);
+
+		// Los impactos se aaden al final del vector
+		unsigned int first = hitSpots.size();
+		hitSpots.resize(first + nbHits);
+		for(unsigned int i = 0; i < nbHits; ++i) {
+			fillSweepHit(_sweepBuffer[i], hitSpots[first + i]);
 		}
+	}
 
-		delete [] hitBuffer;
+	//________________________________________________________________________
+
+	unsigned int CServer::sweepMultiple(const physx::PxGeometry& geometry, const Vector3& position,
+										const Vector3& unitDir, float distance, CSweepHit* hitSpots, unsigned int maxHits,
+										bool sortResultingArray, unsigned int filterMask) const {
 
-		if( !hitSpots.empty() && sortResultingArray ) {
-			// Ordenamos el vector de resultados
-			std::sort(hitSpots.begin(), hitSpots.end(), sweepComparator);
+		unsigned int nbHits = std::min( sweepToBuffer(geometry, position, unitDir, distance, sortResultingArray, filterMask), maxHits );
+		for(unsigned int i = 0; i < nbHits; ++i) {
+			fillSweepHit(_sweepBuffer[i], hitSpots[i]);
 		}
+
+		return nbHits;
 	}
 
 	//________________________________________________________________________
@@ -623,6 +790,9 @@ namespace Physics {
 	bool CServer::sweepSingle(const physx::PxGeometry& sweepGeometry, const Vector3& position, 
 						      const Vector3& unitDir, float distance, Vector3& hitSpot, unsigned int filterMask) const {
 
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
+
 		// Seteamos los flags de sweep
 		const PxSceneQueryFlags outputFlags = PxSceneQueryFlag::eDISTANCE | PxSceneQueryFlag::eIMPACT | PxSceneQueryFlag::eNORMAL;
 
@@ -651,6 +821,9 @@ namespace Physics {
 	bool CServer::sweepAny(const physx::PxGeometry& sweepGeometry, const Vector3& position, 
 						   const Vector3& unitDir, float distance, unsigned int filterMask) const {
 
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
+
 		// Seteamos los flags de sweep
 		const PxSceneQueryFlags outputFlags = PxSceneQueryFlag::eDISTANCE | PxSceneQueryFlag::eIMPACT | PxSceneQueryFlag::eNORMAL;
 
@@ -671,16 +844,12 @@ namespace Physics {
 
 	//________________________________________________________________________
 
-	void CServer::overlapMultiple(const PxGeometry& geometry, const Vector3& position, std::vector<Logic::CEntity*>& entitiesHit, unsigned int filterMask) const {
-		// Comprobar que es una de las geometrias soportadas por la query de overlap
+	unsigned int CServer::overlapToBuffer(const PxGeometry& geometry, const Vector3& position, unsigned int filterMask) const {
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
 
 		// La situamos en la posicion dada
 		PxTransform pose( Vector3ToPxVec3(position) );
-		// Seteamos el tamao del buffer de colisiones a 5
-		PxU32 bufferSize = 5;
-		// Reservamos memoria para el buffer
-		PxShape** hitBuffer = new(std::nothrow) PxShape* [bufferSize];
-		assert(hitBuffer != NULL && "Error en la reserva de memoria");
 
 		// Calculamos el overlap contra objetos dinamicos y contra estaticos.
 		// El valor de retorno es el numero de hits del buffer o -1 si el buffer no es lo suficientemente
@@ -693,37 +862,279 @@ namespace Physics {
 			filterData.data.word0 = filterMask;
 		}
 
-		unsigned int nbHits = _scene->overlapMultiple(geometry, pose, hitBuffer, bufferSize, filterData);
+		PxI32 nbHits = _scene->overlapMultiple(geometry, pose, _overlapBuffer, _overlapBufferSize, filterData);
 		while(nbHits == -1) {
 			// Si el buffer se ha desbordado aumentamos su tamao al doble
 			// y volvemos ha realizar la query
-			delete [] hitBuffer;
+			delete [] _overlapBuffer;
 		
-			bufferSize *= 2;
-			hitBuffer = new(std::nothrow) PxShape* [bufferSize];
-			assert(hitBuffer != NULL && "Error en la reserva de memoria");
+			_overlapBufferSize *= 2;
+			_overlapBuffer = new(std::nothrow) PxShape* [_overlapBufferSize];
+			assert(_overlapBuffer != NULL && "Error en la reserva de memoria");
 
 			// Realizamos de nuevo la query
-			nbHits = _scene->overlapMultiple(geometry, pose, hitBuffer, bufferSize, filterData);
+			nbHits = _scene->overlapMultiple(geometry, pose, _overlapBuffer, _overlapBufferSize, filterData);
+		}
+
+		return nbHits;
+	}
+
+	//________________________________________________________________________
+
+	void CServer::overlapMultiple(const PxGeometry& geometry, const Vector3& position, std::vector<Logic::CEntity*>& entitiesHit, unsigned int filterMask) const {
+		unsigned int nbHits = overlapToBuffer(geometry, position, filterMask);
+
+		// Rellenamos el vector con un puntero a cada una de las entidades golpeadas
+		for(unsigned int i = 0; i < nbHits; ++i) {
+			IPhysics *component = static_cast<IPhysics*>( _overlapBuffer[i]->getActor().userData );
+			entitiesHit.push_back( component != NULL ? component->getEntity() : NULL );
+		}
+	}
+
+	//________________________________________________________________________
+
+	unsigned int CServer::overlapMultiple(const PxGeometry& geometry, const Vector3& position, Logic::CEntity** entitiesHit, 
+										  unsigned int maxHits, unsigned int filterMask) const {
+
+		unsigned int nbHits = std::min( overlapToBuffer(geometry, position, filterMask), maxHits );
+		for(unsigned int i = 0; i < nbHits; ++i) {
+			IPhysics *component = static_cast<IPhysics*>( _overlapBuffer[i]->getActor().userData );
+			entitiesHit[i] = component != NULL ? component->getEntity() : NULL;
 		}
 
-		if(nbHits > 0) {
-			// Si hemos golpeado a otras entidades creamos un buffer
-			entitiesHit.reserve(nbHits);
+		return nbHits;
+	}
+
+	//________________________________________________________________________
+
+	void CServer::raycastBatch(const CRaycastQuery* queries, unsigned int nbQueries, CQueryResult* results,
+							   std::vector<CRaycastHit>& hits, bool sortResultingArray) const {
+
+		assert(_scene);
+		if(nbQueries == 0)
+			return;
+
+		// PhysX no admite ejecutar lotes de queries mientras simula
+		fetchSimulation();
 
-			// Rellenamos el buffer con un puntero a cada una de las entidades golpeadas
-			for(int i = 0; i < nbHits; ++i) {
-				IPhysics *component = static_cast<IPhysics*>( hitBuffer[i]->getActor().userData );
-				entitiesHit.push_back( component != NULL ? component->getEntity() : NULL );
+		// PhysX necesita un hueco de resultado por query
+		if(_raycastBatch == NULL || nbQueries > _batchRaycastResultsSize) {
+			if(nbQueries > _batchRaycastResultsSize) {
+				delete [] _batchRaycastResults;
+
+				while(_batchRaycastResultsSize < nbQueries)
+					_batchRaycastResultsSize *= 2;
+
+				_batchRaycastResults = new(std::nothrow) PxRaycastQueryResult [_batchRaycastResultsSize];
+				assert(_batchRaycastResults != NULL && "Error en la reserva de memoria");
 			}
+
+			createRaycastBatch();
 		}
 
-		delete [] hitBuffer;
+		// Seteamos los flags que indican que informacin queremos extraer
+		const PxSceneQueryFlags outputFlags = PxSceneQueryFlag::eDISTANCE | PxSceneQueryFlag::eIMPACT | PxSceneQueryFlag::eNORMAL;
+
+		bool overflow;
+		do {
+			// Encolamos todas las queries y las resolvemos de una vez
+			for(unsigned int i = 0; i < nbQueries; ++i) {
+				const CRaycastQuery& query = queries[i];
+				PxVec3 origin = Vector3ToPxVec3( query.ray.getOrigin() );
+				PxVec3 unitDir = Vector3ToPxVec3( query.ray.getDirection() );
+
+				// Con la mscara 0 se usa el filtro por defecto
+				PxSceneQueryFilterData filters;
+				if(query.filterMask != 0) {
+					filters.data.word0 = query.filterMask;
+				}
+
+				if(query.single) {
+					_raycastBatch->raycastSingle(origin, unitDir, query.maxDistance, filters, outputFlags);
+				}
+				else {
+					_raycastBatch->raycastMultiple(origin, unitDir, query.maxDistance, filters, outputFlags);
+				}
+			}
+
+			_raycastBatch->execute();
+
+			// Si los impactos no han cabido doblamos el buffer y repetimos el lote
+			overflow = false;
+			for(unsigned int i = 0; i < nbQueries && !overflow; ++i) {
+				overflow = _batchRaycastResults[i].queryStatus == PxBatchQueryStatus::eOVERFLOW;
+			}
+
+			if(overflow) {
+				delete [] _batchRaycastHits;
+
+				_batchRaycastHitsSize *= 2;
+				_batchRaycastHits = new(std::nothrow) PxRaycastHit [_batchRaycastHitsSize];
+				assert(_batchRaycastHits != NULL && "Error en la reserva de memoria");
+
+				createRaycastBatch();
+			}
+		} while(overflow);
+
+		// Volcamos los impactos en el vector compacto
+		for(unsigned int i = 0; i < nbQueries; ++i) {
+			PxRaycastQueryResult& result = _batchRaycastResults[i];
+			if(sortResultingArray) {
+				std::sort(result.hits, result.hits + result.nbHits, raycastComparator);
+			}
+
+			unsigned int first = hits.size();
+			results[i].firstHit = first;
+			results[i].nbHits = result.nbHits;
+
+			hits.resize(first + result.nbHits);
+			for(unsigned int j = 0; j < result.nbHits; ++j) {
+				fillRaycastHit(result.hits[j], hits[first + j]);
+			}
+		}
+	}
+
+	//________________________________________________________________________
+
+	void CServer::sweepBatch(const PxGeometry& geometry, const CSweepQuery* queries, unsigned int nbQueries, 
+							 CQueryResult* results, std::vector<CSweepHit>& hitSpots, bool sortResultingArray) const {
+
+		assert(_scene);
+		if(nbQueries == 0)
+			return;
+
+		// PhysX no admite ejecutar lotes de queries mientras simula
+		fetchSimulation();
+
+		// PhysX necesita un hueco de resultado por query
+		if(_sweepBatch == NULL || nbQueries > _batchSweepResultsSize) {
+			if(nbQueries > _batchSweepResultsSize) {
+				delete [] _batchSweepResults;
+
+				while(_batchSweepResultsSize < nbQueries)
+					_batchSweepResultsSize *= 2;
+
+				_batchSweepResults = new(std::nothrow) PxSweepQueryResult [_batchSweepResultsSize];
+				assert(_batchSweepResults != NULL && "Error en la reserva de memoria");
+			}
+
+			createSweepBatch();
+		}
+
+		// Seteamos los flags de sweep
+		const PxSceneQueryFlags outputFlags = PxSceneQueryFlag::eDISTANCE | PxSceneQueryFlag::eIMPACT | PxSceneQueryFlag::eNORMAL;
+
+		bool overflow;
+		do {
+			// Encolamos todas las queries y las resolvemos de una vez
+			for(unsigned int i = 0; i < nbQueries; ++i) {
+				const CSweepQuery& query = queries[i];
+				PxTransform pose( Vector3ToPxVec3(query.position) );
+				PxVec3 unitDir = Vector3ToPxVec3(query.unitDir);
+
+				// Con la mscara 0 se usa el filtro por defecto
+				PxSceneQueryFilterData filters;
+				if(query.filterMask != 0) {
+					filters.data.word0 = query.filterMask;
+				}
+
+				if(query.single) {
+					_sweepBatch->sweepSingle(geometry, pose, unitDir, query.distance, filters, outputFlags);
+				}
+				else {
+					_sweepBatch->sweepMultiple(geometry, pose, unitDir, query.distance, filters, outputFlags);
+				}
+			}
+
+			_sweepBatch->execute();
+
+			// Si los impactos no han cabido doblamos el buffer y repetimos el lote
+			overflow = false;
+			for(unsigned int i = 0; i < nbQueries && !overflow; ++i) {
+				overflow = _batchSweepResults[i].queryStatus == PxBatchQueryStatus::eOVERFLOW;
+			}
+
+			if(overflow) {
+				delete [] _batchSweepHits;
+
+				_batchSweepHitsSize *= 2;
+				_batchSweepHits = new(std::nothrow) PxSweepHit [_batchSweepHitsSize];
+				assert(_batchSweepHits != NULL && "Error en la reserva de memoria");
+
+				createSweepBatch();
+			}
+		} while(overflow);
+
+		// Volcamos los impactos en el vector compacto
+		for(unsigned int i = 0; i < nbQueries; ++i) {
+			PxSweepQueryResult& result = _batchSweepResults[i];
+			if(sortResultingArray) {
+				std::sort(result.hits, result.hits + result.nbHits, sweepComparator);
+			}
+
+			unsigned int first = hitSpots.size();
+			results[i].firstHit = first;
+			results[i].nbHits = result.nbHits;
+
+			hitSpots.resize(first + result.nbHits);
+			for(unsigned int j = 0; j < result.nbHits; ++j) {
+				fillSweepHit(result.hits[j], hitSpots[first + j]);
+			}
+		}
+	}
+
+	//________________________________________________________________________
+
+	void CServer::createRaycastBatch() const {
+		if(_raycastBatch != NULL) {
+			_raycastBatch->release();
+		}
+
+		PxBatchQueryDesc desc;
+		desc.userRaycastResultBuffer = _batchRaycastResults;
+		desc.userRaycastHitBuffer = _batchRaycastHits;
+		desc.raycastHitBufferSize = _batchRaycastHitsSize;
+
+		_raycastBatch = _scene->createBatchQuery(desc);
+		assert(_raycastBatch && "Error en PxScene::createBatchQuery");
+	}
+
+	//________________________________________________________________________
+
+	void CServer::createSweepBatch() const {
+		if(_sweepBatch != NULL) {
+			_sweepBatch->release();
+		}
+
+		PxBatchQueryDesc desc;
+		desc.userSweepResultBuffer = _batchSweepResults;
+		desc.userSweepHitBuffer = _batchSweepHits;
+		desc.sweepHitBufferSize = _batchSweepHitsSize;
+
+		_sweepBatch = _scene->createBatchQuery(desc);
+		assert(_sweepBatch && "Error en PxScene::createBatchQuery");
+	}
+
+	//________________________________________________________________________
+
+	void CServer::releaseBatches() {
+		if(_raycastBatch != NULL) {
+			_raycastBatch->release();
+			_raycastBatch = NULL;
+		}
+
+		if(_sweepBatch != NULL) {
+			_sweepBatch->release();
+			_sweepBatch = NULL;
+		}
 	}
 
 	//________________________________________________________________________
 
 	bool CServer::overlapAny(const PxGeometry& geometry, const Vector3& position, unsigned int filterMask) const {
+		// PhysX no admite queries mientras simula
+		fetchSimulation();
+
 		PxShape* hit;
 
 		if(filterMask == 0) {
@@ -18,9 +18,14 @@ Contiene la declaraci
 #include "MaterialManager.h"
 #include "RaycastHit.h"
 #include "SweepHit.h"
+#include "QueryBatch.h"
 
 #include <PxFiltering.h>
 
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 // Predeclaracin de tipos
 namespace Logic {
 	class CEntity;
@@ -55,6 +60,12 @@ namespace physx {
 	class PxScene;
 	class PxRigidBody;
 	class PxControllerBehaviorCallback;
+	class PxShape;
+	class PxBatchQuery;
+	struct PxRaycastHit;
+	struct PxSweepHit;
+	struct PxRaycastQueryResult;
+	struct PxSweepQueryResult;
 
 	namespace pxtask {
 		class CudaContextManager;
@@ -221,13 +232,103 @@ namespace Physics {
 		Realiza la simulacin fsica y actualiza la posicin de todas las 
 		entidades fsicas.
 
-		La simulacin fsica se hacen en pequeos steps de tiempo para evitar
-		que se produzcan situaciones inesperadas al haber ticks muy grandes.
+		La fsica no acumula tiempo por su cuenta: recibe los mismos pasos de
+		tick fijo que la lgica (los calcula el planificador de la aplicacin)
+		y cada uno se simula en varios steps ms pequeos para evitar
+		situaciones inesperadas (ver setFixedTimeStep).
+
+		En modo segmentado (ver setPipelined) el ltimo step se deja simulando
+		en los hilos de PhysX y no se recogen sus resultados hasta la siguiente
+		llamada a fetchSimulation.
 
-		@param secs Millisegundos transcurridos desde la ltima actualizacin.
+		@param steps Pasos de tick fijo que hay que simular.
 		@return Valor booleano indicando si todo fue bien.
 		*/
-		bool tick(unsigned int msecs);
+		bool tick(unsigned int steps);
+
+		//________________________________________________________________________
+
+		/**
+		Fija la duracin del paso de tick fijo y en cuntos steps de PhysX se
+		divide. Tiene que coincidir con el paso fijo de la lgica para que las
+		dos simulaciones avancen a la par.
+
+		@param msecs Milisegundos de cada paso fijo.
+		@param subSteps Steps de simulacin por paso fijo.
+		*/
+		void setFixedTimeStep(unsigned int msecs, unsigned int subSteps);
+
+		//________________________________________________________________________
+
+		/**
+		Punto de sincronizacin con la simulacin en curso: espera a que PhysX
+		termine el step lanzado en el ltimo tick y recoge sus resultados. Aqu
+		se disparan los callbacks de colisin (onContact, onTrigger).
+		<p>
+		Si no hay ningn step en curso no hace nada. Adems de al principio de
+		cada frame, se llama antes de todo lo que PhysX no permite mientras
+		simula (ver setPipelined).
+		*/
+		void fetchSimulation() const;
+
+		//________________________________________________________________________
+
+		/**
+		Activa o desactiva el modo segmentado. En este modo el step de fsica
+		de un frame se simula mientras se termina ese frame y se espera al
+		siguiente:
+
+		<ol>
+		<li>fetchSimulation: se recogen los resultados del step anterior.</li>
+		<li>Tick de la lgica, con la escena sincronizada.</li>
+		<li>tick: se lanza el step del frame sin esperar a que acabe.</li>
+		<li>Envo de red, render, audio y espera del planificador, en
+		paralelo con PhysX.</li>
+		</ol>
+
+		Durante el solape PhysX 3.2 solo admite escrituras sobre los actores
+		(poses, velocidades, fuerzas), que guarda y aplica en el siguiente
+		step. Lo que no admite se sincroniza solo llamando a fetchSimulation
+		antes de tocar la escena, por si llega desde fuera del tick de la
+		lgica (por ejemplo al procesar los mensajes de red del siguiente
+		frame):
+
+		<ul>
+		<li>Queries: raycasts, sweeps, overlaps y sus versiones por lotes.</li>
+		<li>Mover character controllers.</li>
+		<li>Aadir o quitar actores, agregados y controllers.</li>
+		<li>Cambiar flags y filtros de los shapes.</li>
+		</ul>
+
+		@param pipelined true para solapar la fsica con el resto del frame.
+		*/
+		void setPipelined(bool pipelined);
+
+		//________________________________________________________________________
+
+		/** Devuelve true si la fsica se simula en paralelo con el resto del frame. */
+		bool isPipelined() const { return _pipelined; }
+
+		//________________________________________________________________________
+
+		/** Devuelve true si hay un step de simulacin en curso. */
+		bool isSimulating() const { return _simulating; }
+
+		//________________________________________________________________________
+
+		/**
+		Fija el nmero de hilos de trabajo del dispatcher de PhysX. Solo tiene
+		efecto sobre las escenas que se creen a partir de este momento.
+
+		@param nbThreads Nmero de hilos. 0 para calcularlo a partir de los
+		ncleos de la mquina (todos menos el que ejecuta la lgica).
+		*/
+		void setWorkerThreads(unsigned int nbThreads);
+
+		//________________________________________________________________________
+
+		/** Devuelve el nmero de hilos de trabajo del dispatcher de PhysX. */
+		unsigned int getWorkerThreads() const { return _nbWorkerThreads; }
 
 
 		// =======================================================================
@@ -326,6 +427,25 @@ namespace Physics {
 
 		//________________________________________________________________________
 
+		/**
+		Igual que la versin con vector, pero los impactos se escriben en un array
+		del que llama, as que la query no reserva memoria. Si hay ms impactos
+		que huecos y se piden ordenados, se devuelven los ms cercanos.
+
+		@param ray Rayo que queremos disparar.
+		@param maxDistance Longitud mxima del rayo.
+		@param hits Array en el que se escriben los impactos.
+		@param maxHits Nmero de huecos del array.
+		@param sortResultingArray true para ordenar los impactos por distancia.
+		@param filterMask Mscara que indica contra que grupos de colisin queremos que choque
+		el raycast.
+		@return Nmero de impactos escritos en el array.
+		*/
+		unsigned int raycastMultiple(const Ray& ray, float maxDistance, CRaycastHit* hits, unsigned int maxHits, 
+									 bool sortResultingArray = false, unsigned int filterMask = 0) const;
+
+		//________________________________________________________________________
+
 		/**
 		Lanza un rayo y devuelve la primera entidad contra la que golpea. En caso de no
 		golpear contra ninguna entidad devuelve false.
@@ -376,6 +496,23 @@ namespace Physics {
 
 		//________________________________________________________________________
 
+		/**
+		Igual que la versin con vector, pero las entidades se escriben en un array
+		del que llama, as que la query no reserva memoria.
+
+		@param geometry Geometra para la query de overlap.
+		@param position Posicin en la que queremos situar el centro de la geometra.
+		@param entitiesHit Array en el que se escriben las entidades golpeadas.
+		@param maxHits Nmero de huecos del array.
+		@param filterMask Mscara que indica contra que grupos de colisin queremos que choque
+		el overlap.
+		@return Nmero de entidades escritas en el array.
+		*/
+		unsigned int overlapMultiple(const physx::PxGeometry& geometry, const Vector3& position, Logic::CEntity** entitiesHit, 
+									 unsigned int maxHits, unsigned int filterMask = 0) const;
+
+		//________________________________________________________________________
+
 		/**
 		Dada una geometra, realiza una query de overlap y devuelve true si la geometra dada
 		colisiona contra algn actor (dinmico o esttico).
@@ -418,6 +555,28 @@ namespace Physics {
 
 		//________________________________________________________________________
 
+		/**
+		Igual que la versin con vector, pero los impactos se escriben en un array
+		del que llama, as que la query no reserva memoria. Si hay ms impactos
+		que huecos y se piden ordenados, se devuelven los ms cercanos.
+
+		@param geometry Geometra para la query de sweep.
+		@param position Posicin en la que queremos situar el centro de la geometra.
+		@param unitDir Direccin unitaria en la que queremos que se realice el barrido.
+		@param distance Distancia mxima del barrido.
+		@param hitSpots Array en el que se escriben los impactos.
+		@param maxHits Nmero de huecos del array.
+		@param sortResultingArray true para ordenar los impactos por distancia.
+		@param filterMask Mscara que indica contra que grupos de colisin queremos que choque
+		la query de sweep.
+		@return Nmero de impactos escritos en el array.
+		*/
+		unsigned int sweepMultiple(const physx::PxGeometry& geometry, const Vector3& position,
+								   const Vector3& unitDir, float distance, CSweepHit* hitSpots, unsigned int maxHits,
+								   bool sortResultingArray = false, unsigned int filterMask = 0) const;
+
+		//________________________________________________________________________
+
 		/**
 		Dada una geometra, realiza una query de sweep y devuelve true si la geometra dada
 		colisiona contra un actor (dinmico o esttico). Adems devuelve informacin sobre
@@ -461,6 +620,50 @@ namespace Physics {
 					  const Vector3& unitDir, float distance, unsigned int filterMask = 0) const;
 
 
+		// =======================================================================
+		//                          QUERIES POR LOTES
+		// =======================================================================
+
+
+		/**
+		Lanza varios raycasts de una vez usando las batched queries de PhysX. Es lo
+		que hay que usar con las armas que disparan varios rayos por disparo (perdigones,
+		rfagas): en vez de una query por rayo se hace un nico envo a PhysX.
+		<p>
+		Los impactos de todas las queries se aaden al final de un nico vector, y
+		para cada query se indica qu tramo del vector le corresponde.
+
+		@param queries Raycasts del lote.
+		@param nbQueries Nmero de raycasts.
+		@param results Array (con nbQueries huecos) en el que se devuelve el tramo de
+		impactos de cada raycast.
+		@param hits Vector al que se aaden los impactos de todos los raycasts. Si tiene
+		capacidad suficiente no se reserva memoria.
+		@param sortResultingArray true para ordenar por distancia los impactos de cada
+		raycast.
+		*/
+		void raycastBatch(const CRaycastQuery* queries, unsigned int nbQueries, CQueryResult* results,
+						  std::vector<CRaycastHit>& hits, bool sortResultingArray = false) const;
+
+		//________________________________________________________________________
+
+		/**
+		Lanza varios sweeps de una misma geometra de una vez usando las batched
+		queries de PhysX.
+
+		@param geometry Geometra que barren todos los sweeps del lote.
+		@param queries Sweeps del lote.
+		@param nbQueries Nmero de sweeps.
+		@param results Array (con nbQueries huecos) en el que se devuelve el tramo de
+		impactos de cada sweep.
+		@param hitSpots Vector al que se aaden los impactos de todos los sweeps.
+		@param sortResultingArray true para ordenar por distancia los impactos de cada
+		sweep.
+		*/
+		void sweepBatch(const physx::PxGeometry& geometry, const CSweepQuery* queries, unsigned int nbQueries, 
+						CQueryResult* results, std::vector<CSweepHit>& hitSpots, bool sortResultingArray = false) const;
+
+
 		// =======================================================================
 		//               MTODOS PARA LA OBTENCIN DE INFO DE PHYSX
 		// =======================================================================
@@ -535,6 +738,75 @@ namespace Physics {
 		virtual ~CServer();
 
 
+		// =======================================================================
+		//                            METODOS PRIVADOS
+		// =======================================================================
+
+
+		/**
+		Lanza un raycast contra la escena dejando los impactos en _raycastBuffer,
+		que crece si se queda pequeo.
+
+		@return Nmero de impactos.
+		*/
+		unsigned int raycastToBuffer(const Ray& ray, float maxDistance, bool sortResultingArray, unsigned int filterMask) const;
+
+		//________________________________________________________________________
+
+		/**
+		Lanza un sweep contra la escena dejando los impactos en _sweepBuffer,
+		que crece si se queda pequeo.
+
+		@return Nmero de impactos.
+		*/
+		unsigned int sweepToBuffer(const physx::PxGeometry& geometry, const Vector3& position, const Vector3& unitDir, 
+								   float distance, bool sortResultingArray, unsigned int filterMask) const;
+
+		//________________________________________________________________________
+
+		/**
+		Lanza un overlap contra la escena dejando las shapes en _overlapBuffer,
+		que crece si se queda pequeo.
+
+		@return Nmero de shapes.
+		*/
+		unsigned int overlapToBuffer(const physx::PxGeometry& geometry, const Vector3& position, unsigned int filterMask) const;
+
+		//________________________________________________________________________
+
+		/**
+		(Re)crea la batched query de raycasts con los buffers actuales. PhysX fija
+		los buffers al crear la query, as que hay que recrearla cada vez que crecen.
+		*/
+		void createRaycastBatch() const;
+
+		//________________________________________________________________________
+
+		/** (Re)crea la batched query de sweeps con los buffers actuales. */
+		void createSweepBatch() const;
+
+		//________________________________________________________________________
+
+		/** Libera las batched queries (al destruir la escena). */
+		void releaseBatches();
+
+		//________________________________________________________________________
+
+		/** Rellena un CRaycastHit a partir de un impacto de PhysX. */
+		void fillRaycastHit(const physx::PxRaycastHit& pxHit, CRaycastHit& hit) const;
+
+		//________________________________________________________________________
+
+		/**
+		Devuelve la cadena internada con el nombre de un collider. Los nombres de
+		los actores viven en tablas de cadenas de PhysX que no se liberan, as
+		que el puntero identifica el nombre y solo se copia la primera vez.
+
+		@param name Nombre del actor en PhysX.
+		*/
+		const std::string* internColliderName(const char* name) const;
+
+
 		// =======================================================================
 		//                          MIEMBROS PRIVADOS
 		// =======================================================================
@@ -579,12 +851,59 @@ namespace Physics {
 		/** Puntero al gestor de colisiones. */
 		CCollisionManager* _collisionManager;
 
-		/** Tiempo real acumulado. Sirve para comprobar si tenemos que realizar un o varios steps de simulacin fsica. */
-		unsigned int _acumTime;
-
-		/** Tamao del timestep que tomamos para realizar una simulacin. */
+		/** Milisegundos de cada paso de tick fijo. */
 		unsigned int _fixedTime;
 
+		/** Steps de simulacin en los que se divide cada paso fijo. */
+		unsigned int _subSteps;
+
+		/** Nmero de hilos de trabajo del dispatcher de PhysX. */
+		unsigned int _nbWorkerThreads;
+
+		/** true si la simulacin se solapa con el resto del frame. */
+		bool _pipelined;
+
+		/**
+		true si hay un step lanzado cuyos resultados no se han recogido. Es
+		mutable porque las queries, que son const, tienen que sincronizarse.
+		*/
+		mutable bool _simulating;
+
+		/** 
+		Buffers de trabajo de las queries. Se reservan una vez y solo crecen, as
+		que una query no reserva memoria salvo que bata el rcord de impactos.
+		Las queries solo se lanzan desde el hilo de la lgica (los hilos de PhysX
+		no las usan), por lo que basta un juego de buffers.
+		*/
+		mutable physx::PxRaycastHit* _raycastBuffer;
+		mutable unsigned int _raycastBufferSize;
+
+		mutable physx::PxSweepHit* _sweepBuffer;
+		mutable unsigned int _sweepBufferSize;
+
+		mutable physx::PxShape** _overlapBuffer;
+		mutable unsigned int _overlapBufferSize;
+
+		/** 
+		Batched queries de PhysX y sus buffers de resultados y de impactos. Se crean
+		la primera vez que se usan y, como los buffers anteriores, solo crecen.
+		*/
+		mutable physx::PxBatchQuery* _raycastBatch;
+		mutable physx::PxRaycastQueryResult* _batchRaycastResults;
+		mutable unsigned int _batchRaycastResultsSize;
+		mutable physx::PxRaycastHit* _batchRaycastHits;
+		mutable unsigned int _batchRaycastHitsSize;
+
+		mutable physx::PxBatchQuery* _sweepBatch;
+		mutable physx::PxSweepQueryResult* _batchSweepResults;
+		mutable unsigned int _batchSweepResultsSize;
+		mutable physx::PxSweepHit* _batchSweepHits;
+		mutable unsigned int _batchSweepHitsSize;
+
+		/** Nombres de collider internados y el nombre internado de cada nombre de PhysX. */
+		mutable std::unordered_set<std::string> _colliderNames;
+		mutable std::unordered_map<const char*, const std::string*> _colliderNamesByActorName;
+
 	}; // class CServer
 
 }; // namespace Physics
@@ -79,7 +79,8 @@ namespace Physics {
 		// Establecer los filtros en base al grupo de colision
 		Physics::CServer::getSingletonPtr()->setupFiltering(_actor, group, groupList);
 
-		// Aadir el actor a la escena
+		// Aadir el actor a la escena (esperando a que PhysX no est simulando)
+		physicsServer->fetchSimulation();
 		scene->addActor(*_actor);
 	}
 
@@ -112,7 +113,8 @@ namespace Physics {
 
 		Physics::CServer::getSingletonPtr()->setupFiltering(_actor, group, groupList);
 	
-		// Aadir el actor a la escena
+		// Aadir el actor a la escena (esperando a que PhysX no est simulando)
+		physicsServer->fetchSimulation();
 		scene->addActor(*_actor);
 	}
 